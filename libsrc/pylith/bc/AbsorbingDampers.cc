@@ -26,7 +26,8 @@
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
-#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh, MatVisitorSubMesh
+#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 #include "pylith/topology/Stratum.hh" // USES Stratum
 
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
@@ -275,6 +276,15 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
     _velocityVisitor = new topology::VecVisitorSubMesh(fields->get("velocity(t)"), *_submeshIS);assert(_velocityVisitor);
   } // if
   scalar_array velocityCell(numBasis*spaceDim);
+
+  _setupRestrictions(_residualVisitor->petscSection());
+  assert(_fieldRestriction);
+  assert(_coordsRestriction);
+  PetscErrorCode err;
+  PetscScalar* velocityArray = NULL;
+  err = VecGetArray(_velocityVisitor->localVec(), &velocityArray);PYLITH_CHECK_ERROR(err);
+  PetscScalar* residualArray = NULL;
+  err = VecGetArray(_residualVisitor->localVec(), &residualArray);PYLITH_CHECK_ERROR(err);
   
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
@@ -290,11 +300,13 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
 #endif
 
   for (PetscInt c = cStart; c < cEnd; ++c) {
+    const PetscInt iCell = c - cStart;
+
     // Get geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(geometryEvent);
 #endif
-    coordsVisitor.getClosure(&coordsCell, c);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), iCell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -306,7 +318,7 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
     _resetCellVector();
 
     // Restrict input fields to cell
-    _velocityVisitor->getClosure(&velocityCell, c);
+    _fieldRestriction->gather(&velocityCell, velocityArray, iCell);
 
     const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
@@ -336,7 +348,7 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
       } // for
     } // for
 
-    _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
+    _fieldRestriction->scatterAdd(&_cellVector[0], residualArray, iCell);
 
 #if defined(DETAILED_EVENT_LOGGING)
     PetscLogFlops(numQuadPts*(1+numBasis*(1+numBasis*(3*spaceDim))));
@@ -349,6 +361,9 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
 #endif
   } // for
 
+  err = VecRestoreArray(_residualVisitor->localVec(), &residualArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(_velocityVisitor->localVec(), &velocityArray);PYLITH_CHECK_ERROR(err);
+
 #if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(1+numBasis*(1+numBasis*(3*spaceDim))));
   _logger->eventEnd(computeEvent);
@@ -414,6 +429,15 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
   } // if
   scalar_array velocityCell(numBasis*spaceDim);
 
+  _setupRestrictions(_residualVisitor->petscSection());
+  assert(_fieldRestriction);
+  assert(_coordsRestriction);
+  PetscErrorCode err;
+  PetscScalar* velocityArray = NULL;
+  err = VecGetArray(_velocityVisitor->localVec(), &velocityArray);PYLITH_CHECK_ERROR(err);
+  PetscScalar* residualArray = NULL;
+  err = VecGetArray(_residualVisitor->localVec(), &residualArray);PYLITH_CHECK_ERROR(err);
+
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
@@ -423,11 +447,13 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
 #endif
 
   for (PetscInt c=cStart; c < cEnd; ++c) {
+    const PetscInt iCell = c - cStart;
+
     // Get geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(geometryEvent);
 #endif
-    coordsVisitor.getClosure(&coordsCell, c);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), iCell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -439,7 +465,7 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
     _resetCellVector();
 
     // Restrict input fields to cell
-    _velocityVisitor->getClosure(&velocityCell, c);
+    _fieldRestriction->gather(&velocityCell, velocityArray, iCell);
 
     const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
@@ -470,7 +496,7 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
       } // for
     } // for
 
-    _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
+    _fieldRestriction->scatterAdd(&_cellVector[0], residualArray, iCell);
 
 #if defined(DETAILED_EVENT_LOGGING)
     PetscLogFlops(numQuadPts*(1+numBasis+numBasis*(1+spaceDim*3)));
@@ -483,6 +509,9 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
 #endif
   } // for
 
+  err = VecRestoreArray(_residualVisitor->localVec(), &residualArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(_velocityVisitor->localVec(), &velocityArray);PYLITH_CHECK_ERROR(err);
+
 #if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(1+numBasis+numBasis*(1+spaceDim*3)));
   _logger->eventEnd(computeEvent);
@@ -536,11 +565,9 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
 
   // Get sparse matrix
   const topology::Field& solution = fields->solution();
-  const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  if (!_jacobianMatVisitor) {
-    assert(_submeshIS);
-    _jacobianMatVisitor = new topology::MatVisitorSubMesh(jacobianMat, solution, *_submeshIS);assert(_jacobianMatVisitor);
-  } // if
+  const PetscMat jacobianMat = jacobian->assembledMatrix();assert(jacobianMat);
+  _setupJacobianRestriction(solution);
+  assert(_jacobianRestriction->closureSize() == numBasis*spaceDim);
 
   // Get parameters used in integration.
   const PylithScalar dt = _dt;
@@ -557,6 +584,9 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
   _logger->eventBegin(computeEvent);
 #endif
 
+  // Add values in locally owned rows directly into matrix.
+  _jacobianRestriction->beginMatrix(jacobianMat);
+
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
 #if defined(DETAILED_EVENT_LOGGING)
@@ -609,12 +639,13 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
 #endif
     
     // Assemble cell contribution into PETSc Matrix
-    _jacobianMatVisitor->setClosure(&_cellMatrix[0], _cellMatrix.size(), c, ADD_VALUES);
+    _jacobianRestriction->addMatrix(jacobianMat, &_cellMatrix[0], c-cStart);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(updateEvent);
 #endif
   } // for
+  _jacobianRestriction->endMatrix(jacobianMat);
 
 #if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(3+numBasis*(1+numBasis*(1+2*spaceDim))));
@@ -626,6 +657,83 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
   PYLITH_METHOD_END;
 } // integrateJacobian
 
+// ----------------------------------------------------------------------
+// Integrate action of Jacobian matrix (A) on a vector.
+void
+pylith::bc::AbsorbingDampers::integrateJacobianAction(PetscScalar* actionArray,
+						      const PetscScalar* inputArray,
+						      topology::SolutionFields* const fields)
+{ // integrateJacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_boundaryMesh);
+  assert(actionArray);
+  assert(inputArray);
+  assert(fields);
+
+  const int numQuadPts = _quadrature->numQuadPts();
+  const scalar_array& quadWts = _quadrature->quadWts();
+  assert(quadWts.size() == size_t(numQuadPts));
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+
+  const PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
+  topology::Stratum cellsStratum(dmSubMesh, topology::Stratum::HEIGHT, 1);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  topology::Field& dampingConsts = _parameters->get("damping constants");
+  topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
+  PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
+
+  _setupJacobianRestriction(fields->solution());
+  assert(_jacobianRestriction->closureSize() == numBasis*spaceDim);
+
+  const PylithScalar dt = _dt;
+  assert(dt > 0);
+
+  _initCellVector();
+  scalar_array inputCell(numBasis*spaceDim);
+  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
+  topology::CoordsVisitor coordsVisitor(dmSubMesh);
+
+  for(PetscInt c = cStart; c < cEnd; ++c) {
+    coordsVisitor.getClosure(&coordsCell, c);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
+
+    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
+    assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
+
+    _jacobianRestriction->gather(&inputCell, inputArray, c-cStart);
+    _resetCellVector();
+
+    const scalar_array& basis = _quadrature->basis();
+    const scalar_array& jacobianDet = _quadrature->jacobianDet();
+
+    // Same terms as the cell matrix in integrateJacobian() (block
+    // diagonal in the components), applied to the cell values.
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] / (2.0 * dt);
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+        PylithScalar inputQuad = 0.0;
+        for (int jBasis=0, iQ=iQuad*numBasis; jBasis < numBasis; ++jBasis) {
+          inputQuad += basis[iQ+jBasis] * inputCell[jBasis*spaceDim+iDim];
+        } // for
+        const PylithScalar valQ = wt * dampingConstsArray[doff+iQuad*spaceDim+iDim] * inputQuad;
+        for (int iBasis=0, iQ=iQuad*numBasis; iBasis < numBasis; ++iBasis) {
+          _cellVector[iBasis*spaceDim+iDim] += valQ * basis[iQ+iBasis];
+        } // for
+      } // for
+    } // for
+
+    _jacobianRestriction->scatterAdd(&_cellVector[0], actionArray, c-cStart);
+  } // for
+  PetscLogFlops((cEnd-cStart)*numQuadPts*(3+spaceDim*(2+4*numBasis)));
+
+  PYLITH_METHOD_END;
+} // integrateJacobianAction
+
 // ----------------------------------------------------------------------
 // Integrate contributions to Jacobian matrix (A) associated with
 void
@@ -677,7 +785,7 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
   topology::VecVisitorMesh dampingConstsVisitor(dampingConsts);
   PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
 
-  if (!_jacobianMatVisitor) {
+  if (!_jacobianVecVisitor) {
     assert(_submeshIS);
     _jacobianVecVisitor = new topology::VecVisitorSubMesh(*jacobian, *_submeshIS);assert(_jacobianVecVisitor);
   } // if
@@ -134,6 +134,16 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Integrate action of Jacobian matrix (A) on a vector.
+   *
+   * @param actionArray Local array (solution layout) for y += A x.
+   * @param inputArray Local array (solution layout) for x.
+   * @param fields Solution fields
+   */
+  void integrateJacobianAction(PetscScalar* actionArray,
+			       const PetscScalar* inputArray,
+			       topology::SolutionFields* const fields);
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
@@ -24,7 +24,8 @@
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Stratum.hh" // USES Stratum
-#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh, MatVisitorSubMesh
+#include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh, SubMeshIS
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 
@@ -34,8 +35,10 @@ pylith::bc::BCIntegratorSubMesh::BCIntegratorSubMesh(void) :
   _boundaryMesh(0),
   _submeshIS(0),
   _residualVisitor(0),
-  _jacobianMatVisitor(0),
   _jacobianVecVisitor(0),
+  _fieldRestriction(0),
+  _coordsRestriction(0),
+  _jacobianRestriction(0),
   _parameters(0)
 { // constructor
 } // constructor
@@ -60,8 +63,10 @@ pylith::bc::BCIntegratorSubMesh::deallocate(void)
   delete _boundaryMesh; _boundaryMesh = 0;
 
   delete _residualVisitor; _residualVisitor = 0;
-  delete _jacobianMatVisitor; _jacobianMatVisitor = 0;
   delete _jacobianVecVisitor; _jacobianVecVisitor = 0;
+  delete _fieldRestriction; _fieldRestriction = 0;
+  delete _coordsRestriction; _coordsRestriction = 0;
+  delete _jacobianRestriction; _jacobianRestriction = 0;
   delete _submeshIS; _submeshIS = 0; // Must destroy visitors first
 
   delete _parameters; _parameters = 0;
@@ -78,6 +83,9 @@ pylith::bc::BCIntegratorSubMesh::createSubMesh(const topology::Mesh& mesh)
 
   delete _boundaryMesh; _boundaryMesh = 0;
   delete _parameters; _parameters = 0;
+  delete _fieldRestriction; _fieldRestriction = 0;
+  delete _coordsRestriction; _coordsRestriction = 0;
+  delete _jacobianRestriction; _jacobianRestriction = 0;
 
   _boundaryMesh = new topology::Mesh(mesh, _label.c_str());
   assert(_boundaryMesh);
@@ -142,4 +150,69 @@ pylith::bc::BCIntegratorSubMesh::verifyConfiguration(const topology::Mesh& mesh)
 } // verifyConfiguration
 
 
+// ----------------------------------------------------------------------
+// Setup element restrictions for solution and coordinates.
+void
+pylith::bc::BCIntegratorSubMesh::_setupRestrictions(const PetscSection section)
+{ // _setupRestrictions
+  PYLITH_METHOD_BEGIN;
+
+  assert(section);
+  assert(_boundaryMesh);
+
+  const PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
+  topology::Stratum cellsStratum(dmSubMesh, topology::Stratum::HEIGHT, 1);
+
+  if (!_fieldRestriction) {
+    _fieldRestriction = new topology::ElementRestriction;assert(_fieldRestriction);
+  } // if
+  if (!_fieldRestriction->isCurrent(section)) {
+    _fieldRestriction->initialize(dmSubMesh, section, cellsStratum);
+  } // if
+
+  PetscSection coordsSection = NULL;
+  PetscErrorCode err = DMGetCoordinateSection(dmSubMesh, &coordsSection);PYLITH_CHECK_ERROR(err);
+  if (!_coordsRestriction) {
+    _coordsRestriction = new topology::ElementRestriction;assert(_coordsRestriction);
+  } // if
+  if (!_coordsRestriction->isCurrent(coordsSection)) {
+    _coordsRestriction->initialize(dmSubMesh, coordsSection, cellsStratum);
+  } // if
+
+  PYLITH_METHOD_END;
+} // _setupRestrictions
+
+// ----------------------------------------------------------------------
+// Setup element restriction for assembling Jacobian.
+void
+pylith::bc::BCIntegratorSubMesh::_setupJacobianRestriction(const topology::Field& solution)
+{ // _setupJacobianRestriction
+  PYLITH_METHOD_BEGIN;
+
+  if (_jacobianRestriction) { // Layout of solution does not change.
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(_boundaryMesh);
+  assert(_submeshIS);
+
+  const PetscDM dmSubMesh = _boundaryMesh->dmMesh();assert(dmSubMesh);
+  topology::Stratum cellsStratum(dmSubMesh, topology::Stratum::HEIGHT, 1);
+
+  PetscIS subpointIS = _submeshIS->indexSet();assert(subpointIS);
+  PetscSection subsection = NULL, globalSubsection = NULL;
+  PetscErrorCode err;
+  err = PetscSectionCreateSubmeshSection(solution.localSection(), subpointIS, &subsection);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionCreateSubmeshSection(solution.globalSection(), subpointIS, &globalSubsection);PYLITH_CHECK_ERROR(err);
+
+  _jacobianRestriction = new topology::ElementRestriction;assert(_jacobianRestriction);
+  _jacobianRestriction->initialize(dmSubMesh, subsection, cellsStratum, globalSubsection);
+
+  err = PetscSectionDestroy(&subsection);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionDestroy(&globalSubsection);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setupJacobianRestriction
+
+
 // End of file 
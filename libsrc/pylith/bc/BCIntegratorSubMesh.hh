@@ -81,14 +81,40 @@ public :
    */
   void verifyConfiguration(const topology::Mesh& mesh) const;
 
+  // PROTECTED METHODS //////////////////////////////////////////////////
+protected :
+
+  /** Setup element restrictions for solution and coordinates over the
+   * boundary cells.
+   *
+   * The restrictions are built only if they do not exist or the
+   * subsection of the solution field has changed.
+   *
+   * @param section Local subsection of solution (or residual) field.
+   */
+  void _setupRestrictions(const PetscSection section);
+
+  /** Setup element restriction with global indices for assembling
+   * cell matrices over the boundary cells into the Jacobian.
+   *
+   * The global indices follow the global section of the solution, so
+   * they remain consistent when the solution keeps constrained DOF
+   * (see topology::Field::keepConstrainedDOF()).
+   *
+   * @param solution Solution field.
+   */
+  void _setupJacobianRestriction(const topology::Field& solution);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
   topology::Mesh* _boundaryMesh; ///< Boundary mesh.
   topology::SubMeshIS* _submeshIS; ///< Cache index set for submesh.
   topology::VecVisitorSubMesh* _residualVisitor; ///< Cache residual field visitor.
-  topology::MatVisitorSubMesh* _jacobianMatVisitor; ///< Cache jacobian  matrix visitor.
   topology::VecVisitorSubMesh* _jacobianVecVisitor; ///< Cache jacobian field visitor.
+  topology::ElementRestriction* _fieldRestriction; ///< Cache restriction of solution fields to boundary cells.
+  topology::ElementRestriction* _coordsRestriction; ///< Cache restriction of coordinates to boundary cells.
+  topology::ElementRestriction* _jacobianRestriction; ///< Cache restriction for assembling Jacobian over boundary cells.
 
   /// Parameters for boundary condition.
   topology::Fields* _parameters;
@@ -26,6 +26,7 @@
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/VisitorSubMesh.hh" // USES VecVisitorSubMesh
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 #include "pylith/topology/Stratum.hh" // USES Stratum
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
@@ -124,16 +125,23 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
   PetscScalar* valueArray = valueVisitor.localArray();
 
   // Get subsections
-  topology::SubMeshIS submeshIS(*_boundaryMesh);
-  topology::VecVisitorSubMesh residualVisitor(residual, submeshIS);
-  submeshIS.deallocate();
+  assert(_submeshIS);
+  if (!_residualVisitor) {
+    _residualVisitor = new topology::VecVisitorSubMesh(residual, *_submeshIS);assert(_residualVisitor);
+  } // if
+  _setupRestrictions(_residualVisitor->petscSection());
+  assert(_fieldRestriction);
+  assert(_coordsRestriction);
+  PetscScalar* residualArray = NULL;
+  PetscErrorCode err = VecGetArray(_residualVisitor->localVec(), &residualArray);PYLITH_CHECK_ERROR(err);
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
   // Loop over faces and integrate contribution from each face
   for(PetscInt c = cStart; c < cEnd; ++c) {
-    coordsVisitor.getClosure(&coordsCell, c);
+    const PetscInt iCell = c - cStart;
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), iCell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
     // Reset element vector to zero
@@ -160,11 +168,13 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
       } // for
     } // for
 
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
+    _fieldRestriction->scatterAdd(&_cellVector[0], residualArray, iCell);
 
     PetscLogFlops(numQuadPts*(1+numBasis*(1+numBasis*(1+2*spaceDim))));
   } // for
 
+  err = VecRestoreArray(_residualVisitor->localVec(), &residualArray);PYLITH_CHECK_ERROR(err);
+
   PYLITH_METHOD_END;
 } // integrateResidual
 
@@ -236,6 +236,12 @@ pylith::faults::BruneSlipFn::initialize(const topology::Mesh& faultMesh,
   _dbSlipTime->close();
   _dbRiseTime->close();
 
+  // Release arrays before caching parameters.
+  finalSlipVisitor.clear();
+  slipTimeVisitor.clear();
+  riseTimeVisitor.clear();
+  _cacheParameters(finalSlip, slipTime, &riseTime);
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -250,62 +256,25 @@ pylith::faults::BruneSlipFn::slip(topology::Field* slip,
   assert(slip);
   assert(_parameters);
 
-  // Get vertices in fault mesh
-  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-
-  // Get sections
-  const topology::Field& finalSlip = _parameters->get("final slip");
-  topology::VecVisitorMesh finalSlipVisitor(finalSlip);
-  const PetscScalar* finalSlipArray = finalSlipVisitor.localArray();
-
-  const topology::Field& slipTime = _parameters->get("slip time");
-  topology::VecVisitorMesh slipTimeVisitor(slipTime);
-  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
-
-  const topology::Field& riseTime = _parameters->get("rise time");
-  topology::VecVisitorMesh riseTimeVisitor(riseTime);
-  const PetscScalar* riseTimeArray = riseTimeVisitor.localArray();
-
   topology::VecVisitorMesh slipVisitor(*slip);
   PetscScalar* slipArray = slipVisitor.localArray();
-  DMLabel clamped = NULL;
-  PetscErrorCode err;
-
-  err = DMGetLabel(dmMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
-  const int spaceDim = _slipVertex.size();
-  for (PetscInt v = vStart; v < vEnd; ++v) {
-    if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
-      continue;
-    } // if
 
-    const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
-    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
-    const PetscInt rtoff = riseTimeVisitor.sectionOffset(v);
-    const PetscInt soff = slipVisitor.sectionOffset(v);
+  const int spaceDim = _cache.spaceDim;
+  const int numVertices = _cache.vertices.size();
+  for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+    const PetscInt soff = slipVisitor.sectionOffset(_cache.vertices[iVertex]);
+    assert(spaceDim == slipVisitor.sectionDof(_cache.vertices[iVertex]));
 
-    assert(spaceDim == finalSlipVisitor.sectionDof(v));
-    assert(1 == slipTimeVisitor.sectionDof(v));
-    assert(1 == riseTimeVisitor.sectionDof(v));
-    assert(spaceDim == slipVisitor.sectionDof(v));
+    const PylithScalar slip = _slipFn(t-_cache.slipTime[iVertex], _cache.slipMag[iVertex], _cache.riseTime[iVertex]);
 
-    PylithScalar finalSlipMag = 0.0;
-    for (int i=0; i < spaceDim; ++i)
-      finalSlipMag += finalSlipArray[fsoff+i]*finalSlipArray[fsoff+i];
-    finalSlipMag = sqrt(finalSlipMag);
-
-    const PylithScalar slip = _slipFn(t-slipTimeArray[stoff], finalSlipMag, riseTimeArray[rtoff]);
-    const PylithScalar scale = finalSlipMag > 0.0 ? slip / finalSlipMag : 0.0;
-    
     // Update field
-    for(PetscInt d = 0; d < spaceDim; ++d) {
-      slipArray[soff+d] += finalSlipArray[fsoff+d] * scale;
+    const PylithScalar* slipDir = &_cache.slipDir[iVertex*spaceDim];
+    for (int d = 0; d < spaceDim; ++d) {
+      slipArray[soff+d] += slipDir[d] * slip;
     } // for
   } // for
 
-  PetscLogFlops((vEnd-vStart) * (2+8 + 3*spaceDim));
+  PetscLogFlops(numVertices * (1+8 + 2*spaceDim));
 
   PYLITH_METHOD_END;
 } // slip
@@ -23,10 +23,78 @@
 #include "TopologyOps.hh" // USES TopologyOps
 #include "pylith/topology/Mesh.hh" // USES Mesh
 
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <cstring> // USES strncmp()
 #include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error, std::logic_error
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace faults {
+    namespace _CohesiveTopology {
+      /** Check whether point is in the closure of a local cell.
+       *
+       * @param dm PETSc DM for mesh.
+       * @param point Point in mesh.
+       * @param cStart First cell.
+       * @param cEnd One past last cell.
+       * @returns True if point is used by a local cell, false otherwise.
+       */
+      bool isUsed(PetscDM dm,
+		  const PetscInt point,
+		  const PetscInt cStart,
+		  const PetscInt cEnd) {
+	if (point >= cStart && point < cEnd) {
+	  return true;
+	} // if
+	PetscInt* star = NULL;
+	PetscInt starSize = 0;
+	PetscErrorCode err = DMPlexGetTransitiveClosure(dm, point, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+	bool used = false;
+	for (PetscInt i=0; i < starSize*2; i += 2) {
+	  if (star[i] >= cStart && star[i] < cEnd) {
+	    used = true;
+	    break;
+	  } // if
+	} // for
+	err = DMPlexRestoreTransitiveClosure(dm, point, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+	return used;
+      } // isUsed
+
+      /** Add point to leaves of point star forest.
+       *
+       * @param leaves Map from local point to its owner.
+       * @param point Local point.
+       * @param owner Owner of point.
+       * @param conflicts Description of points with conflicting owners.
+       * @returns False if point was already added with a different owner.
+       */
+      bool addLeaf(std::map<PetscInt, PetscSFNode>* leaves,
+		   const PetscInt point,
+		   const PetscSFNode& owner,
+		   std::ostringstream* conflicts) {
+	assert(leaves);
+	assert(conflicts);
+	std::map<PetscInt, PetscSFNode>::const_iterator l_iter = leaves->find(point);
+	if (l_iter == leaves->end()) {
+	  (*leaves)[point] = owner;
+	  return true;
+	} // if
+	if (l_iter->second.rank == owner.rank && l_iter->second.index == owner.index) {
+	  return true;
+	} // if
+	*conflicts << "\n  Point " << point << " has owners (" << l_iter->second.rank << ", " << l_iter->second.index
+		   << ") and (" << owner.rank << ", " << owner.index << ").";
+	return false;
+      } // addLeaf
+    } // _CohesiveTopology
+  } // faults
+} // pylith
+
 // ----------------------------------------------------------------------
 void
 pylith::faults::CohesiveTopology::createFault(topology::Mesh* faultMesh,
@@ -103,22 +171,194 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
 						     const bool constraintCell)
 { // createInterpolated
   assert(mesh);
-  PetscDM        sdm = NULL;
   PetscDM        dm  = mesh->dmMesh();assert(dm);
-  PetscDMLabel   subpointMap = NULL, label = NULL, mlabel = NULL;
-  PetscInt       dim, cMax, cEnd, numCohesiveCellsOld;
+  PetscDMLabel   label = NULL;
   PetscErrorCode err;
 
-  // Have to remember the old number of cohesive cells
-  err = DMPlexGetHeightStratum(dm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
-  err = DMPlexGetHybridBounds(dm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
-  numCohesiveCellsOld = cEnd - (cMax < 0 ? cEnd : cMax);
-  // Create cohesive cells
+  _labelSplit(&label, dm, faultMesh, faultBdLabel);
+  _insertCohesiveCells(mesh, label, materialId);
+  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+} // createInterpolated
+
+// ----------------------------------------------------------------------
+// Label points to split and cells on each side of the fault without
+// creating cohesive cells.
+void
+pylith::faults::CohesiveTopology::labelCohesive(topology::Mesh* mesh,
+						const topology::Mesh& faultMesh,
+						PetscDMLabel faultBdLabel,
+						const char* faultLabel)
+{ // labelCohesive
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(faultLabel);
+
+  PetscDM dm = mesh->dmMesh();assert(dm);
+  PetscDMLabel label = NULL;
+  PetscErrorCode err;
+
+  _labelSplit(&label, dm, faultMesh, faultBdLabel);
+
+  // Labels are completed before any fault is split, so faults labeled
+  // this way cannot share vertices (split or unsplit).
+  const std::string labelName = _cohesiveLabelName(faultLabel);
+  const std::string prefix = _cohesiveLabelName("");
+  PetscInt vStart = 0, vEnd = 0;
+  err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+  PetscIS valuesIS = NULL;
+  PetscInt numValues = 0;
+  const PetscInt* values = NULL;
+  err = DMLabelGetValueIS(label, &valuesIS);PYLITH_CHECK_ERROR(err);
+  err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+  PetscInt numLabels = 0;
+  err = DMGetNumLabels(dm, &numLabels);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iLabel=0; iLabel < numLabels; ++iLabel) {
+    const char* otherName = NULL;
+    err = DMGetLabelName(dm, iLabel, &otherName);PYLITH_CHECK_ERROR(err);
+    if (strncmp(otherName, prefix.c_str(), prefix.length()) || labelName == otherName) {
+      continue;
+    } // if
+    PetscDMLabel otherLabel = NULL;
+    PetscInt otherDefault = -1;
+    err = DMGetLabel(dm, otherName, &otherLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelGetDefaultValue(otherLabel, &otherDefault);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+      PetscIS pointsIS = NULL;
+      PetscInt numPoints = 0;
+      const PetscInt* points = NULL;
+      err = DMLabelGetStratumIS(label, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+      err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+      err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+      PetscInt numShared = 0;
+      for (PetscInt iPoint=0; iPoint < numPoints; ++iPoint) {
+	if (points[iPoint] < vStart || points[iPoint] >= vEnd) {
+	  continue;
+	} // if
+	PetscInt otherValue = otherDefault;
+	err = DMLabelGetValue(otherLabel, points[iPoint], &otherValue);PYLITH_CHECK_ERROR(err);
+	numShared += (otherValue != otherDefault) ? 1 : 0;
+      } // for
+      err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+      if (numShared > 0) {
+	err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+	err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+	err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+	std::ostringstream msg;
+	msg << "Fault '" << faultLabel << "' shares vertices with fault '" << otherName+prefix.length()
+	    << "'. Cohesive cells for intersecting faults must be inserted before distributing the mesh.";
+	throw std::runtime_error(msg.str());
+      } // if
+    } // for
+  } // for
+
+  // Store label in mesh, so it is distributed with the mesh.
+  PetscDMLabel meshLabel = NULL;
+  err = DMCreateLabel(dm, labelName.c_str());PYLITH_CHECK_ERROR(err);
+  err = DMGetLabel(dm, labelName.c_str(), &meshLabel);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+    PetscIS pointsIS = NULL;
+    PetscInt numPoints = 0;
+    const PetscInt* points = NULL;
+    err = DMLabelGetStratumIS(label, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint=0; iPoint < numPoints; ++iPoint) {
+      err = DMLabelSetValue(meshLabel, points[iPoint], values[iValue]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // labelCohesive
+
+// ----------------------------------------------------------------------
+// Check whether mesh has label created by labelCohesive() for fault.
+bool
+pylith::faults::CohesiveTopology::hasCohesiveLabel(const topology::Mesh& mesh,
+						   const char* faultLabel)
+{ // hasCohesiveLabel
+  PYLITH_METHOD_BEGIN;
+
+  assert(faultLabel);
+
+  PetscDM dm = mesh.dmMesh();assert(dm);
+  PetscBool hasLabel = PETSC_FALSE;
+  PetscErrorCode err = DMHasLabel(dm, _cohesiveLabelName(faultLabel).c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(hasLabel ? true : false);
+} // hasCohesiveLabel
+
+// ----------------------------------------------------------------------
+// Create cohesive cells in a distributed mesh using label created by
+// labelCohesive().
+void
+pylith::faults::CohesiveTopology::createFromLabel(topology::Mesh* mesh,
+						  const char* faultLabel,
+						  const int materialId)
+{ // createFromLabel
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(faultLabel);
+
+  const std::string labelName = _cohesiveLabelName(faultLabel);
+  PetscDM dm = mesh->dmMesh();assert(dm);
+  PetscDMLabel label = NULL;
+  PetscErrorCode err = DMGetLabel(dm, labelName.c_str(), &label);PYLITH_CHECK_ERROR(err);
+  if (!label) {
+    std::ostringstream msg;
+    msg << "Could not find label '" << labelName << "' with points to split for fault '" << faultLabel << "'.";
+    throw std::logic_error(msg.str());
+  } // if
+
+  _insertCohesiveCells(mesh, label, materialId);
+
+  PetscDM sdm = mesh->dmMesh();assert(sdm);
+  _reconcilePointSF(sdm);
+
+  // The split mesh has a shifted copy of the label, which is no longer needed.
+  PetscDMLabel splitLabel = NULL;
+  err = DMRemoveLabel(sdm, labelName.c_str(), &splitLabel);PYLITH_CHECK_ERROR(err);
+  err = DMLabelDestroy(&splitLabel);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // createFromLabel
+
+// ----------------------------------------------------------------------
+// Get name of label created by labelCohesive().
+std::string
+pylith::faults::CohesiveTopology::_cohesiveLabelName(const char* faultLabel)
+{ // _cohesiveLabelName
+  assert(faultLabel);
+  return std::string("pylith_cohesive_") + faultLabel;
+} // _cohesiveLabelName
+
+// ----------------------------------------------------------------------
+// Complete label of points to split and cells on each side of the fault.
+void
+pylith::faults::CohesiveTopology::_labelSplit(PetscDMLabel* label,
+					      PetscDM dm,
+					      const topology::Mesh& faultMesh,
+					      PetscDMLabel faultBdLabel)
+{ // _labelSplit
+  assert(label);
+  assert(dm);
+  PetscDMLabel   subpointMap = NULL;
+  PetscInt       dim;
+  PetscErrorCode err;
+
+  err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
   err = DMPlexGetSubpointMap(faultMesh.dmMesh(), &subpointMap);PYLITH_CHECK_ERROR(err);
-  err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
-  err = DMLabelClearStratum(label, mesh->dimension());PYLITH_CHECK_ERROR(err);
+  err = DMLabelDuplicate(subpointMap, label);PYLITH_CHECK_ERROR(err);
+  err = DMLabelClearStratum(*label, dim);PYLITH_CHECK_ERROR(err);
   // Fix over-aggressive completion of boundary label
-  err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
   if (faultBdLabel && (dim > 2)) {
     PetscIS         bdIS;
     const PetscInt *bd;
@@ -126,8 +366,13 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
 
     err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetStratumIS(faultBdLabel, 1, &bdIS);PYLITH_CHECK_ERROR(err);
-    err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
-    err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+    // After distribution, a process may not have any buried edges.
+    n = 0;
+    bd = NULL;
+    if (bdIS) {
+      err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
+      err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+    }
     for (i = 0; i < n; ++i) {
       const PetscInt p = bd[i];
 
@@ -157,14 +402,14 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
           err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
           err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
           for (s = 0, sA = 0; s < supportSizeA; ++s) {
-            err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
+            err = DMLabelGetValue(*label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
             err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
             if (val >= 0 && bval >= 0) ++sA;
           }
           err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
           err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
           for (s = 0, sB = 0; s < supportSizeB; ++s) {
-            err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
+            err = DMLabelGetValue(*label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
             err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
             if (val >= 0 && bval >= 0) ++sB;
           }
@@ -181,18 +426,42 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
         }
       }
     }
-    err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+    if (bdIS) {
+      err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+    }
   }
   // Completes the set of cells scheduled to be replaced
-  err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
-  err = DMPlexConstructCohesiveCells(dm, label, &sdm);PYLITH_CHECK_ERROR(err);
+  err = DMPlexLabelCohesiveComplete(dm, *label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
+} // _labelSplit
+
+// ----------------------------------------------------------------------
+// Split mesh and insert cohesive cells.
+void
+pylith::faults::CohesiveTopology::_insertCohesiveCells(topology::Mesh* mesh,
+						       PetscDMLabel label,
+						       const int materialId)
+{ // _insertCohesiveCells
+  assert(mesh);
+  assert(label);
+  PetscDM        sdm = NULL;
+  PetscDM        dm  = mesh->dmMesh();assert(dm);
+  PetscDMLabel   mlabel = NULL;
+  PetscInt       cMax, cEnd, numCohesiveCellsOld;
+  PetscErrorCode err;
 
+  // Have to remember the old number of cohesive cells
+  err = DMPlexGetHeightStratum(dm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  numCohesiveCellsOld = cEnd - (cMax < 0 ? cEnd : cMax);
+  // Create cohesive cells
+  err = DMPlexConstructCohesiveCells(dm, label, &sdm);PYLITH_CHECK_ERROR(err);
   err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
   if (mlabel) {
     err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
     err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
-    assert(cEnd > cMax + numCohesiveCellsOld);
+    // After distribution, a process may not have any cells on the fault.
+    assert(cEnd >= cMax + numCohesiveCellsOld);
     for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
       PetscInt onBd;
 
@@ -203,13 +472,12 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
       err = DMLabelSetValue(mlabel, cell, materialId);PYLITH_CHECK_ERROR(err);
     }
   }
-  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
 
   PetscReal lengthScale = 1.0;
   err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
   err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
   mesh->dmMesh(sdm);
-} // createInterpolated
+} // _insertCohesiveCells
 
 // ----------------------------------------------------------------------
 // Form a parallel fault mesh using the cohesive cell information
@@ -246,5 +514,272 @@ pylith::faults::CohesiveTopology::createFaultParallel(topology::Mesh* faultMesh,
   PYLITH_METHOD_END;
 } // createFaultParallel
 
+// ----------------------------------------------------------------------
+// Add split and cohesive points created on more than one processor to
+// the point star forest.
+void
+pylith::faults::CohesiveTopology::_reconcilePointSF(PetscDM dm)
+{ // _reconcilePointSF
+  PYLITH_METHOD_BEGIN;
+
+  assert(dm);
+  PetscErrorCode err;
+
+  PetscSF sfPoint = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotes = NULL;
+  err = DMGetPointSF(dm, &sfPoint);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &leaves, &remotes);PYLITH_CHECK_ERROR(err);
+  if (numRoots < 0) { // Mesh is not distributed.
+    PYLITH_METHOD_END;
+  } // if
+
+  MPI_Comm comm = PetscObjectComm((PetscObject) dm);
+  PetscMPIInt commRank = 0;
+  err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+  PetscInt pStart = 0, pEnd = 0, cStart = 0, cEnd = 0, dim = 0;
+  err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
+  assert(0 == pStart);
+  assert(numRoots <= pEnd);
+
+  // Mesh is interpolated, so depth of a point gives its hybrid bound.
+  PetscInt cMax = -1, fMax = -1, eMax = -1, vMax = -1;
+  err = DMPlexGetHybridBounds(dm, &cMax, &fMax, &eMax, &vMax);PYLITH_CHECK_ERROR(err);
+  std::vector<PetscInt> hybridMax(dim+1, -1);
+  hybridMax[0] = vMax;
+  if (dim > 2) hybridMax[1] = eMax;
+  if (dim > 1) hybridMax[dim-1] = fMax;
+  hybridMax[dim] = cMax;
+  PetscDMLabel depthLabel = NULL;
+  err = DMPlexGetDepthLabel(dm, &depthLabel);PYLITH_CHECK_ERROR(err);
+
+  // Members of the family of each point: the point, its split copy, and
+  // its cohesive (hybrid) point. An unsplit point on the fault boundary
+  // has a hybrid point but no split copy.
+  const int familySize = 3;
+  std::vector<PetscInt> family(pEnd*familySize, -1);
+  std::vector<bool> isShared(pEnd, false);
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    isShared[leaves ? leaves[i] : i] = true;
+  } // for
+  const PetscInt* degree = NULL;
+  err = PetscSFComputeDegreeBegin(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+  err = PetscSFComputeDegreeEnd(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+  PetscInt numMultiRoots = 0;
+  for (PetscInt p=0; p < numRoots; ++p) {
+    numMultiRoots += degree[p];
+    if (degree[p] > 0) {
+      isShared[p] = true;
+    } // if
+  } // for
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    family[p*familySize] = p;
+    if (!isShared[p]) {
+      continue;
+    } // if
+    const PetscInt* support = NULL;
+    PetscInt supportSize = 0;
+    err = DMPlexGetSupportSize(dm, p, &supportSize);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetSupport(dm, p, &support);PYLITH_CHECK_ERROR(err);
+    for (PetscInt s=0; s < supportSize; ++s) {
+      PetscInt depth = -1;
+      err = DMLabelGetValue(depthLabel, support[s], &depth);PYLITH_CHECK_ERROR(err);
+      assert(depth >= 0 && depth <= dim);
+      if (hybridMax[depth] < 0 || support[s] < hybridMax[depth]) {
+	continue;
+      } // if
+      const PetscInt* cone = NULL;
+      PetscInt coneSize = 0;
+      err = DMPlexGetConeSize(dm, support[s], &coneSize);PYLITH_CHECK_ERROR(err);
+      err = DMPlexGetCone(dm, support[s], &cone);PYLITH_CHECK_ERROR(err);
+      if (coneSize >= 2 && cone[0] == p) {
+	family[p*familySize+1] = (cone[1] != p) ? cone[1] : -1;
+	family[p*familySize+2] = support[s];
+	break;
+      } // if
+    } // for
+  } // for
+
+  // Send each member of the family of a leaf to the owner of the point,
+  // flagging members not used by local cells with a negative index.
+  std::vector<PetscSFNode> leafCandidates(pEnd*familySize);
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    for (int iMember=0; iMember < familySize; ++iMember) {
+      const PetscInt member = family[p*familySize+iMember];
+      PetscSFNode& candidate = leafCandidates[p*familySize+iMember];
+      candidate.rank = commRank;
+      candidate.index = (member >= 0 && _CohesiveTopology::isUsed(dm, member, cStart, cEnd)) ? member : -1;
+    } // for
+  } // for
+  std::vector<PetscSFNode> rootCandidates(numMultiRoots*familySize);
+  std::vector<PetscSFNode> leafMember(pEnd), rootMember(numMultiRoots > 0 ? numMultiRoots : 1);
+  for (int iMember=0; iMember < familySize; ++iMember) {
+    for (PetscInt p=pStart; p < pEnd; ++p) {
+      leafMember[p] = leafCandidates[p*familySize+iMember];
+    } // for
+    err = PetscSFGatherBegin(sfPoint, MPIU_2INT, &leafMember[0], &rootMember[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGatherEnd(sfPoint, MPIU_2INT, &leafMember[0], &rootMember[0]);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < numMultiRoots; ++i) {
+      rootCandidates[i*familySize+iMember] = rootMember[i];
+    } // for
+  } // for
+
+  // Choose owner of each member of the family of a root. Keep the
+  // current owner if it uses the member; otherwise, use the processor
+  // with the lowest rank that uses it.
+  std::vector<PetscSFNode> owners(pEnd*familySize);
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    for (int iMember=0; iMember < familySize; ++iMember) {
+      PetscSFNode& owner = owners[p*familySize+iMember];
+      owner.rank = (0 == iMember) ? commRank : -1;
+      owner.index = (0 == iMember) ? p : -1;
+    } // for
+  } // for
+  for (PetscInt p=0, offset=0; p < numRoots; offset += degree[p++]) {
+    if (!degree[p]) {
+      continue;
+    } // if
+    bool isFamily = family[p*familySize+2] >= 0;
+    for (PetscInt i=offset; i < offset+degree[p]; ++i) {
+      isFamily = isFamily || rootCandidates[i*familySize+2].index >= 0;
+    } // for
+    if (!isFamily) {
+      continue;
+    } // if
+    for (int iMember=0; iMember < familySize; ++iMember) {
+      PetscSFNode& owner = owners[p*familySize+iMember];
+      owner = leafCandidates[p*familySize+iMember];
+      if (owner.index >= 0) {
+	continue;
+      } // if
+      owner.rank = -1;
+      for (PetscInt i=offset; i < offset+degree[p]; ++i) {
+	const PetscSFNode& candidate = rootCandidates[i*familySize+iMember];
+	if (candidate.index >= 0 && (owner.rank < 0 || candidate.rank < owner.rank)) {
+	  owner = candidate;
+	} // if
+      } // for
+      if (owner.rank < 0 && 0 == iMember) { // Point is not used anywhere; leave as is.
+	owner.rank = commRank;
+	owner.index = p;
+      } // if
+    } // for
+  } // for
+
+  // Send owners to leaves.
+  std::vector<PetscSFNode> leafOwners(pEnd*familySize);
+  std::vector<PetscSFNode> ownerMember(pEnd);
+  for (int iMember=0; iMember < familySize; ++iMember) {
+    for (PetscInt p=pStart; p < pEnd; ++p) {
+      leafMember[p] = owners[p*familySize+iMember];
+    } // for
+    err = PetscSFBcastBegin(sfPoint, MPIU_2INT, &leafMember[0], &ownerMember[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfPoint, MPIU_2INT, &leafMember[0], &ownerMember[0]);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < numLeaves; ++i) {
+      const PetscInt p = leaves ? leaves[i] : i;
+      leafOwners[p*familySize+iMember] = ownerMember[p];
+    } // for
+  } // for
+
+  // Every local copy of a member not owned by this processor is a
+  // leaf. A point must not end up with two different owners; that
+  // would silently turn a root into a leaf of a leaf.
+  std::map<PetscInt, PetscSFNode> newLeaves;
+  std::ostringstream conflicts;
+  bool isConsistent = true;
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    const PetscInt p = leaves ? leaves[i] : i;
+    for (int iMember=0; iMember < familySize; ++iMember) {
+      const PetscInt member = family[p*familySize+iMember];
+      const PetscSFNode& owner = leafOwners[p*familySize+iMember];
+      if (member >= 0 && owner.rank >= 0 && owner.rank != commRank) {
+	isConsistent = _CohesiveTopology::addLeaf(&newLeaves, member, owner, &conflicts) && isConsistent;
+      } // if
+    } // for
+  } // for
+  for (PetscInt p=0; p < numRoots; ++p) {
+    if (!degree[p]) {
+      continue;
+    } // if
+    for (int iMember=0; iMember < familySize; ++iMember) {
+      const PetscInt member = family[p*familySize+iMember];
+      const PetscSFNode& owner = owners[p*familySize+iMember];
+      if (member >= 0 && owner.rank >= 0 && owner.rank != commRank) {
+	isConsistent = _CohesiveTopology::addLeaf(&newLeaves, member, owner, &conflicts) && isConsistent;
+      } // if
+    } // for
+  } // for
+
+  // DMPlex requires leaves sorted by local point.
+  const PetscInt numNewLeaves = newLeaves.size();
+  PetscInt* newLocal = NULL;
+  PetscSFNode* newRemote = NULL;
+  err = PetscMalloc1(numNewLeaves, &newLocal);PYLITH_CHECK_ERROR(err);
+  err = PetscMalloc1(numNewLeaves, &newRemote);PYLITH_CHECK_ERROR(err);
+  PetscInt index = 0;
+  for (std::map<PetscInt, PetscSFNode>::const_iterator l_iter=newLeaves.begin(); l_iter != newLeaves.end(); ++l_iter, ++index) {
+    newLocal[index] = l_iter->first;
+    newRemote[index] = l_iter->second;
+  } // for
+
+  // Every remote point must be a root, i.e., a point in the chart of
+  // the remote processor that is not itself a leaf there.
+  PetscMPIInt commSize = 0;
+  err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+  std::vector<PetscInt> chartSizes(commSize, 0);
+  const PetscInt chartSize = pEnd - pStart;
+  err = MPI_Allgather((void*) &chartSize, 1, MPIU_INT, &chartSizes[0], 1, MPIU_INT, comm);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < numNewLeaves; ++i) {
+    if (newRemote[i].rank < 0 || newRemote[i].rank >= commSize || newRemote[i].rank == commRank ||
+	newRemote[i].index < 0 || newRemote[i].index >= chartSizes[newRemote[i].rank]) {
+      conflicts << "\n  Point " << newLocal[i] << " has invalid owner (" << newRemote[i].rank << ", " << newRemote[i].index << ").";
+      isConsistent = false;
+    } // if
+  } // for
+  PetscInt hasInvalidOwnerLocal = isConsistent ? 0 : 1;
+  PetscInt hasInvalidOwner = 0;
+  err = MPI_Allreduce(&hasInvalidOwnerLocal, &hasInvalidOwner, 1, MPIU_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+
+  PetscSF sfNew = NULL;
+  PetscDM dmCoord = NULL;
+  err = PetscSFCreate(comm, &sfNew);PYLITH_CHECK_ERROR(err);
+  err = PetscSFSetGraph(sfNew, pEnd-pStart, numNewLeaves, newLocal, PETSC_OWN_POINTER, newRemote, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+  if (!hasInvalidOwner) {
+    // The star forest owns newLocal and newRemote, so use the map of leaves.
+    std::vector<PetscInt> isLeaf(pEnd > 0 ? pEnd : 1, 0), isRemoteLeaf(pEnd > 0 ? pEnd : 1, 0);
+    for (std::map<PetscInt, PetscSFNode>::const_iterator l_iter=newLeaves.begin(); l_iter != newLeaves.end(); ++l_iter) {
+      isLeaf[l_iter->first] = 1;
+    } // for
+    err = PetscSFBcastBegin(sfNew, MPIU_INT, &isLeaf[0], &isRemoteLeaf[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfNew, MPIU_INT, &isLeaf[0], &isRemoteLeaf[0]);PYLITH_CHECK_ERROR(err);
+    for (std::map<PetscInt, PetscSFNode>::const_iterator l_iter=newLeaves.begin(); l_iter != newLeaves.end(); ++l_iter) {
+      if (isRemoteLeaf[l_iter->first]) {
+	conflicts << "\n  Point " << l_iter->first << " has owner (" << l_iter->second.rank << ", " << l_iter->second.index
+		  << ") that is not a root.";
+	hasInvalidOwnerLocal = 1;
+      } // if
+    } // for
+    err = MPI_Allreduce(&hasInvalidOwnerLocal, &hasInvalidOwner, 1, MPIU_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (hasInvalidOwner) {
+    err = PetscSFDestroy(&sfNew);PYLITH_CHECK_ERROR(err);
+    std::ostringstream msg;
+    msg << "Inconsistent owners of split and cohesive points on processor " << commRank << ".";
+    msg << (conflicts.str().empty() ? "\n  Conflicting owners detected on another processor." : conflicts.str());
+    throw std::logic_error(msg.str());
+  } // if
+
+  err = DMSetPointSF(dm, sfNew);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateDM(dm, &dmCoord);PYLITH_CHECK_ERROR(err);
+  err = DMSetPointSF(dmCoord, sfNew);PYLITH_CHECK_ERROR(err);
+  err = PetscSFDestroy(&sfNew);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _reconcilePointSF
+
 
 // End of file
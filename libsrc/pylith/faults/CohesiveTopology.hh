@@ -30,6 +30,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh::IntSection
 
 #include <map>
+#include <string> // USES std::string
 
 // CohesiveTopology -----------------------------------------------------
 /// Creation of cohesive cells.
@@ -78,6 +79,52 @@ public :
               int& firstFaultCell,
               const bool constraintCell = false);
 
+  /** Label points to split and cells on each side of the fault
+   * without creating cohesive cells.
+   *
+   * Used to insert cohesive cells after distributing the mesh: the
+   * label is stored in the mesh, so it is distributed with the mesh,
+   * and createFromLabel() uses it to insert cohesive cells on each
+   * processor. Faults labeled this way must not share vertices.
+   *
+   * @param mesh Finite-element mesh (label is added to mesh).
+   * @param faultMesh Finite-element mesh of fault.
+   * @param faultBdLabel Label marking buried edges of fault (NULL if none).
+   * @param faultLabel Name of group of vertices defining fault.
+   */
+  static
+  void labelCohesive(topology::Mesh* mesh,
+		     const topology::Mesh& faultMesh,
+		     PetscDMLabel faultBdLabel,
+		     const char* faultLabel);
+
+  /** Check whether mesh has label created by labelCohesive() for fault.
+   *
+   * @param mesh Finite-element mesh.
+   * @param faultLabel Name of group of vertices defining fault.
+   * @returns True if mesh has label, false otherwise.
+   */
+  static
+  bool hasCohesiveLabel(const topology::Mesh& mesh,
+			const char* faultLabel);
+
+  /** Create cohesive cells in a distributed mesh using label created
+   * by labelCohesive().
+   *
+   * Points that are split on more than one processor are matched in
+   * the point star forest, and each split copy and cohesive point is
+   * owned by a processor that uses it. The label is removed from the
+   * mesh.
+   *
+   * @param mesh Finite-element mesh.
+   * @param faultLabel Name of group of vertices defining fault.
+   * @param materialId Material id for cohesive elements.
+   */
+  static
+  void createFromLabel(topology::Mesh* mesh,
+		       const char* faultLabel,
+		       const int materialId);
+
   /** Create (distributed) fault mesh from cohesive cells.
    *
    * @param faultMesh Finite-element mesh of fault (output).
@@ -94,6 +141,60 @@ public :
 			   const char* label,
 			   const bool constraintCell =false);
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Get name of label created by labelCohesive().
+   *
+   * @param faultLabel Name of group of vertices defining fault.
+   * @returns Name of label.
+   */
+  static
+  std::string _cohesiveLabelName(const char* faultLabel);
+
+  /** Complete label of points to split and cells on each side of
+   * the fault.
+   *
+   * @param label Label of points to split (output).
+   * @param dm PETSc DM for domain mesh.
+   * @param faultMesh Finite-element mesh of fault.
+   * @param faultBdLabel Label marking buried edges of fault (NULL if none).
+   */
+  static
+  void _labelSplit(PetscDMLabel* label,
+		   PetscDM dm,
+		   const topology::Mesh& faultMesh,
+		   PetscDMLabel faultBdLabel);
+
+  /** Split mesh and insert cohesive cells.
+   *
+   * @param mesh Finite-element mesh.
+   * @param label Label of points to split and cells on each side of fault.
+   * @param materialId Material id for cohesive elements.
+   */
+  static
+  void _insertCohesiveCells(topology::Mesh* mesh,
+			    PetscDMLabel label,
+			    const int materialId);
+
+  /** Add split and cohesive points created on more than one processor
+   * to the point star forest.
+   *
+   * Every processor sharing a point that was split (or that has a
+   * cohesive point without being split) creates its own copies. For
+   * each shared point, the processor owning the point chooses an owner
+   * for the point, its split copy, and its cohesive point among the
+   * processors with cells that use them; all other copies become
+   * leaves.
+   *
+   * Throws std::logic_error on every processor if a point would get
+   * more than one owner or if the owner of a leaf is not a root.
+   *
+   * @param dm PETSc DM for mesh with cohesive cells.
+   */
+  static
+  void _reconcilePointSF(PetscDM dm);
+
 }; // class CohesiveTopology
 
 #endif // pylith_faults_cohesivetopology_hh
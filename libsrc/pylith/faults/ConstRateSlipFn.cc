@@ -205,6 +205,11 @@ pylith::faults::ConstRateSlipFn::initialize(const topology::Mesh& faultMesh,
   _dbSlipRate->close();
   _dbSlipTime->close();
 
+  // Release arrays before caching parameters.
+  slipRateVisitor.clear();
+  slipTimeVisitor.clear();
+  _cacheParameters(slipRate, slipTime);
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -219,43 +224,27 @@ pylith::faults::ConstRateSlipFn::slip(topology::Field* slip,
   assert(slip);
   assert(_parameters);
 
-  // Get vertices in fault mesh
-  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-
-  // Get sections
-  const topology::Field& slipRate = _parameters->get("slip rate");
-  topology::VecVisitorMesh slipRateVisitor(slipRate);
-  const PetscScalar* slipRateArray = slipRateVisitor.localArray();
-
-  const topology::Field& slipTime = _parameters->get("slip time");
-  topology::VecVisitorMesh slipTimeVisitor(slipTime);
-  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
-
   topology::VecVisitorMesh slipVisitor(*slip);
   PetscScalar* slipArray = slipVisitor.localArray();
 
-  const int spaceDim = _slipRateVertex.size();
-  for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt sroff = slipRateVisitor.sectionOffset(v);
-    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
-    const PetscInt soff = slipVisitor.sectionOffset(v);
-
-    assert(spaceDim == slipRateVisitor.sectionDof(v));
-    assert(1 == slipTimeVisitor.sectionDof(v));
-    assert(spaceDim == slipVisitor.sectionDof(v));
+  const int spaceDim = _cache.spaceDim;
+  const int numVertices = _cache.vertices.size();
+  for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+    const PetscInt soff = slipVisitor.sectionOffset(_cache.vertices[iVertex]);
+    assert(spaceDim == slipVisitor.sectionDof(_cache.vertices[iVertex]));
 
-    const PylithScalar relTime = t - slipTimeArray[stoff];
+    const PylithScalar relTime = t - _cache.slipTime[iVertex];
     if (relTime > 0.0) {
-      for(PetscInt d = 0; d < spaceDim; ++d) {
-        slipArray[soff+d] += slipRateArray[sroff+d] * relTime; // Convert slip rate to slip
+      // Convert slip rate to slip
+      const PylithScalar* slipDir = &_cache.slipDir[iVertex*spaceDim];
+      const PylithScalar slip = _cache.slipMag[iVertex] * relTime;
+      for (int d = 0; d < spaceDim; ++d) {
+        slipArray[soff+d] += slipDir[d] * slip;
       } // for
     } // if
   } // for
 
-  PetscLogFlops((vEnd-vStart) * (1 + _slipRateVertex.size()));
+  PetscLogFlops(numVertices * (2 + 2*spaceDim));
 
   PYLITH_METHOD_END;
 } // slip
@@ -103,6 +103,38 @@ pylith::faults::FaultCohesive::numVerticesNoMesh(const topology::Mesh& mesh) con
   PYLITH_METHOD_RETURN(nvertices);
 } // numVerticesNoMesh
 
+// ----------------------------------------------------------------------
+// Label points to split for fault implementation without adjusting
+// mesh topology.
+void
+pylith::faults::FaultCohesive::labelTopology(topology::Mesh* const mesh)
+{ // labelTopology
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(std::string("") != label());
+
+  try {
+    if (_useFaultMesh) {
+      assert(3 == mesh->dimension());
+      throw std::logic_error("Support for UCD fault files no longer implemented."); 
+    } // if
+
+    topology::Mesh faultMesh;
+    PetscDMLabel faultBdLabel = NULL;
+    _createFaultMesh(&faultMesh, &faultBdLabel, *mesh);
+    CohesiveTopology::labelCohesive(mesh, faultMesh, faultBdLabel, label());
+
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while labeling points to split for fault '" << label() << "'.\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  }
+
+  PYLITH_METHOD_END;
+} // labelTopology
+
 // ----------------------------------------------------------------------
 // Adjust mesh topology for fault implementation.
 void
@@ -117,54 +149,26 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
   assert(std::string("") != label());
   
   try {
-    topology::Mesh faultMesh;
-  
-    // Get group of vertices associated with fault
-    PetscDM dmMesh = mesh->dmMesh();assert(dmMesh);
-    
-    if (!_useFaultMesh) {
-      const char* charlabel = label();
-
-      PetscDMLabel   groupField;
-      PetscBool      hasLabel;
-      PetscInt       depth, gdepth, dim;
-      PetscMPIInt    rank;
-      PetscErrorCode err;
-      // We do not have labels on all ranks until after distribution
-      err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
-      err = DMHasLabel(dmMesh, charlabel, &hasLabel);PYLITH_CHECK_ERROR(err);
-      if (!hasLabel && !rank) {
-        std::ostringstream msg;
-        msg << "Mesh missing group of vertices '" << label()
-            << "' for fault interface condition.";
-        throw std::runtime_error(msg.str());
-      } // if
-      err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
-      err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
-      err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh->comm());PYLITH_CHECK_ERROR(err);
-      err = DMGetLabel(dmMesh, charlabel, &groupField);PYLITH_CHECK_ERROR(err);
-      CohesiveTopology::createFault(&faultMesh, *mesh, groupField);
+    if (CohesiveTopology::hasCohesiveLabel(*mesh, label())) {
+      // Points to split were labeled before distributing the mesh.
+      CohesiveTopology::createFromLabel(mesh, label(), id());
+
+      // Check consistency of mesh.
+      topology::MeshOps::checkTopology(*mesh);
+    } else if (!_useFaultMesh) {
+      topology::Mesh faultMesh;
       PetscDMLabel faultBdLabel = NULL;
-
-      // We do not have labels on all ranks until after distribution
-      if (strlen(edge()) > 0 && !rank) {
-	err = DMGetLabel(dmMesh, edge(), &faultBdLabel);PYLITH_CHECK_ERROR(err);
-	if (!faultBdLabel) {
-	  std::ostringstream msg;
-	  msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
-	  throw std::runtime_error(msg.str());
-	} // if
-      } // if
+      _createFaultMesh(&faultMesh, &faultBdLabel, *mesh);
       CohesiveTopology::create(mesh, faultMesh, faultBdLabel, id(), *firstFaultVertex, *firstLagrangeVertex, *firstFaultCell, useLagrangeConstraints());
+
+      // Check consistency of mesh.
+      topology::MeshOps::checkTopology(*mesh);
+      topology::MeshOps::checkTopology(faultMesh);
     } else {
       assert(3 == mesh->dimension());
       throw std::logic_error("Support for UCD fault files no longer implemented."); 
     } // if/else
 
-    // Check consistency of mesh.
-    topology::MeshOps::checkTopology(*mesh);
-    topology::MeshOps::checkTopology(faultMesh);
-
   } catch (const std::exception& err) {
     std::ostringstream msg;
     msg << "Error occurred while adjusting topology to create cohesive cells for fault '" << label() << "'.\n"
@@ -176,5 +180,56 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
   PYLITH_METHOD_END;
 } // adjustTopology
 
+// ----------------------------------------------------------------------
+// Create fault mesh from group of vertices and get label of buried
+// edges.
+void
+pylith::faults::FaultCohesive::_createFaultMesh(topology::Mesh* faultMesh,
+						PetscDMLabel* faultBdLabel,
+						const topology::Mesh& mesh)
+{ // _createFaultMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(faultMesh);
+  assert(faultBdLabel);
+
+  // Get group of vertices associated with fault
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  const char* charlabel = label();
+
+  PetscDMLabel   groupField;
+  PetscBool      hasLabel;
+  PetscInt       depth, gdepth, dim;
+  PetscMPIInt    rank;
+  PetscErrorCode err;
+  // We do not have labels on all ranks until after distribution
+  err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
+  err = DMHasLabel(dmMesh, charlabel, &hasLabel);PYLITH_CHECK_ERROR(err);
+  if (!hasLabel && !rank) {
+    std::ostringstream msg;
+    msg << "Mesh missing group of vertices '" << label()
+	<< "' for fault interface condition.";
+    throw std::runtime_error(msg.str());
+  } // if
+  err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+  err = DMGetLabel(dmMesh, charlabel, &groupField);PYLITH_CHECK_ERROR(err);
+  CohesiveTopology::createFault(faultMesh, mesh, groupField);
+
+  // We do not have labels on all ranks until after distribution
+  *faultBdLabel = NULL;
+  if (strlen(edge()) > 0) {
+    err = DMGetLabel(dmMesh, edge(), faultBdLabel);PYLITH_CHECK_ERROR(err);
+    if (!*faultBdLabel && !rank) {
+      std::ostringstream msg;
+      msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // if
+
+  PYLITH_METHOD_END;
+} // _createFaultMesh
+
 
 // End of file 
@@ -72,6 +72,17 @@ public :
    */
   int numVerticesNoMesh(const topology::Mesh& mesh) const;
 
+  /** Label points to split for fault implementation without adjusting
+   * mesh topology.
+   *
+   * Used to label faults on the serial mesh before distributing it;
+   * adjustTopology() then inserts the cohesive cells on each
+   * processor using the distributed label.
+   *
+   * @param mesh PETSc mesh.
+   */
+  void labelTopology(topology::Mesh* const mesh);
+
   /** Adjust mesh topology for fault implementation.
    *
    * If firstFaultVertex == 0, then firstFaultVertex is set to the first point
@@ -113,6 +124,20 @@ protected :
   /// Map label of cohesive cell to label of fault cell.
   std::map<PetscInt, PetscInt> _cohesiveToFault;
 
+// PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create fault mesh from group of vertices and get label of buried
+   * edges.
+   *
+   * @param faultMesh Fault mesh (result).
+   * @param faultBdLabel Label of buried edges (result, NULL if none).
+   * @param mesh PETSc mesh.
+   */
+  void _createFaultMesh(topology::Mesh* faultMesh,
+			PetscDMLabel* faultBdLabel,
+			const topology::Mesh& mesh);
+
 // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
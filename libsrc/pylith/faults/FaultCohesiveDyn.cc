@@ -70,6 +70,9 @@ pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
     _ksp(0),
     _openFreeSurf(true)
 { // constructor
+    // Sensitivity solve extracts the cell blocks of the assembled
+    // Jacobian adjacent to the fault.
+    _hasJacobianAction = false;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -429,7 +432,15 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
     topology::VecVisitorMesh orientationVisitor(orientation);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
+    // Compute slip, slip rate, and normal traction at all unclamped
+    // vertices first and then update the state variables of the
+    // friction model for all of them at once.
     const int numVertices = _cohesiveVertices.size();
+    int_array pointsBatch(numVertices);
+    scalar_array slipBatch(numVertices);
+    scalar_array slipRateBatch(numVertices);
+    scalar_array tractionNormalBatch(numVertices);
+    int numPointsBatch = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -471,45 +482,65 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
             } // for
         } // for
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
-
-        // Use fault constitutive model to compute traction associated with
-        // friction.
+        // Magnitude of slip and slip rate and normal traction used by
+        // fault constitutive model.
+        PylithScalar slipMag = 0.0;
+        PylithScalar slipRateMag = 0.0;
+        PylithScalar tractionNormal = 0.0;
         switch (spaceDim) { // switch
         case 1: { // case 1
-            const PylithScalar slipMag = 0.0;
-            const PylithScalar slipRateMag = 0.0;
-            const PylithScalar tractionNormal = tractionTpdtVertex[0];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            tractionNormal = tractionTpdtVertex[0];
             break;
         } // case 1
         case 2: { // case 2
-            const PylithScalar slipMag = fabs(slipVertex[0]);
-            const PylithScalar slipRateMag = fabs(slipRateVertex[0]);
-            const PylithScalar tractionNormal = tractionTpdtVertex[1];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            slipMag = fabs(slipVertex[0]);
+            slipRateMag = fabs(slipRateVertex[0]);
+            tractionNormal = tractionTpdtVertex[1];
             break;
         } // case 2
         case 3: { // case 3
-            const PylithScalar slipMag =
-                sqrt(slipVertex[0]*slipVertex[0] + slipVertex[1]*slipVertex[1]);
-            const PylithScalar slipRateMag =
-                sqrt(slipRateVertex[0]*slipRateVertex[0] +
-                     slipRateVertex[1]*slipRateVertex[1]);
-            const PylithScalar tractionNormal = tractionTpdtVertex[2];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            slipMag = sqrt(slipVertex[0]*slipVertex[0] + slipVertex[1]*slipVertex[1]);
+            slipRateMag = sqrt(slipRateVertex[0]*slipRateVertex[0] +
+                               slipRateVertex[1]*slipRateVertex[1]);
+            tractionNormal = tractionTpdtVertex[2];
             break;
         } // case 3
         default:
             assert(0);
             throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::updateStateVars().");
         } // switch
+
+        pointsBatch[numPointsBatch] = v_fault;
+        slipBatch[numPointsBatch] = slipMag;
+        slipRateBatch[numPointsBatch] = slipRateMag;
+        tractionNormalBatch[numPointsBatch] = tractionNormal;
+        ++numPointsBatch;
     } // for
 
+    // Use fault constitutive model to update state variables.
+    if (numPointsBatch > 0) {
+        _friction->updateStateVarsBatch(t, &slipBatch[0], &slipRateBatch[0], &tractionNormalBatch[0],
+                                        &pointsBatch[0], numPointsBatch);
+    } // if
+
+    FaultCohesiveLagrange::updateStateVars(t, fields);
+
     PYLITH_METHOD_END;
 } // updateStateVars
 
+// ----------------------------------------------------------------------
+// Get stable time step for advancing from time t to time t+dt.
+PylithScalar
+pylith::faults::FaultCohesiveDyn::stableTimeStep(const topology::Mesh& mesh)
+{ // stableTimeStep
+    PYLITH_METHOD_BEGIN;
+
+    assert(_friction);
+    const PylithScalar dtStable = _friction->stableTimeStep();
+
+    PYLITH_METHOD_RETURN(dtStable);
+} // stableTimeStep
+
 // ----------------------------------------------------------------------
 // Constrain solution based on friction.
 void
@@ -523,10 +554,12 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
         (scalar_array*,
         const PylithScalar,
+        const int,
         const scalar_array&,
         const scalar_array&,
         const scalar_array&,
         const PylithScalar,
+        const PylithScalar,
         const bool);
 
     assert(fields);
@@ -593,7 +626,18 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
                                "FaultCohesiveDyn::constrainSolnSpace().");
     } // switch
 
+    // Correct the trial solution at all unclamped vertices first, so
+    // that the fault constitutive model computes friction for all of
+    // them at once.
     const int numVertices = _cohesiveVertices.size();
+    int_array verticesBatch(numVertices);
+    int_array pointsBatch(numVertices);
+    scalar_array slipTpdtBatch(numVertices*spaceDim);
+    scalar_array slipRateBatch(numVertices*spaceDim);
+    scalar_array tractionTpdtBatch(numVertices*spaceDim);
+    scalar_array dTractionTpdtNormalBatch(numVertices);
+    scalar_array frictionBatch(numVertices);
+    int numPointsBatch = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -686,19 +730,46 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
             slipTpdtVertex[indexN] = 0.0;
         } // if
 
-        // Step 2: Apply friction criterion to trial solution to get
-        // change in Lagrange multiplier (dTractionTpdtVertex) in fault
-        // coordinate system.
+        const int boff = numPointsBatch*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            slipTpdtBatch[boff+iDim] = slipTpdtVertex[iDim];
+            slipRateBatch[boff+iDim] = slipRateVertex[iDim];
+            tractionTpdtBatch[boff+iDim] = tractionTpdtVertex[iDim];
+        } // for
+        dTractionTpdtNormalBatch[numPointsBatch] = dTractionTpdtVertexNormal;
+        verticesBatch[numPointsBatch] = iVertex;
+        pointsBatch[numPointsBatch] = v_fault;
+        ++numPointsBatch;
+    } // for
+
+    // Step 2: Apply friction criterion to trial solution to get
+    // change in Lagrange multiplier (dTractionTpdtVertex) in fault
+    // coordinate system.
+
+    // Use fault constitutive model to compute friction at all vertices.
+    _calcFrictionBatch(&frictionBatch, t, slipTpdtBatch, slipRateBatch, tractionTpdtBatch, pointsBatch, numPointsBatch);
+
+    for (int iBatch=0; iBatch < numPointsBatch; ++iBatch) {
+        const int v_fault = _cohesiveVertices[verticesBatch[iBatch]].fault;
+
+        // Get orientation
+        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+        const int boff = iBatch*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            slipTpdtVertex[iDim] = slipTpdtBatch[boff+iDim];
+            slipRateVertex[iDim] = slipRateBatch[boff+iDim];
+            tractionTpdtVertex[iDim] = tractionTpdtBatch[boff+iDim];
+        } // for
+        const PylithScalar dTractionTpdtVertexNormal = dTractionTpdtNormalBatch[iBatch];
 
         // Use fault constitutive model to compute traction associated with
         // friction.
         dTractionTpdtVertex = 0.0;
         const PylithScalar jacobianShearVertex = 0.0;
         const bool iterating = true; // Iterating to get friction
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
+        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, v_fault, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, frictionBatch[iBatch], jacobianShearVertex, iterating);
 
         // Rotate increment in traction back to global coordinate system.
         dLagrangeTpdtVertex = 0.0;
@@ -1053,10 +1124,12 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
         (scalar_array*,
         const PylithScalar,
+        const int,
         const scalar_array&,
         const scalar_array&,
         const scalar_array&,
         const PylithScalar,
+        const PylithScalar,
         const bool);
 
     assert(fields);
@@ -1158,7 +1231,20 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 #endif
 
     PetscErrorCode err = 0;
+
+    // Compute the increment in the Lagrange multipliers, slip, and
+    // fault traction at all unclamped vertices first, so that the
+    // fault constitutive model computes friction for all of them at
+    // once.
     const int numVertices = _cohesiveVertices.size();
+    int_array verticesBatch(numVertices);
+    int_array pointsBatch(numVertices);
+    scalar_array slipBatch(numVertices*spaceDim);
+    scalar_array slipRateBatch(numVertices*spaceDim); // No slip rate in lumped soln
+    scalar_array tractionTpdtBatch(numVertices*spaceDim);
+    scalar_array lagrangeTIncrBatch(numVertices*spaceDim);
+    scalar_array frictionBatch(numVertices);
+    int numPointsBatch = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -1196,9 +1282,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
         assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
 
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
         // Get relative displacement at fault vertex.
         const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
         assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
@@ -1218,42 +1301,109 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         _logger->eventBegin(computeEvent);
 #endif
 
+        const int boff = numPointsBatch*spaceDim;
+
         // Adjust solution as in prescribed rupture, updating the Lagrange
-        // multipliers and the corresponding displacment increments.
+        // multipliers.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             assert(jacobianArray[jpoff+iDim] > 0.0);
             assert(jacobianArray[jnoff+iDim] > 0.0);
             const PylithScalar S = (1.0/jacobianArray[jpoff+iDim] + 1.0/jacobianArray[jnoff+iDim]) * areaVertex*areaVertex;
             assert(S > 0.0);
-            lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[rloff+iDim] + areaVertex * (dispTIncrArray[dipoff+iDim] - dispTIncrArray[dinoff+iDim]));
-            dispIncrVertexN[iDim] =  areaVertex / jacobianArray[jnoff+iDim]*lagrangeTIncrVertex[iDim];
-            dispIncrVertexP[iDim] = -areaVertex / jacobianArray[jpoff+iDim]*lagrangeTIncrVertex[iDim];
+            lagrangeTIncrBatch[boff+iDim] = 1.0/S * (-residualArray[rloff+iDim] + areaVertex * (dispTIncrArray[dipoff+iDim] - dispTIncrArray[dinoff+iDim]));
         } // for
 
-        // Compute slip, slip rate, and Lagrange multiplier at time t+dt
-        // in fault coordinate system.
-        slipVertex = 0.0;
-        slipRateVertex = 0.0;
-        tractionTpdtVertex = 0.0;
+        // Compute slip and Lagrange multiplier at time t+dt in fault
+        // coordinate system.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
+            PylithScalar slipDim = 0.0;
+            PylithScalar tractionDim = 0.0;
             for (int jDim=0; jDim < spaceDim; ++jDim) {
-                slipVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * dispRelArray[droff+jDim];
-                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + lagrangeTIncrVertex[jDim]);
+                slipDim += orientationArray[ooff+iDim*spaceDim+jDim] * dispRelArray[droff+jDim];
+                tractionDim += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + lagrangeTIncrBatch[boff+jDim]);
             } // for
+            slipBatch[boff+iDim] = slipDim;
+            tractionTpdtBatch[boff+iDim] = tractionDim;
+        } // for
+
+        verticesBatch[numPointsBatch] = iVertex;
+        pointsBatch[numPointsBatch] = v_fault;
+        ++numPointsBatch;
+
+#if defined(DETAILED_EVENT_LOGGING)
+        _logger->eventEnd(computeEvent);
+#endif
+    } // for
+
+    // Use fault constitutive model to compute friction at all vertices.
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventBegin(computeEvent);
+#endif
+    _calcFrictionBatch(&frictionBatch, t, slipBatch, slipRateBatch, tractionTpdtBatch, pointsBatch, numPointsBatch);
+#if defined(DETAILED_EVENT_LOGGING)
+    _logger->eventEnd(computeEvent);
+#endif
+
+    for (int iBatch=0; iBatch < numPointsBatch; ++iBatch) {
+        const int iVertex = verticesBatch[iBatch];
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+#if defined(DETAILED_EVENT_LOGGING)
+        _logger->eventBegin(restrictEvent);
+#endif
+
+        // Get jacobian at cohesive cell's vertices.
+        const PetscInt jnoff = jacobianVisitor.sectionOffset(v_negative);
+        assert(spaceDim == jacobianVisitor.sectionDof(v_negative));
+
+        const PetscInt jpoff = jacobianVisitor.sectionOffset(v_positive);
+        assert(spaceDim == jacobianVisitor.sectionDof(v_positive));
+
+        // Get dispIncr(t) at Lagrange vertex.
+        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
+        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+
+        // Get area at fault vertex.
+        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+        assert(1 == areaVisitor.sectionDof(v_fault));
+        const PetscScalar areaVertex = areaArray[aoff];
+        assert(areaVertex > 0.0);
+
+        // Get fault orientation at fault vertex.
+        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
+
+#if defined(DETAILED_EVENT_LOGGING)
+        _logger->eventEnd(restrictEvent);
+        _logger->eventBegin(computeEvent);
+#endif
+
+        const int boff = iBatch*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            lagrangeTIncrVertex[iDim] = lagrangeTIncrBatch[boff+iDim];
+            slipVertex[iDim] = slipBatch[boff+iDim];
+            tractionTpdtVertex[iDim] = tractionTpdtBatch[boff+iDim];
+
+            // Displacement increments corresponding to the Lagrange
+            // multipliers from the prescribed rupture adjustment.
+            dispIncrVertexN[iDim] =  areaVertex / jacobianArray[jnoff+iDim]*lagrangeTIncrVertex[iDim];
+            dispIncrVertexP[iDim] = -areaVertex / jacobianArray[jpoff+iDim]*lagrangeTIncrVertex[iDim];
         } // for
+        slipRateVertex = 0.0;
+
           // Jacobian is diagonal and isotropic, so it is invariant with
           // respect to rotation and contains one unique term.
         const PylithScalar jacobianShearVertex = -1.0 / (areaVertex * (1.0 / jacobianArray[jnoff+0] + 1.0 / jacobianArray[jpoff+0]));
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
-
         // Use fault constitutive model to compute traction associated with
         // friction.
         dTractionTpdtVertex = 0.0;
 
         const bool iterating = false; // No iteration for friction in lumped soln
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
+        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, v_fault, slipVertex, slipRateVertex, tractionTpdtVertex, frictionBatch[iBatch], jacobianShearVertex, iterating);
 
         // Rotate traction back to global coordinate system.
         dLagrangeTpdtVertex = 0.0;
@@ -1426,6 +1576,9 @@ pylith::faults::FaultCohesiveDyn::vertexField(const char* name,
         _calcTractions(&buffer, dispT);
         PYLITH_METHOD_RETURN(buffer);
 
+    } else if (_ruptureMetricsField(name)) {
+        PYLITH_METHOD_RETURN(*_ruptureMetricsField(name));
+
     } else if (_friction->hasPropStateVar(name)) {
         PYLITH_METHOD_RETURN(_friction->getField(name));
 
@@ -2045,10 +2198,12 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
     typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
         (scalar_array*,
         const PylithScalar,
+        const int,
         const scalar_array&,
         const scalar_array&,
         const scalar_array&,
         const PylithScalar,
+        const PylithScalar,
         const bool);
 
     // Update time step in friction (can vary).
@@ -2105,6 +2260,16 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
     bool isOpening = false;
     PylithScalar norm2 = 0.0;
     int numVertices = _cohesiveVertices.size();
+
+    // Correct the trial solution at all local vertices first, so that
+    // the fault constitutive model computes friction for all of them
+    // at once.
+    int_array pointsBatch(numVertices);
+    scalar_array slipTpdtBatch(numVertices*spaceDim);
+    scalar_array slipRateBatch(numVertices*spaceDim);
+    scalar_array tractionTpdtBatch(numVertices*spaceDim);
+    scalar_array frictionBatch(numVertices);
+    int numPointsBatch = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -2212,21 +2377,41 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
             isOpening = true;
         } // if
 
-        // Apply friction criterion to trial solution to get change in
-        // Lagrange multiplier (dLagrangeTpdtVertex) in fault coordinate
-        // system.
+        const int boff = numPointsBatch*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            slipTpdtBatch[boff+iDim] = slipTpdtVertex[iDim];
+            slipRateBatch[boff+iDim] = slipRateVertex[iDim];
+            tractionTpdtBatch[boff+iDim] = tractionTpdtVertex[iDim];
+        } // for
+        pointsBatch[numPointsBatch] = v_fault;
+        ++numPointsBatch;
+    } // for
+
+    // Apply friction criterion to trial solution to get change in
+    // Lagrange multiplier (dLagrangeTpdtVertex) in fault coordinate
+    // system.
+
+    // Use fault constitutive model to compute friction at all vertices.
+    _calcFrictionBatch(&frictionBatch, t, slipTpdtBatch, slipRateBatch, tractionTpdtBatch, pointsBatch, numPointsBatch);
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+    for (int iBatch=0; iBatch < numPointsBatch; ++iBatch) {
+        const int v_fault = pointsBatch[iBatch];
+
+        const int boff = iBatch*spaceDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            slipTpdtVertex[iDim] = slipTpdtBatch[boff+iDim];
+            slipRateVertex[iDim] = slipRateBatch[boff+iDim];
+            tractionTpdtVertex[iDim] = tractionTpdtBatch[boff+iDim];
+        } // for
 
         // Use fault constitutive model to compute traction associated with
         // friction.
         tractionMisfitVertex = 0.0;
         const PylithScalar jacobianShearVertex = 0.0;
         const bool iterating = true; // Iterating to get friction
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&tractionMisfitVertex, t,
-                                                     slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex,
-                                                     iterating);
+        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&tractionMisfitVertex, t, v_fault,
+                                                     slipTpdtVertex, slipRateVertex, tractionTpdtVertex, frictionBatch[iBatch],
+                                                     jacobianShearVertex, iterating);
 
 #if 0 // DEBUGGING
         std::cout << "alpha: " << alpha
@@ -2244,6 +2429,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
             std::cout << " " << tractionTpdtVertex[iDim];
         } // for
         std::cout << ", dDispRel:";
+        const PetscInt sdroff = sensDispRelVisitor.sectionOffset(v_fault);
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             std::cout << " " << sensDispRelArray[sdroff+iDim];
         } // for
@@ -2268,15 +2454,72 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
     PYLITH_METHOD_RETURN(sqrt(norm2Total) / numVerticesTotal);
 } // _constrainSolnSpaceNorm
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of fault vertices.
+void
+pylith::faults::FaultCohesiveDyn::_calcFrictionBatch(scalar_array* friction,
+                                                     const PylithScalar t,
+                                                     const scalar_array& slip,
+                                                     const scalar_array& slipRate,
+                                                     const scalar_array& tractionTpdt,
+                                                     const int_array& points,
+                                                     const int numPoints)
+{ // _calcFrictionBatch
+    PYLITH_METHOD_BEGIN;
+
+    assert(friction);
+    assert(_quadrature);
+    assert(_friction);
+
+    const int spaceDim = _quadrature->spaceDim();
+    const int indexN = spaceDim - 1;
+    assert(friction->size() >= size_t(numPoints));
+    assert(slip.size() >= size_t(numPoints*spaceDim));
+    assert(slipRate.size() >= size_t(numPoints*spaceDim));
+    assert(tractionTpdt.size() >= size_t(numPoints*spaceDim));
+
+    // Friction is not used in 1-D (no shear tractions).
+    if (1 == spaceDim || numPoints <= 0) {
+        *friction = 0.0;
+        PYLITH_METHOD_END;
+    } // if
+
+    // Magnitude of slip and slip rate and normal traction used by
+    // fault constitutive model.
+    scalar_array slipMagBatch(numPoints);
+    scalar_array slipRateMagBatch(numPoints);
+    scalar_array tractionNormalBatch(numPoints);
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+        const int off = iPoint*spaceDim;
+        PylithScalar slipMag2 = 0.0;
+        PylithScalar slipRateMag2 = 0.0;
+        for (int iDim=0; iDim < indexN; ++iDim) {
+            slipMag2 += slip[off+iDim]*slip[off+iDim];
+            slipRateMag2 += slipRate[off+iDim]*slipRate[off+iDim];
+        } // for
+        slipMagBatch[iPoint] = sqrt(slipMag2);
+        slipRateMagBatch[iPoint] = sqrt(slipRateMag2);
+        tractionNormalBatch[iPoint] = tractionTpdt[off+indexN];
+    } // for
+    PetscLogFlops(numPoints*(2 + indexN*4));
+
+    _friction->calcFrictionBatch(&(*friction)[0], t, &slipMagBatch[0], &slipRateMagBatch[0], &tractionNormalBatch[0],
+                                 &points[0], numPoints);
+
+    PYLITH_METHOD_END;
+} // _calcFrictionBatch
+
 
 // ----------------------------------------------------------------------
 // Constrain solution space in 1-D.
 void
 pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(scalar_array* dTractionTpdt,
                                                         const PylithScalar t,
+                                                        const int point,
                                                         const scalar_array& slip,
                                                         const scalar_array& sliprate,
                                                         const scalar_array& tractionTpdt,
+                                                        const PylithScalar frictionStress,
                                                         const PylithScalar jacobianShear,
                                                         const bool iterating)
 { // _constrainSolnSpace1D
@@ -2299,9 +2542,11 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(scalar_array* dTractionT
 void
 pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionTpdt,
                                                         const PylithScalar t,
+                                                        const int point,
                                                         const scalar_array& slip,
                                                         const scalar_array& slipRate,
                                                         const scalar_array& tractionTpdt,
+                                                        const PylithScalar frictionStress,
                                                         const PylithScalar jacobianShear,
                                                         const bool iterating)
 { // _constrainSolnSpace2D
@@ -2315,9 +2560,9 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
 
     if (fabs(slip[1]) < _zeroToleranceNormal && tractionNormal < -_zeroTolerance) {
         // if in compression and no opening
-        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
+        PylithScalar frictionStressCur = frictionStress;
 
-        if (tractionShearMag > frictionStress || (iterating && slipRateMag > 0.0)) {
+        if (tractionShearMag > frictionStressCur || (iterating && slipRateMag > 0.0)) {
             // traction is limited by friction, so have sliding OR
             // friction exceeds traction due to overshoot in slip
 
@@ -2326,6 +2571,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
                 if (0.0 != jacobianShear) {
                     assert(jacobianShear < 0.0);
                     // Use Newton to get better update
+                    _friction->retrievePropsStateVars(point);
                     const int maxiter = 32;
                     PylithScalar slipMagCur = slipMag;
                     PylithScalar slipRateMagCur = slipRateMag;
@@ -2337,16 +2583,16 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
                         if (slipMag > 0.0) {
                             // Use Newton (in log slip space) to get better update in slip & traction.
                             // D_{i+1} = exp(ln(D_i) - (T-T_f)/(D_i * (jacobian - frictionDeriv))
-                            slipMagCur = exp(log(slipMag) - (tractionShearMagCur - frictionStress) / (slipMag * (jacobianShear - frictionDeriv)));
+                            slipMagCur = exp(log(slipMag) - (tractionShearMagCur - frictionStressCur) / (slipMag * (jacobianShear - frictionDeriv)));
                         } else {
                             // Use Newton (in linear slip space) to get better update in slip & traction.
                             // D_{i+1} = D_i - (T-T_f)/(jacobian - frictionDeriv)
-                            slipMagCur = slipMag - (tractionShearMagCur - frictionStress) / (jacobianShear - frictionDeriv);
+                            slipMagCur = slipMag - (tractionShearMagCur - frictionStressCur) / (jacobianShear - frictionDeriv);
                         } // if
                         tractionShearMagCur += (slipMagCur - slipMag) * jacobianShear;
                         slipRateMagCur = (slipMagCur - slipMag0) / _dt;
-                        frictionStress = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal);
-                        if (fabs(tractionShearMagCur - frictionStress) < _zeroTolerance) {
+                        frictionStressCur = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal);
+                        if (fabs(tractionShearMagCur - frictionStressCur) < _zeroTolerance) {
                             break;
                         } // if
                     } // for
@@ -2355,7 +2601,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
 
                 // Update traction increment based on value required to stick
                 // versus friction
-                const PylithScalar dlp = -(tractionShearMag - frictionStress) * tractionTpdt[0] / tractionShearMag;
+                const PylithScalar dlp = -(tractionShearMag - frictionStressCur) * tractionTpdt[0] / tractionShearMag;
                 (*dTractionTpdt)[0] = dlp;
             } else {
                 // No shear stress and no friction.
@@ -2381,9 +2627,11 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
 void
 pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionTpdt,
                                                         const PylithScalar t,
+                                                        const int point,
                                                         const scalar_array& slip,
                                                         const scalar_array& slipRate,
                                                         const scalar_array& tractionTpdt,
+                                                        const PylithScalar frictionStress,
                                                         const PylithScalar jacobianShear,
                                                         const bool iterating)
 { // _constrainSolnSpace3D
@@ -2397,9 +2645,9 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
 
     if (fabs(slip[2]) < _zeroToleranceNormal && tractionNormal < -_zeroTolerance) {
         // if in compression and no opening
-        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
+        PylithScalar frictionStressCur = frictionStress;
 
-        if (tractionShearMag > frictionStress || (iterating && slipRateMag > 0.0)) {
+        if (tractionShearMag > frictionStressCur || (iterating && slipRateMag > 0.0)) {
             // traction is limited by friction, so have sliding OR
             // friction exceeds traction due to overshoot in slip
 
@@ -2408,6 +2656,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
                 if (0.0 != jacobianShear) {
                     assert(jacobianShear < 0.0);
                     // Use Newton to get better update
+                    _friction->retrievePropsStateVars(point);
                     const int maxiter = 32;
                     PylithScalar slipMagCur = slipMag;
                     PylithScalar slipRateMagCur = slipRateMag;
@@ -2419,16 +2668,16 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
                         if (slipMag > 0.0) {
                             // Use Newton (in log slip space) to get better update in slip & traction.
                             // D_{i+1} = exp(ln(D_i) - (T-T_f)/(D_i * (jacobian - frictionDeriv))
-                            slipMagCur = exp(log(slipMag) - (tractionShearMagCur - frictionStress) / (slipMag * (jacobianShear - frictionDeriv)));
+                            slipMagCur = exp(log(slipMag) - (tractionShearMagCur - frictionStressCur) / (slipMag * (jacobianShear - frictionDeriv)));
                         } else {
                             // Use Newton (in linear slip space) to get better update in slip & traction.
                             // D_{i+1} = D_i - (T-T_f)/(jacobian - frictionDeriv)
-                            slipMagCur = slipMag - (tractionShearMagCur - frictionStress) / (jacobianShear - frictionDeriv);
+                            slipMagCur = slipMag - (tractionShearMagCur - frictionStressCur) / (jacobianShear - frictionDeriv);
                         } // if
                         tractionShearMagCur += (slipMagCur - slipMag) * jacobianShear;
                         slipRateMagCur = (slipMagCur - slipMag0) / _dt;
-                        frictionStress = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal);
-                        if (fabs(tractionShearMagCur - frictionStress) < _zeroTolerance) {
+                        frictionStressCur = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal);
+                        if (fabs(tractionShearMagCur - frictionStressCur) < _zeroTolerance) {
                             break;
                         } // if
                     } // for
@@ -2437,8 +2686,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
 
                 // Update traction increment based on value required to stick
                 // versus friction
-                const PylithScalar dlp = -(tractionShearMag - frictionStress) * tractionTpdt[0] / tractionShearMag;
-                const PylithScalar dlq = -(tractionShearMag - frictionStress) * tractionTpdt[1] / tractionShearMag;
+                const PylithScalar dlp = -(tractionShearMag - frictionStressCur) * tractionTpdt[0] / tractionShearMag;
+                const PylithScalar dlq = -(tractionShearMag - frictionStressCur) * tractionTpdt[1] / tractionShearMag;
 
                 (*dTractionTpdt)[0] = dlp;
                 (*dTractionTpdt)[1] = dlq;
@@ -124,6 +124,16 @@ public :
   void updateStateVars(const PylithScalar t,
 		       topology::SolutionFields* const fields);
 
+  /** Get stable time step for advancing from time t to time t+dt.
+   *
+   * Uses the stable time step for the state variables of the fault
+   * constitutive model.
+   *
+   * @param mesh Finite-element mesh.
+   * @returns Time step
+   */
+  PylithScalar stableTimeStep(const topology::Mesh& mesh);
+
   /** Constrain solution space based on friction.
    *
    * @param fields Solution fields.
@@ -228,21 +238,44 @@ private :
 				       const PylithScalar t,
 				       topology::SolutionFields* const fields);
 
+  /** Compute friction at a batch of fault vertices using the slip,
+   * slip rate, and traction in the fault coordinate system.
+   *
+   * @param friction Friction at each vertex [numPoints].
+   * @param t Current time.
+   * @param slip Slip at each vertex [numPoints*spaceDim].
+   * @param slipRate Slip rate at each vertex [numPoints*spaceDim].
+   * @param tractionTpdt Fault traction at each vertex [numPoints*spaceDim].
+   * @param points Fault vertices [numPoints].
+   * @param numPoints Number of vertices in batch.
+   */
+  void _calcFrictionBatch(scalar_array* friction,
+			  const PylithScalar t,
+			  const scalar_array& slip,
+			  const scalar_array& slipRate,
+			  const scalar_array& tractionTpdt,
+			  const int_array& points,
+			  const int numPoints);
+
   /** Constrain solution space in 1-D.
    *
    * @param dLagrangeTpdt Adjustment to Lagrange multiplier.
    * @param t Current time.
+   * @param point Fault vertex assoc. w/Lagrange multiplier vertex.
    * @param slip Slip assoc. w/Lagrange multiplier vertex.
    * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param frictionStress Friction for slip, slip rate, and traction.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
    */
   void _constrainSolnSpace1D(scalar_array* dLagrangeTpdt,
 			     const PylithScalar t,
+			     const int point,
 			     const scalar_array& slip,
 			     const scalar_array& slipRate,
 			     const scalar_array& tractionTpdt,
+			     const PylithScalar frictionStress,
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
@@ -250,17 +283,21 @@ private :
    *
    * @param dLagrangeTpdt Adjustment to Lagrange multiplier.
    * @param t Current time.
+   * @param point Fault vertex assoc. w/Lagrange multiplier vertex.
    * @param slip Slip assoc. w/Lagrange multiplier vertex.
    * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param frictionStress Friction for slip, slip rate, and traction.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
    */
   void _constrainSolnSpace2D(scalar_array* dLagrangeTpdt,
 			     const PylithScalar t,
+			     const int point,
 			     const scalar_array& slip,
 			     const scalar_array& slipRate,
 			     const scalar_array& tractionTpdt,
+			     const PylithScalar frictionStress,
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
@@ -268,17 +305,21 @@ private :
    *
    * @param dLagrangeTpdt Adjustment to Lagrange multiplier.
    * @param t Current time.
+   * @param point Fault vertex assoc. w/Lagrange multiplier vertex.
    * @param slip Slip assoc. w/Lagrange multiplier vertex.
    * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param frictionStress Friction for slip, slip rate, and traction.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
    */
   void _constrainSolnSpace3D(scalar_array* dLagrangeTpdt,
 			     const PylithScalar t,
+			     const int point,
 			     const scalar_array& slip,
 			     const scalar_array& slipRate,
 			     const scalar_array& tractionTpdt,
+			     const PylithScalar frictionStress,
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
@@ -247,6 +247,9 @@ pylith::faults::FaultCohesiveKin::vertexField(const char* name,
     _calcTractionsChange(&buffer, dispT);
     PYLITH_METHOD_RETURN(buffer);
 
+  } else if (_ruptureMetricsField(name)) {
+    PYLITH_METHOD_RETURN(*_ruptureMetricsField(name));
+
   } else {
     std::ostringstream msg;
     msg << "Request for unknown vertex field '" << name << "' for fault '"
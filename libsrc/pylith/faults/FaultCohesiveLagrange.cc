@@ -49,6 +49,7 @@
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <fstream> // USES std::ofstream
 
 #include <iostream>
 
@@ -57,7 +58,14 @@
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
-    _cohesiveIS(0)
+    _cohesiveIS(0),
+    _ruptureSlipRateThreshold(1.0e-3),
+    _ruptureShearModulus(3.0e+10),
+    _ruptureArea(0.0),
+    _potency(0.0),
+    _momentRate(0.0),
+    _ruptureMetricsFilename(""),
+    _ruptureMetrics(false)
 { // constructor
     _useLagrangeConstraints = true;
 } // constructor
@@ -155,9 +163,100 @@ pylith::faults::FaultCohesiveLagrange::initialize(const topology::Mesh& mesh,
     // Compute tributary area for each vertex in fault mesh.
     _calcArea();
 
+    if (_ruptureMetrics) {
+        _initializeRuptureMetrics();
+    } // if
+
     PYLITH_METHOD_END;
 } // initialize
 
+// ----------------------------------------------------------------------
+// Turn on/off accumulation of rupture metrics.
+void
+pylith::faults::FaultCohesiveLagrange::ruptureMetrics(const bool value)
+{ // ruptureMetrics
+    _ruptureMetrics = value;
+} // ruptureMetrics
+
+// ----------------------------------------------------------------------
+// Set slip rate threshold for rupture time.
+void
+pylith::faults::FaultCohesiveLagrange::ruptureSlipRateThreshold(const PylithScalar value)
+{ // ruptureSlipRateThreshold
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Slip rate threshold (" << value << ") for rupture time for "
+            << "fault " << label() << " must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _ruptureSlipRateThreshold = value;
+} // ruptureSlipRateThreshold
+
+// ----------------------------------------------------------------------
+// Set shear modulus for computing moment rate from potency rate.
+void
+pylith::faults::FaultCohesiveLagrange::ruptureShearModulus(const PylithScalar value)
+{ // ruptureShearModulus
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Shear modulus (" << value << ") for moment rate for "
+            << "fault " << label() << " must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _ruptureShearModulus = value;
+} // ruptureShearModulus
+
+// ----------------------------------------------------------------------
+// Set name of file for time history of global rupture metrics.
+void
+pylith::faults::FaultCohesiveLagrange::ruptureMetricsFilename(const char* filename)
+{ // ruptureMetricsFilename
+    _ruptureMetricsFilename = (filename) ? filename : "";
+} // ruptureMetricsFilename
+
+// ----------------------------------------------------------------------
+// Get area of fault that has ruptured.
+PylithScalar
+pylith::faults::FaultCohesiveLagrange::ruptureArea(void) const
+{ // ruptureArea
+    return _ruptureArea;
+} // ruptureArea
+
+// ----------------------------------------------------------------------
+// Get potency.
+PylithScalar
+pylith::faults::FaultCohesiveLagrange::potency(void) const
+{ // potency
+    return _potency;
+} // potency
+
+// ----------------------------------------------------------------------
+// Get moment rate.
+PylithScalar
+pylith::faults::FaultCohesiveLagrange::momentRate(void) const
+{ // momentRate
+    return _momentRate;
+} // momentRate
+
+// ----------------------------------------------------------------------
+// Update state variables as needed.
+void
+pylith::faults::FaultCohesiveLagrange::updateStateVars(const PylithScalar t,
+                                                       topology::SolutionFields* const fields)
+{ // updateStateVars
+    PYLITH_METHOD_BEGIN;
+
+    if (_ruptureMetrics) {
+        assert(fields);
+        // Solution has been advanced to t+dt.
+        _updateRuptureMetrics(t+_dt, *fields);
+    } // if
+
+    PYLITH_METHOD_END;
+} // updateStateVars
+
 // ----------------------------------------------------------------------
 void
 pylith::faults::FaultCohesiveLagrange::setupSolnDof(topology::Field* field)
@@ -404,8 +503,11 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
         indicesRel[i] = i;
     } // for
 
-    // Get sparse matrix
-    const PetscMat jacobianMatrix = jacobian->matrix(); assert(jacobianMatrix);
+    // Get sparse matrix. A matrix-free Jacobian applies the constraint
+    // terms in integrateJacobianAction() and keeps only the diagonal
+    // blocks, which calcPreconditioner() sets after assembly.
+    const PetscMat jacobianMatrix = jacobian->assembledMatrix(); assert(jacobianMatrix);
+    const bool isMatrixFree = jacobian->isMatrixFree();
 
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
@@ -459,35 +561,37 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
         _logger->eventBegin(updateEvent);
 #endif
 
-        // Set diagonal entries of Jacobian at positive vertex to area
-        // associated with vertex.
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            jacobianVertex[iDim*spaceDim+iDim] = areaArray[aoff];
-
-        // Values at positive vertex, entry L,P in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesP.size(), &indicesP[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at positive vertex, entry P,L in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesP.size(), &indicesP[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at negative vertex, entry L,N in Jacobian
-        jacobianVertex *= -1.0;
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesN.size(), &indicesN[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at negative vertex, entry N,L in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesN.size(), &indicesN[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+        if (!isMatrixFree) {
+            // Set diagonal entries of Jacobian at positive vertex to area
+            // associated with vertex.
+            for (int iDim=0; iDim < spaceDim; ++iDim)
+                jacobianVertex[iDim*spaceDim+iDim] = areaArray[aoff];
+
+            // Values at positive vertex, entry L,P in Jacobian
+            err = MatSetValues(jacobianMatrix,
+                               indicesL.size(), &indicesL[0],
+                               indicesP.size(), &indicesP[0],
+                               &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+
+            // Values at positive vertex, entry P,L in Jacobian
+            err = MatSetValues(jacobianMatrix,
+                               indicesP.size(), &indicesP[0],
+                               indicesL.size(), &indicesL[0],
+                               &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+
+            // Values at negative vertex, entry L,N in Jacobian
+            jacobianVertex *= -1.0;
+            err = MatSetValues(jacobianMatrix,
+                               indicesL.size(), &indicesL[0],
+                               indicesN.size(), &indicesN[0],
+                               &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+
+            // Values at negative vertex, entry N,L in Jacobian
+            err = MatSetValues(jacobianMatrix,
+                               indicesN.size(), &indicesN[0],
+                               indicesL.size(), &indicesL[0],
+                               &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+        } // if
 
         // Values at Lagrange vertex, entry L,L in Jacobian
         // We must have entries on the diagonal.
@@ -594,6 +698,75 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
     PYLITH_METHOD_END;
 } // integrateJacobian
 
+// ----------------------------------------------------------------------
+// Integrate action of Jacobian matrix (A) on a vector.
+void
+pylith::faults::FaultCohesiveLagrange::integrateJacobianAction(PetscScalar* actionArray,
+                                                               const PetscScalar* inputArray,
+                                                               topology::SolutionFields* const fields)
+{ // integrateJacobianAction
+    PYLITH_METHOD_BEGIN;
+
+    assert(actionArray);
+    assert(inputArray);
+    assert(fields);
+    assert(_fields);
+
+    // Same entries as integrateJacobian(), applied to the input:
+    //
+    // DOF P: area * x_L
+    // DOF N: -area * x_L
+    // DOF L: area * (x_P - x_N)
+
+    const int spaceDim = _quadrature->spaceDim();
+
+    topology::Field& area = _fields->get("area");
+    topology::VecVisitorMesh areaVisitor(area);
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    PetscSection solnSection = fields->solution().localSection(); assert(solnSection);
+    PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
+
+    PetscErrorCode err = 0;
+    const int numVertices = _cohesiveVertices.size();
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+        if (e_lagrange < 0) { // Skip clamped edges.
+            continue;
+        } // if
+
+        // Compute contribution only if Lagrange constraint is local.
+        PetscInt gloff = 0;
+        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
+        if (gloff < 0) {
+            continue;
+        } // if
+
+        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+        assert(1 == areaVisitor.sectionDof(v_fault));
+        const PylithScalar areaValue = areaArray[aoff];
+
+        PetscInt loff = 0, noff = 0, poff = 0;
+        err = PetscSectionGetOffset(solnSection, e_lagrange, &loff); PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(solnSection, v_negative, &noff); PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(solnSection, v_positive, &poff); PYLITH_CHECK_ERROR(err);
+
+        for (int d=0; d < spaceDim; ++d) {
+            const PylithScalar valueL = areaValue * inputArray[loff+d];
+            actionArray[poff+d] += valueL;
+            actionArray[noff+d] -= valueL;
+            actionArray[loff+d] += areaValue * (inputArray[poff+d] - inputArray[noff+d]);
+        } // for
+    } // for
+    PetscLogFlops(numVertices*spaceDim*5);
+
+    PYLITH_METHOD_END;
+} // integrateJacobianAction
+
 // ----------------------------------------------------------------------
 // Integrate contributions to Jacobian matrix (A) associated with
 // operator.
@@ -624,6 +797,15 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
      *
      * Because we use quadrature points located at the vertices,
      * L_{ii} = area, L_{ij} = 0 if i != j
+     *
+     * If the preconditioning matrix has a block size of spaceDim (or
+     * is the point-block diagonal matrix of a matrix-free Jacobian), we
+     * use the spaceDim x spaceDim blocks of Kn and Kp at each vertex
+     * instead of the diagonals. This captures the coupling among the
+     * components, which matters for faults that are not aligned with
+     * the coordinate axes and for heterogeneous stiffness.
+     *
+     * Pmat_block = -area^2 (Kn_block^{-1} + Kp_block^{-1})
      */
 
     const int setupEvent = _logger->eventId("FaPr setup");
@@ -641,9 +823,9 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     // Allocate vectors for vertex values
     scalar_array jacobianVertexP(spaceDim*spaceDim);
     scalar_array jacobianVertexN(spaceDim*spaceDim);
-    scalar_array jacobianInvVertexP(spaceDim);
-    scalar_array jacobianInvVertexN(spaceDim);
-    scalar_array precondVertexL(spaceDim);
+    scalar_array jacobianInvVertexP(spaceDim*spaceDim);
+    scalar_array jacobianInvVertexN(spaceDim*spaceDim);
+    scalar_array precondVertexL(spaceDim*spaceDim);
     int_array indicesN(spaceDim);
     int_array indicesP(spaceDim);
     int_array indicesRel(spaceDim);
@@ -658,9 +840,20 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
 
     PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
 
-    PetscDM lagrangeDM = fields->solution().subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
+    // The assembled matrix of a matrix-free Jacobian holds the point
+    // blocks of the whole system in the solution numbering; a custom
+    // preconditioner holds only the Lagrange multipliers.
+    const bool isPointBlockPC = jacobian->isMatrixFree() && *precondMatrix == jacobian->assembledMatrix();
     PetscSection lagrangeGlobalSection = NULL;
-    PetscErrorCode err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = 0;
+    if (!isPointBlockPC) {
+        PetscDM lagrangeDM = fields->solution().subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
+        err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscInt blockSize = 1;
+    err = MatGetBlockSize(*precondMatrix, &blockSize); PYLITH_CHECK_ERROR(err);
+    const bool useBlocks = spaceDim > 1 && (blockSize == spaceDim || isPointBlockPC);
 
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
@@ -716,19 +909,26 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
         _logger->eventBegin(computeEvent);
 #endif
 
-        // Compute inverse of Jacobian diagonals
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            jacobianInvVertexN[iDim] = 1.0/jacobianVertexN[iDim*spaceDim+iDim];
-            jacobianInvVertexP[iDim] = 1.0/jacobianVertexP[iDim*spaceDim+iDim];
-        } // for
+        if (useBlocks) {
+            // Compute inverse of Jacobian blocks
+            _invertBlock(&jacobianInvVertexN, jacobianVertexN, spaceDim);
+            _invertBlock(&jacobianInvVertexP, jacobianVertexP, spaceDim);
+        } else {
+            // Compute inverse of Jacobian diagonals
+            jacobianInvVertexN = 0.0;
+            jacobianInvVertexP = 0.0;
+            for (int iDim=0; iDim < spaceDim; ++iDim) {
+                jacobianInvVertexN[iDim*spaceDim+iDim] = 1.0/jacobianVertexN[iDim*spaceDim+iDim];
+                jacobianInvVertexP[iDim*spaceDim+iDim] = 1.0/jacobianVertexP[iDim*spaceDim+iDim];
+            } // for
+        } // if/else
 
-        // Compute -[L] [Adiag]^(-1) [L]^T
+        // Compute -[L] [A]^(-1) [L]^T
         //   L_{ii} = L^T{ii} = areaVertex
-        //   Adiag^{-1}_{ii} = jacobianInvVertexN[i] + jacobianInvVertexP[i]
-        precondVertexL = 0.0;
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            precondVertexL[iDim] -= areaArray[aoff] * areaArray[aoff] *
-                                    (jacobianInvVertexN[iDim] + jacobianInvVertexP[iDim]);
+        //   A^{-1} = jacobianInvVertexN + jacobianInvVertexP
+        const PylithScalar areaSquared = areaArray[aoff] * areaArray[aoff];
+        for (int i=0; i < spaceDim*spaceDim; ++i) {
+            precondVertexL[i] = -areaSquared * (jacobianInvVertexN[i] + jacobianInvVertexP[i]);
         } // for
 
 
@@ -738,17 +938,26 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
 #endif
 
         // Set diagonal entries in preconditioned matrix.
-        PetscInt poff = 0;
-        err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &poff); PYLITH_CHECK_ERROR(err);
+        PetscInt poff = gloff;
+        if (!isPointBlockPC) {
+            err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &poff); PYLITH_CHECK_ERROR(err);
+        } // if
 
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            err = MatSetValue(*precondMatrix, poff+iDim, poff+iDim, precondVertexL[iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
-        } // for
+        if (useBlocks) {
+            indicesN = indicesRel + poff;
+            err = MatSetValues(*precondMatrix,
+                               indicesN.size(), &indicesN[0], indicesN.size(), &indicesN[0],
+                               &precondVertexL[0], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+        } else {
+            for (int iDim=0; iDim < spaceDim; ++iDim) {
+                err = MatSetValue(*precondMatrix, poff+iDim, poff+iDim, precondVertexL[iDim*spaceDim+iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+            } // for
+        } // if/else
 
 #if 0 // DEBUGGING
         std::cout << "1/P_vertex " << e_lagrange << ", poff: " << poff << std::endl;
         for(int iDim = 0; iDim < spaceDim; ++iDim) {
-            std::cout << "  " << precondVertexL[iDim] << std::endl;
+            std::cout << "  " << precondVertexL[iDim*spaceDim+iDim] << std::endl;
         } // for
 #endif
 
@@ -758,7 +967,7 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
 #endif
     } // for
     err = MatDestroy(&jacobianNP); PYLITH_CHECK_ERROR(err);
-    PetscLogFlops(numVertices*spaceDim*6);
+    PetscLogFlops(numVertices*spaceDim*(useBlocks ? 9*spaceDim+6 : 6));
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -767,6 +976,63 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     PYLITH_METHOD_END;
 } // calcPreconditioner
 
+// ----------------------------------------------------------------------
+// Invert small dense block of Jacobian at a vertex.
+void
+pylith::faults::FaultCohesiveLagrange::_invertBlock(scalar_array* inverse,
+                                                    const scalar_array& block,
+                                                    const int size)
+{ // _invertBlock
+    assert(inverse);
+    assert(size*size == int(block.size()));
+    assert(size*size == int(inverse->size()));
+
+    PylithScalar det = 0.0;
+    switch (size) {
+    case 1:
+        det = block[0];
+        break;
+    case 2:
+        det = block[0]*block[3] - block[1]*block[2];
+        break;
+    case 3:
+        det = block[0]*(block[4]*block[8] - block[5]*block[7]) -
+              block[1]*(block[3]*block[8] - block[5]*block[6]) +
+              block[2]*(block[3]*block[7] - block[4]*block[6]);
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown size for block in FaultCohesiveLagrange::_invertBlock().");
+    } // switch
+    if (0.0 == det) {
+        throw std::runtime_error("Singular block of Jacobian at fault vertex in custom preconditioner for Lagrange constraints.");
+    } // if
+
+    scalar_array& inv = *inverse;
+    switch (size) {
+    case 1:
+        inv[0] = 1.0 / det;
+        break;
+    case 2:
+        inv[0] = block[3] / det;
+        inv[1] = -block[1] / det;
+        inv[2] = -block[2] / det;
+        inv[3] = block[0] / det;
+        break;
+    case 3:
+        inv[0] = (block[4]*block[8] - block[5]*block[7]) / det;
+        inv[1] = (block[2]*block[7] - block[1]*block[8]) / det;
+        inv[2] = (block[1]*block[5] - block[2]*block[4]) / det;
+        inv[3] = (block[5]*block[6] - block[3]*block[8]) / det;
+        inv[4] = (block[0]*block[8] - block[2]*block[6]) / det;
+        inv[5] = (block[2]*block[3] - block[0]*block[5]) / det;
+        inv[6] = (block[3]*block[7] - block[4]*block[6]) / det;
+        inv[7] = (block[1]*block[6] - block[0]*block[7]) / det;
+        inv[8] = (block[0]*block[4] - block[1]*block[3]) / det;
+        break;
+    } // switch
+} // _invertBlock
+
 // ----------------------------------------------------------------------
 // Adjust solution from solver with lumped Jacobian to match Lagrange
 // multiplier constraints.
@@ -1825,6 +2091,244 @@ pylith::faults::FaultCohesiveLagrange::_calcTractionsChange(topology::Field* tra
     PYLITH_METHOD_END;
 } // _calcTractionsChange
 
+// ----------------------------------------------------------------------
+// Allocate fields for rupture metrics.
+void
+pylith::faults::FaultCohesiveLagrange::_initializeRuptureMetrics(void)
+{ // _initializeRuptureMetrics
+    PYLITH_METHOD_BEGIN;
+
+    assert(_faultMesh);
+    assert(_fields);
+    assert(_normalizer);
+
+    const PylithScalar lengthScale = _normalizer->lengthScale();
+    const PylithScalar timeScale = _normalizer->timeScale();
+
+    // Relative displacement at previous time step.
+    const topology::Field& dispRel = _fields->get("relative disp");
+    _fields->add("relative disp (t-dt)", "relative_disp_tmdt");
+    topology::Field& dispRelPrev = _fields->get("relative disp (t-dt)");
+    dispRelPrev.cloneSection(dispRel);
+    dispRelPrev.zeroAll();
+
+    // Scalar fields use same layout as area field.
+    const topology::Field& area = _fields->get("area");
+    const int numMetrics = 4;
+    const char* names[numMetrics] = {
+        "rupture time",
+        "peak slip rate",
+        "peak slip rate time",
+        "cumulative slip",
+    };
+    const char* labels[numMetrics] = {
+        "rupture_time",
+        "peak_slip_rate",
+        "peak_slip_rate_time",
+        "cumulative_slip",
+    };
+    const PylithScalar scales[numMetrics] = {
+        timeScale,
+        lengthScale / timeScale,
+        timeScale,
+        lengthScale,
+    };
+    for (int i=0; i < numMetrics; ++i) {
+        _fields->add(names[i], labels[i]);
+        topology::Field& metric = _fields->get(names[i]);
+        metric.cloneSection(area);
+        metric.vectorFieldType(topology::FieldBase::SCALAR);
+        metric.scale(scales[i]);
+        metric.zeroAll();
+    } // for
+
+    // Negative rupture time denotes vertices that have not ruptured.
+    topology::Field& ruptureTime = _fields->get("rupture time");
+    PetscErrorCode err = VecSet(ruptureTime.localVector(), -1.0); PYLITH_CHECK_ERROR(err);
+
+    _ruptureArea = 0.0;
+    _potency = 0.0;
+    _momentRate = 0.0;
+
+    if (_ruptureMetricsFilename.length() > 0 && 0 == _faultMesh->commRank()) {
+        std::ofstream fileout(_ruptureMetricsFilename.c_str());
+        if (!fileout.is_open() || !fileout.good()) {
+            std::ostringstream msg;
+            msg << "Could not open file '" << _ruptureMetricsFilename << "' for rupture metrics of fault '" << label() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        fileout << "# time rupture_area potency moment_rate\n";
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initializeRuptureMetrics
+
+// ----------------------------------------------------------------------
+// Update rupture metrics using the current relative displacement.
+void
+pylith::faults::FaultCohesiveLagrange::_updateRuptureMetrics(const PylithScalar t,
+                                                             const topology::SolutionFields& fields)
+{ // _updateRuptureMetrics
+    PYLITH_METHOD_BEGIN;
+
+    assert(_faultMesh);
+    assert(_fields);
+    assert(_normalizer);
+
+    const int spaceDim = _quadrature->spaceDim();
+    const PylithScalar lengthScale = _normalizer->lengthScale();
+    const PylithScalar timeScale = _normalizer->timeScale();
+    const PylithScalar slipRateThreshold = _ruptureSlipRateThreshold / (lengthScale / timeScale);
+
+    // Get fields.
+    topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
+    const PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+    topology::VecVisitorMesh dispRelPrevVisitor(_fields->get("relative disp (t-dt)"));
+    PetscScalar* dispRelPrevArray = dispRelPrevVisitor.localArray();
+
+    topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
+    const PetscScalar* orientationArray = orientationVisitor.localArray();
+
+    topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    topology::VecVisitorMesh ruptureTimeVisitor(_fields->get("rupture time"));
+    PetscScalar* ruptureTimeArray = ruptureTimeVisitor.localArray();
+
+    topology::VecVisitorMesh peakRateVisitor(_fields->get("peak slip rate"));
+    PetscScalar* peakRateArray = peakRateVisitor.localArray();
+
+    topology::VecVisitorMesh peakRateTimeVisitor(_fields->get("peak slip rate time"));
+    PetscScalar* peakRateTimeArray = peakRateTimeVisitor.localArray();
+
+    topology::VecVisitorMesh cumSlipVisitor(_fields->get("cumulative slip"));
+    PetscScalar* cumSlipArray = cumSlipVisitor.localArray();
+
+    PetscSection solnGlobalSection = fields.solution().globalSection(); assert(solnGlobalSection);
+
+    // Sums over local vertices [rupture area, potency, potency rate].
+    PylithScalar sumsLocal[3] = { 0.0, 0.0, 0.0 };
+
+    const int numVertices = _cohesiveVertices.size();
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+
+        if (e_lagrange < 0) { // Skip clamped edges.
+            continue;
+        } // if
+
+        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+
+        const PetscInt dpoff = dispRelPrevVisitor.sectionOffset(v_fault);
+        assert(spaceDim == dispRelPrevVisitor.sectionDof(v_fault));
+
+        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
+
+        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+        assert(1 == areaVisitor.sectionDof(v_fault));
+
+        const PetscInt rtoff = ruptureTimeVisitor.sectionOffset(v_fault);
+        const PetscInt proff = peakRateVisitor.sectionOffset(v_fault);
+        const PetscInt ptoff = peakRateTimeVisitor.sectionOffset(v_fault);
+        const PetscInt csoff = cumSlipVisitor.sectionOffset(v_fault);
+
+        // Remove fault opening using normal direction (last row of
+        // orientation).
+        const PetscScalar* normalDir = &orientationArray[ooff+(spaceDim-1)*spaceDim];
+        PylithScalar slipNormal = 0.0;
+        PylithScalar slipIncrNormal = 0.0;
+        for (int d=0; d < spaceDim; ++d) {
+            slipNormal += dispRelArray[droff+d] * normalDir[d];
+            slipIncrNormal += (dispRelArray[droff+d] - dispRelPrevArray[dpoff+d]) * normalDir[d];
+        } // for
+        PylithScalar slipShear2 = 0.0;
+        PylithScalar slipIncrShear2 = 0.0;
+        for (int d=0; d < spaceDim; ++d) {
+            const PylithScalar slipShear = dispRelArray[droff+d] - slipNormal*normalDir[d];
+            const PylithScalar slipIncrShear = dispRelArray[droff+d] - dispRelPrevArray[dpoff+d] - slipIncrNormal*normalDir[d];
+            slipShear2 += slipShear*slipShear;
+            slipIncrShear2 += slipIncrShear*slipIncrShear;
+            dispRelPrevArray[dpoff+d] = dispRelArray[droff+d];
+        } // for
+        const PylithScalar slipShearMag = sqrt(slipShear2);
+        const PylithScalar slipIncrShearMag = sqrt(slipIncrShear2);
+        const PylithScalar slipRate = (_dt > 0.0) ? slipIncrShearMag / _dt : 0.0;
+
+        cumSlipArray[csoff] += slipIncrShearMag;
+        if (slipRate > peakRateArray[proff]) {
+            peakRateArray[proff] = slipRate;
+            peakRateTimeArray[ptoff] = t;
+        } // if
+        if (ruptureTimeArray[rtoff] < 0.0 && slipRate >= slipRateThreshold) {
+            ruptureTimeArray[rtoff] = t;
+        } // if
+
+        // Include vertex in global sums only if Lagrange constraint is local.
+        PetscInt goff = 0;
+        PetscErrorCode err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
+        if (goff < 0)
+            continue;
+
+        const PylithScalar areaVertex = areaArray[aoff];
+        if (ruptureTimeArray[rtoff] >= 0.0) {
+            sumsLocal[0] += areaVertex;
+        } // if
+        sumsLocal[1] += areaVertex * slipShearMag;
+        sumsLocal[2] += areaVertex * slipRate;
+    } // for
+    PetscLogFlops(numVertices*(3 + spaceDim*13));
+
+    PylithScalar sums[3] = { 0.0, 0.0, 0.0 };
+    PetscErrorCode err = MPI_Allreduce(sumsLocal, sums, 3, MPIU_SCALAR, MPI_SUM, _faultMesh->comm()); PYLITH_CHECK_ERROR(err);
+
+    const PylithScalar areaScale = pow(lengthScale, spaceDim-1);
+    const PylithScalar potencyScale = pow(lengthScale, spaceDim);
+    _ruptureArea = sums[0] * areaScale;
+    _potency = sums[1] * potencyScale;
+    _momentRate = _ruptureShearModulus * sums[2] * potencyScale / timeScale;
+
+    if (_ruptureMetricsFilename.length() > 0 && 0 == _faultMesh->commRank()) {
+        std::ofstream fileout(_ruptureMetricsFilename.c_str(), std::ios::app);
+        if (!fileout.is_open() || !fileout.good()) {
+            std::ostringstream msg;
+            msg << "Could not open file '" << _ruptureMetricsFilename << "' for rupture metrics of fault '" << label() << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        fileout << t*timeScale << " " << _ruptureArea << " " << _potency << " " << _momentRate << "\n";
+    } // if
+
+    PYLITH_METHOD_END;
+} // _updateRuptureMetrics
+
+// ----------------------------------------------------------------------
+// Get vertex field for rupture metrics.
+const pylith::topology::Field*
+pylith::faults::FaultCohesiveLagrange::_ruptureMetricsField(const char* name)
+{ // _ruptureMetricsField
+    PYLITH_METHOD_BEGIN;
+
+    if (!_ruptureMetrics) {
+        PYLITH_METHOD_RETURN(0);
+    } // if
+    assert(_fields);
+
+    if (0 == strcasecmp("rupture_time", name)) {
+        PYLITH_METHOD_RETURN(&_fields->get("rupture time"));
+    } else if (0 == strcasecmp("peak_slip_rate", name)) {
+        PYLITH_METHOD_RETURN(&_fields->get("peak slip rate"));
+    } else if (0 == strcasecmp("peak_slip_rate_time", name)) {
+        PYLITH_METHOD_RETURN(&_fields->get("peak slip rate time"));
+    } else if (0 == strcasecmp("cumulative_slip", name)) {
+        PYLITH_METHOD_RETURN(&_fields->get("cumulative slip"));
+    } // if/else
+
+    PYLITH_METHOD_RETURN(0);
+} // _ruptureMetricsField
+
 // ----------------------------------------------------------------------
 // Allocate buffer for vector field.
 void
@@ -1893,8 +2397,8 @@ pylith::faults::FaultCohesiveLagrange::_getJacobianSubmatrixNP(PetscMat* jacobia
 
     PetscErrorCode err;
 
-    // Get Jacobian matrix
-    const PetscMat jacobianMatrix = jacobian.matrix();
+    // Get Jacobian matrix (point-block diagonal if matrix-free)
+    const PetscMat jacobianMatrix = jacobian.assembledMatrix();
     assert(jacobianMatrix);
 
     const spatialdata::geocoords::CoordSys* cs = fields.mesh().coordsys(); assert(cs);
@@ -119,6 +119,59 @@ public :
   virtual
   void setupSolnDof(topology::Field* field);
 
+  /** Turn on/off accumulation of rupture metrics (rupture time, peak
+   * slip rate and its time, cumulative slip) at fault vertices and
+   * global rupture area, potency, and moment rate.
+   *
+   * @param value True if rupture metrics should be computed.
+   */
+  void ruptureMetrics(const bool value);
+
+  /** Set slip rate threshold for rupture time.
+   *
+   * @param value Slip rate threshold (dimensional).
+   */
+  void ruptureSlipRateThreshold(const PylithScalar value);
+
+  /** Set shear modulus for computing moment rate from potency rate.
+   *
+   * @param value Shear modulus (dimensional).
+   */
+  void ruptureShearModulus(const PylithScalar value);
+
+  /** Set name of file for time history of global rupture metrics.
+   *
+   * @param filename Name of file (empty for no file).
+   */
+  void ruptureMetricsFilename(const char* filename);
+
+  /** Get area of fault that has ruptured.
+   *
+   * @returns Rupture area (dimensional).
+   */
+  PylithScalar ruptureArea(void) const;
+
+  /** Get potency (integral of shear slip magnitude over the fault).
+   *
+   * @returns Potency (dimensional).
+   */
+  PylithScalar potency(void) const;
+
+  /** Get moment rate.
+   *
+   * @returns Moment rate (dimensional).
+   */
+  PylithScalar momentRate(void) const;
+
+  /** Update state variables as needed.
+   *
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  virtual
+  void updateStateVars(const PylithScalar t,
+		       topology::SolutionFields* const fields);
+
   /** Integrate contributions to residual term (r) for operator that
    * require assembly processors.
    *
@@ -155,6 +208,18 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Integrate action of Jacobian matrix (A) on a vector, applying
+   * the constraint terms L u and L^T l without assembling them.
+   *
+   * @param actionArray Local array (solution layout) for y += A x.
+   * @param inputArray Local array (solution layout) for x.
+   * @param fields Solution fields
+   */
+  virtual
+  void integrateJacobianAction(PetscScalar* actionArray,
+			       const PetscScalar* inputArray,
+			       topology::SolutionFields* const fields);
+
   /** Compute custom fault precoditioner using Schur complement.
    *
    * We have J = [A C^T]
@@ -162,6 +227,10 @@ public :
    *
    * We approximate C A^(-1) C^T.
    *
+   * If precondMatrix is the assembled matrix of a matrix-free
+   * Jacobian, the approximation is inserted into the diagonal blocks
+   * of the Lagrange multipliers in the global (solution) numbering.
+   *
    * @param pc PETSc preconditioner structure.
    * @param jacobian Sparse matrix for Jacobian of system.
    * @param fields Solution fields
@@ -267,6 +336,24 @@ protected :
   void _calcTractionsChange(topology::Field* tractions,
 			    const topology::Field& solution);
 
+  /// Allocate fields for rupture metrics.
+  void _initializeRuptureMetrics(void);
+
+  /** Update rupture metrics using the current relative displacement.
+   *
+   * @param t Time associated with current relative displacement.
+   * @param fields Solution fields.
+   */
+  void _updateRuptureMetrics(const PylithScalar t,
+			     const topology::SolutionFields& fields);
+
+  /** Get vertex field for rupture metrics.
+   *
+   * @param name Name of field.
+   * @returns Vertex field or 0 if name is not a rupture metric.
+   */
+  const topology::Field* _ruptureMetricsField(const char* name);
+
   /// Allocate buffer for vector field.
   void _allocateBufferVectorField(void);
 
@@ -289,6 +376,17 @@ protected :
 			       const topology::Jacobian& jacobian,
 			       const topology::SolutionFields& fields);
 
+  /** Invert small dense block of Jacobian at a vertex.
+   *
+   * @param inverse Inverse of block (row major) [size*size].
+   * @param block Block of Jacobian (row major) [size*size].
+   * @param size Size of block (1, 2, or 3).
+   */
+  static
+  void _invertBlock(scalar_array* inverse,
+		    const scalar_array& block,
+		    const int size);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -317,6 +415,14 @@ protected :
 
   topology::StratumIS* _cohesiveIS; ///< Index set of cohesive cells.
 
+  PylithScalar _ruptureSlipRateThreshold; ///< Slip rate threshold for rupture time.
+  PylithScalar _ruptureShearModulus; ///< Shear modulus for moment rate.
+  PylithScalar _ruptureArea; ///< Global rupture area (dimensional).
+  PylithScalar _potency; ///< Global potency (dimensional).
+  PylithScalar _momentRate; ///< Global moment rate (dimensional).
+  std::string _ruptureMetricsFilename; ///< Name of file for global rupture metrics.
+  bool _ruptureMetrics; ///< True if computing rupture metrics.
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -23,12 +23,19 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
+
+#include <cmath> // USES sqrt()
+#include <cassert> // USES assert()
 
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::SlipTimeFn::SlipTimeFn(void) :
   _parameters(0)
 { // constructor
+  _cache.spaceDim = 0;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -47,6 +54,13 @@ pylith::faults::SlipTimeFn::deallocate(void)
 
   delete _parameters; _parameters = 0;
 
+  _cache.spaceDim = 0;
+  _cache.vertices.resize(0);
+  _cache.slipDir.resize(0);
+  _cache.slipMag.resize(0);
+  _cache.slipTime.resize(0);
+  _cache.riseTime.resize(0);
+
   PYLITH_METHOD_END;
 } // deallocate
   
@@ -58,5 +72,80 @@ pylith::faults::SlipTimeFn::parameterFields(void) const
   return _parameters;
 } // parameterFields
 
+// ----------------------------------------------------------------------
+// Cache parameters at fault vertices that are not clamped.
+void
+pylith::faults::SlipTimeFn::_cacheParameters(const topology::Field& slipVec,
+					     const topology::Field& slipTime,
+					     const topology::Field* riseTime)
+{ // _cacheParameters
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = slipVec.dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  PetscDMLabel clamped = NULL;
+  PetscErrorCode err = DMGetLabel(dmMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
+  int numVertices = 0;
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    if (!FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
+      ++numVertices;
+    } // if
+  } // for
+
+  topology::VecVisitorMesh slipVecVisitor(slipVec);
+  const PetscScalar* slipVecArray = slipVecVisitor.localArray();
+  topology::VecVisitorMesh slipTimeVisitor(slipTime);
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  const int spaceDim = slipVec.spaceDim();
+  _cache.spaceDim = spaceDim;
+  _cache.vertices.resize(numVertices);
+  _cache.slipDir.resize(numVertices*spaceDim);
+  _cache.slipMag.resize(numVertices);
+  _cache.slipTime.resize(numVertices);
+  _cache.riseTime.resize(riseTime ? numVertices : 0);
+
+  for (PetscInt v = vStart, iVertex = 0; v < vEnd; ++v) {
+    if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
+      continue;
+    } // if
+
+    const PetscInt svoff = slipVecVisitor.sectionOffset(v);
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    assert(spaceDim == slipVecVisitor.sectionDof(v));
+    assert(1 == slipTimeVisitor.sectionDof(v));
+
+    PylithScalar slipMag = 0.0;
+    for (int d = 0; d < spaceDim; ++d) {
+      slipMag += slipVecArray[svoff+d]*slipVecArray[svoff+d];
+    } // for
+    slipMag = sqrt(slipMag);
+    const PylithScalar scale = (slipMag > 0.0) ? 1.0 / slipMag : 0.0;
+
+    _cache.vertices[iVertex] = v;
+    for (int d = 0; d < spaceDim; ++d) {
+      _cache.slipDir[iVertex*spaceDim+d] = slipVecArray[svoff+d] * scale;
+    } // for
+    _cache.slipMag[iVertex] = slipMag;
+    _cache.slipTime[iVertex] = slipTimeArray[stoff];
+    ++iVertex;
+  } // for
+
+  if (riseTime) {
+    topology::VecVisitorMesh riseTimeVisitor(*riseTime);
+    const PetscScalar* riseTimeArray = riseTimeVisitor.localArray();
+    for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+      const PetscInt rtoff = riseTimeVisitor.sectionOffset(_cache.vertices[iVertex]);
+      assert(1 == riseTimeVisitor.sectionDof(_cache.vertices[iVertex]));
+      _cache.riseTime[iVertex] = riseTimeArray[rtoff];
+    } // for
+  } // if
+
+  PYLITH_METHOD_END;
+} // _cacheParameters
+
 
 // End of file 
@@ -31,6 +31,8 @@
 
 #include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
 
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array
+
 // SlipTimeFn -----------------------------------------------------------
 /**
  * @brief Abstract base class for kinematic slip time function.
@@ -95,10 +97,42 @@ public :
    */
   const topology::Fields* parameterFields(void) const;
 
+// PROTECTED STRUCTS ////////////////////////////////////////////////////
+protected :
+
+  /** Parameters of the slip time function at fault vertices that are
+   * not clamped, stored as contiguous arrays so slip can be computed
+   * with a linear sweep over the vertices.
+   */
+  struct ParamsCache {
+    int spaceDim; ///< Number of slip components per vertex.
+    int_array vertices; ///< Fault vertices that are not clamped.
+    scalar_array slipDir; ///< Unit direction of slip vector (spaceDim per vertex).
+    scalar_array slipMag; ///< Magnitude of slip vector.
+    scalar_array slipTime; ///< Time when slip begins.
+    scalar_array riseTime; ///< Rise time (empty if not used).
+  }; // ParamsCache
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Cache parameters at fault vertices that are not clamped. Called
+   * at the end of initialize().
+   *
+   * @param slipVec Field with slip vector (final slip, slip rate, or
+   * slip amplitude).
+   * @param slipTime Field with time when slip begins.
+   * @param riseTime Field with rise time (NULL if not used).
+   */
+  void _cacheParameters(const topology::Field& slipVec,
+			const topology::Field& slipTime,
+			const topology::Field* riseTime =0);
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
   topology::Fields* _parameters; ///< Parameters for slip time function.
+  ParamsCache _cache; ///< Parameters at vertices that are not clamped.
 
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
@@ -204,6 +204,11 @@ pylith::faults::StepSlipFn::initialize(const topology::Mesh& faultMesh,
   _dbFinalSlip->close();
   _dbSlipTime->close();
 
+  // Release arrays before caching parameters.
+  finalSlipVisitor.clear();
+  slipTimeVisitor.clear();
+  _cacheParameters(finalSlip, slipTime);
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -218,43 +223,26 @@ pylith::faults::StepSlipFn::slip(topology::Field* slip,
   assert(slip);
   assert(_parameters);
 
-  // Get vertices in fault mesh
-  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-
-  // Get sections
-  const topology::Field& finalSlip = _parameters->get("final slip");
-  topology::VecVisitorMesh finalSlipVisitor(finalSlip);
-  const PetscScalar* finalSlipArray = finalSlipVisitor.localArray();
-
-  const topology::Field& slipTime = _parameters->get("slip time");
-  topology::VecVisitorMesh slipTimeVisitor(slipTime);
-  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
-
   topology::VecVisitorMesh slipVisitor(*slip);
   PetscScalar* slipArray = slipVisitor.localArray();
 
-  const int spaceDim = _slipVertex.size();
-  for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
-    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
-    const PetscInt soff = slipVisitor.sectionOffset(v);
-
-    assert(spaceDim == finalSlipVisitor.sectionDof(v));
-    assert(1 == slipTimeVisitor.sectionDof(v));
-    assert(spaceDim == slipVisitor.sectionDof(v));
+  const int spaceDim = _cache.spaceDim;
+  const int numVertices = _cache.vertices.size();
+  for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+    const PetscInt soff = slipVisitor.sectionOffset(_cache.vertices[iVertex]);
+    assert(spaceDim == slipVisitor.sectionDof(_cache.vertices[iVertex]));
 
-    const PylithScalar relTime = t - slipTimeArray[stoff];
+    const PylithScalar relTime = t - _cache.slipTime[iVertex];
     if (relTime >= 0.0) {
-      for(PetscInt d = 0; d < spaceDim; ++d) {
-        slipArray[soff+d] += finalSlipArray[fsoff+d];
+      const PylithScalar* slipDir = &_cache.slipDir[iVertex*spaceDim];
+      const PylithScalar slipMag = _cache.slipMag[iVertex];
+      for (int d = 0; d < spaceDim; ++d) {
+        slipArray[soff+d] += slipDir[d] * slipMag;
       } // for
     } // if
   } // for
 
-  PetscLogFlops((vEnd-vStart) * 1);
+  PetscLogFlops(numVertices * (1 + 2*spaceDim));
 
   PYLITH_METHOD_END;
 } // slip
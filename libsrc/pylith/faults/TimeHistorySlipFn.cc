@@ -210,6 +210,11 @@ pylith::faults::TimeHistorySlipFn::initialize(const topology::Mesh& faultMesh,
   _dbAmplitude->close();
   _dbSlipTime->close();
 
+  // Release arrays before caching parameters.
+  slipAmplitudeVisitor.clear();
+  slipTimeVisitor.clear();
+  _cacheParameters(slipAmplitude, slipTime);
+
   // Open time history database.
   _dbTimeHistory->open();
   _timeScale = timeScale;
@@ -229,38 +234,19 @@ pylith::faults::TimeHistorySlipFn::slip(topology::Field* slip,
   assert(_parameters);
   assert(_dbTimeHistory);
 
-  // Get vertices in fault mesh
-  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-
-  // Get sections
-  const topology::Field& slipAmplitude = _parameters->get("slip amplitude");
-  topology::VecVisitorMesh slipAmplitudeVisitor(slipAmplitude);
-  const PetscScalar* slipAmplitudeArray = slipAmplitudeVisitor.localArray();
-
-  const topology::Field& slipTime = _parameters->get("slip time");
-  topology::VecVisitorMesh slipTimeVisitor(slipTime);
-  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
-
   topology::VecVisitorMesh slipVisitor(*slip);
   PetscScalar* slipArray = slipVisitor.localArray();
 
-  const int spaceDim = _slipVertex.size();
-  PylithScalar amplitude = 0.0;
-  for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt saoff = slipAmplitudeVisitor.sectionOffset(v);
-    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
-    const PetscInt soff = slipVisitor.sectionOffset(v);
-
-    assert(spaceDim == slipAmplitudeVisitor.sectionDof(v));
-    assert(1 == slipTimeVisitor.sectionDof(v));
-    assert(spaceDim == slipVisitor.sectionDof(v));
+  const int spaceDim = _cache.spaceDim;
+  const int numVertices = _cache.vertices.size();
+  for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+    const PetscInt soff = slipVisitor.sectionOffset(_cache.vertices[iVertex]);
+    assert(spaceDim == slipVisitor.sectionDof(_cache.vertices[iVertex]));
 
-    PylithScalar relTime = t - slipTimeArray[stoff];
+    PylithScalar relTime = t - _cache.slipTime[iVertex];
     if (relTime >= 0.0) {
       relTime *= _timeScale;
+      PylithScalar amplitude = 0.0;
       const int err = _dbTimeHistory->query(&amplitude, relTime);
       if (err) {
         std::ostringstream msg;
@@ -270,13 +256,15 @@ pylith::faults::TimeHistorySlipFn::slip(topology::Field* slip,
         throw std::runtime_error(msg.str());
       } // if
 
-      for(PetscInt d = 0; d < spaceDim; ++d) {
-        slipArray[soff+d] += slipAmplitudeArray[saoff+d] * amplitude;
+      const PylithScalar* slipDir = &_cache.slipDir[iVertex*spaceDim];
+      const PylithScalar slip = _cache.slipMag[iVertex] * amplitude;
+      for (int d = 0; d < spaceDim; ++d) {
+        slipArray[soff+d] += slipDir[d] * slip;
       } // for
-    } // else
+    } // if
   } // for
 
-  PetscLogFlops((vEnd-vStart) * 3);
+  PetscLogFlops(numVertices * (3 + 2*spaceDim));
 
   PYLITH_METHOD_END;
 } // slip
@@ -30,6 +30,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
@@ -56,6 +57,7 @@ pylith::feassemble::ElasticityExplicit::ElasticityExplicit(void) :
   _dtm1(-1.0),
   _normViscosity(0.1)
 { // constructor
+  _hasJacobianAction = false; // Jacobian must be assembled.
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -136,10 +138,6 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
 { // integrateResidual
   PYLITH_METHOD_BEGIN;
   
-  /// Member prototype for _elasticityResidualXD()
-  typedef void (pylith::feassemble::ElasticityExplicit::*elasticityResidual_fn_type)
-    (const scalar_array&);
-
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -177,23 +175,13 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
          "different than the spatial dimension of the "
          "domain not implemented yet.");
 
-  // Set variables dependent on dimension of cell
-  totalStrain_fn_type calcTotalStrainFn;
-  elasticityResidual_fn_type elasticityResidualFn;
-  if (2 == cellDim) {
-    elasticityResidualFn =
-      &pylith::feassemble::ElasticityExplicit::_elasticityResidual2D;
-    calcTotalStrainFn =
-      &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
-  } else if (3 == cellDim) {
-    elasticityResidualFn =
-      &pylith::feassemble::ElasticityExplicit::_elasticityResidual3D;
-    calcTotalStrainFn =
-      &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
-  } else {
+  // Kernels for cell type and quadrature scheme selected in initialize().
+  const totalStrain_fn_type calcTotalStrainFn = _calcTotalStrainFn;
+  const elasticityResidual_fn_type elasticityResidualFn = _elasticityResidualFn;
+  if (!calcTotalStrainFn || !elasticityResidualFn) {
     assert(0);
     throw std::runtime_error("Error unknown cell dimension.");
-  } // if/else
+  } // if
 
   // Allocate vectors for cell values.
   scalar_array strainCell(numQuadPts*tensorSize);
@@ -210,22 +198,19 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
   topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
-  accVisitor.optimizeClosure();
 
   scalar_array velCell(numBasis*spaceDim);
   topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
-  velVisitor.optimizeClosure();
 
   scalar_array dispCell(numBasis*spaceDim);
   scalar_array dispAdjCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
-  residualVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -251,7 +236,7 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(geometryEvent);
 #endif
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -271,9 +256,9 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
     _resetCellVector();
 
     // Restrict input fields to cell
-    accVisitor.getClosure(&accCell, cell);
-    velVisitor.getClosure(&velCell, cell);
-    dispVisitor.getClosure(&dispCell, cell);
+    _dispRestriction->gather(&accCell, accVisitor.localArray(), c);
+    _dispRestriction->gather(&velCell, velVisitor.localArray(), c);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(restrictEvent);
@@ -365,7 +350,7 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
 #endif
 
     // Assemble cell contribution into field
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], residualVisitor.localArray(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(updateEvent);
@@ -453,6 +438,7 @@ pylith::feassemble::ElasticityExplicit::integrateJacobian(topology::Field* jacob
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, jacobianVisitor.localSection());
 
   _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
@@ -466,7 +452,7 @@ pylith::feassemble::ElasticityExplicit::integrateJacobian(topology::Field* jacob
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(geometryEvent);
 #endif
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -519,7 +505,7 @@ pylith::feassemble::ElasticityExplicit::integrateJacobian(topology::Field* jacob
 #endif
     
     // Assemble cell contribution into lumped matrix.
-    jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], jacobianVisitor.localArray(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(updateEvent);
@@ -30,6 +30,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
@@ -53,6 +54,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::ElasticityExplicitLgDeform(void)
   _dtm1(-1.0),
   _normViscosity(0.1)
 { // constructor
+  _hasJacobianAction = false; // Jacobian must be assembled.
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -131,10 +133,6 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
 { // integrateResidualLumped
   PYLITH_METHOD_BEGIN;
   
-  /// Member prototype for _elasticityResidualXD()
-  typedef void (pylith::feassemble::ElasticityExplicitLgDeform::*elasticityResidual_fn_type)
-    (const scalar_array&, const scalar_array&);
-
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -167,15 +165,11 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
 
   // Set variables dependent on dimension of cell
   totalStrain_fn_type calcTotalStrainFn;
-  elasticityResidual_fn_type elasticityResidualFn;
+  const lgDeformResidual_fn_type elasticityResidualFn = _lgDeformResidualFn; // selected in initialize()
   if (2 == cellDim) {
-    elasticityResidualFn = 
-      &pylith::feassemble::ElasticityExplicitLgDeform::_elasticityResidual2D;
     calcTotalStrainFn = 
       &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain2D;
   } else if (3 == cellDim) {
-    elasticityResidualFn = 
-      &pylith::feassemble::ElasticityExplicitLgDeform::_elasticityResidual3D;
     calcTotalStrainFn = 
       &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain3D;
   } else {
@@ -198,22 +192,19 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
   topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
-  accVisitor.optimizeClosure();
 
   scalar_array velCell(numBasis*spaceDim);
   topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
-  velVisitor.optimizeClosure();
 
   scalar_array dispCell(numBasis*spaceDim);
   scalar_array dispAdjCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
-  residualVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -235,7 +226,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
     const PetscInt cell = cells[c];
 
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     // Get state variables for cell.
@@ -245,9 +236,9 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
     _resetCellVector();
 
     // Restrict input fields to cell
-    accVisitor.getClosure(&accCell, cell);
-    velVisitor.getClosure(&velCell, cell);
-    dispVisitor.getClosure(&dispCell, cell);
+    _dispRestriction->gather(&accCell, accVisitor.localArray(), c);
+    _dispRestriction->gather(&velCell, velVisitor.localArray(), c);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
@@ -320,7 +311,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
     CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, dispAdjCell);
     
     // Assemble cell contribution into field
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], residualVisitor.localArray(), c);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
@@ -392,6 +383,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateJacobian(topology::Fiel
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, jacobianVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -402,7 +394,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateJacobian(topology::Fiel
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     // Get state variables for cell.
@@ -445,7 +437,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateJacobian(topology::Fiel
 #endif
     
     // Assemble cell contribution into lumped matrix.
-    jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], jacobianVisitor.localArray(), c);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
@@ -29,6 +29,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
@@ -63,6 +64,7 @@ pylith::feassemble::ElasticityExplicitTri3::ElasticityExplicitTri3(void) :
   _dtm1(-1.0),
   _normViscosity(0.1)
 { // constructor
+  _hasJacobianAction = false; // Jacobian must be assembled.
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -198,22 +200,19 @@ pylith::feassemble::ElasticityExplicitTri3::integrateResidual(const topology::Fi
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
   topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
-  accVisitor.optimizeClosure();
 
   scalar_array velCell(numBasis*spaceDim);
   topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
-  velVisitor.optimizeClosure();
 
   scalar_array dispCell(numBasis*spaceDim);
   scalar_array dispAdjCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
   
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
-  residualVisitor.optimizeClosure();
 
   scalar_array coordsCell(numCorners*spaceDim);
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -240,9 +239,9 @@ pylith::feassemble::ElasticityExplicitTri3::integrateResidual(const topology::Fi
 #endif
 
     // Restrict input fields to cell
-    accVisitor.getClosure(&accCell, cell);
-    velVisitor.getClosure(&velCell, cell);
-    dispVisitor.getClosure(&dispCell, cell);
+    _dispRestriction->gather(&accCell, accVisitor.localArray(), c);
+    _dispRestriction->gather(&velCell, velVisitor.localArray(), c);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(restrictEvent);
@@ -250,7 +249,7 @@ pylith::feassemble::ElasticityExplicitTri3::integrateResidual(const topology::Fi
 #endif
 
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     const PylithScalar area = _area(coordsCell);assert(area > 0.0);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -371,7 +370,7 @@ pylith::feassemble::ElasticityExplicitTri3::integrateResidual(const topology::Fi
 #endif
 
     // Assemble cell contribution into field
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], residualVisitor.localArray(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(updateEvent);
@@ -458,6 +457,7 @@ pylith::feassemble::ElasticityExplicitTri3::integrateJacobian(topology::Field* j
 
   scalar_array coordsCell(numCorners*spaceDim);
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, jacobianVisitor.localSection());
 
   _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
@@ -470,7 +470,7 @@ pylith::feassemble::ElasticityExplicitTri3::integrateJacobian(topology::Field* j
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(geometryEvent);
 #endif
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     const PylithScalar area = _area(coordsCell);assert(area > 0.0);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -497,7 +497,7 @@ pylith::feassemble::ElasticityExplicitTri3::integrateJacobian(topology::Field* j
 #endif
     
     // Assemble cell contribution into lumped matrix.
-    jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], jacobianVisitor.localArray(), c);
 
 #if defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(updateEvent);
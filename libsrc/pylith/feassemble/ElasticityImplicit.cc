@@ -30,6 +30,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/array.hh" // USES scalar_array
@@ -70,6 +71,7 @@ pylith::feassemble::ElasticityImplicit::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   IntegratorElasticity::deallocate();
+  _tangentModuli.resize(0);
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -111,10 +113,6 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
 { // integrateResidual
   PYLITH_METHOD_BEGIN;
 
-  /// Member prototype for _elasticityResidualXD()
-  typedef void (pylith::feassemble::ElasticityImplicit::*elasticityResidual_fn_type)
-    (const scalar_array&);
-  
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -145,19 +143,13 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
 			   "different than the spatial dimension of the "
 			   "domain not implemented yet.");
 
-  // Set variables dependent on dimension of cell
-  totalStrain_fn_type calcTotalStrainFn;
-  elasticityResidual_fn_type elasticityResidualFn;
-  if (2 == cellDim) {
-    elasticityResidualFn = &pylith::feassemble::ElasticityImplicit::_elasticityResidual2D;
-    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
-  } else if (3 == cellDim) {
-    elasticityResidualFn = &pylith::feassemble::ElasticityImplicit::_elasticityResidual3D;
-    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
-  } else {
+  // Kernels for cell type and quadrature scheme selected in initialize().
+  const totalStrain_fn_type calcTotalStrainFn = _calcTotalStrainFn;
+  const elasticityResidual_fn_type elasticityResidualFn = _elasticityResidualFn;
+  if (!calcTotalStrainFn || !elasticityResidualFn) {
     assert(false);
     throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateResidual().");
-  } // if/else		   
+  } // if
 
   // Allocate vectors for cell values.
   scalar_array dispTpdtCell(numBasis*spaceDim);
@@ -175,17 +167,15 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   scalar_array dispIncrCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
-  dispIncrVisitor.optimizeClosure();
 
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
-  residualVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -200,7 +190,7 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     // Get state variables for cell.
@@ -210,8 +200,8 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     _resetCellVector();
 
     // Restrict input fields to cell
-    dispVisitor.getClosure(&dispCell, cell);
-    dispIncrVisitor.getClosure(&dispIncrCell, cell);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
+    _dispRestriction->gather(&dispIncrCell, dispIncrVisitor.localArray(), c);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
@@ -267,7 +257,7 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     } // for
 #endif
     // Assemble cell contribution into field
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], residualVisitor.localArray(), c);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
@@ -285,10 +275,6 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 { // integrateJacobian
   PYLITH_METHOD_BEGIN;
 
-  /// Member prototype for _elasticityJacobianXD()
-  typedef void (pylith::feassemble::ElasticityImplicit::*elasticityJacobian_fn_type)
-    (const scalar_array&);
-
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -313,23 +299,13 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 			   "contribution to Jacobian matrix for cells with " \
 			   "different dimensions than the spatial dimension.");
 
-  // Set variables dependent on dimension of cell
-  totalStrain_fn_type calcTotalStrainFn;
-  elasticityJacobian_fn_type elasticityJacobianFn;
-  if (2 == cellDim) {
-    elasticityJacobianFn = 
-      &pylith::feassemble::ElasticityImplicit::_elasticityJacobian2D;
-    calcTotalStrainFn = 
-      &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
-  } else if (3 == cellDim) {
-    elasticityJacobianFn = 
-      &pylith::feassemble::ElasticityImplicit::_elasticityJacobian3D;
-    calcTotalStrainFn = 
-      &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
-  } else {
+  // Kernels for cell type and quadrature scheme selected in initialize().
+  const totalStrain_fn_type calcTotalStrainFn = _calcTotalStrainFn;
+  const elasticityJacobian_fn_type elasticityJacobianFn = _elasticityJacobianFn;
+  if (!calcTotalStrainFn || !elasticityJacobianFn) {
     assert(false);
     throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobian().");
-  } // if/else
+  } // if
 
   // Allocate vector for total strain
   scalar_array dispTpdtCell(numBasis*spaceDim);
@@ -345,20 +321,26 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   scalar_array dispIncrCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
-  dispIncrVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
   // Get sparse matrix
-  const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+  const PetscMat jacobianMat = jacobian->assembledMatrix();assert(jacobianMat);
+  _setupJacobianRestriction(dmMesh, fields->solution());
+  assert(_jacobianRestriction->closureSize() == numBasis*spaceDim);
+
+  // Keep tangent moduli for the Jacobian action if matrix-free.
+  const bool storeModuli = jacobian->isMatrixFree();
+  if (!storeModuli) {
+    _tangentModuli.resize(0);
+  } // if
 
   // Get parameters used in integration.
   const PylithScalar dt = _dt;
@@ -367,12 +349,15 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
 
+  // Add values in locally owned rows directly into matrix.
+  _jacobianRestriction->beginMatrix(jacobianMat);
+
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     // Get physical properties and state variables for cell.
@@ -382,8 +367,8 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
     _resetCellMatrix();
 
     // Restrict input fields to cell
-    dispVisitor.getClosure(&dispCell, cell);
-    dispIncrVisitor.getClosure(&dispIncrCell, cell);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
+    _dispRestriction->gather(&dispIncrCell, dispIncrVisitor.localArray(), c);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
@@ -398,6 +383,15 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
       
     // Get "elasticity" matrix at quadrature points for this cell
     const scalar_array& elasticConsts = _material->calcDerivElastic(strainCell);
+    if (storeModuli) {
+      const size_t cellSize = elasticConsts.size();
+      if (_tangentModuli.size() != numCells*cellSize) {
+	_tangentModuli.resize(numCells*cellSize);
+      } // if
+      for (size_t i = 0; i < cellSize; ++i) {
+	_tangentModuli[c*cellSize+i] = elasticConsts[i];
+      } // for
+    } // if
 
     CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts);
 
@@ -436,10 +430,10 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
       delete [] work;
     } // if
 
-    // Assemble cell contribution into PETSc matrix.
-    //   Notice that we are using the default sections
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    // Assemble cell contribution into PETSc matrix using cached global indices.
+    _jacobianRestriction->addMatrix(jacobianMat, &_cellMatrix[0], c);
   } // for
+  _jacobianRestriction->endMatrix(jacobianMat);
   _material->destroyPropsAndVarsVisitors();
 
   _needNewJacobian = false;
@@ -450,5 +444,86 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   PYLITH_METHOD_END;
 } // integrateJacobian
 
+// ----------------------------------------------------------------------
+// Apply stiffness matrix to a vector without assembling it.
+void
+pylith::feassemble::ElasticityImplicit::integrateJacobianAction(PetscScalar* actionArray,
+								const PetscScalar* inputArray,
+								topology::SolutionFields* const fields)
+{ // integrateJacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(actionArray);
+  assert(inputArray);
+  assert(fields);
+  assert(_coordsRestriction);
+  assert(_jacobianRestriction);
+
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int tensorSize = _material->tensorSize();
+  const int numConsts = tensorSize*tensorSize;
+
+  const totalStrain_fn_type calcTotalStrainFn = _calcTotalStrainFn;
+  const elasticityResidual_fn_type elasticityResidualFn = _elasticityResidualFn;
+  if (!calcTotalStrainFn || !elasticityResidualFn) {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobianAction().");
+  } // if
+
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  if (_tangentModuli.size() != size_t(numCells*numQuadPts*numConsts)) {
+    throw std::logic_error("Tangent moduli for matrix-free Jacobian action not "
+			   "computed. Jacobian must be reformed before it is applied.");
+  } // if
+
+  scalar_array inputCell(numBasis*spaceDim);
+  scalar_array strainCell(numQuadPts*tensorSize);
+  scalar_array stressCell(numQuadPts*tensorSize);
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+
+    _jacobianRestriction->gather(&inputCell, inputArray, c);
+    calcTotalStrainFn(&strainCell, basisDeriv, &inputCell[0], numBasis, spaceDim, numQuadPts);
+
+    // Linearized stress, sigma = C : epsilon(x).
+    const PylithScalar* moduli = &_tangentModuli[c*numQuadPts*numConsts];
+    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar* strainQ = &strainCell[iQuad*tensorSize];
+      for (int i = 0; i < tensorSize; ++i) {
+	PylithScalar value = 0.0;
+	for (int j = 0; j < tensorSize; ++j) {
+	  value += moduli[iQuad*numConsts+i*tensorSize+j] * strainQ[j];
+	} // for
+	stressCell[iQuad*tensorSize+i] = value;
+      } // for
+    } // for
+    PetscLogFlops(numQuadPts*tensorSize*tensorSize*2);
+
+    // Residual kernel computes -B^T sigma.
+    _resetCellVector();
+    CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell);
+    _cellVector *= -1.0;
+
+    _jacobianRestriction->scatterAdd(&_cellVector[0], actionArray, c);
+  } // for
+
+  PYLITH_METHOD_END;
+} // integrateJacobianAction
+
 
 // End of file 
@@ -116,6 +116,18 @@ public :
   void integrateJacobian(topology::Jacobian* jacobian,
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
+
+  /** Integrate action of Jacobian matrix (A) on a vector using the
+   * tangent moduli stored by the last call to integrateJacobian() with
+   * a matrix-free Jacobian.
+   *
+   * @param actionArray Local array (solution layout) for y += A x.
+   * @param inputArray Local array (solution layout) for x.
+   * @param fields Solution fields
+   */
+  void integrateJacobianAction(PetscScalar* actionArray,
+			       const PetscScalar* inputArray,
+			       topology::SolutionFields* const fields);
   
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -131,6 +143,10 @@ private :
 
   PylithScalar _dtm1; ///< Time step for t-dt1 -> t
 
+  /// Tangent moduli at quadrature points of all cells for matrix-free
+  /// Jacobian action [numCells*numQuadPts*numElasticConsts].
+  scalar_array _tangentModuli;
+
 }; // ElasticityImplicit
 
 #endif // pylith_feassemble_elasticityimplicit_hh
@@ -30,6 +30,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/array.hh" // USES scalar_array
@@ -53,6 +54,7 @@
 pylith::feassemble::ElasticityImplicitLgDeform::ElasticityImplicitLgDeform(void) :
   _dtm1(-1.0)
 { // constructor
+  _hasJacobianAction = false; // Jacobian must be assembled.
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -113,10 +115,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
 { // integrateResidual
   PYLITH_METHOD_BEGIN;
 
-  /// Member prototype for _elasticityResidualXD()
-  typedef void (pylith::feassemble::ElasticityImplicitLgDeform::*elasticityResidual_fn_type)
-    (const scalar_array&, const scalar_array&);
-  
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -142,12 +140,10 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
 
   // Set variables dependent on dimension of cell
   totalStrain_fn_type calcTotalStrainFn;
-  elasticityResidual_fn_type elasticityResidualFn;
+  const lgDeformResidual_fn_type elasticityResidualFn = _lgDeformResidualFn; // selected in initialize()
   if (2 == cellDim) {
-    elasticityResidualFn = &pylith::feassemble::ElasticityImplicitLgDeform::_elasticityResidual2D;
     calcTotalStrainFn = &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain2D;
   } else if (3 == cellDim) {
-    elasticityResidualFn = &pylith::feassemble::ElasticityImplicitLgDeform::_elasticityResidual3D;
     calcTotalStrainFn = &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain3D;
   } else {
     assert(false);
@@ -173,17 +169,15 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   scalar_array dispIncrCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
-  dispIncrVisitor.optimizeClosure();
 
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
-  residualVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -199,7 +193,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
     const PetscInt cell = cells[c];
 
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     // Get state variables for cell.
@@ -209,8 +203,8 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
     _resetCellVector();
 
     // Restrict input fields to cell
-    dispVisitor.getClosure(&dispCell, cell);
-    dispIncrVisitor.getClosure(&dispIncrCell, cell);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
+    _dispRestriction->gather(&dispIncrCell, dispIncrVisitor.localArray(), c);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
@@ -261,7 +255,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
     CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, dispTpdtCell);
 
     // Assemble cell contribution into field
-    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    _dispRestriction->scatterAdd(&_cellVector[0], residualVisitor.localArray(), c);
   } // for
   _material->destroyPropsAndVarsVisitors();
   
@@ -279,10 +273,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
 { // integrateJacobian
   PYLITH_METHOD_BEGIN;
 
-  /// Member prototype for _elasticityJacobianXD()
-  typedef void (pylith::feassemble::ElasticityImplicitLgDeform::*elasticityJacobian_fn_type)
-    (const scalar_array&, const scalar_array&, const scalar_array&);
-
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -309,15 +299,11 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
 
   // Set variables dependent on dimension of cell
   totalStrain_fn_type calcTotalStrainFn;
-  elasticityJacobian_fn_type elasticityJacobianFn;
+  const lgDeformJacobian_fn_type elasticityJacobianFn = _lgDeformJacobianFn; // selected in initialize()
   if (2 == cellDim) {
-    elasticityJacobianFn = 
-      &pylith::feassemble::ElasticityImplicitLgDeform::_elasticityJacobian2D;
     calcTotalStrainFn = 
       &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain2D;
   } else if (3 == cellDim) {
-    elasticityJacobianFn = 
-      &pylith::feassemble::ElasticityImplicitLgDeform::_elasticityJacobian3D;
     calcTotalStrainFn = 
       &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain3D;
   } else {
@@ -343,18 +329,18 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   scalar_array dispIncrCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
-  dispIncrVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   // Get sparse matrix
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+  _setupJacobianRestriction(dmMesh, fields->solution());
+  assert(_jacobianRestriction->closureSize() == numBasis*spaceDim);
 
   _material->createPropsAndVarsVisitors();
 
@@ -365,12 +351,15 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
 
+  // Add values in locally owned rows directly into matrix.
+  _jacobianRestriction->beginMatrix(jacobianMat);
+
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
     // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     // Get physical properties and state variables for cell.
@@ -380,8 +369,8 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
     _resetCellMatrix();
 
     // Restrict input fields to cell
-    dispVisitor.getClosure(&dispCell, cell);
-    dispIncrVisitor.getClosure(&dispIncrCell, cell);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
+    _dispRestriction->gather(&dispIncrCell, dispIncrVisitor.localArray(), c);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
@@ -439,9 +428,10 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
       delete [] work;
     } // if
 
-    // Assemble cell contribution into PETSc matrix.
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    // Assemble cell contribution into PETSc matrix using cached global indices.
+    _jacobianRestriction->addMatrix(jacobianMat, &_cellMatrix[0], c);
   } // for
+  _jacobianRestriction->endMatrix(jacobianMat);
   _material->destroyPropsAndVarsVisitors();
 
   _needNewJacobian = false;
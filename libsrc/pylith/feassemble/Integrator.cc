@@ -40,7 +40,8 @@ pylith::feassemble::Integrator::Integrator(void) :
   _gravityField(0),
   _logger(0),
   _needNewJacobian(true),
-  _isJacobianSymmetric(true)
+  _isJacobianSymmetric(true),
+  _hasJacobianAction(true)
 { // constructor
 } // constructor
 
@@ -154,6 +155,28 @@ pylith::feassemble::Integrator::_resetCellMatrix(void)
   _cellMatrix = 0.0;
 } // _resetCellMatrix
 
+// ----------------------------------------------------------------------
+// Copy upper triangle of symmetric cell matrix to lower triangle.
+void
+pylith::feassemble::Integrator::_fillLowerCellMatrix(void)
+{ // _fillLowerCellMatrix
+  assert(_quadrature);
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int n = numBasis*spaceDim;
+  assert(_cellMatrix.size() == size_t(n*n));
+
+  for (int iBasis=0; iBasis < numBasis; ++iBasis)
+    for (int jBasis=0; jBasis < iBasis; ++jBasis)
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	const int iRow = iBasis*spaceDim+iDim;
+	for (int jDim=0; jDim < spaceDim; ++jDim) {
+	  const int jRow = jBasis*spaceDim+jDim;
+	  _cellMatrix[iRow*n+jRow] = _cellMatrix[jRow*n+iRow];
+	} // for
+      } // for
+} // _fillLowerCellMatrix
+
 // ----------------------------------------------------------------------
 // Lump cell matrix, putting the result in the cell vector using
 // equivalent forces for rigid body motion.
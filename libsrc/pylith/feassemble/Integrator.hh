@@ -121,6 +121,13 @@ public :
   virtual
   bool isJacobianSymmetric(void) const;
 
+  /** Check whether integrator can apply its Jacobian to a vector
+   * without assembling it (see integrateJacobianAction()).
+   *
+   * @returns True if Jacobian action is available, false otherwise.
+   */
+  bool hasJacobianAction(void) const;
+
   /** Initialize integrator.
    *
    * @param mesh Finite-element mesh.
@@ -181,6 +188,22 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Integrate action of Jacobian matrix (A) associated with operator
+   * on a vector, y += A x, without assembling A.
+   *
+   * Used with matrix-free Jacobians. Quantities that do not depend on
+   * x (e.g., tangent moduli) are stored by integrateJacobian(), which
+   * is always called before the action is applied.
+   *
+   * @param actionArray Local array (solution layout) for y.
+   * @param inputArray Local array (solution layout) for x; constrained DOF are zero.
+   * @param fields Solution fields
+   */
+  virtual
+  void integrateJacobianAction(PetscScalar* actionArray,
+			       const PetscScalar* inputArray,
+			       topology::SolutionFields* const fields);
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator.
    *
@@ -255,6 +278,11 @@ protected :
   /// Zero out matrix containing result of integration for cell.
   void _resetCellMatrix(void);
 
+  /// Copy upper triangle of symmetric cell matrix to lower triangle
+  /// (blocks with jBasis < iBasis), so kernels need only compute the
+  /// blocks with jBasis >= iBasis.
+  void _fillLowerCellMatrix(void);
+
   /// Lump cell matrix, putting the result in the cell vector using
   /// equivalent forces for rigid body motion.
   void _lumpCellMatrix(void);
@@ -285,6 +313,10 @@ protected :
   /// Default is false;
   bool _isJacobianSymmetric;
 
+  /// True if integrateJacobianAction() matches integrateJacobian().
+  /// Default is true (no contribution to Jacobian).
+  bool _hasJacobianAction;
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -30,6 +30,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 #include "pylith/materials/ElasticMaterial.hh" // USES ElasticMaterial
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -49,7 +50,14 @@
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
-    _outputFields(0)
+    _dispRestriction(0),
+    _coordsRestriction(0),
+    _jacobianRestriction(0),
+    _outputFields(0),
+    _elasticityResidualFn(0),
+    _elasticityJacobianFn(0),
+    _calcTotalStrainFn(0),
+    _avgCellOutput(false)
 { // constructor
 } // constructor
 
@@ -71,6 +79,9 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
 
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
+    delete _dispRestriction; _dispRestriction = 0;
+    delete _coordsRestriction; _coordsRestriction = 0;
+    delete _jacobianRestriction; _jacobianRestriction = 0;
     delete _outputFields; _outputFields = 0;
 
     PYLITH_METHOD_END;
@@ -87,6 +98,14 @@ pylith::feassemble::IntegratorElasticity::material(materials::ElasticMaterial* m
     } // if
 } // material
 
+// ----------------------------------------------------------------------
+// Set flag for computing cell fields averaged over quadrature points.
+void
+pylith::feassemble::IntegratorElasticity::averageCellOutput(const bool flag)
+{ // averageCellOutput
+    _avgCellOutput = flag;
+} // averageCellOutput
+
 // ----------------------------------------------------------------------
 // Determine whether we need to recompute the Jacobian.
 bool
@@ -122,6 +141,9 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     // Compute geometry for quadrature operations.
     _quadrature->initializeGeometry();
 
+    // Select kernels for cell type and quadrature scheme.
+    _setupKernels();
+
     // Optimize coordinate retrieval in closure
     topology::CoordsVisitor::optimizeClosure(dmMesh);
 
@@ -167,16 +189,12 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     const int spaceDim = _quadrature->spaceDim();
     const int numCorners = _quadrature->refGeometry().numCorners();
     const int tensorSize = _material->tensorSize();
-    totalStrain_fn_type calcTotalStrainFn;
-    if (2 == cellDim) {
-        calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
-    } else if (3 == cellDim) {
-        calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
-    } else {
+    const totalStrain_fn_type calcTotalStrainFn = _calcTotalStrainFn;
+    if (!calcTotalStrainFn) {
         std::cerr << "Bad cell dimension '" << cellDim << "'." << std::endl;
         assert(0);
         throw std::logic_error("Bad cell dimension in IntegratorElasticity::updateStateVars().");
-    } // else
+    } // if
 
     // Allocate arrays for cell data.
     scalar_array strainCell(numQuadPts*tensorSize);
@@ -191,10 +209,10 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     // Setup visitors.
     scalar_array dispCell(numBasis*spaceDim);
     topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-    dispVisitor.optimizeClosure();
 
     scalar_array coordsCell(numCorners*spaceDim);
     topology::CoordsVisitor coordsVisitor(dmMesh);
+    _setupRestrictions(dmMesh, dispVisitor.localSection());
 
     _material->createPropsAndVarsVisitors();
 
@@ -203,7 +221,7 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
         const PetscInt cell = cells[c];
 
         // Retrieve geometry information for current cell
-        coordsVisitor.getClosure(&coordsCell, cell);
+        _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
         _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
         const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
@@ -211,7 +229,7 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
         _material->retrievePropsAndVars(cell);
 
         // Restrict input fields to cell
-        dispVisitor.getClosure(&dispCell, cell);
+        _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
 
         // Compute strains
         calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
@@ -311,6 +329,8 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
         _outputFields = new topology::Fields(mesh); assert(_outputFields);
     } // if
 
+    const scalar_array* quadWts = (_avgCellOutput) ? &_quadrature->quadWts() : 0;
+
     if (std::string("total_strain") == namelower) {
 
         if (_material->hasStateVar(namelower.c_str())) {
@@ -318,7 +338,7 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
             assert(fields);
             _allocateTensorField(mesh);
             topology::Field& buffer = _outputFields->get("buffer (tensor)");
-            _material->getField(&buffer, namelower.c_str());
+            _material->getField(&buffer, namelower.c_str(), quadWts);
             buffer.dimensionalizeOkay(true);
             PYLITH_METHOD_RETURN(buffer);
 
@@ -341,7 +361,7 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
             assert(fields);
             _allocateTensorField(mesh);
             topology::Field& buffer = _outputFields->get("buffer (tensor)");
-            _material->getField(&buffer, namelower.c_str());
+            _material->getField(&buffer, namelower.c_str(), quadWts);
             buffer.dimensionalizeOkay(true);
             PYLITH_METHOD_RETURN(buffer);
 
@@ -377,7 +397,7 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
         if (!_outputFields->hasField("buffer (other)"))
             _outputFields->add("buffer (other)", "buffer");
         topology::Field& buffer = _outputFields->get("buffer (other)");
-        _material->getField(&buffer, name);
+        _material->getField(&buffer, name, quadWts);
         buffer.dimensionalizeOkay(true);
         PYLITH_METHOD_RETURN(buffer);
 
@@ -429,6 +449,60 @@ pylith::feassemble::IntegratorElasticity::_initializeLogger(void)
     PYLITH_METHOD_END;
 } // initializeLogger
 
+// ----------------------------------------------------------------------
+// Setup element restrictions for solution and coordinates.
+void
+pylith::feassemble::IntegratorElasticity::_setupRestrictions(const PetscDM dmMesh,
+							     const PetscSection dispSection)
+{ // _setupRestrictions
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+    assert(dispSection);
+    assert(_materialIS);
+
+    if (!_dispRestriction) {
+        _dispRestriction = new topology::ElementRestriction; assert(_dispRestriction);
+    } // if
+    if (!_dispRestriction->isCurrent(dispSection)) {
+        _dispRestriction->initialize(dmMesh, dispSection, _materialIS->points(), _materialIS->size());
+    } // if
+
+    PetscSection coordsSection = NULL;
+    PetscErrorCode err = DMGetCoordinateSection(dmMesh, &coordsSection); PYLITH_CHECK_ERROR(err);
+    if (!_coordsRestriction) {
+        _coordsRestriction = new topology::ElementRestriction; assert(_coordsRestriction);
+    } // if
+    if (!_coordsRestriction->isCurrent(coordsSection)) {
+        _coordsRestriction->initialize(dmMesh, coordsSection, _materialIS->points(), _materialIS->size());
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupRestrictions
+
+// ----------------------------------------------------------------------
+// Setup element restriction with global indices for Jacobian assembly.
+void
+pylith::feassemble::IntegratorElasticity::_setupJacobianRestriction(const PetscDM dmMesh,
+								    const topology::Field& solution)
+{ // _setupJacobianRestriction
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+    assert(_materialIS);
+
+    const PetscSection solnSection = solution.localSection(); assert(solnSection);
+    if (!_jacobianRestriction) {
+        _jacobianRestriction = new topology::ElementRestriction; assert(_jacobianRestriction);
+    } // if
+    if (!_jacobianRestriction->isCurrent(solnSection)) {
+        const PetscSection solnGlobalSection = solution.globalSection(); assert(solnGlobalSection);
+        _jacobianRestriction->initialize(dmMesh, solnSection, _materialIS->points(), _materialIS->size(), solnGlobalSection);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupJacobianRestriction
+
 // ----------------------------------------------------------------------
 // Allocate buffer for tensor field at quadrature points.
 void
@@ -454,9 +528,15 @@ pylith::feassemble::IntegratorElasticity::_allocateTensorField(const topology::M
     if (!_outputFields->hasField("buffer (tensor)")) {
         _outputFields->add("buffer (tensor)", "buffer");
         topology::Field& buffer = _outputFields->get("buffer (tensor)");
-        buffer.newSection(cellsTmp, numQuadPts*tensorSize);
-        buffer.allocate();
-        buffer.vectorFieldType(topology::FieldBase::MULTI_TENSOR);
+        if (_avgCellOutput) {
+            buffer.newSection(cellsTmp, tensorSize);
+            buffer.allocate();
+            buffer.vectorFieldType(topology::FieldBase::TENSOR);
+        } else {
+            buffer.newSection(cellsTmp, numQuadPts*tensorSize);
+            buffer.allocate();
+            buffer.vectorFieldType(topology::FieldBase::MULTI_TENSOR);
+        } // if/else
         buffer.dimensionalizeOkay(true);
     } // if
 
@@ -483,16 +563,12 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     const int numBasis = _quadrature->numBasis();
     const int spaceDim = _quadrature->spaceDim();
     const int tensorSize = _material->tensorSize();
-    totalStrain_fn_type calcTotalStrainFn;
-    if (2 == cellDim) {
-        calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
-    } else if (3 == cellDim) {
-        calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
-    } else {
+    const totalStrain_fn_type calcTotalStrainFn = _calcTotalStrainFn;
+    if (!calcTotalStrainFn) {
         std::cerr << "Bad cell dimension '" << cellDim << "'." << std::endl;
         assert(0);
         throw std::logic_error("Bad cell dimension in IntegratorElasticity.");
-    } // else
+    } // if
 
     // Allocate arrays for cell data.
     scalar_array dispCellTmp(numBasis*spaceDim);
@@ -511,13 +587,14 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     // Setup field visitors.
     scalar_array dispCell(numBasis*spaceDim);
     topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-    dispVisitor.optimizeClosure();
 
     topology::VecVisitorMesh fieldVisitor(*field);
     PetscScalar* fieldArray = fieldVisitor.localArray();
+    const scalar_array& quadWts = _quadrature->quadWts();
 
     scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
     topology::CoordsVisitor coordsVisitor(dmMesh);
+    _setupRestrictions(dmMesh, dispVisitor.localSection());
 
     _material->createPropsAndVarsVisitors();
 
@@ -526,30 +603,32 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
         const PetscInt cell = cells[c];
 
         // Retrieve geometry information for current cell
-        coordsVisitor.getClosure(&coordsCell, cell);
+        _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
         _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
         // Get cell geometry information that depends on cell
-        dispVisitor.getClosure(&dispCell, cell);
+        _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
         const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
         // Compute strains
         calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
 
-        const PetscInt off = fieldVisitor.sectionOffset(cell);
-        assert(tensorCellSize == fieldVisitor.sectionDof(cell));
-        if (!calcStress) {
-            for (int i=0; i < tensorCellSize; ++i) {
-                fieldArray[off+i] = strainCell[i];
-            } // for
-        } else {
+        if (calcStress) {
             _material->retrievePropsAndVars(cell);
             stressCell = _material->calcStress(strainCell);
+        } // if
+        const scalar_array& tensorCell = (calcStress) ? stressCell : strainCell;
 
+        const PetscInt off = fieldVisitor.sectionOffset(cell);
+        if (_avgCellOutput) {
+            assert(tensorSize == fieldVisitor.sectionDof(cell));
+            _averageQuadPts(&fieldArray[off], tensorCell, quadWts, tensorSize);
+        } else {
+            assert(tensorCellSize == fieldVisitor.sectionDof(cell));
             for (int i=0; i < tensorCellSize; ++i) {
-                fieldArray[off+i] = stressCell[i];
+                fieldArray[off+i] = tensorCell[i];
             } // for
-        } // else
+        } // if/else
     } // for
     _material->destroyPropsAndVarsVisitors();
 
@@ -558,21 +637,24 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 2-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_array& stress)
-{ // _elasticityResidual2D
+pylith::feassemble::IntegratorElasticity::_elasticityResidual2DT(const scalar_array& stress)
+{ // _elasticityResidual2DT
     const int cellDim = 2;
     const int spaceDim = 2;
     const int stressSize = 3;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+    const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
     const scalar_array& quadWts = _quadrature->quadWts();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     assert(_quadrature->spaceDim() == spaceDim);
     assert(_quadrature->cellDim() == cellDim);
+    assert(_quadrature->numQuadPts() == numQuadPts);
+    assert(_quadrature->numBasis() == numBasis);
     assert(quadWts.size() == size_t(numQuadPts));
 
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
@@ -591,25 +673,28 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_arr
         } // for
     } // for
     PetscLogFlops(numQuadPts*(1+numBasis*(8+2+9)));
-} // _elasticityResidual2D
+} // _elasticityResidual2DT
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 3-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_array& stress)
-{ // _elasticityResidual3D
+pylith::feassemble::IntegratorElasticity::_elasticityResidual3DT(const scalar_array& stress)
+{ // _elasticityResidual3DT
     const int spaceDim = 3;
     const int cellDim = 3;
     const int stressSize = 6;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+    const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
     const scalar_array& quadWts = _quadrature->quadWts();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     assert(_quadrature->spaceDim() == spaceDim);
     assert(_quadrature->cellDim() == cellDim);
+    assert(_quadrature->numQuadPts() == numQuadPts);
+    assert(_quadrature->numBasis() == numBasis);
     assert(quadWts.size() == size_t(numQuadPts));
 
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
@@ -636,27 +721,34 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_arr
         } // for
     } // for
     PetscLogFlops(numQuadPts*(1+numBasis*(3+12)));
-} // _elasticityResidual3D
+} // _elasticityResidual3DT
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in Jacobian for 2-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_array& elasticConsts)
-{ // _elasticityJacobian2D
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian2DT(const scalar_array& elasticConsts)
+{ // _elasticityJacobian2DT
     const int spaceDim = 2;
     const int cellDim = 2;
     const int numConsts = 9;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+    const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
     const scalar_array& quadWts = _quadrature->quadWts();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     assert(_quadrature->spaceDim() == spaceDim);
     assert(_quadrature->cellDim() == cellDim);
+    assert(_quadrature->numQuadPts() == numQuadPts);
+    assert(_quadrature->numBasis() == numBasis);
     assert(quadWts.size() == size_t(numQuadPts));
 
+    // With symmetric elastic constants the cell matrix is symmetric,
+    // so we compute only the blocks with jBasis >= iBasis.
+    const bool isSymmetric = _isJacobianSymmetric;
+
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
         // tau_ij = C_ijkl * e_kl
@@ -678,7 +770,7 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
             const PylithScalar Ni2 = wt*basisDeriv[iQ+iBasis*spaceDim+1];
             const int iBlock = (iBasis*spaceDim  ) * (numBasis*spaceDim);
             const int iBlock1 = (iBasis*spaceDim+1) * (numBasis*spaceDim);
-            for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+            for (int jBasis=(isSymmetric ? iBasis : 0); jBasis < numBasis; ++jBasis) {
                 const PylithScalar Nj1 = basisDeriv[iQ+jBasis*spaceDim  ];
                 const PylithScalar Nj2 = basisDeriv[iQ+jBasis*spaceDim+1];
                 const PylithScalar ki0j0 =
@@ -702,28 +794,40 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
             } // for
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(2+numBasis*(3*11+4))));
-} // _elasticityJacobian2D
+    if (isSymmetric) {
+        _fillLowerCellMatrix();
+        PetscLogFlops(numQuadPts*(1+numBasis*2+numBasis*(numBasis+1)/2*(3*11+4)));
+    } else {
+        PetscLogFlops(numQuadPts*(1+numBasis*(2+numBasis*(3*11+4))));
+    } // if/else
+} // _elasticityJacobian2DT
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in Jacobian for 3-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_array& elasticConsts)
-{ // _elasticityJacobian3D
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian3DT(const scalar_array& elasticConsts)
+{ // _elasticityJacobian3DT
     const int spaceDim = 3;
     const int cellDim = 3;
     const int numConsts = 36;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+    const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
     const scalar_array& quadWts = _quadrature->quadWts();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     assert(_quadrature->spaceDim() == spaceDim);
     assert(_quadrature->cellDim() == cellDim);
+    assert(_quadrature->numQuadPts() == numQuadPts);
+    assert(_quadrature->numBasis() == numBasis);
     assert(quadWts.size() == size_t(numQuadPts));
 
+    // With symmetric elastic constants the cell matrix is symmetric,
+    // so we compute only the blocks with jBasis >= iBasis.
+    const bool isSymmetric = _isJacobianSymmetric;
+
     // Compute Jacobian for consistent tangent matrix
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
@@ -773,7 +877,7 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_arr
             const PylithScalar Ni1 = wt*basisDeriv[iQ+iBasis*spaceDim+0];
             const PylithScalar Ni2 = wt*basisDeriv[iQ+iBasis*spaceDim+1];
             const PylithScalar Ni3 = wt*basisDeriv[iQ+iBasis*spaceDim+2];
-            for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+            for (int jBasis=(isSymmetric ? iBasis : 0); jBasis < numBasis; ++jBasis) {
                 const PylithScalar Nj1 = basisDeriv[iQ+jBasis*spaceDim+0];
                 const PylithScalar Nj2 = basisDeriv[iQ+jBasis*spaceDim+1];
                 const PylithScalar Nj3 = basisDeriv[iQ+jBasis*spaceDim+2];
@@ -831,22 +935,33 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_arr
             } // for
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(3+numBasis*(6*26+9))));
-} // _elasticityJacobian3D
+    if (isSymmetric) {
+        _fillLowerCellMatrix();
+        PetscLogFlops(numQuadPts*(1+numBasis*3+numBasis*(numBasis+1)/2*(6*26+9)));
+    } else {
+        PetscLogFlops(numQuadPts*(1+numBasis*(3+numBasis*(6*26+9))));
+    } // if/else
+} // _elasticityJacobian3DT
 
 // ----------------------------------------------------------------------
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D(scalar_array* strain,
-                                                             const scalar_array& basisDeriv,
-                                                             const PylithScalar* disp,
-                                                             const int numBasis,
-                                                             const int spaceDim,
-                                                             const int numQuadPts)
-{ // calcTotalStrain2D
+pylith::feassemble::IntegratorElasticity::_calcTotalStrain2DT(scalar_array* strain,
+                                                              const scalar_array& basisDeriv,
+                                                              const PylithScalar* disp,
+                                                              const int numBasisIn,
+                                                              const int spaceDim,
+                                                              const int numQuadPtsIn)
+{ // _calcTotalStrain2DT
     assert(strain);
 
     const int dim = 2;
     const int strainSize = 3;
+    const int numBasis = (numBasisT > 0) ? numBasisT : numBasisIn;
+    const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : numQuadPtsIn;
+
+    assert(numBasis == numBasisIn);
+    assert(numQuadPts == numQuadPtsIn);
 
     assert(basisDeriv.size() == size_t(numQuadPts*numBasis*dim));
     assert(dim == spaceDim);
@@ -859,21 +974,27 @@ pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D(scalar_array* strai
             (*strain)[iQuad*strainSize+2] += 0.5 * (basisDeriv[iQ+iBasis*dim+1] * disp[iBasis*dim  ] +
                                                     basisDeriv[iQ+iBasis*dim  ] * disp[iBasis*dim+1]);
         }                             // for
-} // calcTotalStrain2D
+} // _calcTotalStrain2DT
 
 // ----------------------------------------------------------------------
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D(scalar_array* strain,
-                                                             const scalar_array& basisDeriv,
-                                                             const PylithScalar* disp,
-                                                             const int numBasis,
-                                                             const int spaceDim,
-                                                             const int numQuadPts)
-{ // calcTotalStrain3D
+pylith::feassemble::IntegratorElasticity::_calcTotalStrain3DT(scalar_array* strain,
+                                                              const scalar_array& basisDeriv,
+                                                              const PylithScalar* disp,
+                                                              const int numBasisIn,
+                                                              const int spaceDim,
+                                                              const int numQuadPtsIn)
+{ // _calcTotalStrain3DT
     assert(strain);
 
     const int dim = 3;
     const int strainSize = 6;
+    const int numBasis = (numBasisT > 0) ? numBasisT : numBasisIn;
+    const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : numQuadPtsIn;
+
+    assert(numBasis == numBasisIn);
+    assert(numQuadPts == numQuadPtsIn);
 
     assert(basisDeriv.size() == size_t(numQuadPts*numBasis*dim));
     assert(dim == spaceDim);
@@ -891,7 +1012,165 @@ pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D(scalar_array* strai
             (*strain)[iQuad*strainSize+5] += 0.5 * (basisDeriv[iQ+iBasis*dim+2] * disp[iBasis*dim  ] +
                                                     basisDeriv[iQ+iBasis*dim  ] * disp[iBasis*dim+2]);
         }                             // for
+} // _calcTotalStrain3DT
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in residual for 2-D cells.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_array& stress)
+{ // _elasticityResidual2D
+    _elasticityResidual2DT<0,0>(stress);
+} // _elasticityResidual2D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in residual for 3-D cells.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_array& stress)
+{ // _elasticityResidual3D
+    _elasticityResidual3DT<0,0>(stress);
+} // _elasticityResidual3D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in Jacobian for 2-D cells.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_array& elasticConsts)
+{ // _elasticityJacobian2D
+    _elasticityJacobian2DT<0,0>(elasticConsts);
+} // _elasticityJacobian2D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in Jacobian for 3-D cells.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_array& elasticConsts)
+{ // _elasticityJacobian3D
+    _elasticityJacobian3DT<0,0>(elasticConsts);
+} // _elasticityJacobian3D
+
+// ----------------------------------------------------------------------
+void
+pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D(scalar_array* strain,
+                                                             const scalar_array& basisDeriv,
+                                                             const PylithScalar* disp,
+                                                             const int numBasis,
+                                                             const int spaceDim,
+                                                             const int numQuadPts)
+{ // calcTotalStrain2D
+    _calcTotalStrain2DT<0,0>(strain, basisDeriv, disp, numBasis, spaceDim, numQuadPts);
+} // calcTotalStrain2D
+
+// ----------------------------------------------------------------------
+void
+pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D(scalar_array* strain,
+                                                             const scalar_array& basisDeriv,
+                                                             const PylithScalar* disp,
+                                                             const int numBasis,
+                                                             const int spaceDim,
+                                                             const int numQuadPts)
+{ // calcTotalStrain3D
+    _calcTotalStrain3DT<0,0>(strain, basisDeriv, disp, numBasis, spaceDim, numQuadPts);
 } // calcTotalStrain3D
 
+// ----------------------------------------------------------------------
+// Select kernels for the cell type and quadrature scheme.
+void
+pylith::feassemble::IntegratorElasticity::_setupKernels(void)
+{ // _setupKernels
+    assert(_quadrature);
+
+    const int cellDim = _quadrature->cellDim();
+    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = _quadrature->numQuadPts();
+
+    _calcTotalStrainFn = _totalStrainKernel(cellDim, numBasis, numQuadPts);
+    _elasticityResidualFn = 0;
+    _elasticityJacobianFn = 0;
+    if (cellDim != _quadrature->spaceDim()) {
+        return;
+    } // if
+
+    // Kernels with fixed loop bounds: Tri3 (1 pt), Quad4 (4 pts), Tet4
+    // (1 pt), and Hex8 (8 pts).
+    if (2 == cellDim) {
+        if (3 == numBasis && 1 == numQuadPts) {
+            _elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual2DT<3,1>;
+            _elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian2DT<3,1>;
+        } else if (4 == numBasis && 4 == numQuadPts) {
+            _elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual2DT<4,4>;
+            _elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian2DT<4,4>;
+        } else {
+            _elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual2D;
+            _elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D;
+        } // if/else
+    } else if (3 == cellDim) {
+        if (4 == numBasis && 1 == numQuadPts) {
+            _elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual3DT<4,1>;
+            _elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian3DT<4,1>;
+        } else if (8 == numBasis && 8 == numQuadPts) {
+            _elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual3DT<8,8>;
+            _elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian3DT<8,8>;
+        } else {
+            _elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual3D;
+            _elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D;
+        } // if/else
+    } // if/else
+} // _setupKernels
+
+// ----------------------------------------------------------------------
+// Get kernel for computing total strain.
+pylith::feassemble::IntegratorElasticity::totalStrain_fn_type
+pylith::feassemble::IntegratorElasticity::_totalStrainKernel(const int cellDim,
+                                                             const int numBasis,
+                                                             const int numQuadPts)
+{ // _totalStrainKernel
+    totalStrain_fn_type kernel = 0;
+    if (2 == cellDim) {
+        if (3 == numBasis && 1 == numQuadPts) {
+            kernel = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2DT<3,1>;
+        } else if (4 == numBasis && 4 == numQuadPts) {
+            kernel = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2DT<4,4>;
+        } else {
+            kernel = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+        } // if/else
+    } else if (3 == cellDim) {
+        if (4 == numBasis && 1 == numQuadPts) {
+            kernel = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3DT<4,1>;
+        } else if (8 == numBasis && 8 == numQuadPts) {
+            kernel = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3DT<8,8>;
+        } else {
+            kernel = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+        } // if/else
+    } // if/else
+
+    return kernel;
+} // _totalStrainKernel
+
+// ----------------------------------------------------------------------
+// Average values over quadrature points of a cell.
+void
+pylith::feassemble::IntegratorElasticity::_averageQuadPts(PylithScalar* avgValues,
+                                                          const scalar_array& values,
+                                                          const scalar_array& quadWts,
+                                                          const int fiberDim)
+{ // _averageQuadPts
+    assert(avgValues);
+
+    const int numQuadPts = quadWts.size();
+    assert(values.size() >= size_t(numQuadPts*fiberDim));
+
+    PylithScalar volume = 0.0;
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+        volume += quadWts[iQuad];
+
+    for (int i=0; i < fiberDim; ++i)
+        avgValues[i] = 0.0;
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+        const PylithScalar wt = quadWts[iQuad] / volume;
+        for (int i=0; i < fiberDim; ++i)
+            avgValues[i] += wt * values[iQuad*fiberDim+i];
+    } // for
+
+    PetscLogFlops(numQuadPts*(2+2*fiberDim));
+} // _averageQuadPts
+
 
 // End of file
@@ -55,6 +55,17 @@ public :
 				      const int);
   
 
+// PROTECTED TYPEDEFS ///////////////////////////////////////////////////
+protected :
+
+  /// Member prototype for _elasticityResidualXD()
+  typedef void (pylith::feassemble::IntegratorElasticity::*elasticityResidual_fn_type)
+    (const scalar_array&);
+
+  /// Member prototype for _elasticityJacobianXD()
+  typedef void (pylith::feassemble::IntegratorElasticity::*elasticityJacobian_fn_type)
+    (const scalar_array&);
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -75,6 +86,17 @@ public :
    */
   void material(materials::ElasticMaterial* m);
 
+  /** Set flag for computing cell fields averaged over the quadrature
+   * points of each cell.
+   *
+   * When set, output fields are reduced to a single value per cell as
+   * they are computed, so the field with values at every quadrature
+   * point is never allocated.
+   *
+   * @param flag True to average cell fields, false otherwise.
+   */
+  void averageCellOutput(const bool flag);
+
   /** Determine whether we need to recompute the Jacobian.
    *
    * @returns True if Jacobian needs to be recomputed, false otherwise.
@@ -128,7 +150,32 @@ protected :
   /// Initialize logger.
   void _initializeLogger(void);
 
-  /** Allocate buffer for tensor field at quadrature points.
+  /** Setup element restrictions for solution and coordinates over the
+   * material cells.
+   *
+   * The restrictions are built only if they do not exist or the
+   * section of the solution field has changed.
+   *
+   * @param dmMesh PETSc DM for mesh.
+   * @param dispSection Local section of displacement subfield.
+   */
+  void _setupRestrictions(const PetscDM dmMesh,
+			  const PetscSection dispSection);
+
+  /** Setup element restriction with cached global indices for
+   * assembling cell matrices into the Jacobian over the material cells.
+   *
+   * The restriction is built only if it does not exist or the section
+   * of the solution field has changed.
+   *
+   * @param dmMesh PETSc DM for mesh.
+   * @param solution Solution field.
+   */
+  void _setupJacobianRestriction(const PetscDM dmMesh,
+				 const topology::Field& solution);
+
+  /** Allocate buffer for tensor field at quadrature points (or cells
+   * if averaging cell output).
    *
    * @param mesh Finite-element mesh.
    */
@@ -207,6 +254,121 @@ protected :
 			  const int spaceDim,
 			  const int numQuadPts);
 
+  /** Select kernels for integrating the elasticity terms and
+   * computing the total strain for the cell type and quadrature
+   * scheme.
+   *
+   * Common combinations of the number of basis functions and number
+   * of quadrature points (Tri3 and Tet4 with one point, Quad4 with 4
+   * points, and Hex8 with 8 points) use kernels with loop bounds
+   * fixed at compile time; other combinations use the general
+   * kernels.
+   */
+  virtual
+  void _setupKernels(void);
+
+  /** Get kernel for computing total strain.
+   *
+   * @param cellDim Dimension of cell.
+   * @param numBasis Number of basis functions for cell.
+   * @param numQuadPts Number of quadrature points.
+   * @returns Kernel for computing total strain (0 if cell dimension
+   *   is not supported).
+   */
+  static
+  totalStrain_fn_type _totalStrainKernel(const int cellDim,
+					 const int numBasis,
+					 const int numQuadPts);
+
+  /** Integrate elasticity term in residual for 2-D cells with
+   * number of basis functions and quadrature points fixed at compile
+   * time (0 uses the values from the quadrature).
+   *
+   * @param stress Stress tensor for cell at quadrature points.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityResidual2DT(const scalar_array& stress);
+
+  /** Integrate elasticity term in residual for 3-D cells with
+   * number of basis functions and quadrature points fixed at compile
+   * time (0 uses the values from the quadrature).
+   *
+   * @param stress Stress tensor for cell at quadrature points.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityResidual3DT(const scalar_array& stress);
+
+  /** Integrate elasticity term in Jacobian for 2-D cells with
+   * number of basis functions and quadrature points fixed at compile
+   * time (0 uses the values from the quadrature).
+   *
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityJacobian2DT(const scalar_array& elasticConsts);
+
+  /** Integrate elasticity term in Jacobian for 3-D cells with
+   * number of basis functions and quadrature points fixed at compile
+   * time (0 uses the values from the quadrature).
+   *
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityJacobian3DT(const scalar_array& elasticConsts);
+
+  /** Compute total strain in at quadrature points of a 2-D cell with
+   * number of basis functions and quadrature points fixed at compile
+   * time (0 uses the values of the arguments).
+   *
+   * @param strain Strain tensor at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   * @param disp Displacement at vertices of cell.
+   * @param numBasis Number of basis functions for cell.
+   * @param spaceDim Spatial dimension.
+   * @param numQuadPts Number of quadrature points.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  static
+  void _calcTotalStrain2DT(scalar_array* strain,
+			   const scalar_array& basisDeriv,
+			   const PylithScalar* disp,
+			   const int numBasis,
+			   const int spaceDim,
+			   const int numQuadPts);
+
+  /** Compute total strain in at quadrature points of a 3-D cell with
+   * number of basis functions and quadrature points fixed at compile
+   * time (0 uses the values of the arguments).
+   *
+   * @param strain Strain tensor at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   * @param disp Displacement at vertices of cell.
+   * @param numBasis Number of basis functions for cell.
+   * @param spaceDim Spatial dimension.
+   * @param numQuadPts Number of quadrature points.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  static
+  void _calcTotalStrain3DT(scalar_array* strain,
+			   const scalar_array& basisDeriv,
+			   const PylithScalar* disp,
+			   const int numBasis,
+			   const int spaceDim,
+			   const int numQuadPts);
+
+  /** Average values over quadrature points of a cell.
+   *
+   * @param avgValues Array for averaged values [fiberDim].
+   * @param values Values at quadrature points [numQuadPts*fiberDim].
+   * @param quadWts Weights of quadrature points.
+   * @param fiberDim Number of values per quadrature point.
+   */
+  static
+  void _averageQuadPts(PylithScalar* avgValues,
+		       const scalar_array& values,
+		       const scalar_array& quadWts,
+		       const int fiberDim);
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
@@ -214,9 +376,18 @@ protected :
   materials::ElasticMaterial* _material; ///< Material associated with integrator.
 
   topology::StratumIS* _materialIS; ///< Index set for material cells.
+  topology::ElementRestriction* _dispRestriction; ///< Restriction of solution fields to material cells.
+  topology::ElementRestriction* _coordsRestriction; ///< Restriction of coordinates to material cells.
+  topology::ElementRestriction* _jacobianRestriction; ///< Restriction with global indices for Jacobian assembly.
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
+  elasticityResidual_fn_type _elasticityResidualFn; ///< Kernel for elasticity term in residual.
+  elasticityJacobian_fn_type _elasticityJacobianFn; ///< Kernel for elasticity term in Jacobian.
+  totalStrain_fn_type _calcTotalStrainFn; ///< Kernel for total strain.
+
+  bool _avgCellOutput; ///< True if cell output fields are averaged over quadrature points.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -30,6 +30,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -43,7 +44,9 @@
 
 // ----------------------------------------------------------------------
 // Constructor
-pylith::feassemble::IntegratorElasticityLgDeform::IntegratorElasticityLgDeform(void)
+pylith::feassemble::IntegratorElasticityLgDeform::IntegratorElasticityLgDeform(void) :
+  _lgDeformResidualFn(0),
+  _lgDeformJacobianFn(0)
 { // constructor
 } // constructor
 
@@ -112,10 +115,10 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
 
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -124,14 +127,14 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
     const PetscInt cell = cells[c];
 
     // Retrieve geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     // Get physical properties and state variables for cell.
     _material->retrievePropsAndVars(cell);
 
-    dispVisitor.getClosure(&dispCell, cell);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
   
     // Compute deformation tensor.
     _calcDeformation(&deformCell, basisDeriv, &dispCell[0], numBasis, numQuadPts, spaceDim);
@@ -200,13 +203,14 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
-  dispVisitor.optimizeClosure();
 
   topology::VecVisitorMesh fieldVisitor(*field);
   PetscScalar* fieldArray = fieldVisitor.localArray();
+  const scalar_array& quadWts = _quadrature->quadWts();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _setupRestrictions(dmMesh, dispVisitor.localSection());
 
   _material->createPropsAndVarsVisitors();
 
@@ -215,12 +219,12 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
     const PetscInt cell = cells[c];
 
     // Retrieve geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
+    _coordsRestriction->gather(&coordsCell, coordsVisitor.localArray(), c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     // Restrict input fields to cell
-    dispVisitor.getClosure(&dispCell, cell);
+    _dispRestriction->gather(&dispCell, dispVisitor.localArray(), c);
 
     // Compute deformation tensor.
     _calcDeformation(&deformCell, basisDeriv, &dispCell[0], numBasis, numQuadPts, spaceDim);
@@ -228,13 +232,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
     // Compute strains
     calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
 
-    const PetscInt off = fieldVisitor.sectionOffset(cell);
-    assert(tensorCellSize == fieldVisitor.sectionDof(cell));
-    if (!calcStress) {
-      for (int i=0; i < tensorCellSize; ++i) {
-	fieldArray[off+i] = strainCell[i];
-      } // for
-    } else {
+    if (calcStress) {
       _material->retrievePropsAndVars(cell);
       stressCell = _material->calcStress(strainCell);
 
@@ -244,15 +242,20 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
 	} else if (3 == spaceDim) {
 	  _calcCauchyStress3D(&stressCauchyCell, stressCell, deformCell, numQuadPts);
 	} // if/else
-	for (int i=0; i < tensorCellSize; ++i) {
-	  fieldArray[off+i] = stressCauchyCell[i];
-	} // for
-      } else {
-	for (int i=0; i < tensorCellSize; ++i) {
-	  fieldArray[off+i] = stressCell[i];
-	} // for
-      } // if/else
-    } // else
+      } // if
+    } // if
+    const scalar_array& tensorCell = (!calcStress) ? strainCell : ((calcCauchyStress) ? stressCauchyCell : stressCell);
+
+    const PetscInt off = fieldVisitor.sectionOffset(cell);
+    if (_avgCellOutput) {
+      assert(tensorSize == fieldVisitor.sectionDof(cell));
+      _averageQuadPts(&fieldArray[off], tensorCell, quadWts, tensorSize);
+    } else {
+      assert(tensorCellSize == fieldVisitor.sectionDof(cell));
+      for (int i=0; i < tensorCellSize; ++i) {
+	fieldArray[off+i] = tensorCell[i];
+      } // for
+    } // if/else
   } // for
   _material->destroyPropsAndVarsVisitors();
 
@@ -261,12 +264,13 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 2-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const scalar_array& stress,
-									const scalar_array& disp)
-{ // _elasticityResidual2D
-  const int numQuadPts = _quadrature->numQuadPts();
-  const int numBasis = _quadrature->numBasis();
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2DT(const scalar_array& stress,
+									 const scalar_array& disp)
+{ // _elasticityResidual2DT
+  const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+  const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
   const int cellDim = _quadrature->cellDim();
   const scalar_array& quadWts = _quadrature->quadWts();
@@ -275,6 +279,8 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const sc
   
   assert(2 == cellDim);
   assert(quadWts.size() == size_t(numQuadPts));
+  assert(_quadrature->numQuadPts() == numQuadPts);
+  assert(_quadrature->numBasis() == numBasis);
   const int stressSize = 3;
 
   // Compute deformation gradient tensor.
@@ -307,16 +313,17 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const sc
   } // for
 
   PetscLogFlops(numQuadPts*(1+numBasis*(4*2+2+2*13)));
-} // _elasticityResidual2D
+} // _elasticityResidual2DT
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 3-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const scalar_array& stress,
-									const scalar_array& disp)
-{ // _elasticityResidual3D
-  const int numQuadPts = _quadrature->numQuadPts();
-  const int numBasis = _quadrature->numBasis();
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3DT(const scalar_array& stress,
+									 const scalar_array& disp)
+{ // _elasticityResidual3DT
+  const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+  const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
   const int cellDim = _quadrature->cellDim();
   const scalar_array& quadWts = _quadrature->quadWts();
@@ -325,6 +332,8 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const sc
   
   assert(3 == cellDim);
   assert(quadWts.size() == size_t(numQuadPts));
+  assert(_quadrature->numQuadPts() == numQuadPts);
+  assert(_quadrature->numBasis() == numBasis);
   const int stressSize = 6;
   
   // Compute deformation gradient tensor.
@@ -369,17 +378,18 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const sc
   } // for
 
   PetscLogFlops(numQuadPts*(1+numBasis*(2*9+3+3*27)));
-} // _elasticityResidual3D
+} // _elasticityResidual3DT
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in Jacobian for 2-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const scalar_array& elasticConsts,
-									const scalar_array& stress,
-									const scalar_array& disp)
-{ // _elasticityJacobian2D
-  const int numQuadPts = _quadrature->numQuadPts();
-  const int numBasis = _quadrature->numBasis();
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2DT(const scalar_array& elasticConsts,
+									 const scalar_array& stress,
+									 const scalar_array& disp)
+{ // _elasticityJacobian2DT
+  const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+  const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
   const int cellDim = _quadrature->cellDim();
   const scalar_array& quadWts = _quadrature->quadWts();
@@ -389,6 +399,8 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const sc
   
   assert(2 == cellDim);
   assert(quadWts.size() == size_t(numQuadPts));
+  assert(_quadrature->numQuadPts() == numQuadPts);
+  assert(_quadrature->numBasis() == numBasis);
   const int numConsts = 9;
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
@@ -495,17 +507,18 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const sc
     } // for
   } // for
   PetscLogFlops(numQuadPts*(1+numBasis*(2+numBasis*(3*11+4))));
-} // _elasticityJacobian2D
+} // _elasticityJacobian2DT
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in Jacobian for 3-D cells.
+template<int numBasisT, int numQuadPtsT>
 void
-pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const scalar_array& elasticConsts,
-									const scalar_array& stress,
-									const scalar_array& disp)
-{ // _elasticityJacobian3D
-  const int numQuadPts = _quadrature->numQuadPts();
-  const int numBasis = _quadrature->numBasis();
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3DT(const scalar_array& elasticConsts,
+									 const scalar_array& stress,
+									 const scalar_array& disp)
+{ // _elasticityJacobian3DT
+  const int numQuadPts = (numQuadPtsT > 0) ? numQuadPtsT : _quadrature->numQuadPts();
+  const int numBasis = (numBasisT > 0) ? numBasisT : _quadrature->numBasis();
   const int spaceDim = _quadrature->spaceDim();
   const int cellDim = _quadrature->cellDim();
   const scalar_array& quadWts = _quadrature->quadWts();
@@ -515,6 +528,8 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const sc
 
   assert(3 == cellDim);
   assert(quadWts.size() == size_t(numQuadPts));
+  assert(_quadrature->numQuadPts() == numQuadPts);
+  assert(_quadrature->numBasis() == numBasis);
   assert(6 == tensorSize);
   const int numConsts = 36;
 
@@ -976,8 +991,89 @@ pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const sc
     } // for
   } // for
   PetscLogFlops(numQuadPts*(1+numBasis*(3+numBasis*(6*26+9))));
+} // _elasticityJacobian3DT
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in residual for 2-D cells.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D(const scalar_array& stress,
+									const scalar_array& disp)
+{ // _elasticityResidual2D
+  _elasticityResidual2DT<0,0>(stress, disp);
+} // _elasticityResidual2D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in residual for 3-D cells.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D(const scalar_array& stress,
+									const scalar_array& disp)
+{ // _elasticityResidual3D
+  _elasticityResidual3DT<0,0>(stress, disp);
+} // _elasticityResidual3D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in Jacobian for 2-D cells.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D(const scalar_array& elasticConsts,
+									const scalar_array& stress,
+									const scalar_array& disp)
+{ // _elasticityJacobian2D
+  _elasticityJacobian2DT<0,0>(elasticConsts, stress, disp);
+} // _elasticityJacobian2D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in Jacobian for 3-D cells.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D(const scalar_array& elasticConsts,
+									const scalar_array& stress,
+									const scalar_array& disp)
+{ // _elasticityJacobian3D
+  _elasticityJacobian3DT<0,0>(elasticConsts, stress, disp);
 } // _elasticityJacobian3D
 
+// ----------------------------------------------------------------------
+// Select kernels for the cell type and quadrature scheme.
+void
+pylith::feassemble::IntegratorElasticityLgDeform::_setupKernels(void)
+{ // _setupKernels
+  IntegratorElasticity::_setupKernels();
+
+  assert(_quadrature);
+  const int cellDim = _quadrature->cellDim();
+  const int numBasis = _quadrature->numBasis();
+  const int numQuadPts = _quadrature->numQuadPts();
+
+  _lgDeformResidualFn = 0;
+  _lgDeformJacobianFn = 0;
+  if (cellDim != _quadrature->spaceDim()) {
+    return;
+  } // if
+
+  if (2 == cellDim) {
+    if (3 == numBasis && 1 == numQuadPts) {
+      _lgDeformResidualFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2DT<3,1>;
+      _lgDeformJacobianFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2DT<3,1>;
+    } else if (4 == numBasis && 4 == numQuadPts) {
+      _lgDeformResidualFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2DT<4,4>;
+      _lgDeformJacobianFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2DT<4,4>;
+    } else {
+      _lgDeformResidualFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual2D;
+      _lgDeformJacobianFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian2D;
+    } // if/else
+  } else if (3 == cellDim) {
+    if (4 == numBasis && 1 == numQuadPts) {
+      _lgDeformResidualFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3DT<4,1>;
+      _lgDeformJacobianFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3DT<4,1>;
+    } else if (8 == numBasis && 8 == numQuadPts) {
+      _lgDeformResidualFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3DT<8,8>;
+      _lgDeformJacobianFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3DT<8,8>;
+    } else {
+      _lgDeformResidualFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityResidual3D;
+      _lgDeformJacobianFn = &pylith::feassemble::IntegratorElasticityLgDeform::_elasticityJacobian3D;
+    } // if/else
+  } // if/else
+} // _setupKernels
+
 // ----------------------------------------------------------------------
 // Calculate Green-Lagrange strain tensor at quadrature points of a 2-D cell.
 void 
@@ -47,6 +47,17 @@ public :
 				      const int);
   
 
+// PROTECTED TYPEDEFS ///////////////////////////////////////////////////
+protected :
+
+  /// Member prototype for _elasticityResidualXD()
+  typedef void (pylith::feassemble::IntegratorElasticityLgDeform::*lgDeformResidual_fn_type)
+    (const scalar_array&, const scalar_array&);
+
+  /// Member prototype for _elasticityJacobianXD()
+  typedef void (pylith::feassemble::IntegratorElasticityLgDeform::*lgDeformJacobian_fn_type)
+    (const scalar_array&, const scalar_array&, const scalar_array&);
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -121,6 +132,59 @@ protected :
 			     const scalar_array& stress,
 			     const scalar_array& disp);
 
+  /** Select kernels for integrating the elasticity terms for the
+   * cell type and quadrature scheme.
+   */
+  void _setupKernels(void);
+
+  /** Integrate elasticity term in residual for 2-D cells with number
+   * of basis functions and quadrature points fixed at compile time (0
+   * uses the values from the quadrature).
+   *
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param disp Displacement field at cell's DOF.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityResidual2DT(const scalar_array& stress,
+			      const scalar_array& disp);
+
+  /** Integrate elasticity term in residual for 3-D cells with number
+   * of basis functions and quadrature points fixed at compile time (0
+   * uses the values from the quadrature).
+   *
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param disp Displacement field at cell's DOF.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityResidual3DT(const scalar_array& stress,
+			      const scalar_array& disp);
+
+  /** Integrate elasticity term in Jacobian for 2-D cells with number
+   * of basis functions and quadrature points fixed at compile time (0
+   * uses the values from the quadrature).
+   *
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param disp Displacement field at cell's DOF.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityJacobian2DT(const scalar_array& elasticConsts,
+			      const scalar_array& stress,
+			      const scalar_array& disp);
+
+  /** Integrate elasticity term in Jacobian for 3-D cells with number
+   * of basis functions and quadrature points fixed at compile time (0
+   * uses the values from the quadrature).
+   *
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param disp Displacement field at cell's DOF.
+   */
+  template<int numBasisT, int numQuadPtsT>
+  void _elasticityJacobian3DT(const scalar_array& elasticConsts,
+			      const scalar_array& stress,
+			      const scalar_array& disp);
+
   /** Calculate Green-Lagrange strain tensor at quadrature points of a
    *  1-D cell.
    *
@@ -200,6 +264,12 @@ protected :
 			   const scalar_array& deform,
 			   const int numQuadPts);
 
+// PROTECTED MEMBERS ////////////////////////////////////////////////////
+protected :
+
+  lgDeformResidual_fn_type _lgDeformResidualFn; ///< Kernel for elasticity term in residual.
+  lgDeformJacobian_fn_type _lgDeformJacobianFn; ///< Kernel for elasticity term in Jacobian.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
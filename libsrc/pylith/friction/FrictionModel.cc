@@ -28,6 +28,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/constdefs.h" // USES MAXSCALAR
 #include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
@@ -80,6 +81,15 @@ pylith::friction::FrictionModel::deallocate(void)
   PYLITH_METHOD_END;
 } // deallocate
   
+// ----------------------------------------------------------------------
+// Get stable time step for advancing state variables.
+PylithScalar
+pylith::friction::FrictionModel::stableTimeStep(void) const
+{ // stableTimeStep
+  // Assume any time step will work.
+  return pylith::PYLITH_MAXSCALAR;
+} // stableTimeStep
+
 // ----------------------------------------------------------------------
 // Set scales used to nondimensionalize physical properties.
 void
@@ -442,6 +452,73 @@ pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
   PYLITH_METHOD_END;
 } // updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFrictionBatch(PylithScalar* const friction,
+						   const PylithScalar t,
+						   const PylithScalar* slip,
+						   const PylithScalar* slipRate,
+						   const PylithScalar* normalTraction,
+						   const int* points,
+						   const int numPoints)
+{ // calcFrictionBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  if (numPoints <= 0)
+    PYLITH_METHOD_END;
+  assert(friction);
+  assert(slip);
+  assert(slipRate);
+  assert(normalTraction);
+  assert(points);
+
+  _gatherPropsStateVarsBatch(points, numPoints);
+  const PylithScalar* propertiesBatch = &_propsStateVarsBatch[0];
+  const PylithScalar* stateVarsBatch = (_varsFiberDim > 0) ?
+    &_propsStateVarsBatch[_propsFiberDim*numPoints] : 0;
+
+  _calcFrictionBatch(friction, t, slip, slipRate, normalTraction, numPoints,
+		     propertiesBatch, _propsFiberDim,
+		     stateVarsBatch, _varsFiberDim);
+
+  PYLITH_METHOD_END;
+} // calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute update to state variables at a batch of vertices.
+void
+pylith::friction::FrictionModel::updateStateVarsBatch(const PylithScalar t,
+						      const PylithScalar* slip,
+						      const PylithScalar* slipRate,
+						      const PylithScalar* normalTraction,
+						      const int* points,
+						      const int numPoints)
+{ // updateStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  if (0 == _varsFiberDim || numPoints <= 0)
+    PYLITH_METHOD_END;
+  assert(slip);
+  assert(slipRate);
+  assert(normalTraction);
+  assert(points);
+
+  _gatherPropsStateVarsBatch(points, numPoints);
+  const PylithScalar* propertiesBatch = &_propsStateVarsBatch[0];
+  PylithScalar* stateVarsBatch = &_propsStateVarsBatch[_propsFiberDim*numPoints];
+
+  _updateStateVarsBatch(t, slip, slipRate, normalTraction, numPoints,
+			stateVarsBatch, _varsFiberDim,
+			propertiesBatch, _propsFiberDim);
+
+  _scatterStateVarsBatch(points, numPoints);
+
+  PYLITH_METHOD_END;
+} // updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -457,6 +534,61 @@ pylith::friction::FrictionModel::_updateStateVars(
 { // _updateStateVars
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::FrictionModel::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const int numPoints,
+						    const PylithScalar* properties,
+						    const int numProperties,
+						    const PylithScalar* stateVars,
+						    const int numStateVars)
+{ // _calcFrictionBatch
+  scalar_array propertiesVertex(numProperties);
+  scalar_array stateVarsVertex(numStateVars);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numProperties; ++i)
+      propertiesVertex[i] = properties[i*numPoints+iPoint];
+    for (int i=0; i < numStateVars; ++i)
+      stateVarsVertex[i] = stateVars[i*numPoints+iPoint];
+    friction[iPoint] = _calcFriction(t, slip[iPoint], slipRate[iPoint], normalTraction[iPoint],
+				     (numProperties > 0) ? &propertiesVertex[0] : 0, numProperties,
+				     (numStateVars > 0) ? &stateVarsVertex[0] : 0, numStateVars);
+  } // for
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::FrictionModel::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       const int numPoints,
+						       PylithScalar* const stateVars,
+						       const int numStateVars,
+						       const PylithScalar* properties,
+						       const int numProperties)
+{ // _updateStateVarsBatch
+  scalar_array propertiesVertex(numProperties);
+  scalar_array stateVarsVertex(numStateVars);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numProperties; ++i)
+      propertiesVertex[i] = properties[i*numPoints+iPoint];
+    for (int i=0; i < numStateVars; ++i)
+      stateVarsVertex[i] = stateVars[i*numPoints+iPoint];
+    _updateStateVars(t, slip[iPoint], slipRate[iPoint], normalTraction[iPoint],
+		     (numStateVars > 0) ? &stateVarsVertex[0] : 0, numStateVars,
+		     (numProperties > 0) ? &propertiesVertex[0] : 0, numProperties);
+    for (int i=0; i < numStateVars; ++i)
+      stateVars[i*numPoints+iPoint] = stateVarsVertex[i];
+  } // for
+} // _updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Setup fields for physical properties and state variables.
 void
@@ -524,4 +656,91 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
 } // _setupPropsStateVars
 
 
+// ----------------------------------------------------------------------
+// Gather properties and state variables for a batch of vertices.
+void
+pylith::friction::FrictionModel::_gatherPropsStateVarsBatch(const int* points,
+							    const int numPoints)
+{ // _gatherPropsStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  assert(points);
+
+  const size_t batchSize = (_propsFiberDim+_varsFiberDim)*numPoints;
+  if (_propsStateVarsBatch.size() != batchSize)
+    _propsStateVarsBatch.resize(batchSize);
+
+  // Values are stored by field component, so the offset of component
+  // iOff of vertex iPoint is iOff*numPoints+iPoint.
+  PetscInt iOff = 0;
+  for (int i=0; i < _metadata.numProperties(); ++i) {
+    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
+    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
+    topology::VecVisitorMesh propertyVisitor(propertyField);
+    const PetscScalar* propertyArray = propertyVisitor.localArray();
+    const int fiberDim = property.fiberDim;
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt off = propertyVisitor.sectionOffset(points[iPoint]);
+      assert(fiberDim == propertyVisitor.sectionDof(points[iPoint]));
+      for (int d=0; d < fiberDim; ++d) {
+	_propsStateVarsBatch[(iOff+d)*numPoints+iPoint] = propertyArray[off+d];
+      } // for
+    } // for
+    iOff += fiberDim;
+  } // for
+  for (int i=0; i < _metadata.numStateVars(); ++i) {
+    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
+    topology::VecVisitorMesh stateVarVisitor(stateVarField);
+    const PetscScalar* stateVarArray = stateVarVisitor.localArray();
+    const int fiberDim = stateVar.fiberDim;
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt off = stateVarVisitor.sectionOffset(points[iPoint]);
+      assert(fiberDim == stateVarVisitor.sectionDof(points[iPoint]));
+      for (int d=0; d < fiberDim; ++d) {
+	_propsStateVarsBatch[(iOff+d)*numPoints+iPoint] = stateVarArray[off+d];
+      } // for
+    } // for
+    iOff += fiberDim;
+  } // for
+  assert(_propsFiberDim+_varsFiberDim == iOff);
+
+  PYLITH_METHOD_END;
+} // _gatherPropsStateVarsBatch
+
+// ----------------------------------------------------------------------
+// Scatter state variables for a batch of vertices.
+void
+pylith::friction::FrictionModel::_scatterStateVarsBatch(const int* points,
+							const int numPoints)
+{ // _scatterStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  assert(points);
+  assert(_propsStateVarsBatch.size() == size_t((_propsFiberDim+_varsFiberDim)*numPoints));
+
+  // Properties do not change, so only state variables are scattered.
+  PetscInt iOff = _propsFiberDim;
+  for (int i=0; i < _metadata.numStateVars(); ++i) {
+    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
+    topology::VecVisitorMesh stateVarVisitor(stateVarField);
+    PetscScalar* stateVarArray = stateVarVisitor.localArray();
+    const int fiberDim = stateVar.fiberDim;
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt off = stateVarVisitor.sectionOffset(points[iPoint]);
+      assert(fiberDim == stateVarVisitor.sectionDof(points[iPoint]));
+      for (int d=0; d < fiberDim; ++d) {
+	stateVarArray[off+d] = _propsStateVarsBatch[(iOff+d)*numPoints+iPoint];
+      } // for
+    } // for
+    iOff += fiberDim;
+  } // for
+
+  PYLITH_METHOD_END;
+} // _scatterStateVarsBatch
+
+
 // End of file 
@@ -90,6 +90,15 @@ public :
    */
   PylithScalar timeStep(void) const;
 
+  /** Get stable time step for advancing state variables.
+   *
+   * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
+   *
+   * @returns Time step
+   */
+  virtual
+  PylithScalar stableTimeStep(void) const;
+
   /** Set database for physical property parameters.
    *
    * @param value Pointer to database.
@@ -208,6 +217,44 @@ public :
 		       const PylithScalar normalTraction,
 		       const int vertex);
   
+  /** Compute friction at a batch of vertices.
+   *
+   * Properties and state variables for all of the vertices are
+   * gathered once into structure-of-arrays buffers, so
+   * retrievePropsStateVars() does not need to be called.
+   *
+   * @param friction Array of friction (magnitude of shear traction) [numPoints].
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param points Array of vertices on friction interface [numPoints].
+   * @param numPoints Number of vertices in batch.
+   */
+  void calcFrictionBatch(PylithScalar* const friction,
+			 const PylithScalar t,
+			 const PylithScalar* slip,
+			 const PylithScalar* slipRate,
+			 const PylithScalar* normalTraction,
+			 const int* points,
+			 const int numPoints);
+
+  /** Compute update to state variables at a batch of vertices.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param points Array of vertices on friction interface [numPoints].
+   * @param numPoints Number of vertices in batch.
+   */
+  void updateStateVarsBatch(const PylithScalar t,
+			    const PylithScalar* slip,
+			    const PylithScalar* slipRate,
+			    const PylithScalar* normalTraction,
+			    const int* points,
+			    const int numPoints);
+  
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -335,12 +382,86 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction at a batch of vertices from properties and
+   * state variables stored as structure-of-arrays, i.e., value i of
+   * vertex iPoint is at [i*numPoints+iPoint].
+   *
+   * Default implementation calls _calcFriction() for each vertex.
+   *
+   * @param friction Array of friction (magnitude of shear traction) [numPoints].
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   */
+  virtual
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const int numPoints,
+			  const PylithScalar* properties,
+			  const int numProperties,
+			  const PylithScalar* stateVars,
+			  const int numStateVars);
+
+  /** Update state variables (for next time step) at a batch of
+   * vertices from properties and state variables stored as
+   * structure-of-arrays.
+   *
+   * Default implementation calls _updateStateVars() for each vertex.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   */
+  virtual
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     const int numPoints,
+			     PylithScalar* const stateVars,
+			     const int numStateVars,
+			     const PylithScalar* properties,
+			     const int numProperties);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
   /// Setup fields for physical properties and state variables.
   void _setupPropsStateVars(void);
 
+  /** Gather properties and state variables for a batch of vertices
+   * into structure-of-arrays buffer.
+   *
+   * @param points Array of vertices on friction interface [numPoints].
+   * @param numPoints Number of vertices in batch.
+   */
+  void _gatherPropsStateVarsBatch(const int* points,
+				  const int numPoints);
+
+  /** Scatter state variables for a batch of vertices from
+   * structure-of-arrays buffer.
+   *
+   * @param points Array of vertices on friction interface [numPoints].
+   * @param numPoints Number of vertices in batch.
+   */
+  void _scatterStateVarsBatch(const int* points,
+			      const int numPoints);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -369,6 +490,9 @@ private :
   /// Buffer for properties and state variables at vertex.
   scalar_array _propsStateVarsVertex;
 
+  /// Buffer for properties and state variables for batch of vertices.
+  scalar_array _propsStateVarsBatch;
+
   int _propsFiberDim; ///< Number of properties per point.
   int _varsFiberDim; ///< Number of state variables per point.
 
@@ -29,6 +29,7 @@
 
 #include "petsc.h" // USES PetscLogFlops
 
+#include <cmath> // USES exp(), log(), pow()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -52,11 +53,12 @@ namespace pylith {
       };
 
       // Number of State Variables.
-      const int numStateVars = 1;
+      const int numStateVars = 2;
 
       // State Variables.
       const pylith::materials::Metadata::ParamDescription stateVars[] = {
         { "state_variable", 1, pylith::topology::FieldBase::SCALAR },
+        { "previous_slip_rate", 1, pylith::topology::FieldBase::SCALAR },
       };
 
       // Values expected in spatial database
@@ -70,10 +72,102 @@ namespace pylith {
 	"cohesion",
       };
 
+      // Previous slip rate is not in the spatial database; it is
+      // set by the first update of the state variables.
       const int numDBStateVars = 1;
       const char* dbStateVars[1] = {
 	"state-variable",
       };
+
+      /** Integrate ageing law over a time step with constant slip rate.
+       *
+       * d(theta)/dt = (1 - slipRate * theta / L)
+       *
+       * Use separation of variables to integrate above ODE from
+       * t->t+dt, keeping slip rate constant.
+       *
+       * thetaTpdt = thetaT * exp(-slipRate/L * dt)
+       *             + L/slipRate * (1 -  exp(-slipRate/L * dt))
+       *
+       * As slipRate --> 0, L/sliprate --> infinity and
+       * exp(-sliprate/L*dt) --> 1.  To determine, d(theta)/dt near
+       * sliprate == 0, we expand the exponential term in a Taylor
+       * series:
+       *
+       * exp(-x) = 1 - x +1/2*x**2 + 1/6*x**3
+       *
+       * This leads to (in the vicinity of slipRate == 0):
+       *
+       * thetaTpdt = thetaT * exp(-slipRate/L * dt)
+       *             + dt - 0.5*(sliprate/L)*dt**2 + 1.0/6.0*(slipRate/L)*dt**3;
+       *
+       * The slip rate in L/slipRate is replaced by 1.0 when the Taylor
+       * series is used so that both expressions stay finite and the
+       * function does not branch.
+       *
+       * @param thetaT State variable at time t.
+       * @param slipRate Slip rate over time step.
+       * @param L Characteristic slip distance.
+       * @param dt Time step.
+       *
+       * @returns State variable at time t+dt.
+       */
+      inline
+      PylithScalar ageingStep(const PylithScalar thetaT,
+			      const PylithScalar slipRate,
+			      const PylithScalar L,
+			      const PylithScalar dt) {
+	const PylithScalar vDtL = slipRate * dt / L;
+	const PylithScalar expTerm = exp(-vDtL);
+	const bool useExp = vDtL > 1.0e-20;
+	const PylithScalar slipRateSafe = useExp ? slipRate : 1.0;
+	return useExp ?
+	  thetaT * expTerm + L / slipRateSafe * (1 - expTerm) :
+	  thetaT * expTerm + dt - 0.5 * slipRate/L * dt*dt;
+      } // ageingStep
+
+      /** Advance ageing law over one substep with the slip rate
+       * varying linearly over the time step and estimate the error
+       * using step doubling. Each step uses the slip rate at its
+       * midpoint, so the local error is third order in the step size
+       * and Richardson extrapolation of the full step and two half
+       * steps improves the accuracy of the state variable.
+       *
+       * @param thetaTpdt State variable at end of substep.
+       * @param thetaT State variable at beginning of substep.
+       * @param slipRateT Slip rate at beginning of time step.
+       * @param slipRateTpdt Slip rate at end of time step.
+       * @param tau Time of beginning of substep relative to time step.
+       * @param h Length of substep.
+       * @param L Characteristic slip distance.
+       * @param dt Time step.
+       *
+       * @returns Relative error in state variable over substep.
+       */
+      inline
+      PylithScalar ageingSubstep(PylithScalar* thetaTpdt,
+				 const PylithScalar thetaT,
+				 const PylithScalar slipRateT,
+				 const PylithScalar slipRateTpdt,
+				 const PylithScalar tau,
+				 const PylithScalar h,
+				 const PylithScalar L,
+				 const PylithScalar dt) {
+	const PylithScalar dSlipRate = (dt > 0.0) ? (slipRateTpdt - slipRateT) / dt : 0.0;
+	const PylithScalar thetaFull = ageingStep(thetaT, slipRateT + dSlipRate*(tau+0.5*h), L, h);
+	const PylithScalar thetaHalf = ageingStep(thetaT, slipRateT + dSlipRate*(tau+0.25*h), L, 0.5*h);
+	const PylithScalar thetaDouble = ageingStep(thetaHalf, slipRateT + dSlipRate*(tau+0.75*h), L, 0.5*h);
+	*thetaTpdt = thetaDouble + (thetaDouble - thetaFull) / 3.0;
+
+	const PylithScalar thetaMag = fabs(thetaDouble) > fabs(thetaT) ? fabs(thetaDouble) : fabs(thetaT);
+	return (thetaMag > 0.0) ? fabs(thetaDouble - thetaFull) / thetaMag : 0.0;
+      } // ageingSubstep
+
+      // Safety factor and limits on change in step size for
+      // controlling substeps and stable time step.
+      const PylithScalar stepSafety = 0.9;
+      const PylithScalar stepShrinkMin = 0.2;
+      const PylithScalar stepGrowMax = 5.0;
       
     } // _RateStateAgeing
   } // friction
@@ -107,6 +201,8 @@ const int pylith::friction::RateStateAgeing::db_cohesion =
 
 // Indices of state variables.
 const int pylith::friction::RateStateAgeing::s_state = 0;
+const int pylith::friction::RateStateAgeing::s_slipRatePrev = 
+  pylith::friction::RateStateAgeing::s_state + 1;
 
 // Indices of database values (order must match dbProperties)
 const int pylith::friction::RateStateAgeing::db_state = 0;
@@ -122,7 +218,12 @@ pylith::friction::RateStateAgeing::RateStateAgeing(void) :
 				    _RateStateAgeing::numStateVars,
 				    _RateStateAgeing::dbStateVars,
 				    _RateStateAgeing::numDBStateVars)),
-  _linearSlipRate(1.0e-12)
+  _linearSlipRate(1.0e-12),
+  _stateTolerance(1.0e-6),
+  _maxSlipFraction(0.5),
+  _dtStable(pylith::PYLITH_MAXSCALAR),
+  _tStable(-pylith::PYLITH_MAXSCALAR),
+  _maxSubsteps(100)
 { // constructor
 } // constructor
 
@@ -148,6 +249,61 @@ pylith::friction::RateStateAgeing::linearSlipRate(const PylithScalar value)
   _linearSlipRate = value;
 } // linearSlipRate
 
+// ----------------------------------------------------------------------
+// Set tolerance for relative error in state variable over a time step.
+void
+pylith::friction::RateStateAgeing::stateTolerance(const PylithScalar value)
+{ // stateTolerance
+  if (value <= 0.0) {
+    std::ostringstream msg;
+    msg << "Tolerance (" << value << ") for error in state variable of rate state friction model "
+	<< label() << " must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+  
+  _stateTolerance = value;
+} // stateTolerance
+
+// ----------------------------------------------------------------------
+// Set maximum number of substeps used to integrate state variable
+// over a time step.
+void
+pylith::friction::RateStateAgeing::maxSubsteps(const int value)
+{ // maxSubsteps
+  if (value <= 0) {
+    std::ostringstream msg;
+    msg << "Maximum number of substeps (" << value << ") for rate state friction model "
+	<< label() << " must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+  
+  _maxSubsteps = value;
+} // maxSubsteps
+
+// ----------------------------------------------------------------------
+// Set maximum slip in a time step as a fraction of the characteristic
+// slip distance used for stable time step.
+void
+pylith::friction::RateStateAgeing::maxSlipFraction(const PylithScalar value)
+{ // maxSlipFraction
+  if (value <= 0.0) {
+    std::ostringstream msg;
+    msg << "Maximum slip fraction (" << value << ") for time step of rate state friction model "
+	<< label() << " must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+  
+  _maxSlipFraction = value;
+} // maxSlipFraction
+
+// ----------------------------------------------------------------------
+// Get stable time step for advancing state variables.
+PylithScalar
+pylith::friction::RateStateAgeing::stableTimeStep(void) const
+{ // stableTimeStep
+  return _dtStable;
+} // stableTimeStep
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -255,6 +411,8 @@ pylith::friction::RateStateAgeing::_dbToStateVars(PylithScalar* const stateValue
   assert(_RateStateAgeing::numDBStateVars == numDBValues);
 
   stateValues[s_state] = dbValues[db_state];
+  // Negative value indicates slip rate at previous time step is unknown.
+  stateValues[s_slipRatePrev] = -1.0;
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -267,9 +425,11 @@ pylith::friction::RateStateAgeing::_nondimStateVars(PylithScalar* const values,
   assert(values);
   assert(nvalues == _RateStateAgeing::numStateVars);
 
+  const PylithScalar lengthScale = _normalizer->lengthScale();
   const PylithScalar timeScale = _normalizer->timeScale();
 
   values[s_state] /= timeScale;
+  values[s_slipRatePrev] /= lengthScale / timeScale;
 } // _nondimStateVars
 
 // ----------------------------------------------------------------------
@@ -282,9 +442,11 @@ pylith::friction::RateStateAgeing::_dimStateVars(PylithScalar* const values,
   assert(values);
   assert(nvalues == _RateStateAgeing::numStateVars);
 
+  const PylithScalar lengthScale = _normalizer->lengthScale();
   const PylithScalar timeScale = _normalizer->timeScale();
 
   values[s_state] *= timeScale;
+  values[s_slipRatePrev] *= lengthScale / timeScale;
 } // _dimStateVars
 
 // ----------------------------------------------------------------------
@@ -394,43 +556,197 @@ pylith::friction::RateStateAgeing::_updateStateVars(const PylithScalar t,
   assert(numStateVars);
   assert(_RateStateAgeing::numStateVars == numStateVars);
 
-  // d(theta)/dt = (1 - slipRate * theta / L)
-  //
-  // Use separation of variables to integrate above ODE from t->t+dt,
-  // keeping slip rate constant.
-  //
-  // thetaTpdt = thetaT * exp(-slipRate/L * dt)
-  //             + L/slipRate * (1 -  exp(-slipRate/L * dt))
-  //
-  // As slipRate --> 0, L/sliprate --> infinity and
-  // exp(-sliprate/L*dt) --> 1.  To determine, d(theta)/dt near
-  // sliprate == 0, we expand the exponential term in a Taylor series:
-  //
-  // exp(-x) = 1 - x +1/2*x**2 + 1/6*x**3
-  //
-  // This leads to (in the vicinity of slipRate == 0):
-  //
-  // thetaTpdt = thetaT * exp(-slipRate/L * dt)
-  //             + dt - 0.5*(sliprate/L)*dt**2 + 1.0/6.0*(slipRate/L)*dt**3;
-
+  // Slip rate varies linearly over the time step from the slip rate
+  // at the previous update to the current slip rate. If the slip
+  // rate at the previous update is unknown, it is constant.
   const PylithScalar dt = _dt;
-  const PylithScalar thetaTVertex = stateVars[s_state];
   const PylithScalar L = properties[p_L];
-  const PylithScalar vDtL = slipRate * dt / L;
-  const PylithScalar expTerm = exp(-vDtL);
+  const PylithScalar slipRateT = (stateVars[s_slipRatePrev] >= 0.0) ? stateVars[s_slipRatePrev] : slipRate;
 
+  // Estimate error over a single step to get stable time step and
+  // only use substeps if the estimated error exceeds the tolerance.
   PylithScalar thetaTpdtVertex = 0.0;
-  if (vDtL > 1.0e-20) {
-    thetaTpdtVertex = thetaTVertex * expTerm + L / slipRate * (1 - expTerm);
-    PetscLogFlops(7);
-  } else {
-    thetaTpdtVertex = thetaTVertex * expTerm + dt - 0.5 * slipRate/L * dt*dt;
-    PetscLogFlops(9);
-  } // if/else
-  
+  const PylithScalar error = _RateStateAgeing::ageingSubstep(&thetaTpdtVertex, stateVars[s_state], slipRateT, slipRate, 0.0, dt, L, dt);
+  _updateStableTimeStep(t, error, slipRate, L);
+  if (error > _stateTolerance) {
+    thetaTpdtVertex = _integrateState(stateVars[s_state], slipRateT, slipRate, L, dt);
+  } // if
+  PetscLogFlops(30);
+
   stateVars[s_state] = thetaTpdtVertex;
+  stateVars[s_slipRatePrev] = slipRate;
 
 } // _updateStateVars
 
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::RateStateAgeing::_calcFrictionBatch(PylithScalar* const friction,
+						     const PylithScalar t,
+						     const PylithScalar* slip,
+						     const PylithScalar* slipRate,
+						     const PylithScalar* normalTraction,
+						     const int numPoints,
+						     const PylithScalar* properties,
+						     const int numProperties,
+						     const PylithScalar* stateVars,
+						     const int numStateVars)
+{ // _calcFrictionBatch
+  assert(properties);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(stateVars);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  const PylithScalar slipRateLinear = _linearSlipRate;
+
+  const PylithScalar* f0 = &properties[p_coef*numPoints];
+  const PylithScalar* a = &properties[p_a*numPoints];
+  const PylithScalar* b = &properties[p_b*numPoints];
+  const PylithScalar* L = &properties[p_L*numPoints];
+  const PylithScalar* slipRate0 = &properties[p_slipRate0*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  const PylithScalar* state = &stateVars[s_state*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar tn = normalTraction[iPoint];
+
+    // Prevent zero value for theta, reasonable value is L / slipRate0
+    const PylithScalar theta = (state[iPoint] > 0.0) ? state[iPoint] : L[iPoint] / slipRate0[iPoint];
+
+    // Below slipRateLinear, friction is linear in slip rate starting
+    // from the value at slipRateLinear. Evaluating both logs for every
+    // vertex keeps the loop free of branches.
+    const bool isLinear = slipRate[iPoint] < slipRateLinear;
+    const PylithScalar slipRateLog = isLinear ? slipRateLinear : slipRate[iPoint];
+    const PylithScalar linearTerm = isLinear ? a[iPoint]*(1.0 - slipRate[iPoint]/slipRateLinear) : 0.0;
+    const PylithScalar mu_f = f0[iPoint] + a[iPoint]*log(slipRateLog / slipRate0[iPoint]) + b[iPoint]*log(slipRate0[iPoint]*theta/L[iPoint]) - linearTerm;
+
+    friction[iPoint] = (tn <= 0.0) ? -mu_f * tn + cohesion[iPoint] : cohesion[iPoint];
+  } // for
+
+  PetscLogFlops(16*numPoints);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::RateStateAgeing::_updateStateVarsBatch(const PylithScalar t,
+							const PylithScalar* slip,
+							const PylithScalar* slipRate,
+							const PylithScalar* normalTraction,
+							const int numPoints,
+							PylithScalar* const stateVars,
+							const int numStateVars,
+							const PylithScalar* properties,
+							const int numProperties)
+{ // _updateStateVarsBatch
+  assert(properties);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(stateVars);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  // See _updateStateVars(). The single step with error estimate is
+  // computed for all vertices in one loop without branches, and only
+  // the vertices where the estimated error exceeds the tolerance are
+  // integrated again with substeps.
+  const PylithScalar dt = _dt;
+  const PylithScalar* L = &properties[p_L*numPoints];
+  PylithScalar* state = &stateVars[s_state*numPoints];
+  PylithScalar* slipRatePrev = &stateVars[s_slipRatePrev*numPoints];
+  scalar_array errorBatch(numPoints);
+  scalar_array thetaTBatch(state, numPoints);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar slipRateT = (slipRatePrev[iPoint] >= 0.0) ? slipRatePrev[iPoint] : slipRate[iPoint];
+    errorBatch[iPoint] = _RateStateAgeing::ageingSubstep(&state[iPoint], thetaTBatch[iPoint], slipRateT, slipRate[iPoint], 0.0, dt, L[iPoint], dt);
+  } // for
+  PetscLogFlops(30*numPoints);
+
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    _updateStableTimeStep(t, errorBatch[iPoint], slipRate[iPoint], L[iPoint]);
+    if (errorBatch[iPoint] > _stateTolerance) {
+      const PylithScalar slipRateT = (slipRatePrev[iPoint] >= 0.0) ? slipRatePrev[iPoint] : slipRate[iPoint];
+      state[iPoint] = _integrateState(thetaTBatch[iPoint], slipRateT, slipRate[iPoint], L[iPoint], dt);
+    } // if
+    slipRatePrev[iPoint] = slipRate[iPoint];
+  } // for
+} // _updateStateVarsBatch
+
+// ----------------------------------------------------------------------
+// Integrate ageing law over a time step using adaptive substeps.
+PylithScalar
+pylith::friction::RateStateAgeing::_integrateState(const PylithScalar thetaT,
+						   const PylithScalar slipRateT,
+						   const PylithScalar slipRateTpdt,
+						   const PylithScalar L,
+						   const PylithScalar dt)
+{ // _integrateState
+  // Local error of each substep is third order in the substep size,
+  // so the error scales with (h/hOld)**3. Substeps smaller than
+  // dt/_maxSubsteps are always accepted.
+  const PylithScalar hMin = dt / _maxSubsteps;
+  const PylithScalar tolerance = _stateTolerance;
+
+  PylithScalar theta = thetaT;
+  PylithScalar tau = 0.0;
+  PylithScalar h = dt;
+  int numSubsteps = 0;
+  bool isDone = false;
+  while (!isDone) {
+    const bool isLast = tau + h >= dt;
+    if (isLast) {
+      h = dt - tau;
+    } // if
+    PylithScalar thetaSubstep = 0.0;
+    const PylithScalar error = _RateStateAgeing::ageingSubstep(&thetaSubstep, theta, slipRateT, slipRateTpdt, tau, h, L, dt);
+    ++numSubsteps;
+
+    if (error <= tolerance || h <= hMin) {
+      theta = thetaSubstep;
+      tau += h;
+      isDone = isLast;
+    } // if
+
+    PylithScalar factor = (error > 0.0) ? _RateStateAgeing::stepSafety * pow(tolerance / error, 1.0/3.0) : _RateStateAgeing::stepGrowMax;
+    factor = (factor < _RateStateAgeing::stepShrinkMin) ? _RateStateAgeing::stepShrinkMin : factor;
+    factor = (factor > _RateStateAgeing::stepGrowMax) ? _RateStateAgeing::stepGrowMax : factor;
+    h = (h*factor > hMin) ? h*factor : hMin;
+  } // while
+
+  PetscLogFlops(numSubsteps*40);
+
+  return theta;
+} // _integrateState
+
+// ----------------------------------------------------------------------
+// Update stable time step using error estimate for state variable
+// over a single step and current slip rate.
+void
+pylith::friction::RateStateAgeing::_updateStableTimeStep(const PylithScalar t,
+							 const PylithScalar error,
+							 const PylithScalar slipRate,
+							 const PylithScalar L)
+{ // _updateStableTimeStep
+  // Start over at each update of the state variables.
+  if (t != _tStable) {
+    _dtStable = pylith::PYLITH_MAXSCALAR;
+    _tStable = t;
+  } // if
+
+  if (error > 0.0) {
+    const PylithScalar dtStable = _dt * _RateStateAgeing::stepSafety * pow(_stateTolerance / error, 1.0/3.0);
+    if (dtStable < _dtStable) {
+      _dtStable = dtStable;
+    } // if
+  } // if
+
+  // Limit slip over time step at current slip rate.
+  if (slipRate > 0.0) {
+    const PylithScalar dtSlip = _maxSlipFraction * L / slipRate;
+    if (dtSlip < _dtStable) {
+      _dtStable = dtSlip;
+    } // if
+  } // if
+} // _updateStableTimeStep
+
+
 // End of file 
@@ -31,6 +31,15 @@
  * Ageing Law : Eqn (19), of Kaneko et. al. (2008) added separate expression
  * if (slipRate * dt / L) < = 0.00001 by using Taylor series expansion of
  * exp(slipRate * dt / L) for the term (1 - exp(slipRate * dt / L))
+ *
+ * The ageing law is integrated over each time step with the slip rate
+ * varying linearly from the slip rate at the end of the previous time
+ * step to the current slip rate. Each substep uses the closed form
+ * solution above with the slip rate at the middle of the substep, and
+ * step doubling provides an estimate of the local error that controls
+ * the size of the substeps and the stable time step. The stable time
+ * step also limits the slip in a time step to a fraction of the
+ * characteristic slip distance (Lapusta et al., 2000).
  */
 
 #if !defined(pylith_friction_ratestateageing_hh)
@@ -66,6 +75,39 @@ public :
    */
   void linearSlipRate(const PylithScalar value);
 
+  /** Set tolerance for relative error in state variable over a time
+   * step.
+   *
+   * @param value Relative tolerance.
+   */
+  void stateTolerance(const PylithScalar value);
+
+  /** Set maximum number of substeps used to integrate state variable
+   * over a time step.
+   *
+   * @param value Maximum number of substeps.
+   */
+  void maxSubsteps(const int value);
+
+  /** Set maximum slip in a time step as a fraction of the
+   * characteristic slip distance used for stable time step.
+   *
+   * @param value Fraction of characteristic slip distance.
+   */
+  void maxSlipFraction(const PylithScalar value);
+
+  /** Get stable time step for advancing state variables.
+   *
+   * Minimum over vertices at the most recent update of the time
+   * step for which the estimated error in the state variable over a
+   * single step would meet the tolerance and the time step for which
+   * slip at the current slip rate would equal the maximum fraction
+   * of the characteristic slip distance.
+   *
+   * @returns Time step
+   */
+  PylithScalar stableTimeStep(void) const;
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -189,12 +231,108 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction at a batch of vertices from properties and
+   * state variables stored as structure-of-arrays.
+   *
+   * @param friction Array of friction (magnitude of shear traction) [numPoints].
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   */
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const int numPoints,
+			  const PylithScalar* properties,
+			  const int numProperties,
+			  const PylithScalar* stateVars,
+			  const int numStateVars);
+
+  /** Update state variables (for next time step) at a batch of
+   * vertices from properties and state variables stored as
+   * structure-of-arrays.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   */
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     const int numPoints,
+			     PylithScalar* const stateVars,
+			     const int numStateVars,
+			     const PylithScalar* properties,
+			     const int numProperties);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Integrate ageing law over a time step using adaptive substeps.
+   *
+   * @param thetaT State variable at time t.
+   * @param slipRateT Slip rate at time t.
+   * @param slipRateTpdt Slip rate at time t+dt.
+   * @param L Characteristic slip distance.
+   * @param dt Time step.
+   *
+   * @returns State variable at time t+dt.
+   */
+  PylithScalar _integrateState(const PylithScalar thetaT,
+			       const PylithScalar slipRateT,
+			       const PylithScalar slipRateTpdt,
+			       const PylithScalar L,
+			       const PylithScalar dt);
+
+  /** Update stable time step using error estimate for state variable
+   * over a single step and current slip rate.
+   *
+   * @param t Time in simulation.
+   * @param error Relative error in state variable over time step.
+   * @param slipRate Current slip rate.
+   * @param L Characteristic slip distance.
+   */
+  void _updateStableTimeStep(const PylithScalar t,
+			     const PylithScalar error,
+			     const PylithScalar slipRate,
+			     const PylithScalar L);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
   /// Floor for slip rate used in friction calculation.
   PylithScalar _linearSlipRate;
 
+  /// Tolerance for relative error in state variable over time step.
+  PylithScalar _stateTolerance;
+
+  /// Maximum slip in time step relative to characteristic slip distance.
+  PylithScalar _maxSlipFraction;
+
+  /// Stable time step from most recent update of state variables.
+  PylithScalar _dtStable;
+
+  /// Time of most recent update of state variables.
+  PylithScalar _tStable;
+
+  /// Maximum number of substeps over time step.
+  int _maxSubsteps;
+
   /// Indices for properties in section and spatial database.
   static const int p_coef;
   static const int p_slipRate0;
@@ -212,6 +350,7 @@ private :
 
   /// Indices for state variables in section and spatial database.
   static const int s_state;
+  static const int s_slipRatePrev;
 
   static const int db_state;
 
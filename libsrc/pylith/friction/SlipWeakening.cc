@@ -372,4 +372,74 @@ pylith::friction::SlipWeakening::_updateStateVars(const PylithScalar t,
 } // _updateStateVars
 
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::SlipWeakening::_calcFrictionBatch(PylithScalar* const friction,
+						   const PylithScalar t,
+						   const PylithScalar* slip,
+						   const PylithScalar* slipRate,
+						   const PylithScalar* normalTraction,
+						   const int numPoints,
+						   const PylithScalar* properties,
+						   const int numProperties,
+						   const PylithScalar* stateVars,
+						   const int numStateVars)
+{ // _calcFrictionBatch
+  assert(properties);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(stateVars);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  const PylithScalar* coefS = &properties[p_coefS*numPoints];
+  const PylithScalar* coefD = &properties[p_coefD*numPoints];
+  const PylithScalar* d0 = &properties[p_d0*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  const PylithScalar* slipCumT = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar tn = normalTraction[iPoint];
+    const PylithScalar slipCum = slipCumT[iPoint] + fabs(slip[iPoint] - slipPrev[iPoint]);
+    // Linear slip-weakening form of mu_f.
+    const PylithScalar mu_f = (slipCum < d0[iPoint]) ?
+      coefS[iPoint] - (coefS[iPoint] - coefD[iPoint]) * slipCum / d0[iPoint] :
+      coefD[iPoint];
+    friction[iPoint] = (tn <= 0.0) ? -mu_f * tn + cohesion[iPoint] : cohesion[iPoint];
+  } // for
+
+  PetscLogFlops(10*numPoints);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::SlipWeakening::_updateStateVarsBatch(const PylithScalar t,
+						      const PylithScalar* slip,
+						      const PylithScalar* slipRate,
+						      const PylithScalar* normalTraction,
+						      const int numPoints,
+						      PylithScalar* const stateVars,
+						      const int numStateVars,
+						      const PylithScalar* properties,
+						      const int numProperties)
+{ // _updateStateVarsBatch
+  assert(properties);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(stateVars);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  // Reset state variables if sliding has stopped.
+  const PylithScalar tolerance = 1.0e-12;
+  PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar slipIncr = fabs(slip[iPoint] - slipPrev[iPoint]);
+    slipCum[iPoint] = (slipRate[iPoint] > tolerance && !_forceHealing) ? slipCum[iPoint] + slipIncr : 0.0;
+    slipPrev[iPoint] = slip[iPoint];
+  } // for
+
+  PetscLogFlops(3*numPoints);
+} // _updateStateVarsBatch
+
+
 // End of file 
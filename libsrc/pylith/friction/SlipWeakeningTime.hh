@@ -168,6 +168,55 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction at a batch of vertices from properties and
+   * state variables stored as structure-of-arrays.
+   *
+   * @param friction Array of friction (magnitude of shear traction) [numPoints].
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   */
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const int numPoints,
+			  const PylithScalar* properties,
+			  const int numProperties,
+			  const PylithScalar* stateVars,
+			  const int numStateVars);
+
+  /** Update state variables (for next time step) at a batch of
+   * vertices from properties and state variables stored as
+   * structure-of-arrays.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   */
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     const int numPoints,
+			     PylithScalar* const stateVars,
+			     const int numStateVars,
+			     const PylithScalar* properties,
+			     const int numProperties);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
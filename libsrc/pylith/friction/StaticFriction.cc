@@ -183,4 +183,33 @@ pylith::friction::StaticFriction::_calcFrictionDeriv(const PylithScalar t,
 } // _calcFrictionDeriv
 
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::StaticFriction::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const int numPoints,
+						    const PylithScalar* properties,
+						    const int numProperties,
+						    const PylithScalar* stateVars,
+						    const int numStateVars)
+{ // _calcFrictionBatch
+  assert(properties);
+  assert(_StaticFriction::numProperties == numProperties);
+  assert(0 == numStateVars);
+
+  const PylithScalar* coef = &properties[p_coef*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar tn = normalTraction[iPoint];
+    friction[iPoint] = (tn <= 0.0) ? cohesion[iPoint] - coef[iPoint] * tn : cohesion[iPoint];
+  } // for
+
+  PetscLogFlops(2*numPoints);
+} // _calcFrictionBatch
+
+
 // End of file 
@@ -119,6 +119,31 @@ protected :
 				  const PylithScalar* stateVars,
 				  const int numStateVars);
 
+  /** Compute friction at a batch of vertices from properties and
+   * state variables stored as structure-of-arrays.
+   *
+   * @param friction Array of friction (magnitude of shear traction) [numPoints].
+   * @param t Time in simulation.
+   * @param slip Array of slip [numPoints].
+   * @param slipRate Array of slip rate [numPoints].
+   * @param normalTraction Array of normal traction [numPoints].
+   * @param numPoints Number of vertices in batch.
+   * @param properties Properties [numProperties*numPoints].
+   * @param numProperties Number of properties.
+   * @param stateVars State variables [numStateVars*numPoints].
+   * @param numStateVars Number of state variables.
+   */
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const int numPoints,
+			  const PylithScalar* properties,
+			  const int numProperties,
+			  const PylithScalar* stateVars,
+			  const int numStateVars);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
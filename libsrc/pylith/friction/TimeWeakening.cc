@@ -329,4 +329,68 @@ pylith::friction::TimeWeakening::_updateStateVars(const PylithScalar t,
 } // _updateStateVars
 
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::TimeWeakening::_calcFrictionBatch(PylithScalar* const friction,
+						   const PylithScalar t,
+						   const PylithScalar* slip,
+						   const PylithScalar* slipRate,
+						   const PylithScalar* normalTraction,
+						   const int numPoints,
+						   const PylithScalar* properties,
+						   const int numProperties,
+						   const PylithScalar* stateVars,
+						   const int numStateVars)
+{ // _calcFrictionBatch
+  assert(properties);
+  assert(_TimeWeakening::numProperties == numProperties);
+  assert(stateVars);
+  assert(_TimeWeakening::numStateVars == numStateVars);
+
+  const PylithScalar* coefS = &properties[p_coefS*numPoints];
+  const PylithScalar* coefD = &properties[p_coefD*numPoints];
+  const PylithScalar* Tc = &properties[p_Tc*numPoints];
+  const PylithScalar* cohesion = &properties[p_cohesion*numPoints];
+  const PylithScalar* time = &stateVars[s_time*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar tn = normalTraction[iPoint];
+    // Linear time-weakening form of mu_f.
+    const PylithScalar mu_f = (time[iPoint] < Tc[iPoint]) ?
+      coefS[iPoint] - (coefS[iPoint] - coefD[iPoint]) * time[iPoint] / Tc[iPoint] :
+      coefD[iPoint];
+    friction[iPoint] = (tn <= 0.0) ? -mu_f * tn + cohesion[iPoint] : cohesion[iPoint];
+  } // for
+
+  PetscLogFlops(6*numPoints);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::TimeWeakening::_updateStateVarsBatch(const PylithScalar t,
+						      const PylithScalar* slip,
+						      const PylithScalar* slipRate,
+						      const PylithScalar* normalTraction,
+						      const int numPoints,
+						      PylithScalar* const stateVars,
+						      const int numStateVars,
+						      const PylithScalar* properties,
+						      const int numProperties)
+{ // _updateStateVarsBatch
+  assert(properties);
+  assert(_TimeWeakening::numProperties == numProperties);
+  assert(stateVars);
+  assert(_TimeWeakening::numStateVars == numStateVars);
+
+  // Reset time if sliding has stopped.
+  const PylithScalar tolerance = 1.0e-12;
+  const PylithScalar dt = _dt;
+  PylithScalar* time = &stateVars[s_time*numPoints];
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    time[iPoint] = (slipRate[iPoint] > tolerance) ? time[iPoint] + dt : 0.0;
+  } // for
+} // _updateStateVarsBatch
+
+
 // End of file 
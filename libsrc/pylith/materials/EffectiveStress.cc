@@ -0,0 +1,86 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "EffectiveStress.hh" // implementation of object methods
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::materials::EffectiveStress::SolverLog::SolverLog(void) :
+  _logger(0),
+  _solveEvent(0),
+  _iterationEvent(0),
+  _fallbackEvent(0),
+  _numSolves(0),
+  _numIterations(0),
+  _numFallbacks(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::materials::EffectiveStress::SolverLog::~SolverLog(void)
+{ // destructor
+  delete _logger; _logger = 0;
+} // destructor
+
+// ----------------------------------------------------------------------
+// Register events.
+void
+pylith::materials::EffectiveStress::SolverLog::initialize(const char* className)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  delete _logger; _logger = new utils::EventLogger;assert(_logger);
+  _logger->className(className);
+  _logger->initialize();
+  _solveEvent = _logger->registerEvent("EffStress solve");
+  _iterationEvent = _logger->registerEvent("EffStress iterate");
+  _fallbackEvent = _logger->registerEvent("EffStress fallback");
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Add counts to events and reset them.
+void
+pylith::materials::EffectiveStress::SolverLog::report(void)
+{ // report
+  PYLITH_METHOD_BEGIN;
+
+  if (_logger) {
+    _logger->eventCount(_solveEvent, _numSolves);
+    _logger->eventCount(_iterationEvent, _numIterations);
+    _logger->eventCount(_fallbackEvent, _numFallbacks);
+  } // if
+  _numSolves = 0;
+  _numIterations = 0;
+  _numFallbacks = 0;
+
+  PYLITH_METHOD_END;
+} // report
+
+
+// End of file 
@@ -27,6 +27,9 @@
 // Include directives ---------------------------------------------------
 #include "materialsfwd.hh"
 
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
+#include "pylith/utils/types.hh" // USES PylithScalar
+
 // EffectiveStress ------------------------------------------------------
 /** @brief C++ EffectiveStress object.
  *
@@ -36,6 +39,18 @@
 class pylith::materials::EffectiveStress
 { // class EffectiveStress
 
+  // PUBLIC STRUCTS /////////////////////////////////////////////////////
+public :
+
+  /// Iteration statistics for a single effective stress solve.
+  struct SolveStats {
+    int numIterations; ///< Number of Newton function evaluations.
+    bool fallback; ///< True if Newton's method did not converge.
+  }; // SolveStats
+
+  /// Log of effective stress solves accumulated between reports.
+  class SolverLog;
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -57,6 +72,29 @@ public :
 		   const PylithScalar stressScale,
 		   material_type* const material);
 
+  /** Get effective stress using Newton's method warm-started from the
+   * initial guess.
+   *
+   * The initial guess is normally the converged effective stress from
+   * the previous time step, so Newton's method with the analytic
+   * derivative usually converges in a few iterations without
+   * bracketing the root. If Newton's method fails to converge, we
+   * fall back to calculate().
+   *
+   * @param effStressInitialGuess Initial guess for effective stress.
+   * @param stressScale Stress scale used if initial guess is zero.
+   * @param material Material with effective stress function.
+   * @param stats Iteration statistics for the solve (optional).
+   *
+   * @returns Computed effective stress.
+   */
+  template<typename material_type>
+  static
+  PylithScalar calculateWarmStart(const PylithScalar effStressInitialGuess,
+				  const PylithScalar stressScale,
+				  material_type* const material,
+				  SolveStats* stats =0);
+
   // PRIVATE METHODS /////////////////////////////////////////////////////
 private :
 
@@ -89,6 +127,90 @@ private :
 
 }; // class EffectiveStress
 
+// SolverLog ------------------------------------------------------------
+/** @brief Log of effective stress solves for a material.
+ *
+ * Solves are too fine-grained to log individually as events, so we
+ * count the solves, Newton iterations, and fallbacks to bracketing
+ * and add the counts to the events once per time step in report().
+ */
+class pylith::materials::EffectiveStress::SolverLog
+{ // class SolverLog
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  SolverLog(void);
+
+  /// Destructor
+  ~SolverLog(void);
+
+  /** Register events.
+   *
+   * Must be called on all processes, including those without any
+   * cells in the material, so all processes have the same events.
+   *
+   * @param className Name of logging class.
+   */
+  void initialize(const char* className);
+
+  /** Get effective stress using calculateWarmStart() and update counts.
+   *
+   * @param effStressInitialGuess Initial guess for effective stress.
+   * @param stressScale Stress scale used if initial guess is zero.
+   * @param material Material with effective stress function.
+   *
+   * @returns Computed effective stress.
+   */
+  template<typename material_type>
+  PylithScalar calculate(const PylithScalar effStressInitialGuess,
+			 const PylithScalar stressScale,
+			 material_type* const material);
+
+  /** Add counts to events and reset them.
+   *
+   * Counts are discarded if initialize() has not been called.
+   */
+  void report(void);
+
+  /** Get number of solves since last report.
+   *
+   * @returns Number of solves.
+   */
+  int numSolves(void) const;
+
+  /** Get number of Newton iterations since last report.
+   *
+   * @returns Number of Newton function evaluations.
+   */
+  int numIterations(void) const;
+
+  /** Get number of fallbacks to bracketing since last report.
+   *
+   * @returns Number of fallbacks.
+   */
+  int numFallbacks(void) const;
+
+  // NOT IMPLEMENTED ////////////////////////////////////////////////////
+private :
+
+  SolverLog(const SolverLog&); ///< Not implemented
+  const SolverLog& operator=(const SolverLog&); ///< Not implemented
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  utils::EventLogger* _logger; ///< Event logger.
+  int _solveEvent; ///< Event for effective stress solves.
+  int _iterationEvent; ///< Event for Newton iterations.
+  int _fallbackEvent; ///< Event for fallbacks to bracketing.
+  int _numSolves; ///< Number of solves since last report.
+  int _numIterations; ///< Number of Newton iterations since last report.
+  int _numFallbacks; ///< Number of fallbacks since last report.
+
+}; // class SolverLog
+
 #endif // pylith_materials_effectivestress_hh
 
 #include "EffectiveStress.icc" // template methods
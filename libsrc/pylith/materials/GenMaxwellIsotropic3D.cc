@@ -52,7 +52,7 @@ namespace pylith {
       const int numElasticConsts = 36;
 
       /// Number of physical properties.
-      const int numProperties = 5;
+      const int numProperties = 7;
       
       /// Physical properties.
       const Metadata::ParamDescription properties[numProperties] = {
@@ -61,6 +61,8 @@ namespace pylith {
 	{ "lambda", 1, pylith::topology::FieldBase::SCALAR },
 	{ "shear_ratio", numMaxwellModels, pylith::topology::FieldBase::OTHER },
 	{ "maxwell_time", numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_param", numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_decay", numMaxwellModels, pylith::topology::FieldBase::OTHER },
       };
       // Values expected in properties spatial database.  :KLUDGE: Not
       // generalized over number of models.
@@ -134,6 +136,14 @@ const int pylith::materials::GenMaxwellIsotropic3D::p_maxwellTime =
   pylith::materials::GenMaxwellIsotropic3D::p_shearRatio +
   pylith::materials::_GenMaxwellIsotropic3D::numMaxwellModels;
 
+const int pylith::materials::GenMaxwellIsotropic3D::p_viscousStrainParam =
+  pylith::materials::GenMaxwellIsotropic3D::p_maxwellTime +
+  pylith::materials::_GenMaxwellIsotropic3D::numMaxwellModels;
+
+const int pylith::materials::GenMaxwellIsotropic3D::p_viscousStrainDecay =
+  pylith::materials::GenMaxwellIsotropic3D::p_viscousStrainParam +
+  pylith::materials::_GenMaxwellIsotropic3D::numMaxwellModels;
+
 // Indices of database values (order must match dbProperties)
 const int pylith::materials::GenMaxwellIsotropic3D::db_density = 0;
 
@@ -307,6 +317,10 @@ pylith::materials::GenMaxwellIsotropic3D::_dbToProperties(
     } // if
     propValues[p_shearRatio + imodel] = muRatio;
     propValues[p_maxwellTime + imodel] = maxwellTime;
+
+    // Computed from nondimensional values in _dtToProperties().
+    propValues[p_viscousStrainParam + imodel] = 0.0;
+    propValues[p_viscousStrainDecay + imodel] = 0.0;
   } // for
 
   PetscLogFlops(6 + 3 * numMaxwellModels);
@@ -364,6 +378,30 @@ pylith::materials::GenMaxwellIsotropic3D::_dimProperties(PylithScalar* const val
   PetscLogFlops(3+1*numMaxwellModels);
 } // _dimProperties
 
+// ----------------------------------------------------------------------
+// Compute properties that depend on the current time step.
+void
+pylith::materials::GenMaxwellIsotropic3D::_dtToProperties(PylithScalar* const propValues,
+							   const int numValues)
+{ // _dtToProperties
+  assert(0 != propValues);
+  assert(numValues == _numPropsQuadPt);
+
+  const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
+  for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
+    PylithScalar dq = 0.0;
+    PylithScalar expFac = 0.0;
+    if (propValues[p_shearRatio + imodel] != 0.0) {
+      const PylithScalar maxwellTime = propValues[p_maxwellTime + imodel];
+      dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      expFac = exp(-_dt/maxwellTime);
+      PetscLogFlops(2);
+    } // if
+    propValues[p_viscousStrainParam + imodel] = dq;
+    propValues[p_viscousStrainDecay + imodel] = expFac;
+  } // for
+} // _dtToProperties
+
 // ----------------------------------------------------------------------
 // Compute initial state variables from values in spatial database.
 void
@@ -690,12 +728,9 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
     shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
     visFrac += shearRatio;
     if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      visFac += shearRatio*properties[p_viscousStrainParam + imodel];
     } // if
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
@@ -945,11 +980,8 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     properties[p_shearRatio+1],
     properties[p_shearRatio+2]
   };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
+  const PylithScalar* dq = &properties[p_viscousStrainParam];
+  const PylithScalar* expFac = &properties[p_viscousStrainDecay];
 
   // :TODO: Need to account for initial values for state variables
   const PylithScalar meanStrainTpdt =
@@ -963,13 +995,6 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
   
   PetscLogFlops(6);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
-
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
@@ -984,27 +1009,27 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel * tensorSize+iComp] = 
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      PetscLogFlops(4);
     } // if
 
     // Maxwell model 2
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      PetscLogFlops(4);
     } // if
 
     // Maxwell model 3
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      PetscLogFlops(4);
     } // if
 
   } // for
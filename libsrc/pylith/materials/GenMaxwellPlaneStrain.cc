@@ -52,7 +52,7 @@ namespace pylith {
       const int numElasticConsts = 9;
 
       /// Number of physical properties.
-      const int numProperties = 5;
+      const int numProperties = 7;
       
       /// Physical properties.
       const Metadata::ParamDescription properties[numProperties] = {
@@ -61,6 +61,8 @@ namespace pylith {
 	{ "lambda", 1, pylith::topology::FieldBase::SCALAR },
 	{ "shear_ratio", numMaxwellModels, pylith::topology::FieldBase::OTHER },
 	{ "maxwell_time", numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_param", numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_decay", numMaxwellModels, pylith::topology::FieldBase::OTHER },
       };
       // Values expected in properties spatial database.  :KLUDGE: Not
       // generalized over number of models.
@@ -127,6 +129,14 @@ const int pylith::materials::GenMaxwellPlaneStrain::p_maxwellTime =
   pylith::materials::GenMaxwellPlaneStrain::p_shearRatio +
   pylith::materials::_GenMaxwellPlaneStrain::numMaxwellModels;
 
+const int pylith::materials::GenMaxwellPlaneStrain::p_viscousStrainParam =
+  pylith::materials::GenMaxwellPlaneStrain::p_maxwellTime +
+  pylith::materials::_GenMaxwellPlaneStrain::numMaxwellModels;
+
+const int pylith::materials::GenMaxwellPlaneStrain::p_viscousStrainDecay =
+  pylith::materials::GenMaxwellPlaneStrain::p_viscousStrainParam +
+  pylith::materials::_GenMaxwellPlaneStrain::numMaxwellModels;
+
 // Indices of database values (order must match dbProperties)
 const int pylith::materials::GenMaxwellPlaneStrain::db_density = 0;
 
@@ -302,6 +312,10 @@ pylith::materials::GenMaxwellPlaneStrain::_dbToProperties(
     } // if
     propValues[p_shearRatio + imodel] = muRatio;
     propValues[p_maxwellTime + imodel] = maxwellTime;
+
+    // Computed from nondimensional values in _dtToProperties().
+    propValues[p_viscousStrainParam + imodel] = 0.0;
+    propValues[p_viscousStrainDecay + imodel] = 0.0;
   } // for
 
   PetscLogFlops(6 + 3 * numMaxwellModels);
@@ -359,6 +373,30 @@ pylith::materials::GenMaxwellPlaneStrain::_dimProperties(PylithScalar* const val
   PetscLogFlops(3 + 1 * numMaxwellModels);
 } // _dimProperties
 
+// ----------------------------------------------------------------------
+// Compute properties that depend on the current time step.
+void
+pylith::materials::GenMaxwellPlaneStrain::_dtToProperties(PylithScalar* const propValues,
+							   const int numValues)
+{ // _dtToProperties
+  assert(0 != propValues);
+  assert(numValues == _numPropsQuadPt);
+
+  const int numMaxwellModels = _GenMaxwellPlaneStrain::numMaxwellModels;
+  for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
+    PylithScalar dq = 0.0;
+    PylithScalar expFac = 0.0;
+    if (propValues[p_shearRatio + imodel] != 0.0) {
+      const PylithScalar maxwellTime = propValues[p_maxwellTime + imodel];
+      dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      expFac = exp(-_dt / maxwellTime);
+      PetscLogFlops(2);
+    } // if
+    propValues[p_viscousStrainParam + imodel] = dq;
+    propValues[p_viscousStrainDecay + imodel] = expFac;
+  } // for
+} // _dtToProperties
+
 // ----------------------------------------------------------------------
 // Compute initial state variables from values in spatial database.
 void
@@ -681,12 +719,9 @@ pylith::materials::GenMaxwellPlaneStrain::_calcElasticConstsViscoelastic(
   PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
     shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
     visFrac += shearRatio;
     if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio * ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      visFac += shearRatio * properties[p_viscousStrainParam + imodel];
     } // if
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
@@ -896,11 +931,8 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     properties[p_shearRatio+1],
     properties[p_shearRatio+2]
   };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
+  const PylithScalar* dq = &properties[p_viscousStrainParam];
+  const PylithScalar* expFac = &properties[p_viscousStrainDecay];
 
   const PylithScalar strainTpdt[] = {totalStrain[0],
 			       totalStrain[1],
@@ -918,13 +950,6 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
 
   PetscLogFlops(4);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
-
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
@@ -938,25 +963,25 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 1
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      PetscLogFlops(4);
     } // if
 
     // Maxwell model 2
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      PetscLogFlops(4);
     } // if
 
     // Maxwell model 3
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      PetscLogFlops(4);
     } // if
 
   } // for
@@ -53,7 +53,7 @@ namespace pylith {
       const int numElasticConsts = 36;
 
       /// Number of physical properties.
-      const int numProperties = 7;
+      const int numProperties = 11;
       
       /// Physical properties.
       const Metadata::ParamDescription properties[numProperties] = {
@@ -67,6 +67,14 @@ namespace pylith {
 	{ "bulk_ratio", numMaxwellModels, pylith::topology::FieldBase::OTHER },
 	{ "maxwell_time_bulk", 
 	  numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_param_shear", 
+	  numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_decay_shear", 
+	  numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_param_bulk", 
+	  numMaxwellModels, pylith::topology::FieldBase::OTHER },
+	{ "viscous_strain_decay_bulk", 
+	  numMaxwellModels, pylith::topology::FieldBase::OTHER },
       };
       // Values expected in properties spatial database.
       // :KLUDGE: Not generalized over number of models.
@@ -159,6 +167,22 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3D::p_maxwellTimeBulk =
   pylith::materials::GenMaxwellQpQsIsotropic3D::p_bulkRatio +
   pylith::materials::_GenMaxwellQpQsIsotropic3D::numMaxwellModels;
 
+const int pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainParamShear =
+  pylith::materials::GenMaxwellQpQsIsotropic3D::p_maxwellTimeBulk +
+  pylith::materials::_GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
+const int pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainDecayShear =
+  pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainParamShear +
+  pylith::materials::_GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
+const int pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainParamBulk =
+  pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainDecayShear +
+  pylith::materials::_GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
+const int pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainDecayBulk =
+  pylith::materials::GenMaxwellQpQsIsotropic3D::p_viscousStrainParamBulk +
+  pylith::materials::_GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
 // Indices of database values (order must match dbProperties)
 const int pylith::materials::GenMaxwellQpQsIsotropic3D::db_density = 0;
 
@@ -369,6 +393,12 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_dbToProperties(
     propValues[p_bulkRatio + imodel] = bulkRatio;
     propValues[p_maxwellTimeShear + imodel] = maxwellTimeShear;
     propValues[p_maxwellTimeBulk + imodel] = maxwellTimeBulk;
+
+    // Computed from nondimensional values in _dtToProperties().
+    propValues[p_viscousStrainParamShear + imodel] = 0.0;
+    propValues[p_viscousStrainDecayShear + imodel] = 0.0;
+    propValues[p_viscousStrainParamBulk + imodel] = 0.0;
+    propValues[p_viscousStrainDecayBulk + imodel] = 0.0;
   } // for
 
   PetscLogFlops(6+2*numMaxwellModels);
@@ -434,6 +464,31 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_dimProperties(PylithScalar* const
   PetscLogFlops(3+2*numMaxwellModels);
 } // _dimProperties
 
+// ----------------------------------------------------------------------
+// Compute properties that depend on the current time step.
+void
+pylith::materials::GenMaxwellQpQsIsotropic3D::_dtToProperties(PylithScalar* const propValues,
+							       const int numValues)
+{ // _dtToProperties
+  assert(0 != propValues);
+  assert(numValues == _numPropsQuadPt);
+
+  const int numMaxwellModels = _GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+  for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
+    const PylithScalar maxwellTimeShear = propValues[p_maxwellTimeShear + imodel];
+    propValues[p_viscousStrainParamShear + imodel] = 
+      ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeShear);
+    propValues[p_viscousStrainDecayShear + imodel] = exp(-_dt/maxwellTimeShear);
+
+    const PylithScalar maxwellTimeBulk = propValues[p_maxwellTimeBulk + imodel];
+    propValues[p_viscousStrainParamBulk + imodel] = 
+      ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeBulk);
+    propValues[p_viscousStrainDecayBulk + imodel] = exp(-_dt/maxwellTimeBulk);
+  } // for
+
+  PetscLogFlops(4*numMaxwellModels);
+} // _dtToProperties
+
 // ----------------------------------------------------------------------
 // Compute initial state variables from values in spatial database.
 void
@@ -756,12 +811,8 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsViscoelastic(
     elasFracShear -= shearRatio;
     elasFracBulk -= bulkRatio;
 
-    const PylithScalar maxwellTimeShear = properties[p_maxwellTimeShear+iModel];
-    visFactorDev +=
-      shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeShear);
-    const PylithScalar maxwellTimeBulk = properties[p_maxwellTimeBulk+iModel];
-    visFactorBulk +=
-      bulkRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeBulk);
+    visFactorDev += shearRatio*properties[p_viscousStrainParamShear+iModel];
+    visFactorBulk += bulkRatio*properties[p_viscousStrainParamBulk+iModel];
   } // for
   const PylithScalar tolerance = 1.0e-6;
   assert(elasFracShear >= -tolerance);
@@ -1045,8 +1096,8 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
   const PylithScalar diag[6] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
 
-    const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeShear+iModel]);
+    const PylithScalar dq = properties[p_viscousStrainParamShear+iModel];
+    const PylithScalar expFac = properties[p_viscousStrainDecayShear+iModel];
 
     for (int i=0; i < tensorSize; ++i) {
       const PylithScalar devStrainTpdt = totalStrain[i] - diag[i]*meanStrainTpdt;
@@ -1054,7 +1105,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
       const PylithScalar deltaStrain = devStrainTpdt - devStrainT;
       
       _viscousDevStrain[iModel*tensorSize+i] = 
-	exp(-_dt/properties[p_maxwellTimeShear+iModel]) * 
+	expFac * 
 	stateVars[s_viscousDevStrain+iModel*tensorSize+i] + 
 	properties[p_shearRatio+iModel] * dq * deltaStrain;
     } // for
@@ -1066,13 +1117,13 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
   // Compute Prony series terms
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
 
-    const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeBulk+iModel]);
+    const PylithScalar dq = properties[p_viscousStrainParamBulk+iModel];
+    const PylithScalar expFac = properties[p_viscousStrainDecayBulk+iModel];
 
     const PylithScalar deltaStrain = meanStrainTpdt - meanStrainT;
 
     _viscousMeanStrain[iModel] =  
-      exp(-_dt/properties[p_maxwellTimeBulk+iModel]) * 
+      expFac * 
       stateVars[s_viscousMeanStrain+iModel] + 
       properties[p_bulkRatio+iModel] * dq * deltaStrain;
   } // for
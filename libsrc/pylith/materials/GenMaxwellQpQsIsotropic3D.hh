@@ -105,6 +105,14 @@ protected :
   void _dimProperties(PylithScalar* const values,
 		      const int nvalues) const;
 
+  /** Compute properties that depend on the current time step.
+   *
+   * @param propValues Array of property values.
+   * @param numValues Number of values.
+   */
+  void _dtToProperties(PylithScalar* const propValues,
+		       const int numValues);
+
   /** Compute initial state variables from values in spatial database.
    *
    * @param stateValues Array of state variable values.
@@ -511,6 +519,10 @@ private :
   static const int p_maxwellTimeShear;
   static const int p_bulkRatio;
   static const int p_maxwellTimeBulk;
+  static const int p_viscousStrainParamShear;
+  static const int p_viscousStrainDecayShear;
+  static const int p_viscousStrainParamBulk;
+  static const int p_viscousStrainDecayBulk;
 
   static const int db_density;
   static const int db_vs;
@@ -225,6 +225,7 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
       } // if
       _dbToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], propertiesQuery);
       _nondimProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
+      _dtToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
 
       if (_dbInitialState) {
 	err = _dbInitialState->query(&stateVarsQuery[0], numDBStateVars, &quadPtsGlobal[index], spaceDim, cs);
@@ -315,7 +316,8 @@ pylith::materials::Material::hasStateVar(const char* name)
 // Get physical property or state variable field.
 void
 pylith::materials::Material::getField(topology::Field *field,
-				      const char* name) const
+				      const char* name,
+				      const scalar_array* quadWts) const
 { // getField
   PYLITH_METHOD_BEGIN;
 
@@ -361,7 +363,8 @@ pylith::materials::Material::getField(topology::Field *field,
     const int numPropsQuadPt = _numPropsQuadPt;
     const int numQuadPts = totalPropsFiberDim / numPropsQuadPt;
     assert(totalPropsFiberDim == numQuadPts * numPropsQuadPt);
-    const int totalFiberDim = numQuadPts * fiberDim;
+    assert(!quadWts || quadWts->size() == size_t(numQuadPts));
+    const int totalFiberDim = (quadWts) ? fiberDim : numQuadPts * fiberDim;
 
     // Allocate buffer for property field if necessary.
     bool useCurrentField = false;
@@ -390,18 +393,34 @@ pylith::materials::Material::getField(topology::Field *field,
     // Buffer for property at cell's quadrature points
     scalar_array propertiesCell(numPropsQuadPt);
 
+    PylithScalar volume = 0.0;
+    if (quadWts) {
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+        volume += (*quadWts)[iQuad];
+    } // if
+
     // Loop over cells
     for(PetscInt c = 0; c < numCells; ++c) {
       const PetscInt cell = cells[c];
 
       const PetscInt poff = propertiesVisitor.sectionOffset(cell);
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
+      if (quadWts) {
+        for (int i=0; i < fiberDim; ++i)
+          fieldArray[foff+i] = 0.0;
+      } // if
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         for (int i=0; i < numPropsQuadPt; ++i)
           propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
         _dimProperties(&propertiesCell[0], numPropsQuadPt);
-        for (int i=0; i < fiberDim; ++i)
-          fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
+        if (quadWts) {
+          const PylithScalar wt = (*quadWts)[iQuad] / volume;
+          for (int i=0; i < fiberDim; ++i)
+            fieldArray[foff+i] += wt * propertiesCell[propOffset+i];
+        } else {
+          for (int i=0; i < fiberDim; ++i)
+            fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
+        } // if/else
       } // for
     } // for
   } else { // field is a state variable
@@ -427,7 +446,8 @@ pylith::materials::Material::getField(topology::Field *field,
     const int numVarsQuadPt = _numVarsQuadPt;
     const int numQuadPts = totalVarsFiberDim / numVarsQuadPt;
     assert(totalVarsFiberDim == numQuadPts * numVarsQuadPt);
-    const int totalFiberDim = numQuadPts * fiberDim;
+    assert(!quadWts || quadWts->size() == size_t(numQuadPts));
+    const int totalFiberDim = (quadWts) ? fiberDim : numQuadPts * fiberDim;
 
     // Allocate buffer for state variable field if necessary.
     bool useCurrentField = false;
@@ -456,23 +476,45 @@ pylith::materials::Material::getField(topology::Field *field,
     // Buffer for state variable at cell's quadrature points
     scalar_array stateVarsCell(numVarsQuadPt);
     
+    PylithScalar volume = 0.0;
+    if (quadWts) {
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+        volume += (*quadWts)[iQuad];
+    } // if
+
     // Loop over cells
     for(PetscInt c = 0; c < numCells; ++c) {
       const PetscInt cell = cells[c];
 
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
       const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
+      if (quadWts) {
+        for (int i=0; i < fiberDim; ++i)
+          fieldArray[foff+i] = 0.0;
+      } // if
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         for (int i=0; i < numVarsQuadPt; ++i) {
           stateVarsCell[i] = stateVarsArray[iQuad*numVarsQuadPt + soff+i];
 	} // for
 	_dimStateVars(&stateVarsCell[0], numVarsQuadPt);
-        for (int i=0; i < fiberDim; ++i)
-          fieldArray[iQuad*fiberDim + foff+i] = stateVarsCell[varOffset+i];
+        if (quadWts) {
+          const PylithScalar wt = (*quadWts)[iQuad] / volume;
+          for (int i=0; i < fiberDim; ++i)
+            fieldArray[foff+i] += wt * stateVarsCell[varOffset+i];
+        } else {
+          for (int i=0; i < fiberDim; ++i)
+            fieldArray[iQuad*fiberDim + foff+i] = stateVarsCell[varOffset+i];
+        } // if/else
       } // for
     } // for
   } // if/else
 
+  // Averaged fields hold a single value per cell.
+  if (quadWts) {
+    field->vectorFieldType(fieldType);
+    PYLITH_METHOD_END;
+  } // if
+
   topology::FieldBase::VectorFieldEnum multiType = topology::FieldBase::MULTI_OTHER;
   switch (fieldType)
     { // switch
@@ -502,6 +544,37 @@ pylith::materials::Material::getField(topology::Field *field,
   PYLITH_METHOD_END;
 } // getField
   
+// ----------------------------------------------------------------------
+// Recompute properties that depend on the time step.
+void
+pylith::materials::Material::_updateDtProperties(void)
+{ // _updateDtProperties
+  PYLITH_METHOD_BEGIN;
+
+  if (!_properties) {
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(_materialIS);
+  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = _materialIS->points();
+
+  topology::VecVisitorMesh propertiesVisitor(*_properties);
+  PetscScalar* propertiesArray = propertiesVisitor.localArray();
+
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    const PetscInt off = propertiesVisitor.sectionOffset(cell);
+    const PetscInt dof = propertiesVisitor.sectionDof(cell);
+    assert(0 == dof % _numPropsQuadPt);
+    for (PetscInt d=0; d < dof; d += _numPropsQuadPt) {
+      _dtToProperties(&propertiesArray[off+d], _numPropsQuadPt);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _updateDtProperties
+
 // ----------------------------------------------------------------------
 // Get indices for physical property or state variable field.
 void
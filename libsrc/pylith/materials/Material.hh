@@ -31,6 +31,7 @@
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
 
 #include "Metadata.hh" // HASA Metadata
 
@@ -192,11 +193,18 @@ public :
   /** Get physical property or state variable field. Data is returned
    * via the argument.
    *
+   * If quadrature weights are given, the values are averaged over the
+   * quadrature points of each cell as they are extracted, so the
+   * field holds a single value per cell.
+   *
    * @param field Field over material cells.
    * @param name Name of field to retrieve.
+   * @param quadWts Weights of quadrature points (=0 for values at
+   *   quadrature points).
    */
   void getField(topology::Field *field,
-		const char* name) const;
+		const char* name,
+		const scalar_array* quadWts =0) const;
 
   /** Get the field with all properties.
    *
@@ -242,6 +250,28 @@ protected :
   void _dimProperties(PylithScalar* const values,
 		      const int nvalues) const = 0;
 
+  /** Compute properties that depend on the current time step.
+   *
+   * Called at each quadrature point with nondimensional properties
+   * when the properties are initialized and by _updateDtProperties().
+   * Default is to do nothing.
+   *
+   * @param propValues Array of property values.
+   * @param numValues Number of values.
+   */
+  virtual
+  void _dtToProperties(PylithScalar* const propValues,
+		       const int numValues);
+
+  /** Recompute properties that depend on the time step at every
+   * quadrature point using _dtToProperties().
+   *
+   * Materials with time step dependent properties call this when
+   * the time step changes. Nothing is done before the properties
+   * field is created in initialize().
+   */
+  void _updateDtProperties(void);
+
   /** Compute initial state variables from values in spatial database.
    *
    * @param stateValues Array of state variable values.
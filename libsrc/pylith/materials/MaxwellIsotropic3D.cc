@@ -49,7 +49,7 @@ namespace pylith {
       const int numElasticConsts = 36;
 
       /// Number of physical properties.
-      const int numProperties = 4;
+      const int numProperties = 6;
       
       /// Physical properties.
       const Metadata::ParamDescription properties[] = {
@@ -57,6 +57,8 @@ namespace pylith {
 	{ "mu", 1, pylith::topology::FieldBase::SCALAR },
 	{ "lambda", 1, pylith::topology::FieldBase::SCALAR },
 	{ "maxwell_time", 1, pylith::topology::FieldBase::SCALAR },
+	{ "viscous_strain_param", 1, pylith::topology::FieldBase::SCALAR },
+	{ "viscous_strain_decay", 1, pylith::topology::FieldBase::SCALAR },
       };
 	
       // Values expected in properties spatial database
@@ -104,6 +106,12 @@ const int pylith::materials::MaxwellIsotropic3D::p_lambda =
 const int pylith::materials::MaxwellIsotropic3D::p_maxwellTime = 
   pylith::materials::MaxwellIsotropic3D::p_lambda + 1;
 
+const int pylith::materials::MaxwellIsotropic3D::p_viscousStrainParam = 
+  pylith::materials::MaxwellIsotropic3D::p_maxwellTime + 1;
+
+const int pylith::materials::MaxwellIsotropic3D::p_viscousStrainDecay = 
+  pylith::materials::MaxwellIsotropic3D::p_viscousStrainParam + 1;
+
 // Indices of database values (order must match dbProperties)
 const int pylith::materials::MaxwellIsotropic3D::db_density = 0;
 
@@ -227,6 +235,10 @@ pylith::materials::MaxwellIsotropic3D::_dbToProperties(
   propValues[p_lambda] = lambda;
   propValues[p_maxwellTime] = maxwellTime;
 
+  // Computed from nondimensional values in _dtToProperties().
+  propValues[p_viscousStrainParam] = 0.0;
+  propValues[p_viscousStrainDecay] = 0.0;
+
   PetscLogFlops(7);
 } // _dbToProperties
 
@@ -280,6 +292,23 @@ pylith::materials::MaxwellIsotropic3D::_dimProperties(PylithScalar* const values
   PetscLogFlops(4);
 } // _dimProperties
 
+// ----------------------------------------------------------------------
+// Compute properties that depend on the current time step.
+void
+pylith::materials::MaxwellIsotropic3D::_dtToProperties(PylithScalar* const propValues,
+                                                        const int numValues)
+{ // _dtToProperties
+  assert(0 != propValues);
+  assert(numValues == _numPropsQuadPt);
+
+  const PylithScalar maxwellTime = propValues[p_maxwellTime];
+  propValues[p_viscousStrainParam] = 
+    ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  propValues[p_viscousStrainDecay] = exp(-_dt/maxwellTime);
+
+  PetscLogFlops(2);
+} // _dtToProperties
+
 // ----------------------------------------------------------------------
 // Compute initial state variables from values in spatial database.
 void
@@ -567,12 +596,11 @@ pylith::materials::MaxwellIsotropic3D::_calcElasticConstsViscoelastic(
 
   const PylithScalar mu = properties[p_mu];
   const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  const PylithScalar dq = properties[p_viscousStrainParam];
 
   const PylithScalar visFac = mu * dq / 3.0;
 
@@ -780,7 +808,6 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
   assert(_MaxwellIsotropic3D::tensorSize == initialStrainSize);
 
   const int tensorSize = _tensorSize;
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   // :TODO: Need to account for initial values for state variables
   // and the initial strain??
@@ -799,8 +826,8 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
       stateVars[s_totalStrain+2] ) / 3.0;
   
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  const PylithScalar dq = properties[p_viscousStrainParam];
+  const PylithScalar expFac = properties[p_viscousStrainDecay];
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
@@ -50,7 +50,7 @@ namespace pylith {
       const int numElasticConsts = 9;
 
       /// Number of physical properties.
-      const int numProperties = 4;
+      const int numProperties = 6;
 
       /// Physical properties.
       const Metadata::ParamDescription properties[] = {
@@ -58,6 +58,8 @@ namespace pylith {
 	{ "mu", 1, pylith::topology::FieldBase::SCALAR },
 	{ "lambda", 1, pylith::topology::FieldBase::SCALAR },
 	{ "maxwell_time", 1, pylith::topology::FieldBase::SCALAR },
+	{ "viscous_strain_param", 1, pylith::topology::FieldBase::SCALAR },
+	{ "viscous_strain_decay", 1, pylith::topology::FieldBase::SCALAR },
       };
 
       /// Values expected in properties spatial database
@@ -101,6 +103,12 @@ const int pylith::materials::MaxwellPlaneStrain::p_lambda =
 const int pylith::materials::MaxwellPlaneStrain::p_maxwellTime = 
   pylith::materials::MaxwellPlaneStrain::p_lambda + 1;
 
+const int pylith::materials::MaxwellPlaneStrain::p_viscousStrainParam = 
+  pylith::materials::MaxwellPlaneStrain::p_maxwellTime + 1;
+
+const int pylith::materials::MaxwellPlaneStrain::p_viscousStrainDecay = 
+  pylith::materials::MaxwellPlaneStrain::p_viscousStrainParam + 1;
+
 // Indices of database values (order must match dbProperties)
 const int pylith::materials::MaxwellPlaneStrain::db_density = 0;
 
@@ -230,6 +238,10 @@ pylith::materials::MaxwellPlaneStrain::_dbToProperties(
   propValues[p_lambda] = lambda;
   propValues[p_maxwellTime] = maxwellTime;
 
+  // Computed from nondimensional values in _dtToProperties().
+  propValues[p_viscousStrainParam] = 0.0;
+  propValues[p_viscousStrainDecay] = 0.0;
+
   PetscLogFlops(7);
 } // _dbToProperties
 
@@ -283,6 +295,23 @@ pylith::materials::MaxwellPlaneStrain::_dimProperties(PylithScalar* const values
   PetscLogFlops(4);
 } // _dimProperties
 
+// ----------------------------------------------------------------------
+// Compute properties that depend on the current time step.
+void
+pylith::materials::MaxwellPlaneStrain::_dtToProperties(PylithScalar* const propValues,
+                                                        const int numValues)
+{ // _dtToProperties
+  assert(0 != propValues);
+  assert(numValues == _numPropsQuadPt);
+
+  const PylithScalar maxwellTime = propValues[p_maxwellTime];
+  propValues[p_viscousStrainParam] = 
+    ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  propValues[p_viscousStrainDecay] = exp(-_dt/maxwellTime);
+
+  PetscLogFlops(2);
+} // _dtToProperties
+
 // ----------------------------------------------------------------------
 // Compute initial state variables from values in spatial database.
 void
@@ -563,12 +592,11 @@ pylith::materials::MaxwellPlaneStrain::_calcElasticConstsViscoelastic(
  
   const PylithScalar mu = properties[p_mu];
   const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  const PylithScalar dq = properties[p_viscousStrainParam];
 
   const PylithScalar visFac = mu * dq / 3.0;
   elasticConsts[ 0] = bulkModulus + 4.0 * visFac; // C1111
@@ -748,8 +776,6 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   assert(initialStrain);
   assert(_MaxwellPlaneStrain::tensorSize == initialStrainSize);
 
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
-
   const PylithScalar strainTpdt[4] = {
     totalStrain[0],
     totalStrain[1],
@@ -769,8 +795,8 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0 };
 
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  const PylithScalar dq = properties[p_viscousStrainParam];
+  const PylithScalar expFac = properties[p_viscousStrainDecay];
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
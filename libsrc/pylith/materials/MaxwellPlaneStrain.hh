@@ -94,6 +94,14 @@ protected :
   void _dimProperties(PylithScalar* const values,
 		      const int nvalues) const;
 
+  /** Compute properties that depend on the current time step.
+   *
+   * @param propValues Array of property values.
+   * @param numValues Number of values.
+   */
+  void _dtToProperties(PylithScalar* const propValues,
+		       const int numValues);
+
   /** Compute initial state variables from values in spatial database.
    *
    * @param stateValues Array of state variable values.
@@ -510,6 +518,8 @@ private :
   static const int p_mu;
   static const int p_lambda;
   static const int p_maxwellTime;
+  static const int p_viscousStrainParam;
+  static const int p_viscousStrainDecay;
   static const int db_density;
   static const int db_vs;
   static const int db_vp;
@@ -26,6 +26,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "EffectiveStress.hh" // HASA EffectiveStress::SolverLog
 
 // Powerlaw3D -----------------------------------------------------------
 /** @brief 3-D, isotropic, power-law viscoelastic material. 
@@ -51,12 +52,27 @@ public :
   /// Destructor
   ~PowerLaw3D(void);
 
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
   /** Set current time step.
+   *
+   * Counts of effective stress solves since the previous time step
+   * are added to the logging events.
    *
    * @param dt Current time step.
    */
   void timeStep(const PylithScalar dt);
 
+  /** Initialize material by getting physical property parameters from
+   * database and registering logging events.
+   *
+   * @param mesh Finite-element mesh.
+   * @param quadrature Quadrature for finite-element integration
+   */
+  void initialize(const topology::Mesh& mesh,
+		  feassemble::Quadrature* quadrature);
+
   /** Set whether elastic or inelastic constitutive relations are used.
    *
    * @param flag True to use elastic, false to use inelastic.
@@ -508,6 +524,9 @@ private :
   /// Structure to hold parameters for effective stress computation.
   EffStressStruct _effStressParams;
 
+  /// Log of effective stress solves.
+  EffectiveStress::SolverLog _effStressLog;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
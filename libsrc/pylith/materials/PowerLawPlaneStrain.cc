@@ -25,6 +25,7 @@
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -179,6 +180,39 @@ pylith::materials::PowerLawPlaneStrain::~PowerLawPlaneStrain(void)
 { // destructor
 } // destructor
 
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::materials::PowerLawPlaneStrain::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  // Report solves since the last time step.
+  _effStressLog.report();
+
+  ElasticMaterial::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Initialize material by getting physical property parameters from
+// database and registering logging events.
+void
+pylith::materials::PowerLawPlaneStrain::initialize(const topology::Mesh& mesh,
+						    feassemble::Quadrature* quadrature)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  ElasticMaterial::initialize(mesh, quadrature);
+
+  // Register events on all processes, whether or not they have
+  // cells in this material, so the events match across processes.
+  _effStressLog.initialize("PowerLawPlaneStrain");
+
+  PYLITH_METHOD_END;
+} // initialize
+
 // ----------------------------------------------------------------------
 // Set whether elastic or inelastic constitutive relations are used.
 void
@@ -655,8 +689,7 @@ pylith::materials::PowerLawPlaneStrain::_calcStressViscoelastic(
       const PylithScalar effStressInitialGuess = effStressT;
 
       effStressTpdt =
-	EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					       stressScale, this);
+	_effStressLog.calculate<PowerLawPlaneStrain>(effStressInitialGuess, stressScale, this);
     } // if
 
     // Compute stresses from effective stress.
@@ -1004,8 +1037,7 @@ pylith::materials::PowerLawPlaneStrain::_calcElasticConstsViscoelastic(
     const PylithScalar effStressInitialGuess = effStressT;
     
     const PylithScalar effStressTpdt =
-      EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					     stressScale, this);
+      _effStressLog.calculate<PowerLawPlaneStrain>(effStressInitialGuess, stressScale, this);
   
     // Compute quantities at intermediate time tau used to compute values at
     // end of time step.
@@ -1249,8 +1281,7 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsViscoelastic(
     const PylithScalar effStressInitialGuess = effStressT;
 
     effStressTpdt =
-      EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					     stressScale, this);
+      _effStressLog.calculate<PowerLawPlaneStrain>(effStressInitialGuess, stressScale, this);
 
   } // if
 
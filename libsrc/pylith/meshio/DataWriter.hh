@@ -105,11 +105,13 @@ void closeTimeStep(void);
  * @param t Time associated with field.
  * @param field Field over vertices.
  * @param mesh Mesh associated with output.
+ * @param scale Scale applied to values as they are written.
  */
 virtual
 void writeVertexField(const PylithScalar t,
                       topology::Field& field,
-                      const topology::Mesh& mesh) = 0;
+                      const topology::Mesh& mesh,
+                      const PylithScalar scale =1.0) = 0;
 
 /** Write field over cells to file.
  *
@@ -118,12 +120,14 @@ void writeVertexField(const PylithScalar t,
  * @param label Name of label defining cells to include in output
  *   (=0 means use all cells in mesh).
  * @param labelId Value of label defining which cells to include.
+ * @param scale Scale applied to values as they are written.
  */
 virtual
 void writeCellField(const PylithScalar t,
                     topology::Field& field,
                     const char* label =0,
-                    const int labelId =0) = 0;
+                    const int labelId =0,
+                    const PylithScalar scale =1.0) = 0;
 
 /** Write dataset with names of points to file.
  *
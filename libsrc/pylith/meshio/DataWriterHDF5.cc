@@ -137,6 +137,10 @@ pylith::meshio::DataWriterHDF5::open(const topology::Mesh& mesh,
         coordinatesField.scatterLocalToGlobal(metadata.label.c_str());
         PetscVec coordVector = coordinatesField.vector(metadata.label.c_str()); assert(coordVector);
         err = VecScale(coordVector, lengthScale); PYLITH_CHECK_ERROR(err);
+        PetscInt coordSize = 0;
+        err = VecGetSize(coordVector, &coordSize); PYLITH_CHECK_ERROR(err);
+        const int spaceDim = cs->spaceDim();
+        const int numVertices = coordSize / spaceDim;
         err = PetscViewerHDF5PushGroup(_viewer, "/geometry"); PYLITH_CHECK_ERROR(err);
 #if 0
         err = VecView(coordVector, _viewer); PYLITH_CHECK_ERROR(err);
@@ -226,6 +230,9 @@ pylith::meshio::DataWriterHDF5::open(const topology::Mesh& mesh,
             //assert(v == (cell-cStart+1)*numCorners); Would be true without the label check
         } // for
         err = VecRestoreArray(cellVec, &vertices); PYLITH_CHECK_ERROR(err);
+        PetscInt numCells = 0;
+        err = VecGetSize(cellVec, &numCells); PYLITH_CHECK_ERROR(err);
+        numCells /= numCorners;
         err = PetscViewerHDF5PushGroup(_viewer, "/topology"); PYLITH_CHECK_ERROR(err);
         err = VecView(cellVec, _viewer); PYLITH_CHECK_ERROR(err);
         err = PetscViewerHDF5PopGroup(_viewer); PYLITH_CHECK_ERROR(err);
@@ -238,6 +245,10 @@ pylith::meshio::DataWriterHDF5::open(const topology::Mesh& mesh,
         const int cellDim = mesh.dimension();
         HDF5::writeAttribute(h5, "/topology/cells", "cell_dim", (void*)&cellDim, H5T_NATIVE_INT);
 
+        if (!commRank) {
+            _xdmf.open(filename.c_str(), numCells, numCorners, cellDim, numVertices, spaceDim);
+        } // if
+
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while opening HDF5 file " << hdf5Filename() << ".\n" << err.what();
@@ -265,15 +276,33 @@ pylith::meshio::DataWriterHDF5::close(void)
     _timesteps.clear();
     _tstampIndex = 0;
 
+    _xdmf.write();
+    _xdmf.close();
+
     PYLITH_METHOD_END;
 } // close
 
+// ----------------------------------------------------------------------
+// Update Xdmf file with data written for time step.
+void
+pylith::meshio::DataWriterHDF5::closeTimeStep(void)
+{ // closeTimeStep
+    PYLITH_METHOD_BEGIN;
+
+    // Rewrite Xdmf file after every time step, so it is usable even if
+    // the simulation terminates early.
+    _xdmf.write();
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
 // ----------------------------------------------------------------------
 // Write field over vertices to file.
 void
 pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
                                                  topology::Field& field,
-                                                 const topology::Mesh& mesh)
+                                                 const topology::Mesh& mesh,
+                                                 const PylithScalar scale)
 { // writeVertexField
     PYLITH_METHOD_BEGIN;
 
@@ -287,6 +316,10 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
         field.createScatterWithBC(mesh, "", 0, context);
         field.scatterLocalToGlobal(context);
         PetscVec vector = field.vector(context); assert(vector);
+        if (1.0 != scale) {
+            // Dimensionalize global vector; local values are not modified.
+            err = VecScale(vector, scale); PYLITH_CHECK_ERROR(err);
+        } // if
 
         if (_timesteps.find(field.label()) == _timesteps.end())
             _timesteps[field.label()] = 0;
@@ -320,6 +353,13 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
             HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", sattr);
         } // if
 
+        if (!commRank) {
+            PetscInt size = 0, blockSize = 0;
+            err = VecGetSize(vector, &size); PYLITH_CHECK_ERROR(err);
+            err = VecGetBlockSize(vector, &blockSize); PYLITH_CHECK_ERROR(err); assert(blockSize > 0);
+            _xdmf.updateField(field.label(), topology::FieldBase::VERTICES_FIELD, field.vectorFieldType(), size/blockSize, blockSize, istep+1);
+        } // if
+
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << field.label() << "' at time "
@@ -342,7 +382,8 @@ void
 pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
                                                topology::Field& field,
                                                const char* label,
-                                               const int labelId)
+                                               const int labelId,
+                                               const PylithScalar scale)
 { // writeCellField
     PYLITH_METHOD_BEGIN;
 
@@ -355,6 +396,10 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
         field.createScatterWithBC(field.mesh(), label ? label : "", labelId, context);
         field.scatterLocalToGlobal(context);
         PetscVec vector = field.vector(context); assert(vector);
+        if (1.0 != scale) {
+            // Dimensionalize global vector; local values are not modified.
+            err = VecScale(vector, scale); PYLITH_CHECK_ERROR(err);
+        } // if
 
         if (_timesteps.find(field.label()) == _timesteps.end())
             _timesteps[field.label()] = 0;
@@ -387,6 +432,13 @@ pylith::meshio::DataWriterHDF5::writeCellField(const PylithScalar t,
             const char* sattr = topology::FieldBase::vectorFieldString(field.vectorFieldType());
             HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", sattr);
         } // if
+
+        if (!commRank) {
+            PetscInt size = 0, blockSize = 0;
+            err = VecGetSize(vector, &size); PYLITH_CHECK_ERROR(err);
+            err = VecGetBlockSize(vector, &blockSize); PYLITH_CHECK_ERROR(err); assert(blockSize > 0);
+            _xdmf.updateField(field.label(), topology::FieldBase::CELLS_FIELD, field.vectorFieldType(), size/blockSize, blockSize, istep+1);
+        } // if
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << field.label() << "' at time "
@@ -578,6 +630,7 @@ pylith::meshio::DataWriterHDF5::_writeTimeStamp(const PylithScalar t,
     if (!commRank) {
         const PylithScalar tDim = t * DataWriter::_timeScale;
         err = VecSetValue(_tstamp, 0, tDim, INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+        _xdmf.addTimeStamp(tDim);
     } // if
     err = VecAssemblyBegin(_tstamp); PYLITH_CHECK_ERROR(err);
     err = VecAssemblyEnd(_tstamp); PYLITH_CHECK_ERROR(err);
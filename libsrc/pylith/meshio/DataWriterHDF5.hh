@@ -47,6 +47,7 @@
 
 // Include directives ---------------------------------------------------
 #include "DataWriter.hh" // ISA DataWriter
+#include "Xdmf.hh" // HASA Xdmf
 
 #include "pylith/utils/petscfwd.h" // HASA PetscVec
 
@@ -114,15 +115,20 @@ void open(const topology::Mesh& mesh,
 /// Close output files.
 void close(void);
 
+/// Update Xdmf file with data written for time step.
+void closeTimeStep(void);
+
 /** Write field over vertices to file.
  *
  * @param t Time associated with field.
  * @param field Field over vertices.
  * @param mesh Mesh associated with output.
+ * @param scale Scale applied to values as they are written.
  */
 void writeVertexField(const PylithScalar t,
                       topology::Field& field,
-                      const topology::Mesh& mesh);
+                      const topology::Mesh& mesh,
+                      const PylithScalar scale =1.0);
 
 /** Write field over cells to file.
  *
@@ -131,11 +137,13 @@ void writeVertexField(const PylithScalar t,
  * @param label Name of label defining cells to include in output
  *   (=0 means use all cells in mesh).
  * @param labelId Value of label defining which cells to include.
+ * @param scale Scale applied to values as they are written.
  */
 void writeCellField(const PylithScalar t,
                     topology::Field& field,
                     const char* label =0,
-                    const int labelId =0);
+                    const int labelId =0,
+                    const PylithScalar scale =1.0);
 
 /** Write dataset with names of points to file.
  *
@@ -178,6 +186,7 @@ PetscVec _tstamp;   ///< Single value vector holding time stamp.
 
 std::map<std::string, int> _timesteps;   ///< # of time steps written per field.
 int _tstampIndex;   ///< Index of last time stamp written.
+Xdmf _xdmf;   ///< Xdmf metadata file (only used on process 0).
 
 }; // DataWriterHDF5
 
@@ -285,6 +285,8 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
             _h5->createDatasetRawExternal("/topology", "cells", filenameCells.c_str(), dims, ndims, scalartype);
             const int cellDim = mesh.dimension();
             _h5->writeAttribute("/topology/cells", "cell_dim", (void*)&cellDim, H5T_NATIVE_INT);
+
+            _xdmf.open(hdf5Filename().c_str(), numCells, numCorners, cellDim, numVertices, cs->spaceDim());
         } // if
 
     } catch (const std::exception& err) {
@@ -315,15 +317,33 @@ pylith::meshio::DataWriterHDF5Ext::close(void)
     _tstampIndex = 0;
     deallocate();
 
+    _xdmf.write();
+    _xdmf.close();
+
     PYLITH_METHOD_END;
 } // close
 
+// ----------------------------------------------------------------------
+// Update Xdmf file with data written for time step.
+void
+pylith::meshio::DataWriterHDF5Ext::closeTimeStep(void)
+{ // closeTimeStep
+    PYLITH_METHOD_BEGIN;
+
+    // Rewrite Xdmf file after every time step, so it is usable even if
+    // the simulation terminates early.
+    _xdmf.write();
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
 // ----------------------------------------------------------------------
 // Write field over vertices to file.
 void
 pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
                                                     topology::Field& field,
-                                                    const topology::Mesh& mesh)
+                                                    const topology::Mesh& mesh,
+                                                    const PylithScalar scale)
 { // writeVertexField
     PYLITH_METHOD_BEGIN;
 
@@ -363,6 +383,10 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
         assert(binaryViewer);
 
         PetscVec vector = field.vector(context); assert(vector);
+        if (1.0 != scale) {
+            // Dimensionalize global vector; local values are not modified.
+            err = VecScale(vector, scale); PYLITH_CHECK_ERROR(err);
+        } // if
 #if 0
         err = VecView(vector, binaryViewer); PYLITH_CHECK_ERROR(err);
 #else
@@ -448,6 +472,11 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
             _h5->extendDatasetRawExternal("/vertex_fields", field.label(), dims, ndims);
         } // if/else
 
+        if (!commRank) {
+            _xdmf.updateField(field.label(), topology::FieldBase::VERTICES_FIELD, field.vectorFieldType(),
+                              datasetInfo.numPoints, datasetInfo.fiberDim, datasetInfo.numTimeSteps);
+        } // if
+
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << field.label() << "' at time "
@@ -469,7 +498,8 @@ void
 pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
                                                   topology::Field& field,
                                                   const char* label,
-                                                  const int labelId)
+                                                  const int labelId,
+                                                  const PylithScalar scale)
 { // writeCellField
     PYLITH_METHOD_BEGIN;
 
@@ -509,6 +539,10 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
         assert(binaryViewer);
 
         PetscVec vector = field.vector(context); assert(vector);
+        if (1.0 != scale) {
+            // Dimensionalize global vector; local values are not modified.
+            err = VecScale(vector, scale); PYLITH_CHECK_ERROR(err);
+        } // if
 #if 0
         err = VecView(vector, binaryViewer); PYLITH_CHECK_ERROR(err);
 #else
@@ -604,6 +638,11 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
             _h5->extendDatasetRawExternal("/cell_fields", field.label(), dims, ndims);
         } // if/else
 
+        if (!commRank) {
+            _xdmf.updateField(field.label(), topology::FieldBase::CELLS_FIELD, field.vectorFieldType(),
+                              datasetInfo.numPoints, datasetInfo.fiberDim, datasetInfo.numTimeSteps);
+        } // if
+
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while writing field '" << field.label() << "' at time "
@@ -767,6 +806,7 @@ pylith::meshio::DataWriterHDF5Ext::_writeTimeStamp(const PylithScalar t)
     dims[2] = 1;
     const PylithScalar tDim = t * DataWriter::_timeScale;
     _h5->writeDatasetChunk("/", "time", &tDim, dims, dimsChunk, ndims, _tstampIndex, scalartype);
+    _xdmf.addTimeStamp(tDim);
 
     _tstampIndex++;
 
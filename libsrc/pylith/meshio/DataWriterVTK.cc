@@ -265,7 +265,8 @@ pylith::meshio::DataWriterVTK::closeTimeStep(void)
 void
 pylith::meshio::DataWriterVTK::writeVertexField(const PylithScalar t,
 						topology::Field& field,
-						const topology::Mesh& mesh)
+						const topology::Mesh& mesh,
+						const PylithScalar scale)
 { // writeVertexField
   PYLITH_METHOD_BEGIN;
 
@@ -286,7 +287,13 @@ pylith::meshio::DataWriterVTK::writeVertexField(const PylithScalar t,
   } // if
   topology::Field& fieldCached = _vertexFieldCache->get(fieldLabel);
   assert(fieldCached.sectionSize() == field.sectionSize());
-  fieldCached.copy(field);
+  if (1.0 == scale) {
+    fieldCached.copy(field);
+  } else {
+    // Dimensionalize values as they are copied into the cache.
+    PetscErrorCode err = VecAXPBY(fieldCached.localVector(), scale, 0.0, field.localVector());PYLITH_CHECK_ERROR(err);
+    fieldCached.vectorFieldType(field.vectorFieldType());
+  } // if/else
 
   // Could check the field.localSection() matches the default section from VecGetDM().
   PetscVec fieldVec = fieldCached.localVector();assert(fieldVec);
@@ -310,7 +317,8 @@ void
 pylith::meshio::DataWriterVTK::writeCellField(const PylithScalar t,
 					      topology::Field& field,
 					      const char* label,
-					      const int labelId)
+					      const int labelId,
+					      const PylithScalar scale)
 { // writeCellField
   PYLITH_METHOD_BEGIN;
 
@@ -330,7 +338,13 @@ pylith::meshio::DataWriterVTK::writeCellField(const PylithScalar t,
   } // if
   topology::Field& fieldCached = _cellFieldCache->get(fieldLabel);
   assert(fieldCached.sectionSize() == field.sectionSize());
-  fieldCached.copy(field);
+  if (1.0 == scale) {
+    fieldCached.copy(field);
+  } else {
+    // Dimensionalize values as they are copied into the cache.
+    PetscErrorCode err = VecAXPBY(fieldCached.localVector(), scale, 0.0, field.localVector());PYLITH_CHECK_ERROR(err);
+    fieldCached.vectorFieldType(field.vectorFieldType());
+  } // if/else
 
   // Could check the field.localSection() matches the default section from VecGetDM().
   PetscVec fieldVec = fieldCached.localVector();assert(fieldVec);
@@ -129,10 +129,12 @@ public :
    * @param t Time associated with field.
    * @param field Field over vertices.
    * @param mesh Mesh associated with output.
+   * @param scale Scale applied to values as they are written.
    */
   void writeVertexField(const PylithScalar t,
 			topology::Field& field,
-			const topology::Mesh& mesh);
+			const topology::Mesh& mesh,
+			const PylithScalar scale =1.0);
 
   /** Write field over cells to file.
    *
@@ -141,11 +143,13 @@ public :
    * @param label Name of label defining cells to include in output
    *   (=0 means use all cells in mesh).
    * @param labelId Value of label defining which cells to include.
+   * @param scale Scale applied to values as they are written.
    */
   void writeCellField(const PylithScalar t,
 		      topology::Field& field,
 		      const char* label =0,
-		      const int labelId =0);
+		      const int labelId =0,
+		      const PylithScalar scale =1.0);
 
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
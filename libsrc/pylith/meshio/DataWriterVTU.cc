@@ -0,0 +1,837 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+
+#include <petscdmplex.h>
+
+#include <cassert> // USES assert()
+#include <cstring> // USES memcpy()
+#include <cstdio> // USES sprintf()
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _DataWriterVTU {
+
+      /** Append value to binary buffer in native byte order.
+       *
+       * @param values Buffer of values.
+       * @param value Value to append.
+       */
+      template<typename T>
+      void appendValue(std::vector<char>* values,
+		       const T value) {
+	assert(values);
+	const size_t size = values->size();
+	values->resize(size + sizeof(T));
+	memcpy(&(*values)[size], &value, sizeof(T));
+      } // appendValue
+
+      /** Append floating point value to binary buffer.
+       *
+       * @param values Buffer of values.
+       * @param value Value to append.
+       * @param float32 True if value is stored as 32-bit float.
+       */
+      void appendScalar(std::vector<char>* values,
+			const PylithScalar value,
+			const bool float32) {
+	if (float32) {
+	  appendValue<float>(values, float(value));
+	} else {
+	  appendValue<double>(values, double(value));
+	} // if/else
+      } // appendScalar
+
+      /** Get byte order of this machine.
+       *
+       * @returns VTK byte order.
+       */
+      const char* byteOrder(void) {
+	const int one = 1;
+	return (*reinterpret_cast<const char*>(&one)) ? "LittleEndian" : "BigEndian";
+      } // byteOrder
+
+      /** Get VTK cell type.
+       *
+       * @param cellDim Dimension of cell.
+       * @param numCorners Number of vertices in cell.
+       * @returns VTK cell type.
+       */
+      unsigned char cellType(const int cellDim,
+			     const int numCorners) {
+	switch (numCorners) {
+	case 1 :
+	  return 1; // VTK_VERTEX
+	case 2 :
+	  return 3; // VTK_LINE
+	case 3 :
+	  return 5; // VTK_TRIANGLE
+	case 4 :
+	  if (2 == cellDim) {
+	    return 9; // VTK_QUAD
+	  } else if (3 == cellDim) {
+	    return 10; // VTK_TETRA
+	  } // if/else
+	  break;
+	case 8 :
+	  return 12; // VTK_HEXAHEDRON
+	default :
+	  break;
+	} // switch
+
+	std::ostringstream msg;
+	msg << "Unknown VTK cell type for cell with dimension " << cellDim
+	    << " and " << numCorners << " vertices.";
+	throw std::runtime_error(msg.str());
+      } // cellType
+
+      /** Get filename without directory.
+       *
+       * @param filename Name of file.
+       * @returns Filename without directory.
+       */
+      std::string basename(const std::string& filename) {
+	const size_t pos = filename.rfind('/');
+	return (pos != std::string::npos) ? filename.substr(pos+1) : filename;
+      } // basename
+
+      /** Get size of header for appended data array.
+       *
+       * Header contains number of bytes in array as UInt64.
+       */
+      const size_t headerSize = sizeof(unsigned long long);
+
+      /** Get size of base64 encoded data.
+       *
+       * @param size Size of data in bytes.
+       * @returns Number of characters in encoded data.
+       */
+      size_t base64Size(const size_t size) {
+	return 4*((size+2)/3);
+      } // base64Size
+
+    } // _DataWriterVTU
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterVTU::DataWriterVTU(void) :
+  _timeConstant(1.0),
+  _filename("output.pvd"),
+  _timeFormat("%f"),
+  _vStart(0),
+  _vEnd(0),
+  _commRank(0),
+  _commSize(1),
+  _float32(false),
+  _base64(false),
+  _isOpen(false),
+  _isOpenTimeStep(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterVTU::~DataWriterVTU(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterVTU::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  closeTimeStep(); // Insure time step is closed.
+  close(); // Insure clean up.
+  DataWriter::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterVTU::DataWriterVTU(const DataWriterVTU& w) :
+  DataWriter(w),
+  _timeConstant(w._timeConstant),
+  _filename(w._filename),
+  _timeFormat(w._timeFormat),
+  _vStart(0),
+  _vEnd(0),
+  _commRank(0),
+  _commSize(1),
+  _float32(w._float32),
+  _base64(w._base64),
+  _isOpen(false),
+  _isOpenTimeStep(false)
+{ // copy constructor
+} // copy constructor
+
+// ----------------------------------------------------------------------
+// Set value used to normalize time stamp in name of VTK files.
+void
+pylith::meshio::DataWriterVTU::timeConstant(const PylithScalar value)
+{ // timeConstant
+  PYLITH_METHOD_BEGIN;
+
+  if (value <= 0.0) {
+    std::ostringstream msg;
+    msg << "Time used to normalize time stamp in VTK data files must be "
+	<< "positive.\nCurrent value is " << value << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+  _timeConstant = value;
+
+  PYLITH_METHOD_END;
+} // timeConstant
+
+// ----------------------------------------------------------------------
+// Set encoding of appended binary data.
+void
+pylith::meshio::DataWriterVTU::encoding(const char* value)
+{ // encoding
+  PYLITH_METHOD_BEGIN;
+
+  assert(value);
+  const std::string& name = value;
+  if (name == "raw") {
+    _base64 = false;
+  } else if (name == "base64") {
+    _base64 = true;
+  } else {
+    std::ostringstream msg;
+    msg << "Unknown encoding '" << name << "' for binary data in VTK files. "
+	<< "Valid values are 'raw' and 'base64'.";
+    throw std::runtime_error(msg.str());
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // encoding
+
+// ----------------------------------------------------------------------
+// Prepare for writing files.
+void
+pylith::meshio::DataWriterVTU::open(const topology::Mesh& mesh,
+				    const int numTimeSteps,
+				    const char* label,
+				    const int labelId)
+{ // open
+  PYLITH_METHOD_BEGIN;
+
+  DataWriter::open(mesh, numTimeSteps, label, labelId);
+
+  try {
+    PetscErrorCode err = 0;
+
+    _collection.clear();
+    err = MPI_Comm_rank(mesh.comm(), &_commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(mesh.comm(), &_commSize);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    PetscInt cellHeight, cStart, cEnd, cMax;
+    err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmMesh, 0, &_vStart, &_vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    if (cMax >= 0) {
+      cEnd = PetscMin(cEnd, cMax);
+    } // if
+
+    // Cells included in output (cohesive cells are never included).
+    _cells.clear();
+    _cells.reserve(cEnd-cStart);
+    for (PetscInt cell=cStart; cell < cEnd; ++cell) {
+      if (label) {
+	PetscInt value;
+	err = DMGetLabelValue(dmMesh, label, cell, &value);PYLITH_CHECK_ERROR(err);
+	if (value != labelId) continue;
+      } // if
+      _cells.push_back(cell);
+    } // for
+    const PetscInt numCells = _cells.size();
+
+    // Coordinates of vertices (VTK always uses 3 components).
+    const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();assert(cs);
+    const int spaceDim = cs->spaceDim();
+    PylithScalar lengthScale = 1.0;
+    err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    const int numComponents = 3;
+    _points.name = "Points";
+    _points.type = _float32 ? "Float32" : "Float64";
+    _points.numComponents = numComponents;
+    _points.values.clear();
+    _points.values.reserve((_vEnd-_vStart)*numComponents*(_float32 ? sizeof(float) : sizeof(double)));
+    for (PetscInt v=_vStart; v < _vEnd; ++v) {
+      const PetscInt off = coordsVisitor.sectionOffset(v);
+      assert(spaceDim == coordsVisitor.sectionDof(v));
+      for (int iDim=0; iDim < numComponents; ++iDim) {
+	const PylithScalar value = (iDim < spaceDim) ? coordsArray[off+iDim]*lengthScale : 0.0;
+	_DataWriterVTU::appendScalar(&_points.values, value, _float32);
+      } // for
+    } // for
+
+    // Topology using local numbering of vertices.
+    const int cellDim = mesh.dimension();
+    _connectivity.name = "connectivity";
+    _connectivity.type = "Int32";
+    _connectivity.numComponents = 1;
+    _connectivity.values.clear();
+    _offsets.name = "offsets";
+    _offsets.type = "Int32";
+    _offsets.numComponents = 1;
+    _offsets.values.clear();
+    _offsets.values.reserve(numCells*sizeof(int));
+    _types.name = "types";
+    _types.type = "UInt8";
+    _types.numComponents = 1;
+    _types.values.clear();
+    _types.values.reserve(numCells);
+    int offset = 0;
+    for (PetscInt c=0; c < numCells; ++c) {
+      PetscInt *closure = NULL;
+      PetscInt closureSize, nC = 0;
+
+      err = DMPlexGetTransitiveClosure(dmMesh, _cells[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt p=0; p < closureSize*2; p += 2) {
+	if ((closure[p] >= _vStart) && (closure[p] < _vEnd)) {
+	  closure[nC++] = closure[p];
+	} // if
+      } // for
+      err = DMPlexInvertCell(cellDim, nC, closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt p=0; p < nC; ++p) {
+	_DataWriterVTU::appendValue<int>(&_connectivity.values, closure[p] - _vStart);
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dmMesh, _cells[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+      offset += nC;
+      _DataWriterVTU::appendValue<int>(&_offsets.values, offset);
+      _DataWriterVTU::appendValue<unsigned char>(&_types.values, _DataWriterVTU::cellType(cellDim, nC));
+    } // for
+
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error while preparing VTK output '" << _filename << "'.\n" << err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Unknown error while preparing VTK output '" << _filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  _isOpen = true;
+
+  PYLITH_METHOD_END;
+} // open
+
+// ----------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterVTU::close(void)
+{ // close
+  PYLITH_METHOD_BEGIN;
+
+  _cells.clear();
+  _points.values.clear();
+  _connectivity.values.clear();
+  _offsets.values.clear();
+  _types.values.clear();
+  _vertexFields.clear();
+  _cellFields.clear();
+  _collection.clear();
+
+  if (_isOpen) {
+    DataWriter::close();
+  } // if
+  _isOpen = false;
+
+  PYLITH_METHOD_END;
+} // close
+
+// ----------------------------------------------------------------------
+// Prepare file for data at a new time step.
+void
+pylith::meshio::DataWriterVTU::openTimeStep(const PylithScalar t,
+					    const topology::Mesh& mesh,
+					    const char* label,
+					    const int labelId)
+{ // openTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_isOpen && !_isOpenTimeStep);
+
+  _stepRoot = _filenameRoot(t);
+  if (DataWriter::_numTimeSteps > 0) {
+    const PylithScalar tDim = t * DataWriter::_timeScale;
+    _collection.push_back(std::make_pair(tDim, _stepRoot + ".pvtu"));
+  } // if
+
+  _vertexFields.clear();
+  _cellFields.clear();
+
+  _isOpenTimeStep = true;
+
+  PYLITH_METHOD_END;
+} // openTimeStep
+
+// ----------------------------------------------------------------------
+// Write files for time step.
+void
+pylith::meshio::DataWriterVTU::closeTimeStep(void)
+{ // closeTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  if (_isOpenTimeStep) {
+    // Mark time step as closed before writing, so an error does not
+    // leave the writer in a state where the destructor rewrites files.
+    _isOpenTimeStep = false;
+
+    _writePiece();
+    if (!_commRank) {
+      _writeParallelIndex();
+      if (DataWriter::_numTimeSteps > 0) {
+	_writeCollection();
+      } // if
+    } // if
+  } // if
+
+  _vertexFields.clear();
+  _cellFields.clear();
+
+  PYLITH_METHOD_END;
+} // closeTimeStep
+
+// ----------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterVTU::writeVertexField(const PylithScalar t,
+						topology::Field& field,
+						const topology::Mesh& mesh,
+						const PylithScalar scale)
+{ // writeVertexField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_isOpen && _isOpenTimeStep);
+
+  try {
+    _vertexFields.push_back(DataArray());
+    _addFieldValues(&_vertexFields.back(), field, NULL, _vStart, _vEnd-_vStart, scale);
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error while writing field '" << field.label() << "' at time "
+	<< t << " to VTK file '" << _pieceFilename(_stepRoot, _commRank) << "'.\n" << err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Error while writing field '" << field.label() << "' at time "
+	<< t << " to VTK file '" << _pieceFilename(_stepRoot, _commRank) << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // writeVertexField
+
+// ----------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterVTU::writeCellField(const PylithScalar t,
+					      topology::Field& field,
+					      const char* label,
+					      const int labelId,
+					      const PylithScalar scale)
+{ // writeCellField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_isOpen && _isOpenTimeStep);
+
+  try {
+    // Cells were selected using the label in open().
+    _cellFields.push_back(DataArray());
+    const PetscInt* cells = (_cells.size() > 0) ? &_cells[0] : NULL;
+    _addFieldValues(&_cellFields.back(), field, cells, 0, _cells.size(), scale);
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error while writing field '" << field.label() << "' at time "
+	<< t << " to VTK file '" << _pieceFilename(_stepRoot, _commRank) << "'.\n" << err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Error while writing field '" << field.label() << "' at time "
+	<< t << " to VTK file '" << _pieceFilename(_stepRoot, _commRank) << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // writeCellField
+
+// ----------------------------------------------------------------------
+// Generate root of filenames for time step.
+std::string
+pylith::meshio::DataWriterVTU::_filenameRoot(const PylithScalar t) const
+{ // _filenameRoot
+  PYLITH_METHOD_BEGIN;
+
+  std::ostringstream filename;
+  const int indexExt = _filename.find(".pvd");
+  const int numTimeSteps = DataWriter::_numTimeSteps;
+  if (numTimeSteps > 0) {
+    // If data with multiple time steps, then add time stamp to filename
+    char sbuffer[256];
+    sprintf(sbuffer, _timeFormat.c_str(), t/_timeConstant);
+    std::string timestamp(sbuffer);
+    const size_t pos = timestamp.find(".");
+    if (pos != std::string::npos) {
+      timestamp.erase(pos, 1);
+    } // if
+    filename << std::string(_filename, 0, indexExt) << "_t" << timestamp;
+  } else
+    filename << std::string(_filename, 0, indexExt) << "_info";
+
+  PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // _filenameRoot
+
+// ----------------------------------------------------------------------
+// Generate filename for piece written by process.
+std::string
+pylith::meshio::DataWriterVTU::_pieceFilename(const std::string& root,
+					      const int rank)
+{ // _pieceFilename
+  std::ostringstream filename;
+  filename << root << "_p" << rank << ".vtu";
+  return std::string(filename.str());
+} // _pieceFilename
+
+// ----------------------------------------------------------------------
+// Add values from field to data array.
+void
+pylith::meshio::DataWriterVTU::_addFieldValues(DataArray* array,
+					       const topology::Field& field,
+					       const PetscInt* points,
+					       const PetscInt pStart,
+					       const PetscInt numPoints,
+					       const PylithScalar scale) const
+{ // _addFieldValues
+  PYLITH_METHOD_BEGIN;
+
+  assert(array);
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  // Only processes with points for output get the correct fiber dimension.
+  PetscInt fiberDimLocal = 0;
+  if (numPoints > 0) {
+    const PetscInt point = points ? points[pStart] : pStart;
+    fiberDimLocal = fieldVisitor.sectionDof(point);
+  } // if
+  PetscInt fiberDim = 0;
+  PetscErrorCode err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPIU_INT, MPI_MAX, field.mesh().comm());PYLITH_CHECK_ERROR(err);
+
+  // ParaView only recognizes vectors with 3 components, so pad 1-D
+  // and 2-D vectors with zeros.
+  const int numComponents = (topology::FieldBase::VECTOR == field.vectorFieldType() && fiberDim < 3) ? 3 : fiberDim;
+
+  array->name = field.label();
+  array->type = _float32 ? "Float32" : "Float64";
+  array->numComponents = numComponents;
+  array->values.clear();
+  array->values.reserve(numPoints*numComponents*(_float32 ? sizeof(float) : sizeof(double)));
+  for (PetscInt i=0; i < numPoints; ++i) {
+    const PetscInt point = points ? points[pStart+i] : pStart+i;
+    const PetscInt off = fieldVisitor.sectionOffset(point);
+    const PetscInt dof = fieldVisitor.sectionDof(point);
+    assert(dof <= fiberDim);
+    for (int iComp=0; iComp < numComponents; ++iComp) {
+      const PylithScalar value = (iComp < dof) ? fieldArray[off+iComp]*scale : 0.0;
+      _DataWriterVTU::appendScalar(&array->values, value, _float32);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _addFieldValues
+
+// ----------------------------------------------------------------------
+// Write XML element for data array with appended data.
+void
+pylith::meshio::DataWriterVTU::_writeArrayElement(std::ostream& fout,
+						  const DataArray& array,
+						  size_t* offset) const
+{ // _writeArrayElement
+  assert(offset);
+
+  fout << "<DataArray type=\"" << array.type << "\" Name=\"" << array.name << "\"";
+  if (array.numComponents > 1) {
+    fout << " NumberOfComponents=\"" << array.numComponents << "\"";
+  } // if
+  fout << " format=\"appended\" offset=\"" << *offset << "\"/>\n";
+
+  const size_t size = array.values.size();
+  if (_base64) {
+    *offset += _DataWriterVTU::base64Size(_DataWriterVTU::headerSize) + _DataWriterVTU::base64Size(size);
+  } else {
+    *offset += _DataWriterVTU::headerSize + size;
+  } // if/else
+} // _writeArrayElement
+
+// ----------------------------------------------------------------------
+// Write values of data array to appended data.
+void
+pylith::meshio::DataWriterVTU::_writeArrayValues(std::ostream& fout,
+						 const DataArray& array) const
+{ // _writeArrayValues
+  const unsigned long long size = array.values.size();
+  const char* values = (size > 0) ? &array.values[0] : NULL;
+  if (_base64) {
+    // Header and values are encoded separately.
+    fout << _encodeBase64(reinterpret_cast<const char*>(&size), _DataWriterVTU::headerSize)
+	 << _encodeBase64(values, size);
+  } else {
+    fout.write(reinterpret_cast<const char*>(&size), _DataWriterVTU::headerSize);
+    fout.write(values, size);
+  } // if/else
+} // _writeArrayValues
+
+// ----------------------------------------------------------------------
+// Write unstructured grid (.vtu) file for local piece.
+void
+pylith::meshio::DataWriterVTU::_writePiece(void) const
+{ // _writePiece
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& filename = _pieceFilename(_stepRoot, _commRank);
+  std::ofstream fout(filename.c_str(), std::ios::out | std::ios::binary);
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTK file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const size_t numPoints = _vEnd - _vStart;
+  const size_t numCells = _cells.size();
+  const size_t numVertexFields = _vertexFields.size();
+  const size_t numCellFields = _cellFields.size();
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\""
+       << _DataWriterVTU::byteOrder() << "\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\">\n";
+
+  // Appended data is in the same order as the elements.
+  size_t offset = 0;
+  fout << "      <PointData>\n";
+  for (size_t i=0; i < numVertexFields; ++i) {
+    fout << "        ";
+    _writeArrayElement(fout, _vertexFields[i], &offset);
+  } // for
+  fout << "      </PointData>\n"
+       << "      <CellData>\n";
+  for (size_t i=0; i < numCellFields; ++i) {
+    fout << "        ";
+    _writeArrayElement(fout, _cellFields[i], &offset);
+  } // for
+  fout << "      </CellData>\n"
+       << "      <Points>\n"
+       << "        ";
+  _writeArrayElement(fout, _points, &offset);
+  fout << "      </Points>\n"
+       << "      <Cells>\n"
+       << "        ";
+  _writeArrayElement(fout, _connectivity, &offset);
+  fout << "        ";
+  _writeArrayElement(fout, _offsets, &offset);
+  fout << "        ";
+  _writeArrayElement(fout, _types, &offset);
+  fout << "      </Cells>\n"
+       << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"" << (_base64 ? "base64" : "raw") << "\">\n"
+       << "   _";
+  for (size_t i=0; i < numVertexFields; ++i) {
+    _writeArrayValues(fout, _vertexFields[i]);
+  } // for
+  for (size_t i=0; i < numCellFields; ++i) {
+    _writeArrayValues(fout, _cellFields[i]);
+  } // for
+  _writeArrayValues(fout, _points);
+  _writeArrayValues(fout, _connectivity);
+  _writeArrayValues(fout, _offsets);
+  _writeArrayValues(fout, _types);
+  fout << "\n"
+       << "  </AppendedData>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing VTK file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writePiece
+
+// ----------------------------------------------------------------------
+// Write parallel unstructured grid (.pvtu) file.
+void
+pylith::meshio::DataWriterVTU::_writeParallelIndex(void) const
+{ // _writeParallelIndex
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& filename = _stepRoot + ".pvtu";
+  std::ofstream fout(filename.c_str());
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTK file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\""
+       << _DataWriterVTU::byteOrder() << "\" header_type=\"UInt64\">\n"
+       << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+       << "    <PPointData>\n";
+  const size_t numVertexFields = _vertexFields.size();
+  for (size_t i=0; i < numVertexFields; ++i) {
+    fout << "      <PDataArray type=\"" << _vertexFields[i].type
+	 << "\" Name=\"" << _vertexFields[i].name
+	 << "\" NumberOfComponents=\"" << _vertexFields[i].numComponents << "\"/>\n";
+  } // for
+  fout << "    </PPointData>\n"
+       << "    <PCellData>\n";
+  const size_t numCellFields = _cellFields.size();
+  for (size_t i=0; i < numCellFields; ++i) {
+    fout << "      <PDataArray type=\"" << _cellFields[i].type
+	 << "\" Name=\"" << _cellFields[i].name
+	 << "\" NumberOfComponents=\"" << _cellFields[i].numComponents << "\"/>\n";
+  } // for
+  fout << "    </PCellData>\n"
+       << "    <PPoints>\n"
+       << "      <PDataArray type=\"" << _points.type
+       << "\" Name=\"" << _points.name
+       << "\" NumberOfComponents=\"" << _points.numComponents << "\"/>\n"
+       << "    </PPoints>\n";
+  for (int rank=0; rank < _commSize; ++rank) {
+    fout << "    <Piece Source=\"" << _DataWriterVTU::basename(_pieceFilename(_stepRoot, rank)) << "\"/>\n";
+  } // for
+  fout << "  </PUnstructuredGrid>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing VTK file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writeParallelIndex
+
+// ----------------------------------------------------------------------
+// Write collection (.pvd) file with time steps.
+void
+pylith::meshio::DataWriterVTU::_writeCollection(void) const
+{ // _writeCollection
+  PYLITH_METHOD_BEGIN;
+
+  std::ofstream fout(_filename.c_str());
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTK collection file '" << _filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fout.precision(16);
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\""
+       << _DataWriterVTU::byteOrder() << "\">\n"
+       << "  <Collection>\n";
+  const size_t numSteps = _collection.size();
+  for (size_t i=0; i < numSteps; ++i) {
+    fout << "    <DataSet timestep=\"" << _collection[i].first
+	 << "\" group=\"\" part=\"0\" file=\"" << _DataWriterVTU::basename(_collection[i].second) << "\"/>\n";
+  } // for
+  fout << "  </Collection>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing VTK collection file '" << _filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writeCollection
+
+// ----------------------------------------------------------------------
+// Encode data using base64.
+std::string
+pylith::meshio::DataWriterVTU::_encodeBase64(const char* data,
+					     const size_t size)
+{ // _encodeBase64
+  static const char* alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  std::string encoded(_DataWriterVTU::base64Size(size), '=');
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+  size_t index = 0;
+  size_t i = 0;
+  for (; i+2 < size; i += 3) {
+    const unsigned int triple = (bytes[i] << 16) | (bytes[i+1] << 8) | bytes[i+2];
+    encoded[index++] = alphabet[(triple >> 18) & 0x3f];
+    encoded[index++] = alphabet[(triple >> 12) & 0x3f];
+    encoded[index++] = alphabet[(triple >> 6) & 0x3f];
+    encoded[index++] = alphabet[triple & 0x3f];
+  } // for
+  if (i < size) {
+    // Remaining 1 or 2 bytes; padding is already in place.
+    const unsigned int triple = (bytes[i] << 16) | ((i+1 < size) ? (bytes[i+1] << 8) : 0);
+    encoded[index++] = alphabet[(triple >> 18) & 0x3f];
+    encoded[index++] = alphabet[(triple >> 12) & 0x3f];
+    if (i+1 < size) {
+      encoded[index++] = alphabet[(triple >> 6) & 0x3f];
+    } // if
+  } // if
+
+  return encoded;
+} // _encodeBase64
+
+
+// End of file
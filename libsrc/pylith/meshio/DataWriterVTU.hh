@@ -0,0 +1,303 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterVTU.hh
+ *
+ * @brief Object for writing finite-element data to XML VTK files.
+ *
+ * Each process writes its local portion of the mesh and fields to a
+ * separate unstructured grid (.vtu) file with the data in binary
+ * form appended after the XML header. Process 0 writes the parallel
+ * unstructured grid (.pvtu) file that references the pieces for each
+ * time step and a collection (.pvd) file listing all of the time
+ * steps. The collection file is rewritten after each time step, so it
+ * is usable even if the simulation terminates early.
+ *
+ * The XML header must list all of the data arrays before the appended
+ * data, so we accumulate the binary values for the time step and
+ * write the file in closeTimeStep().
+ */
+
+#if !defined(pylith_meshio_datawritervtu_hh)
+#define pylith_meshio_datawritervtu_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include <vector> // HASA std::vector
+#include <utility> // USES std::pair
+#include <iosfwd> // USES std::ostream
+
+// DataWriterVTU --------------------------------------------------------
+/// Object for writing finite-element data to XML VTK files.
+class pylith::meshio::DataWriterVTU : public DataWriter
+{ // DataWriterVTU
+  friend class TestDataWriterVTU; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  DataWriterVTU(void);
+
+  /// Destructor
+  ~DataWriterVTU(void);
+
+  /** Make copy of this object.
+   *
+   * @returns Copy of this.
+   */
+  DataWriter* clone(void) const;
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set filename for VTK collection (.pvd) file.
+   *
+   * The names of the files for each time step are generated from
+   * this name.
+   *
+   * @param filename Name of VTK collection file.
+   */
+  void filename(const char* filename);
+
+  /** Set time format for time stamp in name of VTK files.
+   *
+   * @param format C style time format for filename.
+   */
+  void timeFormat(const char* format);
+
+  /** Set value used to normalize time stamp in name of VTK files.
+   *
+   * Time stamp is divided by this value (time in seconds).
+   *
+   * @param value Value (time in seconds) used to normalize time stamp in
+   * filename.
+   */
+  void timeConstant(const PylithScalar value);
+
+  /** Set flag indicating whether to store floating point values as
+   * 32-bit floats.
+   *
+   * @param value True if values are stored as 32-bit floats, false
+   * if values are stored as 64-bit floats.
+   */
+  void float32(const bool value);
+
+  /** Set encoding of appended binary data.
+   *
+   * @param value Encoding ("raw" or "base64").
+   */
+  void encoding(const char* value);
+
+  /** Prepare for writing files.
+   *
+   * @param mesh Finite-element mesh.
+   * @param numTimeSteps Expected number of time steps for fields.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void open(const topology::Mesh& mesh,
+	    const int numTimeSteps,
+	    const char* label =0,
+	    const int labelId =0);
+
+  /// Close output files.
+  void close(void);
+
+  /** Prepare file for data at a new time step.
+   *
+   * @param t Time stamp for new data
+   * @param mesh Finite-element mesh.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void openTimeStep(const PylithScalar t,
+		    const topology::Mesh& mesh,
+		    const char* label =0,
+		    const int labelId =0);
+
+  /// Write files for time step.
+  void closeTimeStep(void);
+
+  /** Write field over vertices to file.
+   *
+   * @param t Time associated with field.
+   * @param field Field over vertices.
+   * @param mesh Mesh associated with output.
+   * @param scale Scale applied to values as they are written.
+   */
+  void writeVertexField(const PylithScalar t,
+			topology::Field& field,
+			const topology::Mesh& mesh,
+			const PylithScalar scale =1.0);
+
+  /** Write field over cells to file.
+   *
+   * @param t Time associated with field.
+   * @param field Field over cells.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   * @param scale Scale applied to values as they are written.
+   */
+  void writeCellField(const PylithScalar t,
+		      topology::Field& field,
+		      const char* label =0,
+		      const int labelId =0,
+		      const PylithScalar scale =1.0);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Data array with values stored in binary form.
+  struct DataArray {
+    std::string name; ///< Name of array.
+    std::string type; ///< VTK data type (Float32, Int32, etc).
+    int numComponents; ///< Number of components per point/cell.
+    std::vector<char> values; ///< Values in native byte order.
+  }; // DataArray
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Copy constructor.
+   *
+   * @param w Object to copy.
+   */
+  DataWriterVTU(const DataWriterVTU& w);
+
+  /** Generate root of filenames for time step.
+   *
+   * @param t Time in seconds.
+   * @returns Filename without extension.
+   */
+  std::string _filenameRoot(const PylithScalar t) const;
+
+  /** Generate filename for piece written by process.
+   *
+   * @param root Root of filenames for time step.
+   * @param rank Rank of process.
+   * @returns Name of unstructured grid (.vtu) file.
+   */
+  static
+  std::string _pieceFilename(const std::string& root,
+			     const int rank);
+
+  /** Add values from field to data array.
+   *
+   * @param array Data array.
+   * @param field Field with values.
+   * @param points Array of points (=0 means points are consecutive
+   *   starting at pStart).
+   * @param pStart First point (or first index into points).
+   * @param numPoints Number of points.
+   * @param scale Scale applied to values.
+   */
+  void _addFieldValues(DataArray* array,
+		       const topology::Field& field,
+		       const PetscInt* points,
+		       const PetscInt pStart,
+		       const PetscInt numPoints,
+		       const PylithScalar scale) const;
+
+  /** Write XML element for data array with appended data.
+   *
+   * @param fout Output stream.
+   * @param array Data array.
+   * @param offset Offset of data in appended data (updated on return).
+   */
+  void _writeArrayElement(std::ostream& fout,
+			  const DataArray& array,
+			  size_t* offset) const;
+
+  /** Write values of data array to appended data.
+   *
+   * @param fout Output stream.
+   * @param array Data array.
+   */
+  void _writeArrayValues(std::ostream& fout,
+			 const DataArray& array) const;
+
+  /// Write unstructured grid (.vtu) file for local piece.
+  void _writePiece(void) const;
+
+  /// Write parallel unstructured grid (.pvtu) file.
+  void _writeParallelIndex(void) const;
+
+  /// Write collection (.pvd) file with time steps.
+  void _writeCollection(void) const;
+
+  /** Encode data using base64.
+   *
+   * @param data Data to encode.
+   * @param size Size of data in bytes.
+   * @returns Encoded data.
+   */
+  static
+  std::string _encodeBase64(const char* data,
+			    const size_t size);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  const DataWriterVTU& operator=(const DataWriterVTU&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /// Time value (in seconds) used to normalize time stamp.
+  PylithScalar _timeConstant;
+
+  std::string _filename; ///< Name of VTK collection file.
+  std::string _timeFormat; ///< C style time format for time stamp.
+  std::string _stepRoot; ///< Root of filenames for current time step.
+
+  /// Time stamps and names of parallel files for collection file.
+  std::vector<std::pair<PylithScalar, std::string> > _collection;
+
+  std::vector<PetscInt> _cells; ///< Cells included in output.
+  PetscInt _vStart; ///< First vertex in output.
+  PetscInt _vEnd; ///< End of vertices in output.
+
+  DataArray _points; ///< Coordinates of vertices.
+  DataArray _connectivity; ///< Vertices in cells.
+  DataArray _offsets; ///< Offsets of cells in connectivity.
+  DataArray _types; ///< VTK cell types.
+  std::vector<DataArray> _vertexFields; ///< Fields over vertices.
+  std::vector<DataArray> _cellFields; ///< Fields over cells.
+
+  int _commRank; ///< Rank of process.
+  int _commSize; ///< Number of processes.
+
+  bool _float32; ///< True if floating point values are stored as 32-bit.
+  bool _base64; ///< True if appended data is base64 encoded.
+  bool _isOpen; ///< True if called open().
+  bool _isOpenTimeStep; ///< True if called openTimeStep().
+
+}; // DataWriterVTU
+
+#include "DataWriterVTU.icc" // inline methods
+
+#endif // pylith_meshio_datawritervtu_hh
+
+
+// End of file
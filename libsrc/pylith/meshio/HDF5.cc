@@ -1103,6 +1103,171 @@ pylith::meshio::HDF5::extendDatasetRawExternal(const char* parent,
   PYLITH_METHOD_END;
 } // extendDatasetRawExternal
 
+// ----------------------------------------------------------------------
+// Write dataset in a single contiguous block.
+void
+pylith::meshio::HDF5::writeDataset(const char* parent,
+				   const char* name,
+				   const void* data,
+				   const hsize_t* dims,
+				   const int ndims,
+				   hid_t datatype)
+{ // writeDataset
+  PYLITH_METHOD_BEGIN;
+
+  assert(parent);
+  assert(name);
+  assert(dims);
+  assert(_file > 0);
+
+  try {
+    // Open group
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t group = H5Gopen2(_file, parent, H5P_DEFAULT);
+#else
+    hid_t group = H5Gopen(_file, parent);
+#endif
+    if (group < 0)
+      throw std::runtime_error("Could not open group.");
+
+    // Create the dataspace
+    hid_t dataspace = H5Screate_simple(ndims, dims, NULL);
+    if (dataspace < 0)
+      throw std::runtime_error("Could not create dataspace.");
+
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dcreate2(group, name, datatype, dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dcreate(group, name, datatype, dataspace, H5P_DEFAULT);
+#endif
+    if (dataset < 0)
+      throw std::runtime_error("Could not create dataset.");
+
+    hsize_t size = 1;
+    for (int i=0; i < ndims; ++i)
+      size *= dims[i];
+    herr_t err = 0;
+    if (size > 0) {
+      assert(data);
+      err = H5Dwrite(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+      if (err < 0)
+	throw std::runtime_error("Could not write dataset.");
+    } // if
+
+    err = H5Dclose(dataset);
+    if (err < 0)
+      throw std::runtime_error("Could not close dataset.");
+
+    err = H5Sclose(dataspace);
+    if (err < 0)
+      throw std::runtime_error("Could not close dataspace.");
+
+    err = H5Gclose(group);
+    if (err < 0)
+      throw std::runtime_error("Could not close group.");
+
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while writing dataset '"
+	<< parent << "/" << name << "':\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Unknown error occurred while writing dataset '"
+	<< parent << "/" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // writeDataset
+
+// ----------------------------------------------------------------------
+// Read entire dataset.
+void
+pylith::meshio::HDF5::readDataset(const char* parent,
+				  const char* name,
+				  char** const data,
+				  hsize_t** const dims,
+				  int* const ndims,
+				  hid_t datatype)
+{ // readDataset
+  PYLITH_METHOD_BEGIN;
+
+  assert(parent);
+  assert(name);
+  assert(data);
+  assert(dims);
+  assert(ndims);
+  assert(_file > 0);
+
+  try {
+    // Open group
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t group = H5Gopen2(_file, parent, H5P_DEFAULT);
+#else
+    hid_t group = H5Gopen(_file, parent);
+#endif
+    if (group < 0)
+      throw std::runtime_error("Could not open group.");
+
+    // Open the dataset
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dopen2(group, name, H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dopen(group, name);
+#endif
+    if (dataset < 0)
+      throw std::runtime_error("Could not open dataset.");
+
+    hid_t dataspace = H5Dget_space(dataset);
+    if (dataspace < 0)
+      throw std::runtime_error("Could not get dataspace.");
+
+    *ndims = H5Sget_simple_extent_ndims(dataspace);
+    delete[] *dims; *dims = (*ndims > 0) ? new hsize_t[*ndims] : 0;
+    H5Sget_simple_extent_dims(dataspace, *dims, 0);
+
+    int sizeBytes = H5Tget_size(datatype);
+    for (int i=0; i < *ndims; ++i)
+      sizeBytes *= (*dims)[i];
+    delete[] *data; *data = (sizeBytes > 0) ? new char[sizeBytes] : 0;
+
+    herr_t err = 0;
+    if (sizeBytes > 0) {
+      err = H5Dread(dataset, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, (void*)*data);
+      if (err < 0)
+	throw std::runtime_error("Could not read data.");
+    } // if
+
+    err = H5Sclose(dataspace);
+    if (err < 0)
+      throw std::runtime_error("Could not close dataspace.");
+
+    err = H5Dclose(dataset);
+    if (err < 0)
+      throw std::runtime_error("Could not close dataset.");
+
+    err = H5Gclose(group);
+    if (err < 0)
+      throw std::runtime_error("Could not close group.");
+
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while reading dataset '"
+	<< parent << "/" << name << "':\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Unknown error occurred while reading dataset '"
+	<< parent << "/" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // readDataset
+
 // ----------------------------------------------------------------------
 // Write dataset comprised of an array of strings (external HDF5 handle).
 void
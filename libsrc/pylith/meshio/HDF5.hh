@@ -270,6 +270,40 @@ public :
 				const hsize_t* dims,
 				const int ndims);
   
+  /** Write dataset in a single contiguous block.
+   *
+   * @param parent Full path of parent group for dataset.
+   * @param name Name of dataset.
+   * @param data Data.
+   * @param dims Dimensions of data.
+   * @param ndims Number of dimensions of data.
+   * @param datatype Type of data.
+   */
+  void writeDataset(const char* parent,
+		    const char* name,
+		    const void* data,
+		    const hsize_t* dims,
+		    const int ndims,
+		    hid_t datatype);
+
+  /** Read entire dataset.
+   *
+   * Method caller is responsible for memory management of data and dims.
+   *
+   * @param parent Full path of parent group for dataset.
+   * @param name Name of dataset.
+   * @param data Data.
+   * @param dims Dimensions of data.
+   * @param ndims Number of dimensions of data.
+   * @param datatype Type of data.
+   */
+  void readDataset(const char* parent,
+		   const char* name,
+		   char** const data,
+		   hsize_t** const dims,
+		   int* const ndims,
+		   hid_t datatype);
+
   /** Write dataset comprised of an array of strings. 
    *
    * Data is written as fixed length strings matching the maximum
@@ -21,20 +21,50 @@
 #include "MeshIOAscii.hh" // implementation of class methods
 
 #include "MeshBuilder.hh" // USES MeshBuilder
+#include "TextTokenizer.hh" // USES TextTokenizer
 #include "pylith/topology/Mesh.hh" // USES Mesh
 
 #include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
-#include "spatialdata/utils/LineParser.hh" // USES LineParser
 
 #include "journal/info.h" // USES journal::info_t
 
+#include <sys/stat.h> // USES stat()
 #include <iomanip> // USES setw(), setiosflags(), resetiosflags()
-#include <strings.h> // USES strcasecmp()
+#include <cstdio> // USES rename(), remove()
+#include <cstring> // USES strncmp()
 #include <cassert> // USES assert()
 #include <fstream> // USES std::ifstream, std::ofstream
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _MeshIOAscii {
+
+      /// Identifier at beginning of binary cache file.
+      const char cacheMagic[] = "PYLMESH1";
+      const size_t cacheMagicSize = 8;
+
+      /// Write value to binary stream.
+      template<typename T>
+      void writeValue(std::ostream& fout,
+		      const T& value) {
+	fout.write(reinterpret_cast<const char*>(&value), sizeof(T));
+      } // writeValue
+
+      /// Read value from binary stream.
+      template<typename T>
+      T readValue(std::istream& fin) {
+	T value = T(0);
+	fin.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return value;
+      } // readValue
+
+    } // _MeshIOAscii
+  } // meshio
+} // pylith
+
 // ----------------------------------------------------------------------
 const char* pylith::meshio::MeshIOAscii::groupTypeNames[2] = {
   "vertices",
@@ -45,7 +75,8 @@ const char* pylith::meshio::MeshIOAscii::groupTypeNames[2] = {
 // Constructor
 pylith::meshio::MeshIOAscii::MeshIOAscii(void) :
   _filename(""),
-  _useIndexZero(true)
+  _useIndexZero(true),
+  _useCache(false)
 { // constructor
 } // constructor
 
@@ -76,114 +107,36 @@ pylith::meshio::MeshIOAscii::_read(void)
   PYLITH_METHOD_BEGIN;
 
   const int commRank = _mesh->commRank();
-  int meshDim = 0;
-  int spaceDim = 0;
-  int numVertices = 0;
-  int numCells = 0;
-  int numCorners = 0;
-  scalar_array coordinates;
-  int_array cells;
-  int_array materialIds;
+  MeshInfo meshInfo;
 
   if (0 == commRank) {
-    std::ifstream filein(_filename.c_str());
-    if (!filein.is_open() || !filein.good()) {
-      std::ostringstream msg;
-      msg << "Could not open mesh file '" << _filename
-          << "' for reading.\n";
-      throw std::runtime_error(msg.str());
-    } // if
-
-    spatialdata::utils::LineParser parser(filein, "//");
-    parser.eatwhitespace(true);
-    
-    std::string token;
-    std::istringstream buffer;
-    const int maxIgnore = 1024;
-    
-    buffer.str(parser.next());
-    buffer >> token;
-    if (strcasecmp(token.c_str(), "mesh")) {
-      std::ostringstream msg;
-      msg << "Expected 'mesh' token but encountered '" << token << "'\n";
-      throw std::runtime_error(msg.str());
-    } // if
-
-    bool readDim = false;
-    bool readCells = false;
-    bool readVertices = false;
-    bool builtMesh = false;
-
-    try {
-      buffer.str(parser.next());
-      buffer.clear();
-      buffer >> token;
-      while (buffer.good() && token != "}") {
-	if (0 == strcasecmp(token.c_str(), "dimension")) {
-	  buffer.ignore(maxIgnore, '=');
-	  buffer >> meshDim;
-	  readDim = true;
-	} else if (0 == strcasecmp(token.c_str(), "use-index-zero")) {
-	  buffer.ignore(maxIgnore, '=');
-	  std::string flag = "";
-	  buffer >> flag;
-	  if (0 == strcasecmp(flag.c_str(), "true"))
-	    _useIndexZero = true;
-	  else
-	    _useIndexZero = false;
-	} else if (0 == strcasecmp(token.c_str(), "vertices")) {
-	  _readVertices(parser, &coordinates, &numVertices, &spaceDim);
-	  readVertices = true;
-	} else if (0 == strcasecmp(token.c_str(), "cells")) {
-	  _readCells(parser, &cells, &materialIds, &numCells, &numCorners);
-	  readCells = true;
-	} else if (0 == strcasecmp(token.c_str(), "group")) {
-	  std::string name;
-	  GroupPtType type;
-	  int_array points;
-
-	  if (!builtMesh)
-	    throw std::runtime_error("Both 'vertices' and 'cells' must "
-				     "precede any groups in mesh file.");
-	  _readGroup(parser, &points, &type, &name);
-	  _setGroup(name, type, points);
-	} else {
-	  std::ostringstream msg;
-	  msg << "Could not parse '" << token << "' into a mesh setting.";
-	  throw std::runtime_error(msg.str());  
-	} // else
-
-	if (readDim && readCells && readVertices && !builtMesh) {
-	  // Can now build mesh
-	  MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim,
-				 cells, numCells, numCorners, meshDim,
-				 _interpolate);
-	  _setMaterials(materialIds);
-	  builtMesh = true;
-	} // if
-
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> token;
-      } // while
-      if (token != "}")
-	throw std::runtime_error("I/O error occurred while parsing mesh tokens.");
-    } catch (const std::exception& err) {
-      std::ostringstream msg;
-      msg << "Error occurred while reading PyLith mesh ASCII file '"
-	  << _filename << "'.\n"
-	  << err.what();
-      throw std::runtime_error(msg.str());
-    } catch (...) {
-      std::ostringstream msg;      
-      msg << "Unknown I/O error while reading PyLith mesh ASCII file '"
-	  << _filename << "'.\n";
-      throw std::runtime_error(msg.str());
-    } // catch
-    filein.close();
+    if (_useCache && _readCache(&meshInfo)) {
+      journal::info_t info("meshioascii");
+      info << journal::at(__HERE__)
+	   << "Read mesh from cache file '" << _cacheFilename() << "'."
+	   << journal::endl;
+    } else {
+      _parse(&meshInfo);
+      if (_useCache) {
+	_writeCache(meshInfo);
+      } // if
+    } // if/else
+
+    MeshBuilder::buildMesh(_mesh, &meshInfo.coordinates, meshInfo.numVertices, meshInfo.spaceDim,
+			   meshInfo.cells, meshInfo.numCells, meshInfo.numCorners, meshInfo.meshDim,
+			   _interpolate);
+    _setMaterials(meshInfo.materialIds);
+
+    const size_t numGroups = meshInfo.groups.size();
+    for (size_t i=0; i < numGroups; ++i) {
+      const Group& group = meshInfo.groups[i];
+      _setGroup(group.name, group.type, group.points);
+    } // for
   } else {
-    MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim, _interpolate);
-    _setMaterials(materialIds);
+    MeshBuilder::buildMesh(_mesh, &meshInfo.coordinates, meshInfo.numVertices, meshInfo.spaceDim,
+			   meshInfo.cells, meshInfo.numCells, meshInfo.numCorners, meshInfo.meshDim,
+			   _interpolate);
+    _setMaterials(meshInfo.materialIds);
   } // if/else
   _distributeGroups();
 
@@ -225,10 +178,96 @@ pylith::meshio::MeshIOAscii::_write(void) const
   PYLITH_METHOD_END;
 } // write
 
+// ----------------------------------------------------------------------
+// Parse ASCII mesh file.
+void
+pylith::meshio::MeshIOAscii::_parse(MeshInfo* meshInfo)
+{ // _parse
+  PYLITH_METHOD_BEGIN;
+
+  assert(meshInfo);
+
+  TextTokenizer tokenizer;
+  try {
+    tokenizer.open(_filename.c_str());
+  } catch (const std::exception&) {
+    std::ostringstream msg;
+    msg << "Could not open mesh file '" << _filename
+	<< "' for reading.\n";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  try {
+    const char* token = 0;
+    size_t length = 0;
+    if (!tokenizer.nextLine() || !tokenizer.nextToken(&token, &length) || !TextTokenizer::matches(token, length, "mesh")) {
+      std::ostringstream msg;
+      msg << "Expected 'mesh' token but encountered '" << std::string(token ? token : "", length) << "'\n";
+      throw std::runtime_error(msg.str());
+    } // if
+
+    bool readDim = false;
+    bool readCells = false;
+    bool readVertices = false;
+
+    while (true) {
+      if (!tokenizer.nextLine())
+	throw std::runtime_error("I/O error occurred while parsing mesh tokens.");
+      tokenizer.nextToken(&token, &length);
+      if (TextTokenizer::matches(token, length, "}")) {
+	break;
+      } else if (TextTokenizer::matches(token, length, "dimension")) {
+	tokenizer.skipPast('=');
+	meshInfo->meshDim = tokenizer.readInt();
+	readDim = true;
+      } else if (TextTokenizer::matches(token, length, "use-index-zero")) {
+	tokenizer.skipPast('=');
+	const char* flag = 0;
+	size_t flagLength = 0;
+	tokenizer.nextToken(&flag, &flagLength);
+	_useIndexZero = TextTokenizer::matches(flag, flagLength, "true");
+      } else if (TextTokenizer::matches(token, length, "vertices")) {
+	_readVertices(tokenizer, &meshInfo->coordinates, &meshInfo->numVertices, &meshInfo->spaceDim);
+	readVertices = true;
+      } else if (TextTokenizer::matches(token, length, "cells")) {
+	_readCells(tokenizer, &meshInfo->cells, &meshInfo->materialIds, &meshInfo->numCells, &meshInfo->numCorners);
+	readCells = true;
+      } else if (TextTokenizer::matches(token, length, "group")) {
+	if (!readDim || !readCells || !readVertices)
+	  throw std::runtime_error("Both 'vertices' and 'cells' must "
+				   "precede any groups in mesh file.");
+	meshInfo->groups.push_back(Group());
+	Group& group = meshInfo->groups.back();
+	_readGroup(tokenizer, &group.points, &group.type, &group.name);
+      } else {
+	std::ostringstream msg;
+	msg << "Could not parse '" << std::string(token, length) << "' into a mesh setting.";
+	throw std::runtime_error(msg.str());  
+      } // else
+    } // while
+    if (!readDim || !readCells || !readVertices)
+      throw std::runtime_error("Mesh file must contain 'dimension', 'vertices', and 'cells'.");
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while reading PyLith mesh ASCII file '"
+	<< _filename << "' at line " << tokenizer.lineNumber() << ".\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;      
+    msg << "Unknown I/O error while reading PyLith mesh ASCII file '"
+	<< _filename << "' at line " << tokenizer.lineNumber() << ".\n";
+    throw std::runtime_error(msg.str());
+  } // catch
+  tokenizer.close();
+
+  PYLITH_METHOD_END;
+} // _parse
+
 // ----------------------------------------------------------------------
 // Read mesh vertices.
 void
-pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readVertices(TextTokenizer& tokenizer,
 					   scalar_array* coordinates,
 					   int* numVertices, 
 					   int* numDims) const
@@ -239,20 +278,21 @@ pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parse
   assert(numVertices);
   assert(numDims);
 
-  std::string token;
-  std::istringstream buffer;
-  const int maxIgnore = 1024;
-  buffer.str(parser.next());
-  buffer.clear();
-  buffer >> token;
-  while (buffer.good() && token != "}") {
-    if (0 == strcasecmp(token.c_str(), "dimension")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numDims;
-    } else if (0 == strcasecmp(token.c_str(), "count")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numVertices;
-    } else if (0 == strcasecmp(token.c_str(), "coordinates")) {
+  const char* token = 0;
+  size_t length = 0;
+  while (true) {
+    if (!tokenizer.nextLine())
+      throw std::runtime_error("I/O error while parsing vertices.");
+    tokenizer.nextToken(&token, &length);
+    if (TextTokenizer::matches(token, length, "}")) {
+      break;
+    } else if (TextTokenizer::matches(token, length, "dimension")) {
+      tokenizer.skipPast('=');
+      *numDims = tokenizer.readInt();
+    } else if (TextTokenizer::matches(token, length, "count")) {
+      tokenizer.skipPast('=');
+      *numVertices = tokenizer.readInt();
+    } else if (TextTokenizer::matches(token, length, "coordinates")) {
       const int size = (*numVertices) * (*numDims);
       if (0 == size) {
 	const char* msg = 
@@ -260,26 +300,20 @@ pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parse
 	throw std::runtime_error(msg);
       } // if
       coordinates->resize(size);
-      int label;
       for (int iVertex=0, i=0; iVertex < *numVertices; ++iVertex) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
+	if (!tokenizer.nextLine())
+	  throw std::runtime_error("I/O error while parsing vertices.");
+	tokenizer.readInt(); // vertex label
 	for (int iDim=0; iDim < *numDims; ++iDim)
-	  buffer >> (*coordinates)[i++];
+	  (*coordinates)[i++] = tokenizer.readScalar();
       } // for
-      parser.ignore('}');
+      tokenizer.ignore('}');
     } else {
       std::ostringstream msg;
-      msg << "Could not parse '" << token << "' into a vertices setting.";
+      msg << "Could not parse '" << std::string(token, length) << "' into a vertices setting.";
       throw std::runtime_error(msg.str());
     } // else
-    buffer.str(parser.next());
-    buffer.clear();
-    buffer >> token;
   } // while
-  if (token != "}")
-    throw std::runtime_error("I/O error while parsing vertices.");
 
   PYLITH_METHOD_END;
 } // _readVertices
@@ -321,7 +355,7 @@ pylith::meshio::MeshIOAscii::_writeVertices(std::ostream& fileout) const
 // ----------------------------------------------------------------------
 // Read mesh cells.
 void
-pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readCells(TextTokenizer& tokenizer,
 					int_array* cells,
 					int_array* materialIds,
 					int* numCells, 
@@ -334,20 +368,21 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
   assert(numCells);
   assert(numCorners);
 
-  std::string token;
-  std::istringstream buffer;
-  const int maxIgnore = 1024;
-  buffer.str(parser.next());
-  buffer.clear();
-  buffer >> token;
-  while (buffer.good() && token != "}") {
-    if (0 == strcasecmp(token.c_str(), "num-corners")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numCorners;
-    } else if (0 == strcasecmp(token.c_str(), "count")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> *numCells;
-    } else if (0 == strcasecmp(token.c_str(), "simplices")) {
+  const char* token = 0;
+  size_t length = 0;
+  while (true) {
+    if (!tokenizer.nextLine())
+      throw std::runtime_error("I/O error while parsing cells.");
+    tokenizer.nextToken(&token, &length);
+    if (TextTokenizer::matches(token, length, "}")) {
+      break;
+    } else if (TextTokenizer::matches(token, length, "num-corners")) {
+      tokenizer.skipPast('=');
+      *numCorners = tokenizer.readInt();
+    } else if (TextTokenizer::matches(token, length, "count")) {
+      tokenizer.skipPast('=');
+      *numCells = tokenizer.readInt();
+    } else if (TextTokenizer::matches(token, length, "simplices")) {
       const int size = (*numCells) * (*numCorners);
       if (0 == size) {
 	const char* msg = 
@@ -355,22 +390,18 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
 	throw std::runtime_error(msg);
       } // if
       cells->resize(size);
-      int label;
+      // if files begins with index 1, then decrement to index 0
+      // for compatibility with PETSc
+      const int offset = _useIndexZero ? 0 : 1;
       for (int iCell=0, i=0; iCell < *numCells; ++iCell) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
+	if (!tokenizer.nextLine())
+	  throw std::runtime_error("I/O error while parsing cells.");
+	tokenizer.readInt(); // cell label
 	for (int iCorner=0; iCorner < *numCorners; ++iCorner)
-	  buffer >> (*cells)[i++];
+	  (*cells)[i++] = tokenizer.readInt() - offset;
       } // for
-      if (!_useIndexZero) {
-	// if files begins with index 1, then decrement to index 0
-	// for compatibility with PETSc
-	for (int i=0; i < size; ++i)
-	  --(*cells)[i];
-      } // if
-      parser.ignore('}');
-    } else if (0 == strcasecmp(token.c_str(), "material-ids")) {
+      tokenizer.ignore('}');
+    } else if (TextTokenizer::matches(token, length, "material-ids")) {
       if (0 == *numCells) {
 	const char* msg =
 	  "Token 'count' must precede 'material-ids'.";
@@ -378,25 +409,19 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
       } // if
       const int size = *numCells;
       materialIds->resize(size);
-      int label = 0;
       for (int iCell=0; iCell < *numCells; ++iCell) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	buffer >> (*materialIds)[iCell];
+	if (!tokenizer.nextLine())
+	  throw std::runtime_error("I/O error while parsing cells.");
+	tokenizer.readInt(); // cell label
+	(*materialIds)[iCell] = tokenizer.readInt();
       } // for
-      parser.ignore('}');
+      tokenizer.ignore('}');
     } else {
       std::ostringstream msg;
-      msg << "Could not parse '" << token << "' into an cells setting.";
+      msg << "Could not parse '" << std::string(token, length) << "' into an cells setting.";
       throw std::runtime_error(msg.str());
     } // else
-    buffer.str(parser.next());
-    buffer.clear();
-    buffer >> token;
   } // while
-  if (token != "}")
-    throw std::runtime_error("I/O error while parsing cells.");
 
   // If no materials given, assign each cell material identifier of 0
   if (0 == materialIds->size() && *numCells > 0) {
@@ -454,7 +479,7 @@ pylith::meshio::MeshIOAscii::_writeCells(std::ostream& fileout) const
 // ----------------------------------------------------------------------
 // Read mesh group.
 void
-pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readGroup(TextTokenizer& tokenizer,
 					int_array* points,
 					GroupPtType* type,
 					std::string* name) const
@@ -465,72 +490,57 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
   assert(type);
   assert(name);
 
-  std::string token;
-  std::istringstream buffer;
-  const int maxIgnore = 1024;
+  const char* token = 0;
+  size_t length = 0;
   int numPoints = -1;
-  buffer.str(parser.next());
-  buffer.clear();
-  buffer >> token;
-  while (buffer.good() && token != "}") {
-    if (0 == strcasecmp(token.c_str(), "name")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> std::ws;
-      char cbuffer[maxIgnore];
-      buffer.get(cbuffer, maxIgnore, '\n');
-      *name = cbuffer;
-    } else if (0 == strcasecmp(token.c_str(), "type")) {
-      std::string typeName;
-      buffer.ignore(maxIgnore, '=');
-      buffer >> typeName;
-      if (typeName == groupTypeNames[VERTEX])
+  while (true) {
+    if (!tokenizer.nextLine()) {
+      std::ostringstream msg;
+      msg << "I/O error while parsing group '" << *name << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+    tokenizer.nextToken(&token, &length);
+    if (TextTokenizer::matches(token, length, "}")) {
+      break;
+    } else if (TextTokenizer::matches(token, length, "name")) {
+      tokenizer.skipPast('=');
+      tokenizer.restOfLine(name);
+    } else if (TextTokenizer::matches(token, length, "type")) {
+      tokenizer.skipPast('=');
+      const char* typeName = 0;
+      size_t typeLength = 0;
+      tokenizer.nextToken(&typeName, &typeLength);
+      if (TextTokenizer::matches(typeName, typeLength, groupTypeNames[VERTEX]))
         *type = VERTEX;
-      else if (typeName == groupTypeNames[CELL])
+      else if (TextTokenizer::matches(typeName, typeLength, groupTypeNames[CELL]))
         *type = CELL;
       else {
         std::ostringstream msg;
-        msg << "Invalid point type " << typeName << ".";
+        msg << "Invalid point type " << std::string(typeName ? typeName : "", typeLength) << ".";
         throw std::runtime_error(msg.str());
       } // else
-    } else if (0 == strcasecmp(token.c_str(), "count")) {
-      buffer.ignore(maxIgnore, '=');
-      buffer >> numPoints;
-    } else if (0 == strcasecmp(token.c_str(), "indices")) {
+    } else if (TextTokenizer::matches(token, length, "count")) {
+      tokenizer.skipPast('=');
+      numPoints = tokenizer.readInt();
+    } else if (TextTokenizer::matches(token, length, "indices")) {
       if (-1 == numPoints) {
         std::ostringstream msg;
         msg << "Tokens 'count' must precede 'indices'.";
         throw std::runtime_error(msg.str());
       } // if
       points->resize(numPoints);
-      buffer.str(parser.next());
-      buffer.clear();
-      int i = 0;
-      while (buffer.good() && i < numPoints) {
-	buffer >> (*points)[i++];
-	buffer >> std::ws;
-	if (!buffer.good() && i < numPoints) {
-	  buffer.str(parser.next());
-	  buffer.clear();
-	} // if
-      } // while
-      parser.ignore('}');
+      const int offset = _useIndexZero ? 0 : 1;
+      // Indices may span any number of lines.
+      tokenizer.skipPast('{');
+      for (int i=0; i < numPoints; ++i)
+	(*points)[i] = tokenizer.readIntAnyLine() - offset;
+      tokenizer.ignore('}');
     } else {
       std::ostringstream msg;
-      msg << "Could not parse '" << token << "' into a group setting.";
+      msg << "Could not parse '" << std::string(token, length) << "' into a group setting.";
       throw std::runtime_error(msg.str());
     } // else
-    buffer.str(parser.next());
-    buffer.clear();
-    buffer >> token;
   } // while
-  if (token != "}") {
-    std::ostringstream msg;
-    msg << "I/O error while parsing group '" << *name << "'.";
-    throw std::runtime_error(msg.str());
-  } // if
-
-  if (!_useIndexZero)
-    *points -= 1;
 
   PYLITH_METHOD_END;
 } // _readGroup
@@ -566,4 +576,191 @@ pylith::meshio::MeshIOAscii::_writeGroup(std::ostream& fileout,
   PYLITH_METHOD_END;
 } // _writeGroup
   
+// ----------------------------------------------------------------------
+// Get name of binary cache file.
+std::string
+pylith::meshio::MeshIOAscii::_cacheFilename(void) const
+{ // _cacheFilename
+  return _filename + ".cache";
+} // _cacheFilename
+
+// ----------------------------------------------------------------------
+// Read mesh from binary cache file.
+bool
+pylith::meshio::MeshIOAscii::_readCache(MeshInfo* meshInfo)
+{ // _readCache
+  PYLITH_METHOD_BEGIN;
+
+  assert(meshInfo);
+  using _MeshIOAscii::readValue;
+
+  struct stat sourceInfo;
+  if (stat(_filename.c_str(), &sourceInfo)) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  const std::string cacheFilename = _cacheFilename();
+  std::ifstream fin(cacheFilename.c_str(), std::ios::in | std::ios::binary);
+  if (!fin.is_open() || !fin.good()) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  // Cache must match this build and the current ASCII file.
+  char magic[_MeshIOAscii::cacheMagicSize];
+  fin.read(magic, _MeshIOAscii::cacheMagicSize);
+  if (!fin.good() || strncmp(magic, _MeshIOAscii::cacheMagic, _MeshIOAscii::cacheMagicSize)) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  const int intSize = readValue<int>(fin);
+  const int scalarSize = readValue<int>(fin);
+  const long long sourceSize = readValue<long long>(fin);
+  const long long sourceTime = readValue<long long>(fin);
+  if (!fin.good() || intSize != int(sizeof(int)) || scalarSize != int(sizeof(PylithScalar)) ||
+      sourceSize != (long long)(sourceInfo.st_size) || sourceTime != (long long)(sourceInfo.st_mtime)) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  MeshInfo& info = *meshInfo;
+  info.meshDim = readValue<int>(fin);
+  info.spaceDim = readValue<int>(fin);
+  info.numVertices = readValue<int>(fin);
+  info.numCells = readValue<int>(fin);
+  info.numCorners = readValue<int>(fin);
+  const int numGroups = readValue<int>(fin);
+  const int useIndexZero = readValue<int>(fin);
+  if (!fin.good() || info.spaceDim < 0 || info.numVertices < 0 || info.numCells < 0 || info.numCorners < 0 || numGroups < 0) {
+    *meshInfo = MeshInfo();
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  info.coordinates.resize(info.numVertices*info.spaceDim);
+  if (info.coordinates.size() > 0) {
+    fin.read(reinterpret_cast<char*>(&info.coordinates[0]), info.coordinates.size()*sizeof(PylithScalar));
+  } // if
+  info.cells.resize(info.numCells*info.numCorners);
+  if (info.cells.size() > 0) {
+    fin.read(reinterpret_cast<char*>(&info.cells[0]), info.cells.size()*sizeof(int));
+  } // if
+  info.materialIds.resize(info.numCells);
+  if (info.materialIds.size() > 0) {
+    fin.read(reinterpret_cast<char*>(&info.materialIds[0]), info.materialIds.size()*sizeof(int));
+  } // if
+
+  info.groups.resize(numGroups);
+  for (int iGroup=0; iGroup < numGroups && fin.good(); ++iGroup) {
+    Group& group = info.groups[iGroup];
+    const int nameLength = readValue<int>(fin);
+    const int type = readValue<int>(fin);
+    const int numPoints = readValue<int>(fin);
+    if (!fin.good() || nameLength < 0 || numPoints < 0 || (VERTEX != type && CELL != type)) {
+      fin.setstate(std::ios::failbit);
+      break;
+    } // if
+    group.name.resize(nameLength);
+    if (nameLength > 0) {
+      fin.read(&group.name[0], nameLength);
+    } // if
+    group.type = GroupPtType(type);
+    group.points.resize(numPoints);
+    if (numPoints > 0) {
+      fin.read(reinterpret_cast<char*>(&group.points[0]), numPoints*sizeof(int));
+    } // if
+  } // for
+
+  if (!fin.good()) {
+    *meshInfo = MeshInfo();
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  fin.close();
+
+  // Indices in cache are zero based; flag is retained for writing.
+  _useIndexZero = 1 == useIndexZero;
+
+  PYLITH_METHOD_RETURN(true);
+} // _readCache
+
+// ----------------------------------------------------------------------
+// Write mesh to binary cache file.
+void
+pylith::meshio::MeshIOAscii::_writeCache(const MeshInfo& meshInfo) const
+{ // _writeCache
+  PYLITH_METHOD_BEGIN;
+
+  using _MeshIOAscii::writeValue;
+
+  journal::info_t info("meshioascii");
+
+  struct stat sourceInfo;
+  if (stat(_filename.c_str(), &sourceInfo)) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Write to a temporary file and rename it, so that an interrupted
+  // write never leaves a partial cache file behind.
+  const std::string cacheFilename = _cacheFilename();
+  const std::string tmpFilename = cacheFilename + ".tmp";
+  std::ofstream fout(tmpFilename.c_str(), std::ios::out | std::ios::binary);
+  if (!fout.is_open() || !fout.good()) {
+    info << journal::at(__HERE__)
+	 << "Could not open cache file '" << tmpFilename << "' for writing. Skipping cache."
+	 << journal::endl;
+    PYLITH_METHOD_END;
+  } // if
+
+  fout.write(_MeshIOAscii::cacheMagic, _MeshIOAscii::cacheMagicSize);
+  writeValue<int>(fout, sizeof(int));
+  writeValue<int>(fout, sizeof(PylithScalar));
+  writeValue<long long>(fout, sourceInfo.st_size);
+  writeValue<long long>(fout, sourceInfo.st_mtime);
+
+  const int numGroups = meshInfo.groups.size();
+  writeValue<int>(fout, meshInfo.meshDim);
+  writeValue<int>(fout, meshInfo.spaceDim);
+  writeValue<int>(fout, meshInfo.numVertices);
+  writeValue<int>(fout, meshInfo.numCells);
+  writeValue<int>(fout, meshInfo.numCorners);
+  writeValue<int>(fout, numGroups);
+  writeValue<int>(fout, _useIndexZero ? 1 : 0);
+
+  assert(meshInfo.coordinates.size() == size_t(meshInfo.numVertices*meshInfo.spaceDim));
+  assert(meshInfo.cells.size() == size_t(meshInfo.numCells*meshInfo.numCorners));
+  assert(meshInfo.materialIds.size() == size_t(meshInfo.numCells));
+  if (meshInfo.coordinates.size() > 0) {
+    fout.write(reinterpret_cast<const char*>(&meshInfo.coordinates[0]), meshInfo.coordinates.size()*sizeof(PylithScalar));
+  } // if
+  if (meshInfo.cells.size() > 0) {
+    fout.write(reinterpret_cast<const char*>(&meshInfo.cells[0]), meshInfo.cells.size()*sizeof(int));
+  } // if
+  if (meshInfo.materialIds.size() > 0) {
+    fout.write(reinterpret_cast<const char*>(&meshInfo.materialIds[0]), meshInfo.materialIds.size()*sizeof(int));
+  } // if
+
+  for (int iGroup=0; iGroup < numGroups; ++iGroup) {
+    const Group& group = meshInfo.groups[iGroup];
+    const int numPoints = group.points.size();
+    writeValue<int>(fout, group.name.length());
+    writeValue<int>(fout, group.type);
+    writeValue<int>(fout, numPoints);
+    fout.write(group.name.c_str(), group.name.length());
+    if (numPoints > 0) {
+      fout.write(reinterpret_cast<const char*>(&group.points[0]), numPoints*sizeof(int));
+    } // if
+  } // for
+
+  const bool ok = fout.good();
+  fout.close();
+  if (!ok || rename(tmpFilename.c_str(), cacheFilename.c_str())) {
+    remove(tmpFilename.c_str());
+    info << journal::at(__HERE__)
+	 << "Error writing cache file '" << cacheFilename << "'. Skipping cache."
+	 << journal::endl;
+  } else {
+    info << journal::at(__HERE__)
+	 << "Wrote mesh cache file '" << cacheFilename << "'."
+	 << journal::endl;
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // _writeCache
+  
 // End of file 
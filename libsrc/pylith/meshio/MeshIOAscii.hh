@@ -28,13 +28,21 @@
 // Include directives ---------------------------------------------------
 #include "MeshIO.hh" // ISA MeshIO
 
-#include "spatialdata/utils/utilsfwd.hh" // USES LineParser
+#include "pylith/utils/array.hh" // HASA scalar_array, int_array
 
 #include <iosfwd> // USES std::istream, std::ostream
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 // MeshIOAscii ----------------------------------------------------------
-/// C++ input/output manager for PyLith ASCII mesh files.
+/** @brief C++ input/output manager for PyLith ASCII mesh files.
+ *
+ * The file is parsed in a single forward pass using TextTokenizer.
+ * Optionally, the parsed mesh is written to a binary cache file
+ * (filename + ".cache") on the first read and the cache is used on
+ * subsequent reads as long as the size and modification time of the
+ * ASCII file are unchanged.
+ */
 class pylith::meshio::MeshIOAscii : public MeshIO
 { // MeshIOAscii
   friend class TestMeshIOAscii; // unit testing
@@ -63,6 +71,18 @@ public :
    */
   const char* filename(void) const;
 
+  /** Set flag for using binary cache of mesh file.
+   *
+   * @param value True if cache should be used, false otherwise.
+   */
+  void useCache(const bool value);
+
+  /** Get flag for using binary cache of mesh file.
+   *
+   * @returns True if cache is used, false otherwise.
+   */
+  bool useCache(void) const;
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
@@ -72,17 +92,54 @@ protected :
   /// Read mesh
   void _read(void);
 
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Point group read from mesh file.
+  struct Group {
+    std::string name; ///< Name of group
+    GroupPtType type; ///< Type of points in group
+    int_array points; ///< Indices of points in group
+  }; // Group
+
+  /// Mesh information read from mesh file.
+  struct MeshInfo {
+    int meshDim; ///< Dimension of mesh
+    int spaceDim; ///< Dimension of coordinate space
+    int numVertices; ///< Number of vertices
+    int numCells; ///< Number of cells
+    int numCorners; ///< Number of vertices per cell
+    scalar_array coordinates; ///< Coordinates of vertices
+    int_array cells; ///< Indices of cell vertices
+    int_array materialIds; ///< Material identifiers of cells
+    std::vector<Group> groups; ///< Point groups
+
+    MeshInfo(void) :
+      meshDim(0),
+      spaceDim(0),
+      numVertices(0),
+      numCells(0),
+      numCorners(0)
+    {}
+  }; // MeshInfo
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
+  /** Parse ASCII mesh file.
+   *
+   * @param info Mesh information.
+   */
+  void _parse(MeshInfo* info);
+
   /** Read mesh vertices.
    *
-   * @param parser Input parser.
+   * @param tokenizer Input tokenizer.
    * @param coordinates Pointer to array of vertex coordinates
    * @param numVertices Pointer to number of vertices
    * @param spaceDim Pointer to dimension of coordinates vector space
    */
-  void _readVertices(spatialdata::utils::LineParser& parser,
+  void _readVertices(TextTokenizer& tokenizer,
 		     scalar_array* coordinates,
 		     int* numVertices,
 		     int* spaceDim) const;
@@ -95,13 +152,13 @@ private :
   
   /** Read mesh cells.
    *
-   * @param parser Input parser.
+   * @param tokenizer Input tokenizer.
    * @param pCells Pointer to array of indices of cell vertices
    * @param pMaterialIds Pointer to array of material identifiers
    * @param pNumCells Pointer to number of cells
    * @param pNumCorners Pointer to number of corners
    */
-  void _readCells(spatialdata::utils::LineParser& parser,
+  void _readCells(TextTokenizer& tokenizer,
 		  int_array* pCells,
 		  int_array* pMaterialIds,
 		  int* numCells,
@@ -118,10 +175,12 @@ private :
   
   /** Read a point group.
    *
-   * @param parser Input parser.
-   * @param mesh The mesh
+   * @param tokenizer Input tokenizer.
+   * @param points Pointer to array of indices of points in group.
+   * @param type Pointer to type of points in group.
+   * @param name Pointer to name of group.
    */
-  void _readGroup(spatialdata::utils::LineParser& parser,
+  void _readGroup(TextTokenizer& tokenizer,
 		  int_array* points,
                   GroupPtType* type,
                   std::string* name) const;
@@ -134,11 +193,31 @@ private :
   void _writeGroup(std::ostream& fileout,
 		   const char* name) const;
 
+  /** Get name of binary cache file.
+   *
+   * @returns Name of cache file.
+   */
+  std::string _cacheFilename(void) const;
+
+  /** Read mesh from binary cache file.
+   *
+   * @param info Mesh information.
+   * @returns True if cache exists and is current, false otherwise.
+   */
+  bool _readCache(MeshInfo* info);
+
+  /** Write mesh to binary cache file.
+   *
+   * @param info Mesh information.
+   */
+  void _writeCache(const MeshInfo& info) const;
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   std::string _filename; ///< Name of file
   bool _useIndexZero; ///< Flag indicating if indicates start at 0 (T) or 1 (F)
+  bool _useCache; ///< Flag indicating if binary cache of mesh is used
 
   static
   const char *groupTypeNames[]; ///< Types of mesh groups.
@@ -0,0 +1,451 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOHDF5.hh" // implementation of class methods
+
+#include "HDF5.hh" // USES HDF5
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+
+#include "journal/info.h" // USES journal::info_t
+
+#include <vector> // USES std::vector
+#include <cstring> // USES strcmp()
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOHDF5::MeshIOHDF5(void) :
+  _filename("")
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOHDF5::~MeshIOHDF5(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOHDF5::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIO::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::MeshIOHDF5::_read(void)
+{ // _read
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  const int commRank = _mesh->commRank();
+  int meshInfo[3] = { 0, 0, 0 }; // cell dimension, space dimension, depth
+  int hybridBounds[4] = { -1, -1, -1, -1 };
+  std::vector<PetscInt> numPoints;
+  std::vector<PetscInt> coneSizes;
+  std::vector<PetscInt> cones;
+  std::vector<PetscInt> coneOrientations;
+  scalar_array coordinates;
+  PetscErrorCode err = 0;
+
+  HDF5 h5;
+  if (0 == commRank) {
+    try {
+      journal::info_t info("meshiohdf5");
+
+      h5.open(_filename.c_str(), H5F_ACC_RDONLY);
+
+      char* data = 0;
+      hsize_t* dims = 0;
+      int ndims = 0;
+
+      h5.readAttribute("/topology/num_points", "cell_dim", (void*)&meshInfo[0], H5T_NATIVE_INT);
+
+      h5.readDataset("/topology", "num_points", &data, &dims, &ndims, H5T_NATIVE_INT);
+      meshInfo[2] = dims[0] - 1;
+      numPoints.resize(dims[0]);
+      for (size_t i=0; i < numPoints.size(); ++i) {
+	numPoints[i] = ((int*)data)[i];
+      } // for
+
+      h5.readDataset("/topology", "cone_sizes", &data, &dims, &ndims, H5T_NATIVE_INT);
+      coneSizes.resize(dims[0]);
+      for (size_t i=0; i < coneSizes.size(); ++i) {
+	coneSizes[i] = ((int*)data)[i];
+      } // for
+
+      h5.readDataset("/topology", "cones", &data, &dims, &ndims, H5T_NATIVE_INT);
+      cones.resize(dims[0]);
+      for (size_t i=0; i < cones.size(); ++i) {
+	cones[i] = ((int*)data)[i];
+      } // for
+
+      h5.readDataset("/topology", "cone_orientations", &data, &dims, &ndims, H5T_NATIVE_INT);
+      coneOrientations.resize(dims[0]);
+      for (size_t i=0; i < coneOrientations.size(); ++i) {
+	coneOrientations[i] = ((int*)data)[i];
+      } // for
+
+      h5.readDataset("/topology", "hybrid_bounds", &data, &dims, &ndims, H5T_NATIVE_INT);
+      assert(4 == dims[0]);
+      for (int i=0; i < 4; ++i) {
+	hybridBounds[i] = ((int*)data)[i];
+      } // for
+
+      const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+      h5.readDataset("/geometry", "vertices", &data, &dims, &ndims, scalartype);
+      assert(2 == ndims);
+      const int numVertices = dims[0];
+      meshInfo[1] = dims[1];
+      if (numVertices != numPoints[0]) {
+	std::ostringstream msg;
+	msg << "Mismatch in number of vertices in topology (" << numPoints[0]
+	    << ") and number of vertices in geometry (" << numVertices << ").";
+	throw std::runtime_error(msg.str());
+      } // if
+      coordinates.resize(numVertices*meshInfo[1]);
+      for (size_t i=0; i < coordinates.size(); ++i) {
+	coordinates[i] = ((PylithScalar*)data)[i];
+      } // for
+
+      delete[] data; data = 0;
+      delete[] dims; dims = 0;
+
+      info << journal::at(__HERE__)
+	   << "Read " << coneSizes.size() << " points in mesh with "
+	   << numVertices << " vertices." << journal::endl;
+    } catch (const std::exception& err) {
+      std::ostringstream msg;
+      msg << "Error while reading HDF5 mesh file '" << _filename << "'.\n"
+	  << err.what();
+      throw std::runtime_error(msg.str());
+    } catch (...) {
+      std::ostringstream msg;
+      msg << "Unknown error while reading HDF5 mesh file '" << _filename << "'.";
+      throw std::runtime_error(msg.str());
+    } // try/catch
+  } // if
+  err = MPI_Bcast(meshInfo, 3, MPI_INT, 0, _mesh->comm());PYLITH_CHECK_ERROR(err);
+  const int meshDim = meshInfo[0];
+  const int spaceDim = meshInfo[1];
+  const int depth = meshInfo[2];
+  if (commRank > 0) {
+    numPoints.resize(depth+1, 0);
+  } // if
+
+  PetscDM dmMesh = NULL;
+  err = DMCreate(_mesh->comm(), &dmMesh);PYLITH_CHECK_ERROR(err);
+  err = DMSetType(dmMesh, DMPLEX);PYLITH_CHECK_ERROR(err);
+  err = DMSetDimension(dmMesh, meshDim);PYLITH_CHECK_ERROR(err);
+  err = DMSetCoordinateDim(dmMesh, spaceDim);PYLITH_CHECK_ERROR(err);
+  err = DMPlexCreateFromDAG(dmMesh, depth, &numPoints[0],
+			    coneSizes.size() ? &coneSizes[0] : NULL,
+			    cones.size() ? &cones[0] : NULL,
+			    coneOrientations.size() ? &coneOrientations[0] : NULL,
+			    coordinates.size() ? &coordinates[0] : NULL);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetHybridBounds(dmMesh, hybridBounds[0], hybridBounds[1], hybridBounds[2], hybridBounds[3]);PYLITH_CHECK_ERROR(err);
+  _mesh->dmMesh(dmMesh);
+
+  if (0 == commRank) {
+    try {
+      _readLabels(h5);
+      h5.close();
+    } catch (const std::exception& err) {
+      std::ostringstream msg;
+      msg << "Error while reading HDF5 mesh file '" << _filename << "'.\n"
+	  << err.what();
+      throw std::runtime_error(msg.str());
+    } // try/catch
+  } // if
+  _distributeGroups();
+
+  PYLITH_METHOD_END;
+} // _read
+
+// ----------------------------------------------------------------------
+// Write mesh to file.
+void
+pylith::meshio::MeshIOHDF5::_write(void) const
+{ // _write
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+  const int commRank = _mesh->commRank();
+  PetscInt pStart = 0, pEnd = 0;
+  PetscErrorCode err = 0;
+
+  // Point numbering is only global for a mesh that has not been
+  // distributed, i.e., all points are on process 0.
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  int hasPointsLocal = (commRank > 0 && pEnd > pStart) ? 1 : 0;
+  int hasPoints = 0;
+  err = MPI_Allreduce(&hasPointsLocal, &hasPoints, 1, MPI_INT, MPI_MAX, _mesh->comm());PYLITH_CHECK_ERROR(err);
+  if (hasPoints) {
+    std::ostringstream msg;
+    msg << "Cannot write distributed mesh to HDF5 mesh file '" << _filename << "'. "
+	<< "The mesh must be written before it is distributed.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  if (0 == commRank) {
+    try {
+      HDF5 h5(_filename.c_str(), H5F_ACC_TRUNC);
+
+      // Topology
+      assert(0 == pStart);
+      PetscInt depth = 0;
+      err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+      int_array numPoints(depth+1);
+      for (PetscInt d=0; d <= depth; ++d) {
+	PetscInt dStart = 0, dEnd = 0;
+	err = DMPlexGetDepthStratum(dmMesh, d, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+	numPoints[d] = dEnd - dStart;
+      } // for
+
+      int_array coneSizes(pEnd-pStart);
+      int conesSize = 0;
+      for (PetscInt p=pStart; p < pEnd; ++p) {
+	PetscInt coneSize = 0;
+	err = DMPlexGetConeSize(dmMesh, p, &coneSize);PYLITH_CHECK_ERROR(err);
+	coneSizes[p-pStart] = coneSize;
+	conesSize += coneSize;
+      } // for
+
+      int_array cones(conesSize);
+      int_array coneOrientations(conesSize);
+      for (PetscInt p=pStart, index=0; p < pEnd; ++p) {
+	const PetscInt* cone = NULL;
+	const PetscInt* coneOrientation = NULL;
+	err = DMPlexGetCone(dmMesh, p, &cone);PYLITH_CHECK_ERROR(err);
+	err = DMPlexGetConeOrientation(dmMesh, p, &coneOrientation);PYLITH_CHECK_ERROR(err);
+	for (int i=0; i < coneSizes[p-pStart]; ++i, ++index) {
+	  cones[index] = cone[i];
+	  coneOrientations[index] = coneOrientation[i];
+	} // for
+      } // for
+
+      PetscInt cMax = -1, fMax = -1, eMax = -1, vMax = -1;
+      err = DMPlexGetHybridBounds(dmMesh, &cMax, &fMax, &eMax, &vMax);PYLITH_CHECK_ERROR(err);
+      const int hybridBounds[4] = { int(cMax), int(fMax), int(eMax), int(vMax) };
+
+      hsize_t dims[2];
+      h5.createGroup("/topology");
+      dims[0] = numPoints.size();
+      h5.writeDataset("/topology", "num_points", (void*)&numPoints[0], dims, 1, H5T_NATIVE_INT);
+      const int cellDim = _mesh->dimension();
+      h5.writeAttribute("/topology/num_points", "cell_dim", (void*)&cellDim, H5T_NATIVE_INT);
+      dims[0] = coneSizes.size();
+      h5.writeDataset("/topology", "cone_sizes", (coneSizes.size() > 0) ? (void*)&coneSizes[0] : 0, dims, 1, H5T_NATIVE_INT);
+      dims[0] = cones.size();
+      h5.writeDataset("/topology", "cones", (cones.size() > 0) ? (void*)&cones[0] : 0, dims, 1, H5T_NATIVE_INT);
+      h5.writeDataset("/topology", "cone_orientations", (coneOrientations.size() > 0) ? (void*)&coneOrientations[0] : 0, dims, 1, H5T_NATIVE_INT);
+      dims[0] = 4;
+      h5.writeDataset("/topology", "hybrid_bounds", (void*)hybridBounds, dims, 1, H5T_NATIVE_INT);
+
+      // Geometry (dimensioned vertex coordinates in order of vertices).
+      const spatialdata::geocoords::CoordSys* cs = _mesh->coordsys();assert(cs);
+      const int spaceDim = cs->spaceDim();
+      PetscInt vStart = 0, vEnd = 0;
+      err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+      PylithScalar lengthScale = 1.0;
+      err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+
+      topology::CoordsVisitor coordsVisitor(dmMesh);
+      const PetscScalar* coordsArray = coordsVisitor.localArray();
+      scalar_array coordinates((vEnd-vStart)*spaceDim);
+      for (PetscInt v=vStart, index=0; v < vEnd; ++v) {
+	const PetscInt off = coordsVisitor.sectionOffset(v);
+	assert(spaceDim == coordsVisitor.sectionDof(v));
+	for (int iDim=0; iDim < spaceDim; ++iDim, ++index) {
+	  coordinates[index] = coordsArray[off+iDim]*lengthScale;
+	} // for
+      } // for
+
+      const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+      h5.createGroup("/geometry");
+      dims[0] = vEnd - vStart;
+      dims[1] = spaceDim;
+      h5.writeDataset("/geometry", "vertices", (coordinates.size() > 0) ? (void*)&coordinates[0] : 0, dims, 2, scalartype);
+
+      _writeLabels(h5);
+
+      h5.close();
+    } catch (const std::exception& err) {
+      std::ostringstream msg;
+      msg << "Error while writing HDF5 mesh file '" << _filename << "'.\n"
+	  << err.what();
+      throw std::runtime_error(msg.str());
+    } catch (...) {
+      std::ostringstream msg;
+      msg << "Unknown error while writing HDF5 mesh file '" << _filename << "'.";
+      throw std::runtime_error(msg.str());
+    } // try/catch
+  } // if
+
+  PYLITH_METHOD_END;
+} // _write
+
+// ----------------------------------------------------------------------
+// Write labels.
+void
+pylith::meshio::MeshIOHDF5::_writeLabels(HDF5& h5) const
+{ // _writeLabels
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+  PetscInt numLabels = 0;
+  PetscErrorCode err = 0;
+  err = DMGetNumLabels(dmMesh, &numLabels);PYLITH_CHECK_ERROR(err);
+
+  h5.createGroup("/labels");
+  std::vector<const char*> names;
+  for (PetscInt iLabel=0; iLabel < numLabels; ++iLabel) {
+    const char* name = NULL;
+    err = DMGetLabelName(dmMesh, iLabel, &name);PYLITH_CHECK_ERROR(err);
+    // Depth label is regenerated when the mesh is read.
+    if (0 == strcmp(name, "depth")) {
+      continue;
+    } // if
+    names.push_back(name);
+
+    PetscDMLabel label = NULL;
+    err = DMGetLabel(dmMesh, name, &label);PYLITH_CHECK_ERROR(err);
+    PetscInt labelSize = 0;
+    PetscIS valuesIS = NULL;
+    const PetscInt* values = NULL;
+    PetscInt numValues = 0;
+    err = DMLabelGetValueIS(label, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+      PetscInt stratumSize = 0;
+      err = DMLabelGetStratumSize(label, values[iValue], &stratumSize);PYLITH_CHECK_ERROR(err);
+      labelSize += stratumSize;
+    } // for
+
+    int_array pointValues(2*labelSize);
+    for (PetscInt iValue=0, index=0; iValue < numValues; ++iValue) {
+      PetscIS pointsIS = NULL;
+      const PetscInt* points = NULL;
+      PetscInt numPoints = 0;
+      err = DMLabelGetStratumIS(label, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+      if (!pointsIS) {
+	continue;
+      } // if
+      err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+      err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+      for (PetscInt p=0; p < numPoints; ++p, index += 2) {
+	pointValues[index  ] = points[p];
+	pointValues[index+1] = values[iValue];
+      } // for
+      err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    hsize_t dims[2];
+    dims[0] = labelSize;
+    dims[1] = 2;
+    h5.writeDataset("/labels", name, (labelSize > 0) ? (void*)&pointValues[0] : 0, dims, 2, H5T_NATIVE_INT);
+  } // for
+
+  // Keep the order of the labels, because the order of the groups
+  // in the mesh follows the order of the labels.
+  if (names.size() > 0) {
+    h5.writeDataset("/", "label_names", &names[0], names.size());
+  } // if
+
+  PYLITH_METHOD_END;
+} // _writeLabels
+
+// ----------------------------------------------------------------------
+// Read labels.
+void
+pylith::meshio::MeshIOHDF5::_readLabels(HDF5& h5)
+{ // _readLabels
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  if (!h5.hasDataset("/label_names")) {
+    PYLITH_METHOD_END;
+  } // if
+
+  journal::info_t info("meshiohdf5");
+
+  PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+  const string_vector names = h5.readDataset("/", "label_names");
+  const int numLabels = names.size();
+
+  char* data = 0;
+  hsize_t* dims = 0;
+  int ndims = 0;
+  PetscErrorCode err = 0;
+
+  // New labels are added to the front of the list of labels, so we
+  // create them in reverse order.
+  for (int iLabel=numLabels-1; iLabel >= 0; --iLabel) {
+    const char* name = names[iLabel].c_str();
+    info << journal::at(__HERE__)
+	 << "Reading label '" << name << "'." << journal::endl;
+
+    err = DMCreateLabel(dmMesh, name);PYLITH_CHECK_ERROR(err);
+    PetscDMLabel label = NULL;
+    err = DMGetLabel(dmMesh, name, &label);PYLITH_CHECK_ERROR(err);
+
+    h5.readDataset("/labels", name, &data, &dims, &ndims, H5T_NATIVE_INT);
+    assert(2 == ndims);
+    const int labelSize = dims[0];
+    const int* pointValues = (int*)data;
+    for (int i=0; i < labelSize; ++i) {
+      err = DMLabelSetValue(label, pointValues[2*i], pointValues[2*i+1]);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // for
+  delete[] data; data = 0;
+  delete[] dims; dims = 0;
+
+  PYLITH_METHOD_END;
+} // _readLabels
+
+
+// End of file
@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOHDF5.hh
+ *
+ * @brief C++ input/output manager for PyLith HDF5 mesh files.
+ */
+
+#if !defined(pylith_meshio_meshiohdf5_hh)
+#define pylith_meshio_meshiohdf5_hh
+
+// Include directives ---------------------------------------------------
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <string> // HASA std::string
+
+// MeshIOHDF5 -----------------------------------------------------------
+/** @brief C++ input/output manager for PyLith HDF5 mesh files.
+ *
+ * The file holds the complete DMPlex point graph (cone sizes, cones,
+ * and cone orientations for every point in the chart), the vertex
+ * coordinates, the hybrid point bounds, and all labels other than
+ * the depth label. Because the point numbering is preserved, a mesh
+ * written after reordering and inserting cohesive cells is read back
+ * without repeating those steps.
+ *
+ * Layout of the file:
+ *   /topology/num_points [depth+1] (number of points at each depth)
+ *   /topology/cone_sizes [numPoints]
+ *   /topology/cones [sum of cone sizes]
+ *   /topology/cone_orientations [sum of cone sizes]
+ *   /topology/hybrid_bounds [4] (cMax, fMax, eMax, vMax)
+ *   /geometry/vertices [numVertices, spaceDim]
+ *   /labels/NAME [numLabeledPoints, 2] (point, value)
+ *   /label_names [numLabels]
+ *
+ * The mesh must not be distributed when it is written. The mesh is
+ * read on process 0 and distributed afterwards, in the same way as
+ * the other mesh importers.
+ */
+class pylith::meshio::MeshIOHDF5 : public MeshIO
+{ // MeshIOHDF5
+  friend class TestMeshIOHDF5; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  MeshIOHDF5(void);
+
+  /// Destructor
+  ~MeshIOHDF5(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set filename for HDF5 mesh file.
+   *
+   * @param filename Name of file
+   */
+  void filename(const char* name);
+
+  /** Get filename of HDF5 mesh file.
+   *
+   * @returns Name of file
+   */
+  const char* filename(void) const;
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /// Write mesh
+  void _write(void) const;
+
+  /// Read mesh
+  void _read(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Write labels.
+   *
+   * @param h5 HDF5 file.
+   */
+  void _writeLabels(HDF5& h5) const;
+
+  /** Read labels.
+   *
+   * @param h5 HDF5 file.
+   */
+  void _readLabels(HDF5& h5);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::string _filename; ///< Name of file
+
+}; // MeshIOHDF5
+
+#include "MeshIOHDF5.icc" // inline methods
+
+#endif // pylith_meshio_meshiohdf5_hh
+
+
+// End of file
@@ -196,9 +196,9 @@ pylith::meshio::OutputManager::appendVertexField(const PylithScalar t,
   PYLITH_METHOD_BEGIN;
 
   topology::Field& fieldFiltered = (!_vertexFilter) ? field : _vertexFilter->filter(field);
-  topology::Field& fieldDimensioned = _dimension(fieldFiltered);
-  
-  _writer->writeVertexField(t, fieldDimensioned, mesh);
+
+  // Writer dimensionalizes values as it packs them for output.
+  _writer->writeVertexField(t, fieldFiltered, mesh, fieldFiltered.scale());
 
   PYLITH_METHOD_END;
 } // appendVertexField
@@ -213,11 +213,19 @@ pylith::meshio::OutputManager::appendCellField(const PylithScalar t,
 { // appendCellField
   PYLITH_METHOD_BEGIN;
 
-  topology::Field& fieldFiltered = (!_cellFilter) ? field : _cellFilter->filter(field, label, labelId);
-  topology::Field& fieldDimensioned = _dimension(fieldFiltered);
+  // Cell filters operate on values at quadrature points. Fields that
+  // already hold a single value per cell (e.g., averaged by the data
+  // provider as they were computed) are written as is.
+  const topology::FieldBase::VectorFieldEnum fieldType = field.vectorFieldType();
+  const bool isQuadPtField = topology::FieldBase::MULTI_SCALAR == fieldType ||
+    topology::FieldBase::MULTI_VECTOR == fieldType ||
+    topology::FieldBase::MULTI_TENSOR == fieldType ||
+    topology::FieldBase::MULTI_OTHER == fieldType;
+  topology::Field& fieldFiltered = (!_cellFilter || !isQuadPtField) ? field : _cellFilter->filter(field, label, labelId);
 
   try {
-    _writer->writeCellField(t, fieldDimensioned, label, labelId);
+    // Writer dimensionalizes values as it packs them for output.
+    _writer->writeCellField(t, fieldFiltered, label, labelId, fieldFiltered.scale());
   } catch(std::runtime_error e) {
     std::cout << "ERROR: " << e.what() << std::endl<<std::endl<<std::endl;
   } // try/catch
@@ -225,77 +233,5 @@ pylith::meshio::OutputManager::appendCellField(const PylithScalar t,
   PYLITH_METHOD_END;
 } // appendCellField
 
-// ----------------------------------------------------------------------
-// Dimension field.
-pylith::topology::Field&
-pylith::meshio::OutputManager::_dimension(topology::Field& fieldIn)
-{ // _dimension
-  PYLITH_METHOD_BEGIN;
-
-  if (1.0 == fieldIn.scale())
-    PYLITH_METHOD_RETURN(fieldIn);
-
-  if (fieldIn.dimensionalizeOkay()) {
-    fieldIn.dimensionalize();
-    PYLITH_METHOD_RETURN(fieldIn);
-  } else {
-    std::string fieldName = "buffer (other)";
-    switch (fieldIn.vectorFieldType())
-      { // switch
-      case topology::FieldBase::SCALAR :
-	fieldName = "buffer (scalar)";
-	break;
-      case topology::FieldBase::VECTOR :
-	fieldName = "buffer (vector)";
-	break;
-      case topology::FieldBase::TENSOR :
-	fieldName = "buffer (tensor)";
-	break;
-      case topology::FieldBase::OTHER :
-	fieldName = "buffer (other)";
-	break;
-      case topology::FieldBase::MULTI_SCALAR :
-	fieldName = "buffer (multiple scalars)";
-	break;
-      case topology::FieldBase::MULTI_VECTOR :
-	fieldName = "buffer (multiple vectors)";
-	break;
-      case topology::FieldBase::MULTI_TENSOR :
-	fieldName = "buffer (multiple tensors)";
-	break;
-      case topology::FieldBase::MULTI_OTHER :
-	fieldName = "buffer (multiple others)";
-	break;
-      default :
-        // Spit out useful error message and stop via assert. If
-        // optimized, throw exception.
-        std::ostringstream msg;
-        msg << "Unknown field type '" << fieldIn.vectorFieldType() << "'";
-        throw std::logic_error(msg.str());
-      } // switch
-    
-    if (!_fields) {
-      _fields = new topology::Fields(fieldIn.mesh());assert(_fields);
-    } // if
-    
-    if (!_fields->hasField(fieldName.c_str())) {
-      _fields->add(fieldName.c_str(), fieldIn.label());
-      topology::Field& fieldOut = _fields->get(fieldName.c_str());
-      fieldOut.cloneSection(fieldIn);
-      fieldOut.vectorFieldType(fieldIn.vectorFieldType());
-      fieldOut.scale(fieldIn.scale());
-    } // if
-    topology::Field& fieldOut = _fields->get(fieldName.c_str());
-    fieldOut.copy(fieldIn);
-    fieldOut.dimensionalizeOkay(true);
-    fieldOut.dimensionalize();
-
-    PYLITH_METHOD_RETURN(fieldOut);
-  } // if/else
-
-  // Satisfy return value. Should never get this far.
-  PYLITH_METHOD_RETURN(fieldIn);
-} // _dimension
-
 
 // End of file 
@@ -143,15 +143,6 @@ public :
 		       const char* label =0,
 		       const int labelId =0);
 
-// PROTECTED METHODS ////////////////////////////////////////////////////
-protected :
-
-  /** Dimension field.
-   *
-   * @param fieldIn Field to dimensionalize.
-   */
-  topology::Field& _dimension(topology::Field& fieldIn);
-
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
@@ -0,0 +1,494 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TextTokenizer.hh" // implementation of class methods
+
+#include <sys/mman.h> // USES mmap(), munmap(), madvise()
+#include <sys/stat.h> // USES fstat()
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES close()
+#include <strings.h> // USES strncasecmp()
+#include <cstring> // USES memchr(), strlen(), memcpy()
+#include <cstdlib> // USES strtod()
+#include <climits> // USES INT_MAX
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _TextTokenizer {
+
+      /// Check whether character is whitespace within a line.
+      inline
+      bool isWhitespace(const char c) {
+	return ' ' == c || '\t' == c || '\r' == c || '\f' == c || '\v' == c;
+      } // isWhitespace
+
+      /// Check whether character is a decimal digit.
+      inline
+      bool isDigit(const char c) {
+	return c >= '0' && c <= '9';
+      } // isDigit
+
+      /// Powers of 10 that are exactly representable as doubles.
+      const double exactPowers[] = {
+	1.0e+0, 1.0e+1, 1.0e+2, 1.0e+3, 1.0e+4, 1.0e+5, 1.0e+6, 1.0e+7,
+	1.0e+8, 1.0e+9, 1.0e+10, 1.0e+11, 1.0e+12, 1.0e+13, 1.0e+14,
+	1.0e+15, 1.0e+16, 1.0e+17, 1.0e+18, 1.0e+19, 1.0e+20, 1.0e+21,
+	1.0e+22,
+      };
+      const int maxExactPower = 22;
+
+      /// Largest integer exactly representable as a double (2**53).
+      const unsigned long long maxExactMantissa = 9007199254740992ULL;
+
+      /// Maximum number of significant digits accumulated in mantissa.
+      const int maxMantissaDigits = 19;
+
+    } // _TextTokenizer
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::TextTokenizer::TextTokenizer(void) :
+  _buffer(0),
+  _end(0),
+  _cur(0),
+  _lineEnd(0),
+  _next(0),
+  _size(0),
+  _fd(-1),
+  _lineNumber(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::TextTokenizer::~TextTokenizer(void)
+{ // destructor
+  close();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Open file and map it into memory.
+void
+pylith::meshio::TextTokenizer::open(const char* filename)
+{ // open
+  close();
+
+  _fd = ::open(filename, O_RDONLY);
+  if (_fd < 0) {
+    std::ostringstream msg;
+    msg << "Could not open file '" << filename << "' for reading.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  struct stat info;
+  if (fstat(_fd, &info)) {
+    close();
+    std::ostringstream msg;
+    msg << "Could not get size of file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _size = info.st_size;
+
+  if (_size > 0) {
+    void* mapped = mmap(0, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (MAP_FAILED == mapped) {
+      _size = 0;
+      close();
+      std::ostringstream msg;
+      msg << "Could not map file '" << filename << "' into memory.";
+      throw std::runtime_error(msg.str());
+    } // if
+    madvise(mapped, _size, MADV_SEQUENTIAL);
+    _buffer = static_cast<const char*>(mapped);
+  } // if
+  _end = _buffer + _size;
+  _cur = _lineEnd = _next = _buffer;
+  _lineNumber = 1;
+} // open
+
+// ----------------------------------------------------------------------
+// Unmap and close file.
+void
+pylith::meshio::TextTokenizer::close(void)
+{ // close
+  if (_buffer) {
+    munmap(const_cast<char*>(_buffer), _size);
+  } // if
+  if (_fd >= 0) {
+    ::close(_fd);
+  } // if
+  _buffer = _end = _cur = _lineEnd = _next = 0;
+  _size = 0;
+  _fd = -1;
+  _lineNumber = 0;
+} // close
+
+// ----------------------------------------------------------------------
+// Advance to the next line with content.
+bool
+pylith::meshio::TextTokenizer::nextLine(void)
+{ // nextLine
+  using _TextTokenizer::isWhitespace;
+
+  const char* p = _next;
+  while (p < _end) {
+    if ('\n' == *p) {
+      ++_lineNumber;
+      ++p;
+      continue;
+    } // if
+
+    const char* eol = static_cast<const char*>(memchr(p, '\n', _end - p));
+    if (!eol) {
+      eol = _end;
+    } // if
+
+    // Strip comment.
+    const char* contentEnd = eol;
+    for (const char* s = p; s < eol; ++s) {
+      s = static_cast<const char*>(memchr(s, '/', eol - s));
+      if (!s) {
+	break;
+      } // if
+      if (s+1 < eol && '/' == s[1]) {
+	contentEnd = s;
+	break;
+      } // if
+    } // for
+
+    const char* begin = p;
+    while (begin < contentEnd && isWhitespace(*begin)) {
+      ++begin;
+    } // while
+    while (contentEnd > begin && isWhitespace(contentEnd[-1])) {
+      --contentEnd;
+    } // while
+
+    if (begin < contentEnd) {
+      _cur = begin;
+      _lineEnd = contentEnd;
+      _next = eol;
+      return true;
+    } // if
+    p = eol;
+  } // while
+
+  _cur = _lineEnd = _next = _end;
+  return false;
+} // nextLine
+
+// ----------------------------------------------------------------------
+// Get next whitespace delimited token on the current line.
+bool
+pylith::meshio::TextTokenizer::nextToken(const char** token,
+					 size_t* length)
+{ // nextToken
+  assert(token);
+  assert(length);
+
+  _skipWhitespace();
+  if (_cur >= _lineEnd) {
+    *token = 0;
+    *length = 0;
+    return false;
+  } // if
+
+  const char* begin = _cur;
+  while (_cur < _lineEnd && !_TextTokenizer::isWhitespace(*_cur)) {
+    ++_cur;
+  } // while
+  *token = begin;
+  *length = _cur - begin;
+
+  return true;
+} // nextToken
+
+// ----------------------------------------------------------------------
+// Check whether token matches a value (case insensitive).
+bool
+pylith::meshio::TextTokenizer::matches(const char* token,
+				       const size_t length,
+				       const char* value)
+{ // matches
+  assert(value);
+  return length == strlen(value) && 0 == strncasecmp(token, value, length);
+} // matches
+
+// ----------------------------------------------------------------------
+// Skip past the next occurrence of a character on the current line.
+void
+pylith::meshio::TextTokenizer::skipPast(const char delim)
+{ // skipPast
+  if (_cur >= _lineEnd) {
+    return;
+  } // if
+  const char* found = static_cast<const char*>(memchr(_cur, delim, _lineEnd - _cur));
+  _cur = (found) ? found+1 : _lineEnd;
+} // skipPast
+
+// ----------------------------------------------------------------------
+// Skip past the next occurrence of a character, advancing over lines
+// as necessary.
+void
+pylith::meshio::TextTokenizer::ignore(const char delim)
+{ // ignore
+  while (true) {
+    if (_cur < _lineEnd) {
+      const char* found = static_cast<const char*>(memchr(_cur, delim, _lineEnd - _cur));
+      if (found) {
+	// Remainder of the line is parsed as the next line.
+	_cur = found+1;
+	_next = _cur;
+	return;
+      } // if
+    } // if
+    if (!nextLine()) {
+      std::ostringstream msg;
+      msg << "Reached end of file while looking for '" << delim << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // while
+} // ignore
+
+// ----------------------------------------------------------------------
+// Read integer from the current line.
+int
+pylith::meshio::TextTokenizer::readInt(void)
+{ // readInt
+  using _TextTokenizer::isDigit;
+
+  _skipWhitespace();
+  const char* begin = _cur;
+  const char* p = _cur;
+
+  bool negative = false;
+  if (p < _lineEnd && ('-' == *p || '+' == *p)) {
+    negative = '-' == *p;
+    ++p;
+  } // if
+  if (p >= _lineEnd || !isDigit(*p)) {
+    _parseError(begin, "an integer");
+  } // if
+
+  // Magnitude of INT_MIN is one larger than INT_MAX.
+  const long long maxValue = negative ? -(long long)INT_MIN : INT_MAX;
+  long long value = 0;
+  while (p < _lineEnd && isDigit(*p)) {
+    value = 10*value + (*p - '0');
+    if (value > maxValue) {
+      _parseError(begin, "an integer");
+    } // if
+    ++p;
+  } // while
+  if (p < _lineEnd && !_TextTokenizer::isWhitespace(*p)) {
+    _parseError(begin, "an integer");
+  } // if
+  _cur = p;
+
+  return int(negative ? -value : value);
+} // readInt
+
+// ----------------------------------------------------------------------
+// Read integer, advancing to the next line if the current line has
+// no more content.
+int
+pylith::meshio::TextTokenizer::readIntAnyLine(void)
+{ // readIntAnyLine
+  _skipWhitespace();
+  if (_cur >= _lineEnd && !nextLine()) {
+    throw std::runtime_error("Reached end of file while reading integers.");
+  } // if
+  return readInt();
+} // readIntAnyLine
+
+// ----------------------------------------------------------------------
+// Read floating point value from the current line.
+PylithScalar
+pylith::meshio::TextTokenizer::readScalar(void)
+{ // readScalar
+  using namespace _TextTokenizer;
+
+  _skipWhitespace();
+  const char* begin = _cur;
+  const char* tokenEnd = _cur;
+  while (tokenEnd < _lineEnd && !isWhitespace(*tokenEnd)) {
+    ++tokenEnd;
+  } // while
+  if (begin == tokenEnd) {
+    _parseError(begin, "a floating point value");
+  } // if
+
+  // Accumulate up to maxMantissaDigits significant digits. Values
+  // that fit in a double mantissa with a small power of ten are
+  // converted exactly with a single multiplication or division;
+  // all others are handed to strtod().
+  const char* p = begin;
+  bool negative = false;
+  if ('-' == *p || '+' == *p) {
+    negative = '-' == *p;
+    ++p;
+  } // if
+
+  unsigned long long mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool truncated = false;
+  bool hasDigits = false;
+  while (p < tokenEnd && isDigit(*p)) {
+    hasDigits = true;
+    if (numDigits < maxMantissaDigits) {
+      mantissa = 10*mantissa + (*p - '0');
+      if (mantissa > 0) {
+	++numDigits;
+      } // if
+    } else {
+      ++exponent;
+      truncated = truncated || '0' != *p;
+    } // if/else
+    ++p;
+  } // while
+  if (p < tokenEnd && '.' == *p) {
+    ++p;
+    while (p < tokenEnd && isDigit(*p)) {
+      hasDigits = true;
+      if (numDigits < maxMantissaDigits) {
+	mantissa = 10*mantissa + (*p - '0');
+	if (mantissa > 0) {
+	  ++numDigits;
+	} // if
+	--exponent;
+      } else {
+	truncated = truncated || '0' != *p;
+      } // if/else
+      ++p;
+    } // while
+  } // if
+  if (hasDigits && p < tokenEnd && ('e' == *p || 'E' == *p)) {
+    ++p;
+    bool negativeExp = false;
+    if (p < tokenEnd && ('-' == *p || '+' == *p)) {
+      negativeExp = '-' == *p;
+      ++p;
+    } // if
+    if (p >= tokenEnd || !isDigit(*p)) {
+      hasDigits = false;
+    } // if
+    int value = 0;
+    while (p < tokenEnd && isDigit(*p)) {
+      if (value < 100000) {
+	value = 10*value + (*p - '0');
+      } // if
+      ++p;
+    } // while
+    exponent += negativeExp ? -value : value;
+  } // if
+
+  double value = 0.0;
+  if (hasDigits && p == tokenEnd && !truncated && mantissa <= maxExactMantissa &&
+      exponent >= -maxExactPower && exponent <= maxExactPower) {
+    value = double(mantissa);
+    value = (exponent < 0) ? value / exactPowers[-exponent] : value * exactPowers[exponent];
+    if (negative) {
+      value = -value;
+    } // if
+  } else {
+    value = _strtod(begin, tokenEnd);
+  } // if/else
+  _cur = tokenEnd;
+
+  return PylithScalar(value);
+} // readScalar
+
+// ----------------------------------------------------------------------
+// Get the remaining content on the current line.
+void
+pylith::meshio::TextTokenizer::restOfLine(std::string* value)
+{ // restOfLine
+  assert(value);
+
+  _skipWhitespace();
+  value->assign(_cur, _lineEnd - _cur);
+  _cur = _lineEnd;
+} // restOfLine
+
+// ----------------------------------------------------------------------
+// Skip whitespace on the current line.
+void
+pylith::meshio::TextTokenizer::_skipWhitespace(void)
+{ // _skipWhitespace
+  while (_cur < _lineEnd && _TextTokenizer::isWhitespace(*_cur)) {
+    ++_cur;
+  } // while
+} // _skipWhitespace
+
+// ----------------------------------------------------------------------
+// Parse floating point value using strtod().
+double
+pylith::meshio::TextTokenizer::_strtod(const char* begin,
+				       const char* end) const
+{ // _strtod
+  // Mapped buffer is not null terminated, so copy token to the stack
+  // (or the heap for unusually long tokens).
+  const size_t maxLength = 128;
+  char buffer[maxLength];
+  std::string longToken;
+  const size_t length = end - begin;
+  const char* token = buffer;
+  if (length < maxLength) {
+    memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+  } else {
+    longToken.assign(begin, length);
+    token = longToken.c_str();
+  } // if/else
+
+  char* parsedEnd = 0;
+  const double value = strtod(token, &parsedEnd);
+  if (parsedEnd != token + length) {
+    _parseError(begin, "a floating point value");
+  } // if
+
+  return value;
+} // _strtod
+
+// ----------------------------------------------------------------------
+// Throw exception for value that could not be parsed.
+void
+pylith::meshio::TextTokenizer::_parseError(const char* begin,
+					   const char* typeName) const
+{ // _parseError
+  const char* end = begin;
+  while (end < _lineEnd && !_TextTokenizer::isWhitespace(*end)) {
+    ++end;
+  } // while
+
+  std::ostringstream msg;
+  msg << "Could not parse '" << std::string(begin, end - begin) << "' as " << typeName << ".";
+  throw std::runtime_error(msg.str());
+} // _parseError
+
+
+// End of file
@@ -0,0 +1,189 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/TextTokenizer.hh
+ *
+ * @brief C++ object for fast line-oriented parsing of ASCII files.
+ */
+
+#if !defined(pylith_meshio_texttokenizer_hh)
+#define pylith_meshio_texttokenizer_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <string> // HASA std::string
+#include <cstddef> // USES size_t
+
+// TextTokenizer --------------------------------------------------------
+/** @brief Fast line-oriented parsing of ASCII files.
+ *
+ * The file is memory mapped and parsed in a single forward pass
+ * without allocating memory for each token. Comments begin with
+ * "//" and extend to the end of the line; lines without any content
+ * other than whitespace and comments are skipped. Integers and
+ * floating point values are converted directly from the mapped
+ * buffer.
+ */
+class pylith::meshio::TextTokenizer
+{ // TextTokenizer
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  TextTokenizer(void);
+
+  /// Destructor
+  ~TextTokenizer(void);
+
+  /** Open file and map it into memory.
+   *
+   * @param filename Name of file.
+   */
+  void open(const char* filename);
+
+  /// Unmap and close file.
+  void close(void);
+
+  /** Advance to the next line with content.
+   *
+   * Any unparsed content on the current line is discarded.
+   *
+   * @returns False if the end of the file was reached, true otherwise.
+   */
+  bool nextLine(void);
+
+  /** Get next whitespace delimited token on the current line.
+   *
+   * @param token Pointer to start of token (not null terminated).
+   * @param length Number of characters in token.
+   * @returns False if the current line has no more tokens.
+   */
+  bool nextToken(const char** token,
+		 size_t* length);
+
+  /** Check whether token matches a value (case insensitive).
+   *
+   * @param token Pointer to start of token.
+   * @param length Number of characters in token.
+   * @param value Null terminated value.
+   * @returns True if token matches value.
+   */
+  static
+  bool matches(const char* token,
+	       const size_t length,
+	       const char* value);
+
+  /** Skip past the next occurrence of a character on the current line.
+   *
+   * @param delim Character to skip.
+   */
+  void skipPast(const char delim);
+
+  /** Skip past the next occurrence of a character, advancing over
+   * lines as necessary.
+   *
+   * @param delim Character to skip.
+   */
+  void ignore(const char delim);
+
+  /** Read integer from the current line.
+   *
+   * @returns Integer value.
+   */
+  int readInt(void);
+
+  /** Read integer, advancing to the next line if the current line
+   * has no more content.
+   *
+   * @returns Integer value.
+   */
+  int readIntAnyLine(void);
+
+  /** Read floating point value from the current line.
+   *
+   * @returns Floating point value.
+   */
+  PylithScalar readScalar(void);
+
+  /** Get the remaining content on the current line.
+   *
+   * @param value Remaining content with leading and trailing
+   * whitespace removed.
+   */
+  void restOfLine(std::string* value);
+
+  /** Get number of the current line.
+   *
+   * @returns Line number (starting at 1).
+   */
+  int lineNumber(void) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Skip whitespace on the current line.
+  void _skipWhitespace(void);
+
+  /** Parse floating point value using strtod().
+   *
+   * @param begin Start of value.
+   * @param end End of value.
+   * @returns Floating point value.
+   */
+  double _strtod(const char* begin,
+		 const char* end) const;
+
+  /** Throw exception for value that could not be parsed.
+   *
+   * @param begin Start of value.
+   * @param typeName Name of type of value.
+   */
+  void _parseError(const char* begin,
+		   const char* typeName) const;
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  TextTokenizer(const TextTokenizer&); ///< Not implemented
+  const TextTokenizer& operator=(const TextTokenizer&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  const char* _buffer; ///< Start of mapped file.
+  const char* _end; ///< End of mapped file.
+  const char* _cur; ///< Current position on current line.
+  const char* _lineEnd; ///< End of content on current line.
+  const char* _next; ///< Position at which to search for next line.
+  size_t _size; ///< Size of mapped file in bytes.
+  int _fd; ///< File descriptor.
+  int _lineNumber; ///< Number of current line.
+
+}; // TextTokenizer
+
+#include "TextTokenizer.icc" // inline methods
+
+#endif // pylith_meshio_texttokenizer_hh
+
+
+// End of file
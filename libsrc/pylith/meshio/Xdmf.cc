@@ -0,0 +1,510 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "Xdmf.hh" // implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setw()
+#include <cstdio> // USES std::rename(), std::remove()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        namespace _Xdmf {
+            /// Precision of floating point values in HDF5 file.
+            static const int precision = sizeof(PylithScalar);
+        } // _Xdmf
+    } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::Xdmf::Xdmf(void) :
+    _numCells(0),
+    _numCorners(0),
+    _cellDim(0),
+    _numVertices(0),
+    _spaceDim(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::Xdmf::~Xdmf(void)
+{ // destructor
+} // destructor
+
+// ----------------------------------------------------------------------
+// Set topology and geometry of domain and clear fields and time stamps.
+void
+pylith::meshio::Xdmf::open(const char* filenameHDF5,
+                           const int numCells,
+                           const int numCorners,
+                           const int cellDim,
+                           const int numVertices,
+                           const int spaceDim)
+{ // open
+    PYLITH_METHOD_BEGIN;
+
+    assert(filenameHDF5);
+
+    const std::string filenameH5(filenameHDF5);
+    const size_t indexExt = filenameH5.rfind(".h5");
+    _filename = (indexExt != std::string::npos) ? std::string(filenameH5, 0, indexExt) + ".xmf" : filenameH5 + ".xmf";
+
+    // Xdmf file refers to HDF5 file relative to its own location.
+    const size_t indexDir = filenameH5.rfind('/');
+    _filenameHDF5 = (indexDir != std::string::npos) ? std::string(filenameH5, indexDir+1) : filenameH5;
+
+    _numCells = numCells;
+    _numCorners = numCorners;
+    _cellDim = cellDim;
+    _numVertices = numVertices;
+    _spaceDim = spaceDim;
+
+    _timeStamps.clear();
+    _fields.clear();
+
+    PYLITH_METHOD_END;
+} // open
+
+// ----------------------------------------------------------------------
+// Clear metadata.
+void
+pylith::meshio::Xdmf::close(void)
+{ // close
+    _filename = "";
+    _filenameHDF5 = "";
+    _timeStamps.clear();
+    _fields.clear();
+    _numCells = 0;
+    _numCorners = 0;
+    _cellDim = 0;
+    _numVertices = 0;
+    _spaceDim = 0;
+} // close
+
+// ----------------------------------------------------------------------
+// Check whether metadata has been set with open().
+bool
+pylith::meshio::Xdmf::isOpen(void) const
+{ // isOpen
+    return _filename.length() > 0;
+} // isOpen
+
+// ----------------------------------------------------------------------
+// Get name of Xdmf file.
+const std::string&
+pylith::meshio::Xdmf::filename(void) const
+{ // filename
+    return _filename;
+} // filename
+
+// ----------------------------------------------------------------------
+// Add time stamp.
+void
+pylith::meshio::Xdmf::addTimeStamp(const PylithScalar t)
+{ // addTimeStamp
+    _timeStamps.push_back(t);
+} // addTimeStamp
+
+// ----------------------------------------------------------------------
+// Add field or update number of time steps written for field.
+void
+pylith::meshio::Xdmf::updateField(const char* name,
+                                  const topology::FieldBase::DomainEnum domain,
+                                  const topology::FieldBase::VectorFieldEnum vectorFieldType,
+                                  const int numPoints,
+                                  const int fiberDim,
+                                  const int numTimeSteps)
+{ // updateField
+    PYLITH_METHOD_BEGIN;
+
+    assert(name);
+    assert(topology::FieldBase::VERTICES_FIELD == domain || topology::FieldBase::CELLS_FIELD == domain);
+
+    const size_t numFields = _fields.size();
+    size_t i = 0;
+    for (; i < numFields; ++i) {
+        if (_fields[i].name == name && _fields[i].domain == domain) {
+            break;
+        } // if
+    } // for
+    if (i == numFields) {
+        _fields.resize(numFields+1);
+    } // if
+
+    FieldInfo& field = _fields[i];
+    field.name = name;
+    field.domain = domain;
+    field.vectorFieldType = vectorFieldType;
+    field.numPoints = numPoints;
+    field.fiberDim = fiberDim;
+    field.numTimeSteps = numTimeSteps;
+
+    PYLITH_METHOD_END;
+} // updateField
+
+// ----------------------------------------------------------------------
+// Write Xdmf file.
+void
+pylith::meshio::Xdmf::write(void) const
+{ // write
+    PYLITH_METHOD_BEGIN;
+
+    if (!isOpen() || 1 == _spaceDim) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Write to temporary file and then rename it, so that the Xdmf file
+    // is never left partially written.
+    const std::string filenameTmp = _filename + ".tmp";
+    std::ofstream fout(filenameTmp.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open Xdmf file '" << filenameTmp << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    fout << "<?xml version=\"1.0\" ?>\n"
+         << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" [\n"
+         << "<!ENTITY HeavyData \"" << _filenameHDF5 << "\">\n"
+         << "]>\n"
+         << "\n"
+         << "<Xdmf>\n";
+
+    _writeDomain(fout);
+
+    const int numTimeSteps = _timeStamps.size();
+    if (numTimeSteps > 0) {
+        fout << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+        _writeTimeStamps(fout);
+        for (int iTime = 0; iTime < numTimeSteps; ++iTime) {
+            _writeTimeGrid(fout, iTime);
+        } // for
+        fout << "    </Grid>\n";
+    } else {
+        _writeTimeGrid(fout, -1);
+    } // if/else
+
+    fout << "  </Domain>\n"
+         << "</Xdmf>\n";
+
+    fout.close();
+    if (fout.fail()) {
+        std::remove(filenameTmp.c_str());
+        std::ostringstream msg;
+        msg << "Error while writing Xdmf file '" << filenameTmp << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (std::rename(filenameTmp.c_str(), _filename.c_str())) {
+        std::ostringstream msg;
+        msg << "Could not rename Xdmf file '" << filenameTmp << "' to '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // write
+
+// ----------------------------------------------------------------------
+// Write domain topology and geometry.
+void
+pylith::meshio::Xdmf::_writeDomain(std::ostream& fout) const
+{ // _writeDomain
+    PYLITH_METHOD_BEGIN;
+
+    fout << "  <Domain Name=\"domain\">\n";
+
+    // Cells
+    fout << "    <DataItem Name=\"cells\" ItemType=\"Uniform\" Format=\"HDF\" NumberType=\"Float\" Precision=\"" << _Xdmf::precision << "\" Dimensions=\"" << _numCells << " " << _numCorners << "\">\n"
+         << "      &HeavyData;:/topology/cells\n"
+         << "    </DataItem>\n";
+
+    // Vertices
+    if (3 == _spaceDim) {
+        fout << "    <DataItem Name=\"vertices\" ItemType=\"Uniform\" Format=\"HDF\" Dimensions=\"" << _numVertices << " " << _spaceDim << "\">\n"
+             << "      &HeavyData;:/geometry/vertices\n"
+             << "    </DataItem>\n";
+    } else if (2 == _spaceDim) {
+        // Form vector with 3 components using x and y components and
+        // then a fake z-component by multiplying the x-component by zero.
+        fout << "    <DataItem Name=\"vertices\" ItemType=\"Function\" Dimensions=\"" << _numVertices << " 3\" Function=\"JOIN($0, $1, $2)\">\n";
+        const char* componentNames[2] = { "verticesX", "verticesY" };
+        for (int iComponent = 0; iComponent < 2; ++iComponent) {
+            fout << "      <DataItem Name=\"" << componentNames[iComponent] << "\" ItemType=\"Hyperslab\" Type=\"HyperSlab\" Dimensions=\"" << _numVertices << " 1\">\n"
+                 << "        <DataItem Dimensions=\"3 2\" Format=\"XML\">\n"
+                 << "          0 " << iComponent << "   1 1   " << _numVertices << " 1\n"
+                 << "        </DataItem>\n"
+                 << "        <DataItem Dimensions=\"" << _numVertices << " 1\" Format=\"HDF\">\n"
+                 << "          &HeavyData;:/geometry/vertices\n"
+                 << "        </DataItem>\n"
+                 << "      </DataItem>\n";
+        } // for
+        fout << "      <DataItem Name=\"verticesZ\" ItemType=\"Function\" Dimensions=\"" << _numVertices << " 1\" Function=\"0*$0\">\n"
+             << "        <DataItem Reference=\"XML\">\n"
+             << "          /Xdmf/Domain/DataItem[@Name=\"vertices\"]/DataItem[@Name=\"verticesX\"]\n"
+             << "        </DataItem>\n"
+             << "      </DataItem>\n"
+             << "    </DataItem>\n";
+    } else {
+        std::ostringstream msg;
+        msg << "Unexpected spatial dimension " << _spaceDim << " when writing domain vertices to Xdmf file '" << _filename << "'.";
+        throw std::logic_error(msg.str());
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // _writeDomain
+
+// ----------------------------------------------------------------------
+// Write time stamps.
+void
+pylith::meshio::Xdmf::_writeTimeStamps(std::ostream& fout) const
+{ // _writeTimeStamps
+    PYLITH_METHOD_BEGIN;
+
+    const int numTimeSteps = _timeStamps.size();
+    fout << "      <Time TimeType=\"List\">\n"
+         << "        <DataItem Format=\"XML\" NumberType=\"Float\" Dimensions=\"" << numTimeSteps << "\">\n"
+         << "        ";
+    const std::ios_base::fmtflags flags = fout.flags();
+    const std::streamsize precision = fout.precision();
+    fout << std::scientific << std::setprecision(8);
+    for (int iTime = 0; iTime < numTimeSteps; ++iTime) {
+        fout << "  " << std::setw(16) << _timeStamps[iTime];
+    } // for
+    fout.flags(flags);
+    fout.precision(precision);
+    fout << "\n"
+         << "        </DataItem>\n"
+         << "      </Time>\n";
+
+    PYLITH_METHOD_END;
+} // _writeTimeStamps
+
+// ----------------------------------------------------------------------
+// Write grid for a single time step.
+void
+pylith::meshio::Xdmf::_writeTimeGrid(std::ostream& fout,
+                                     const int iTime) const
+{ // _writeTimeGrid
+    PYLITH_METHOD_BEGIN;
+
+    fout << "      <Grid Name=\"domain\" GridType=\"Uniform\">\n";
+
+    // Topology
+    fout << "        <Topology TopologyType=\"" << _cellType() << "\" NumberOfElements=\"" << _numCells << "\">\n"
+         << "          <DataItem Reference=\"XML\">\n"
+         << "            /Xdmf/Domain/DataItem[@Name=\"cells\"]\n"
+         << "          </DataItem>\n"
+         << "        </Topology>\n";
+
+    // Geometry
+    fout << "        <Geometry GeometryType=\"XYZ\">\n"
+         << "          <DataItem Reference=\"XML\">\n"
+         << "            /Xdmf/Domain/DataItem[@Name=\"vertices\"]\n"
+         << "          </DataItem>\n"
+         << "        </Geometry>\n";
+
+    // Fields; skip fields that have not been written for this time step.
+    const size_t numFields = _fields.size();
+    for (size_t i = 0; i < numFields; ++i) {
+        const FieldInfo& field = _fields[i];
+        if (iTime >= field.numTimeSteps) {
+            continue;
+        } // if
+        switch (field.vectorFieldType) {
+        case topology::FieldBase::SCALAR:
+        case topology::FieldBase::VECTOR:
+            _writeGridField(fout, field, iTime);
+            break;
+        default:
+            for (int iComponent = 0; iComponent < field.fiberDim; ++iComponent) {
+                _writeGridFieldComponent(fout, field, iTime, iComponent);
+            } // for
+        } // switch
+    } // for
+
+    fout << "      </Grid>\n";
+
+    PYLITH_METHOD_END;
+} // _writeTimeGrid
+
+// ----------------------------------------------------------------------
+// Write field for current time step.
+void
+pylith::meshio::Xdmf::_writeGridField(std::ostream& fout,
+                                      const FieldInfo& field,
+                                      const int iTime) const
+{ // _writeGridField
+    PYLITH_METHOD_BEGIN;
+
+    const std::string& h5Name = _datasetPath(field);
+    const char* center = (topology::FieldBase::VERTICES_FIELD == field.domain) ? "Node" : "Cell";
+    const int iStep = (iTime >= 0) ? iTime : 0;
+    const int numPoints = field.numPoints;
+    const int numComponents = field.fiberDim;
+
+    std::ostringstream dims;
+    dims << field.numTimeSteps << " " << numPoints << " " << numComponents;
+
+    fout << "        <Attribute Name=\"" << field.name << "\" Type=\"" << _attributeType(field.vectorFieldType) << "\" Center=\"" << center << "\">\n";
+
+    if (2 == _spaceDim && topology::FieldBase::VECTOR == field.vectorFieldType) {
+        // Form vector with 3 components using x and y components and
+        // then a fake z-component by multiplying the x-component by zero.
+        const char* gridRef = (iTime >= 0) ? "/Xdmf/Domain/Grid/Grid[1]" : "/Xdmf/Domain/Grid";
+        fout << "          <DataItem ItemType=\"Function\" Dimensions=\"" << numPoints << " 3\" Function=\"JOIN($0, $1, $2)\">\n";
+        for (int iComponent = 0; iComponent < 2; ++iComponent) {
+            fout << "            <DataItem ItemType=\"HyperSlab\" Dimensions=\"" << numPoints << " 1\" Type=\"HyperSlab\">\n"
+                 << "              <DataItem Dimensions=\"3 3\" Format=\"XML\">\n"
+                 << "                " << iStep << " 0 " << iComponent << "    1 1 1    1 " << numPoints << " 1\n"
+                 << "              </DataItem>\n"
+                 << "              <DataItem DataType=\"Float\" Precision=\"" << _Xdmf::precision << "\" Dimensions=\"" << dims.str() << "\" Format=\"HDF\">\n"
+                 << "                &HeavyData;:" << h5Name << "\n"
+                 << "              </DataItem>\n"
+                 << "            </DataItem>\n";
+        } // for
+        fout << "            <DataItem ItemType=\"Function\" Dimensions=\"" << numPoints << " 1\" Function=\"0*$0\">\n"
+             << "              <DataItem Reference=\"XML\">\n"
+             << "                " << gridRef << "/Attribute[@Name=\"" << field.name << "\"]/DataItem[1]/DataItem[1]\n"
+             << "              </DataItem>\n"
+             << "            </DataItem>\n"
+             << "          </DataItem>\n";
+    } else {
+        fout << "          <DataItem ItemType=\"HyperSlab\" Dimensions=\"1 " << numPoints << " " << numComponents << "\" Type=\"HyperSlab\">\n"
+             << "            <DataItem Dimensions=\"3 3\" Format=\"XML\">\n"
+             << "              " << iStep << " 0 0    1 1 1    1 " << numPoints << " " << numComponents << "\n"
+             << "            </DataItem>\n"
+             << "            <DataItem DataType=\"Float\" Precision=\"" << _Xdmf::precision << "\" Dimensions=\"" << dims.str() << "\" Format=\"HDF\">\n"
+             << "              &HeavyData;:" << h5Name << "\n"
+             << "            </DataItem>\n"
+             << "          </DataItem>\n";
+    } // if/else
+
+    fout << "        </Attribute>\n";
+
+    PYLITH_METHOD_END;
+} // _writeGridField
+
+// ----------------------------------------------------------------------
+// Write single component of field for current time step.
+void
+pylith::meshio::Xdmf::_writeGridFieldComponent(std::ostream& fout,
+                                               const FieldInfo& field,
+                                               const int iTime,
+                                               const int iComponent) const
+{ // _writeGridFieldComponent
+    PYLITH_METHOD_BEGIN;
+
+    std::ostringstream componentName;
+    componentName << field.name;
+    switch (field.vectorFieldType) {
+    case topology::FieldBase::TENSOR:
+        if (2 == _spaceDim) {
+            const char* components[3] = { "_xx", "_yy", "_xy" };
+            assert(iComponent < 3);
+            componentName << components[iComponent];
+        } else if (3 == _spaceDim) {
+            const char* components[6] = { "_xx", "_yy", "_zz", "_xy", "_yz", "_xz" };
+            assert(iComponent < 6);
+            componentName << components[iComponent];
+        } else {
+            std::ostringstream msg;
+            msg << "Unexpected spatial dimension " << _spaceDim << " for names of components of field '" << field.name << "'.";
+            throw std::logic_error(msg.str());
+        } // if/else
+        break;
+    default:
+        componentName << "_" << iComponent;
+    } // switch
+
+    const int iStep = (iTime >= 0) ? iTime : 0;
+    const int numPoints = field.numPoints;
+    const char* center = (topology::FieldBase::VERTICES_FIELD == field.domain) ? "Node" : "Cell";
+
+    fout << "        <Attribute Name=\"" << componentName.str() << "\" Type=\"Scalar\" Center=\"" << center << "\">\n"
+         << "          <DataItem ItemType=\"HyperSlab\" Dimensions=\"1 " << numPoints << " 1\" Type=\"HyperSlab\">\n"
+         << "            <DataItem Dimensions=\"3 3\" Format=\"XML\">\n"
+         << "              " << iStep << " 0 " << iComponent << "    1 1 1    1 " << numPoints << " 1\n"
+         << "            </DataItem>\n"
+         << "            <DataItem DataType=\"Float\" Precision=\"" << _Xdmf::precision << "\" Dimensions=\"" << field.numTimeSteps << " " << numPoints << " " << field.fiberDim << "\" Format=\"HDF\">\n"
+         << "              &HeavyData;:" << _datasetPath(field) << "\n"
+         << "            </DataItem>\n"
+         << "          </DataItem>\n"
+         << "        </Attribute>\n";
+
+    PYLITH_METHOD_END;
+} // _writeGridFieldComponent
+
+// ----------------------------------------------------------------------
+// Get Xdmf cell type.
+const char*
+pylith::meshio::Xdmf::_cellType(void) const
+{ // _cellType
+    if (0 == _cellDim && 1 == _numCorners) {
+        return "Polyvertex";
+    } else if (1 == _cellDim && 2 == _numCorners) {
+        return "Polyline";
+    } else if (2 == _cellDim && 3 == _numCorners) {
+        return "Triangle";
+    } else if (2 == _cellDim && 4 == _numCorners) {
+        return "Quadrilateral";
+    } else if (3 == _cellDim && 4 == _numCorners) {
+        return "Tetrahedron";
+    } else if (3 == _cellDim && 8 == _numCorners) {
+        return "Hexahedron";
+    } // if/else
+
+    return "Unknown";
+} // _cellType
+
+// ----------------------------------------------------------------------
+// Get Xdmf attribute type for field.
+const char*
+pylith::meshio::Xdmf::_attributeType(const topology::FieldBase::VectorFieldEnum vectorFieldType)
+{ // _attributeType
+    switch (vectorFieldType) {
+    case topology::FieldBase::SCALAR:
+        return "Scalar";
+    case topology::FieldBase::VECTOR:
+        return "Vector";
+    case topology::FieldBase::TENSOR:
+        return "Tensor6";
+    default:
+        return "Matrix";
+    } // switch
+} // _attributeType
+
+// ----------------------------------------------------------------------
+// Get path of dataset for field in HDF5 file.
+std::string
+pylith::meshio::Xdmf::_datasetPath(const FieldInfo& field)
+{ // _datasetPath
+    const char* group = (topology::FieldBase::VERTICES_FIELD == field.domain) ? "/vertex_fields/" : "/cell_fields/";
+    return std::string(group) + field.name;
+} // _datasetPath
+
+
+// End of file
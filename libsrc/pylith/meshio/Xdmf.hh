@@ -0,0 +1,230 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/Xdmf.hh
+ *
+ * @brief Object for writing Xdmf metadata file associated with an
+ * HDF5 file.
+ *
+ * The layout of the Xdmf file matches the one generated by
+ * pylith/meshio/Xdmf.py. Instead of reading the HDF5 file, the data
+ * writer supplies the metadata as it writes the datasets, so the Xdmf
+ * file can be updated after every time step. The HDF5 datasets grow
+ * along the time dimension, so the dimensions of every attribute
+ * change with each time step; we rewrite the entire (small) file to a
+ * temporary file and rename it, so the Xdmf file on disk is always
+ * complete.
+ */
+
+#if !defined(pylith_meshio_xdmf_hh)
+#define pylith_meshio_xdmf_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/topology/FieldBase.hh" // USES FieldBase::VectorFieldEnum
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+#include <iosfwd> // USES std::ostream
+
+// Xdmf -----------------------------------------------------------------
+/// Object for writing Xdmf metadata file associated with an HDF5 file.
+class pylith::meshio::Xdmf
+{ // Xdmf
+friend class TestXdmf;   // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+/// Constructor
+Xdmf(void);
+
+/// Destructor
+~Xdmf(void);
+
+/** Set topology and geometry of domain and clear fields and time stamps.
+ *
+ * The name of the Xdmf file is generated by replacing the '.h5'
+ * suffix of the HDF5 filename with '.xmf'.
+ *
+ * @param filenameHDF5 Name of HDF5 file.
+ * @param numCells Number of cells.
+ * @param numCorners Number of vertices in each cell.
+ * @param cellDim Dimension of cells.
+ * @param numVertices Number of vertices.
+ * @param spaceDim Spatial dimension of vertex coordinates.
+ */
+void open(const char* filenameHDF5,
+          const int numCells,
+          const int numCorners,
+          const int cellDim,
+          const int numVertices,
+          const int spaceDim);
+
+/// Clear metadata.
+void close(void);
+
+/** Check whether metadata has been set with open().
+ *
+ * @returns True if open, false otherwise.
+ */
+bool isOpen(void) const;
+
+/** Get name of Xdmf file.
+ *
+ * @returns Name of Xdmf file.
+ */
+const std::string& filename(void) const;
+
+/** Add time stamp.
+ *
+ * @param t Time stamp (dimensioned).
+ */
+void addTimeStamp(const PylithScalar t);
+
+/** Add field or update number of time steps written for field.
+ *
+ * @param name Name of field (name of dataset in HDF5 file).
+ * @param domain Domain of field (vertices or cells).
+ * @param vectorFieldType Type of field.
+ * @param numPoints Number of vertices or cells in dataset.
+ * @param fiberDim Number of components in dataset.
+ * @param numTimeSteps Number of time steps in dataset.
+ */
+void updateField(const char* name,
+                 const topology::FieldBase::DomainEnum domain,
+                 const topology::FieldBase::VectorFieldEnum vectorFieldType,
+                 const int numPoints,
+                 const int fiberDim,
+                 const int numTimeSteps);
+
+/** Write Xdmf file.
+ *
+ * Nothing is written if metadata has not been set or the domain is
+ * 1-D (Xdmf grids are not defined for 1-D domains).
+ */
+void write(void) const;
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+/// Metadata for dataset of field in HDF5 file.
+struct FieldInfo {
+    std::string name;   ///< Name of field.
+    topology::FieldBase::DomainEnum domain;   ///< Vertex or cell field.
+    topology::FieldBase::VectorFieldEnum vectorFieldType;   ///< Type of field.
+    int numPoints;   ///< Number of vertices or cells.
+    int fiberDim;   ///< Number of components.
+    int numTimeSteps;   ///< Number of time steps.
+};   // FieldInfo
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+/** Write domain topology and geometry.
+ *
+ * @param fout Output stream.
+ */
+void _writeDomain(std::ostream& fout) const;
+
+/** Write time stamps.
+ *
+ * @param fout Output stream.
+ */
+void _writeTimeStamps(std::ostream& fout) const;
+
+/** Write grid for a single time step.
+ *
+ * @param fout Output stream.
+ * @param iTime Index of time step (-1 if no time stamps).
+ */
+void _writeTimeGrid(std::ostream& fout,
+                    const int iTime) const;
+
+/** Write field for current time step.
+ *
+ * @param fout Output stream.
+ * @param field Field metadata.
+ * @param iTime Index of time step (-1 if no time stamps).
+ */
+void _writeGridField(std::ostream& fout,
+                     const FieldInfo& field,
+                     const int iTime) const;
+
+/** Write single component of field for current time step.
+ *
+ * @param fout Output stream.
+ * @param field Field metadata.
+ * @param iTime Index of time step (-1 if no time stamps).
+ * @param iComponent Index of component.
+ */
+void _writeGridFieldComponent(std::ostream& fout,
+                              const FieldInfo& field,
+                              const int iTime,
+                              const int iComponent) const;
+
+/** Get Xdmf cell type.
+ *
+ * @returns Name of Xdmf topology type.
+ */
+const char* _cellType(void) const;
+
+/** Get Xdmf attribute type for field.
+ *
+ * @param vectorFieldType Type of field.
+ * @returns Name of Xdmf attribute type.
+ */
+static
+const char* _attributeType(const topology::FieldBase::VectorFieldEnum vectorFieldType);
+
+/** Get path of dataset for field in HDF5 file.
+ *
+ * @param field Field metadata.
+ * @returns Path of dataset.
+ */
+static
+std::string _datasetPath(const FieldInfo& field);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+Xdmf(const Xdmf&);   ///< Not implemented
+const Xdmf& operator=(const Xdmf&);   ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+std::string _filename;   ///< Name of Xdmf file.
+std::string _filenameHDF5;   ///< Name of HDF5 file (without directory).
+std::vector<PylithScalar> _timeStamps;   ///< Time stamps.
+std::vector<FieldInfo> _fields;   ///< Fields in order they were added.
+int _numCells;   ///< Number of cells.
+int _numCorners;   ///< Number of vertices in each cell.
+int _cellDim;   ///< Dimension of cells.
+int _numVertices;   ///< Number of vertices.
+int _spaceDim;   ///< Spatial dimension of vertex coordinates.
+
+}; // Xdmf
+
+#endif // pylith_meshio_xdmf_hh
+
+
+// End of file
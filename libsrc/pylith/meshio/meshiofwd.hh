@@ -31,11 +31,13 @@ namespace pylith {
   namespace meshio {
 
     class BinaryIO;
+    class TextTokenizer;
 
     class MeshIO;
     class MeshBuilder;
     class MeshIOAscii;
     class MeshIOCubit;
+    class MeshIOHDF5;
     class MeshIOLagrit;
 
     class GMVFile;
@@ -49,6 +51,7 @@ namespace pylith {
     class OutputManager;
     class DataWriter;
     class DataWriterVTK;
+    class DataWriterVTU;
     class DataWriterHDF5;
     class DataWriterHDF5Ext;
     class CellFilter;
@@ -29,6 +29,7 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -39,8 +40,12 @@ pylith::problems::Formulation::Formulation(void) :
   _customConstraintPCMat(0),
   _jacobianLumped(0),
   _fields(0),
+  _actionInputVec(0),
+  _actionOutputVec(0),
   _isJacobianSymmetric(false),
-  _splitFields(false)
+  _splitFields(false),
+  _useCustomConstraintPC(false),
+  _useBlockConstraintPC(false)
 { // constructor
 } // constructor
 
@@ -62,8 +67,11 @@ pylith::problems::Formulation::deallocate(void)
   _jacobianLumped = 0; // :TODO: Use shared pointer.
   _fields = 0; // :TODO: Use shared pointer.
 
-#if 0   // :KLUDGE: Assume Solver deallocates matrix.
   PetscErrorCode err = 0;
+  err = VecDestroy(&_actionInputVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&_actionOutputVec);PYLITH_CHECK_ERROR(err);
+
+#if 0   // :KLUDGE: Assume Solver deallocates matrix.
   if (_customConstraintPCMat) {
     err = PetscObjectDereference((PetscObject) _customConstraintPCMat);PYLITH_CHECK_ERROR(err);
     _customConstraintPCMat = 0;
@@ -107,6 +115,24 @@ pylith::problems::Formulation::useCustomConstraintPC(void) const
   return _useCustomConstraintPC;
 } // useCustomConstraintPC
 
+// ----------------------------------------------------------------------
+// Set flag for using block diagonal approximation in custom
+// preconditioner for Lagrange constraints.
+void
+pylith::problems::Formulation::useBlockConstraintPC(const bool flag)
+{ // useBlockConstraintPC
+  _useBlockConstraintPC = flag;
+} // useBlockConstraintPC
+
+// ----------------------------------------------------------------------
+// Get flag indicating use of block diagonal approximation in custom
+// preconditioner for Lagrange constraints.
+bool
+pylith::problems::Formulation::useBlockConstraintPC(void) const
+{ // useBlockConstraintPC
+  return _useBlockConstraintPC;
+} // useBlockConstraintPC
+
 // ----------------------------------------------------------------------
 // Return the fields
 const pylith::topology::SolutionFields&
@@ -166,6 +192,23 @@ pylith::problems::Formulation::updateSettings(topology::Jacobian* jacobian,
   _fields = fields;
   _t = t;
   _dt = dt;
+
+  if (jacobian->isMatrixFree()) {
+    const int numIntegrators = _integrators.size();
+    for (int i=0; i < numIntegrators; ++i) {
+      if (!_integrators[i]->hasJacobianAction()) {
+	throw std::runtime_error("Matrix-free Jacobian (matrix type 'shell') is only "
+				 "supported for implicit small-strain elasticity with "
+				 "absorbing boundaries and prescribed slip faults; use an "
+				 "assembled matrix type.");
+      } // if
+    } // for
+
+    PetscMat mat = jacobian->matrix();assert(mat);
+    PetscErrorCode err = 0;
+    err = MatShellSetContext(mat, (void*) this);PYLITH_CHECK_ERROR(err);
+    err = MatShellSetOperation(mat, MATOP_MULT, (void (*)(void)) jacobianAction);PYLITH_CHECK_ERROR(err);
+  } // if
 } // updateSettings
 
 // ----------------------------------------------------------------------
@@ -258,10 +301,27 @@ pylith::problems::Formulation::reformJacobian(const PetscVec* tmpSolutionVec)
   for (int i=0; i < numIntegrators; ++i) {
     _integrators[i]->integrateJacobian(_jacobian, _t, _fields);
   } // for
+
+  // Decouple constrained DOF kept in the global system.
+  const topology::Field& solution = _fields->solution();
+  if (solution.keepsConstrainedDOF()) {
+    _jacobian->addConstrainedIdentity(solution);
+  } // if
   
   // Assemble jacobian.
   _jacobian->assemble("final_assembly");
 
+  if (_jacobian->isMatrixFree()) {
+    // Constraints (e.g., Lagrange multipliers) have zero diagonal
+    // blocks; replace them in the point-block preconditioning matrix
+    // using the assembled blocks of the other DOF.
+    PetscMat pcMat = _jacobian->assembledMatrix();
+    for (int i=0; i < numIntegrators; ++i) {
+      _integrators[i]->calcPreconditioner(&pcMat, _jacobian, _fields);
+    } // for
+    _jacobian->assemble("final_assembly");
+  } // if
+
   if (_customConstraintPCMat) {
     // Recalculate preconditioner.
     for (int i=0; i < numIntegrators; ++i) {
@@ -305,6 +365,118 @@ pylith::problems::Formulation::reformJacobianLumped(void)
   PYLITH_METHOD_END;
 } // reformJacobianLumped
 
+// ----------------------------------------------------------------------
+// Apply system Jacobian to a vector without assembling it.
+void
+pylith::problems::Formulation::applyJacobian(const PetscVec x,
+					     PetscVec y)
+{ // applyJacobian
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  const topology::Field& solution = _fields->solution();
+  PetscDM dmMesh = solution.dmMesh();assert(dmMesh);
+  PetscSection section = solution.localSection();assert(section);
+  PetscErrorCode err = 0;
+
+  if (!_actionInputVec) {
+    err = DMCreateLocalVector(dmMesh, &_actionInputVec);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLocalVector(dmMesh, &_actionOutputVec);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Constrained DOF are not in the global vector, so they stay zero
+  // unless they are kept in the global system.
+  err = VecSet(_actionInputVec, 0.0);PYLITH_CHECK_ERROR(err);
+  err = DMGlobalToLocalBegin(dmMesh, x, INSERT_VALUES, _actionInputVec);PYLITH_CHECK_ERROR(err);
+  err = DMGlobalToLocalEnd(dmMesh, x, INSERT_VALUES, _actionInputVec);PYLITH_CHECK_ERROR(err);
+
+  const bool keepConstrained = solution.keepsConstrainedDOF();
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  PetscScalar* inputArray = NULL;
+  err = VecGetArray(_actionInputVec, &inputArray);PYLITH_CHECK_ERROR(err);
+  if (keepConstrained) {
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+      PetscInt cdof = 0, off = 0;
+      err = PetscSectionGetConstraintDof(section, p, &cdof);PYLITH_CHECK_ERROR(err);
+      if (cdof <= 0) {
+	continue;
+      } // if
+      const PetscInt* cind = NULL;
+      err = PetscSectionGetConstraintIndices(section, p, &cind);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetOffset(section, p, &off);PYLITH_CHECK_ERROR(err);
+      for (PetscInt i = 0; i < cdof; ++i) {
+	inputArray[off+cind[i]] = 0.0;
+      } // for
+    } // for
+  } // if
+
+  err = VecSet(_actionOutputVec, 0.0);PYLITH_CHECK_ERROR(err);
+  PetscScalar* actionArray = NULL;
+  err = VecGetArray(_actionOutputVec, &actionArray);PYLITH_CHECK_ERROR(err);
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->integrateJacobianAction(actionArray, inputArray, _fields);
+  } // for
+
+  err = VecRestoreArray(_actionOutputVec, &actionArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(_actionInputVec, &inputArray);PYLITH_CHECK_ERROR(err);
+
+  err = VecSet(y, 0.0);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalBegin(dmMesh, _actionOutputVec, ADD_VALUES, y);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalEnd(dmMesh, _actionOutputVec, ADD_VALUES, y);PYLITH_CHECK_ERROR(err);
+
+  // Identity rows for constrained DOF kept in the global system.
+  if (keepConstrained) {
+    PetscSection gsection = solution.globalSection();assert(gsection);
+    PetscInt rowStart = 0, rowEnd = 0;
+    err = VecGetOwnershipRange(y, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* xArray = NULL;
+    PetscScalar* yArray = NULL;
+    err = VecGetArrayRead(x, &xArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(y, &yArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+      PetscInt cdof = 0, gdof = 0, goff = 0;
+      err = PetscSectionGetConstraintDof(section, p, &cdof);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetDof(gsection, p, &gdof);PYLITH_CHECK_ERROR(err);
+      if (cdof <= 0 || gdof <= 0) { // skip unconstrained and unowned points
+	continue;
+      } // if
+      const PetscInt* cind = NULL;
+      err = PetscSectionGetConstraintIndices(section, p, &cind);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetOffset(gsection, p, &goff);PYLITH_CHECK_ERROR(err);
+      for (PetscInt i = 0; i < cdof; ++i) {
+	const PetscInt row = goff + cind[i] - rowStart;
+	yArray[row] += xArray[row];
+      } // for
+    } // for
+    err = VecRestoreArray(y, &yArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(x, &xArray);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_END;
+} // applyJacobian
+
+// ----------------------------------------------------------------------
+// Generic C interface for applyJacobian.
+PetscErrorCode
+pylith::problems::Formulation::jacobianAction(PetscMat mat,
+					      PetscVec x,
+					      PetscVec y)
+{ // jacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  void* context = NULL;
+  PetscErrorCode err = MatShellGetContext(mat, &context);PYLITH_CHECK_ERROR(err);
+  Formulation* formulation = (Formulation*) context;assert(formulation);
+
+  formulation->applyJacobian(x, y);
+
+  PYLITH_METHOD_RETURN(0);
+} // jacobianAction
+
 // ----------------------------------------------------------------------
 // Constrain solution space.
 void
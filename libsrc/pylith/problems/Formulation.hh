@@ -79,6 +79,21 @@ public :
    */
   bool useCustomConstraintPC(void) const;
 
+  /** Set flag for using the block diagonal (rather than diagonal) of
+   * the elasticity Jacobian in the custom preconditioner for Lagrange
+   * constraints.
+   *
+   * @param flag True if using block diagonal, false otherwise.
+   */
+  void useBlockConstraintPC(const bool flag);
+
+  /** Get flag indicating use of block diagonal in custom
+   * preconditioner for Lagrange constraints.
+   *
+   * @returns True if using block diagonal, false otherwise.
+   */
+  bool useBlockConstraintPC(void) const;
+
   /** Get solution fields.
    *
    * @returns solution fields.
@@ -149,6 +164,29 @@ public :
    */
   void reformJacobianLumped(void);
 
+  /** Apply system Jacobian to a vector, y = A x, without assembling A.
+   *
+   * Used as the action of the shell matrix for matrix-free Jacobians.
+   *
+   * @param x Global PETSc vector (solution layout).
+   * @param y Global PETSc vector for result (solution layout).
+   */
+  void applyJacobian(const PetscVec x,
+		     PetscVec y);
+
+  /** Generic C interface for applyJacobian() used as MATOP_MULT of
+   * the shell matrix for matrix-free Jacobians.
+   *
+   * @param mat PETSc shell matrix (context is the formulation).
+   * @param x Global PETSc vector.
+   * @param y Global PETSc vector for result.
+   * @returns PETSc error code.
+   */
+  static
+  PetscErrorCode jacobianAction(PetscMat mat,
+				PetscVec x,
+				PetscVec y);
+
   /** Constrain solution space.
    *
    * @param tmpSolutionVec Temporary PETSc vector for solution.
@@ -179,6 +217,8 @@ protected :
   PetscMat _customConstraintPCMat; ///< Custom PETSc preconditioning matrix for constraints.
   topology::Field* _jacobianLumped; ///< Handle to lumped Jacobian of system.
   topology::SolutionFields* _fields; ///< Handle to solution fields for system.
+  PetscVec _actionInputVec; ///< Local input vector for matrix-free Jacobian action.
+  PetscVec _actionOutputVec; ///< Local output vector for matrix-free Jacobian action.
 
   std::vector<feassemble::Integrator*> _integrators; ///< Array of integrators.
 
@@ -186,6 +226,7 @@ protected :
   bool _splitFields; ///< True if splitting fields.
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
+  bool _useBlockConstraintPC; ///< True if using block diagonal in custom preconditioner for Lagrange constraints.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
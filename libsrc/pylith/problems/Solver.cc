@@ -26,13 +26,17 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/RefineInterpolator.hh" // USES RefineInterpolator
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include <petscksp.h> // USES PCMG
+
 #include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
 
 
 // ----------------------------------------------------------------------
@@ -73,7 +77,11 @@ pylith::problems::Solver::Solver(void) :
     _logger(0),
     _jacobianPC(0),
     _jacobianPCFault(0),
-    _skipNullSpaceCreation(false)
+    _skipNullSpaceCreation(false),
+    _interpolator(0),
+    _useMultigrid(false),
+    _numIterations(0),
+    _converged(true)
 { // constructor
 } // constructor
 
@@ -97,6 +105,7 @@ pylith::problems::Solver::deallocate(void)
     PetscErrorCode err = 0;
     err = MatDestroy(&_jacobianPC); PYLITH_CHECK_ERROR(err);
     err = MatDestroy(&_jacobianPCFault); PYLITH_CHECK_ERROR(err);
+    delete _interpolator; _interpolator = 0;
 
     _ctx.pc = 0; // KSP PC (managed separately)
     _ctx.A = 0; // Jacobian (managed separately)
@@ -119,6 +128,35 @@ pylith::problems::Solver::skipNullSpaceCreation(const bool value)
 } // skipNullSpaceCreation
 
 
+// ----------------------------------------------------------------------
+// Set flag for using geometric multigrid preconditioner.
+void
+pylith::problems::Solver::useMultigrid(const bool value)
+{ // useMultigrid
+    PYLITH_METHOD_BEGIN;
+
+    _useMultigrid = value;
+
+    PYLITH_METHOD_END;
+} // useMultigrid
+
+// ----------------------------------------------------------------------
+// Get number of Krylov iterations in most recent solve.
+int
+pylith::problems::Solver::numIterations(void) const
+{ // numIterations
+    return _numIterations;
+} // numIterations
+
+// ----------------------------------------------------------------------
+// Check whether most recent solve converged.
+bool
+pylith::problems::Solver::converged(void) const
+{ // converged
+    return _converged;
+} // converged
+
+
 // ----------------------------------------------------------------------
 // Initialize solver.
 void
@@ -153,8 +191,9 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
         err = MatShellSetOperation(_jacobianPC, MATOP_CREATE_SUBMATRIX,
                                    (void (*)(void))MyMatGetSubMatrix); PYLITH_CHECK_ERROR(err);
     } else {
-        _jacobianPC = jacobianMat;
-        err = PetscObjectReference((PetscObject) jacobianMat); PYLITH_CHECK_ERROR(err);
+        // Same as the Jacobian unless it is matrix-free.
+        _jacobianPC = jacobian.assembledMatrix();
+        err = PetscObjectReference((PetscObject) _jacobianPC); PYLITH_CHECK_ERROR(err);
     } // if/else
 
     PYLITH_METHOD_END;
@@ -334,9 +373,17 @@ pylith::problems::Solver::_setupFieldSplit(PetscPC* const pc,
         err = MatSetType(_jacobianPCFault, MATAIJ); PYLITH_CHECK_ERROR(err);
         err = MatSetFromOptions(_jacobianPCFault); PYLITH_CHECK_ERROR(err);
 
-        // Allocate just the diagonal.
-        err = MatSeqAIJSetPreallocation(_jacobianPCFault, 1, NULL); PYLITH_CHECK_ERROR(err);
-        err = MatMPIAIJSetPreallocation(_jacobianPCFault, 1, NULL, 0, NULL); PYLITH_CHECK_ERROR(err);
+        // Allocate just the diagonal or the diagonal blocks (all
+        // components of a Lagrange multiplier are owned together). The
+        // block size tells the faults which approximation to compute.
+        PetscInt blockSize = 1;
+        if (formulation->useBlockConstraintPC()) {
+            const spatialdata::geocoords::CoordSys* cs = fields.mesh().coordsys(); assert(cs);
+            blockSize = cs->spaceDim();
+            err = MatSetBlockSize(_jacobianPCFault, blockSize); PYLITH_CHECK_ERROR(err);
+        } // if
+        err = MatSeqAIJSetPreallocation(_jacobianPCFault, blockSize, NULL); PYLITH_CHECK_ERROR(err);
+        err = MatMPIAIJSetPreallocation(_jacobianPCFault, blockSize, NULL, 0, NULL); PYLITH_CHECK_ERROR(err);
         // Set preconditioning matrix in formulation
         formulation->customPCMatrix(_jacobianPCFault); assert(_jacobianPCFault);
 
@@ -354,6 +401,70 @@ pylith::problems::Solver::_setupFieldSplit(PetscPC* const pc,
     PYLITH_METHOD_END;
 } // _setupFieldSplit
 
+// ----------------------------------------------------------------------
+// Setup geometric multigrid preconditioner.
+void
+pylith::problems::Solver::_setupMultigrid(PetscPC pc,
+                                          const topology::Field& solution)
+{ // _setupMultigrid
+    PYLITH_METHOD_BEGIN;
+
+    assert(pc);
+
+    delete _interpolator; _interpolator = new topology::RefineInterpolator; assert(_interpolator);
+    _interpolator->initialize(solution);
+    const int numLevels = _interpolator->numLevels();
+    if (numLevels < 2) {
+        throw std::runtime_error("Geometric multigrid preconditioner requires a mesh hierarchy. "
+                                 "Use uniform refinement (RefineUniform) to create the mesh.");
+    } // if
+
+    // Coarse operators are Galerkin projections of the fine operator,
+    // so the coarse levels need only the interpolation operators.
+    PetscErrorCode err = 0;
+    err = PCSetType(pc, PCMG); PYLITH_CHECK_ERROR(err);
+    err = PCMGSetLevels(pc, numLevels, NULL); PYLITH_CHECK_ERROR(err);
+    err = PCMGSetGalerkin(pc, PC_MG_GALERKIN_BOTH); PYLITH_CHECK_ERROR(err);
+    for (int level = 1; level < numLevels; ++level) {
+        err = PCMGSetInterpolation(pc, level, _interpolator->interpolation(level)); PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PCSetFromOptions(pc); PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupMultigrid
+
+// ----------------------------------------------------------------------
+// Setup geometric multigrid preconditioner for displacement block of field split.
+void
+pylith::problems::Solver::_setupMultigridFieldSplit(PetscKSP ksp,
+                                                    const topology::Field& solution)
+{ // _setupMultigridFieldSplit
+    PYLITH_METHOD_BEGIN;
+
+    assert(ksp);
+
+    if (_interpolator) { // already setup
+        PYLITH_METHOD_END;
+    } // if
+
+    // Subsolvers are created when the field split is setup.
+    PetscErrorCode err = 0;
+    PetscPC pc = NULL;
+    PetscKSP* subksps = NULL;
+    PetscInt numSplits = 0;
+    err = KSPSetUp(ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
+    err = PCFieldSplitGetSubKSP(pc, &numSplits, &subksps); PYLITH_CHECK_ERROR(err);
+    assert(numSplits > 0);
+
+    PetscPC subpc = NULL;
+    err = KSPGetPC(subksps[0], &subpc); PYLITH_CHECK_ERROR(err);
+    err = PetscFree(subksps); PYLITH_CHECK_ERROR(err);
+    _setupMultigrid(subpc, solution);
+
+    PYLITH_METHOD_END;
+} // _setupMultigridFieldSplit
+
 // ----------------------------------------------------------------------
 int
 pylith::problems::Solver::_epsilon(int i,
@@ -29,7 +29,7 @@
 // Include directives ---------------------------------------------------
 #include "problemsfwd.hh" // forward declarations
 
-#include "pylith/topology/topologyfwd.hh" // USES SolutionFields
+#include "pylith/topology/topologyfwd.hh" // USES SolutionFields, RefineInterpolator
 #include "pylith/utils/utilsfwd.hh" // USES EventLogger
 #include "pylith/utils/petscfwd.h" // USES PetscMat
 
@@ -73,6 +73,27 @@ public :
    */
   void skipNullSpaceCreation(const bool value);
 
+  /** Set flag for using geometric multigrid preconditioner.
+   *
+   * The hierarchy comes from uniform refinement of the mesh
+   * (RefineUniform). With split fields, multigrid is used for the
+   * displacement block.
+   *
+   * @param[in] value True to use geometric multigrid.
+   */
+  void useMultigrid(const bool value);
+
+  /** Get number of Krylov iterations in most recent solve.
+   *
+   * @returns Number of linear iterations (0 if no iterative solve).
+   */
+  int numIterations(void) const;
+
+  /** Check whether most recent solve converged.
+   *
+   * @returns True if solver converged (true if no iterative solve).
+   */
+  bool converged(void) const;
 
   /** Initialize solver.
    *
@@ -106,6 +127,23 @@ protected :
 			const topology::Jacobian& jacobian,
 			const topology::SolutionFields& fields);
   
+  /** Setup geometric multigrid preconditioner.
+   *
+   * @param pc PETSc preconditioner.
+   * @param solution Solution field.
+   */
+  void _setupMultigrid(PetscPC pc,
+		       const topology::Field& solution);
+
+  /** Setup geometric multigrid preconditioner for the displacement
+   * block of a field split. Requires the operators to be set.
+   *
+   * @param ksp PETSc linear solver using field split preconditioner.
+   * @param solution Solution field.
+   */
+  void _setupMultigridFieldSplit(PetscKSP ksp,
+				 const topology::Field& solution);
+
   /** :MATT: :TODO: DOCUMENT THIS.
    */
   static
@@ -122,6 +160,10 @@ protected :
   PetscMat _jacobianPCFault; ///< Preconditioning matrix for Lagrange constraints.
   FaultPreconCtx _ctx; ///< Context for preconditioning matrix for Lagrange constraints.
   bool _skipNullSpaceCreation; ///< Skip creating the null space (useful for very small problems with no null space).
+  topology::RefineInterpolator* _interpolator; ///< Interpolation between levels for multigrid.
+  bool _useMultigrid; ///< Use geometric multigrid preconditioner.
+  int _numIterations; ///< Number of Krylov iterations in most recent solve.
+  bool _converged; ///< True if most recent solve converged.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
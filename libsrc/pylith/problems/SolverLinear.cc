@@ -31,6 +31,8 @@
 
 #include <petscksp.h> // USES PetscKSP
 
+#include <stdexcept> // USES std::runtime_error
+
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 // ----------------------------------------------------------------------
@@ -85,6 +87,16 @@ pylith::problems::SolverLinear::initialize(const topology::SolutionFields& field
     PetscPC pc = 0;
     err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
     _setupFieldSplit(&pc, formulation, jacobian, fields);
+  } else if (_useMultigrid) {
+    PetscInt numFields = 0;
+    err = PetscSectionGetNumFields(fields.solution().localSection(), &numFields);PYLITH_CHECK_ERROR(err);
+    if (numFields > 1) {
+      throw std::runtime_error("Geometric multigrid preconditioner for a solution with Lagrange "
+			       "multipliers requires split fields.");
+    } // if
+    PetscPC pc = 0;
+    err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
+    _setupMultigrid(pc, fields.solution());
   } // if
 
   if (!_skipNullSpaceCreation) {
@@ -120,16 +132,33 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
 
   PetscErrorCode err = 0;
   const PetscMat jacobianMat = jacobian->matrix();
-  err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+  const PetscMat precondMat = jacobian->assembledMatrix();
+  err = KSPSetOperators(_ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
   jacobian->resetValuesChanged();
 
+  if (_useMultigrid && _formulation->splitFields()) {
+    _setupMultigridFieldSplit(_ksp, *solution);
+  } // if
+
   const PetscVec residualVec = residual.globalVector();
   const PetscVec solutionVec = solution->globalVector();
 
+  // Constrained DOF kept in the global system have identity rows, so
+  // the right-hand side holds their prescribed values.
+  if (solution->keepsConstrainedDOF()) {
+    solution->copyConstrainedLocalToGlobal(residualVec);
+  } // if
+
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(solveEvent);
 
   err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+  PetscInt numIterations = 0;
+  err = KSPGetIterationNumber(_ksp, &numIterations); PYLITH_CHECK_ERROR(err);
+  _numIterations = numIterations;
+  KSPConvergedReason reason = KSP_CONVERGED_ITERATING;
+  err = KSPGetConvergedReason(_ksp, &reason); PYLITH_CHECK_ERROR(err);
+  _converged = reason > 0;
 
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
@@ -33,6 +33,8 @@
 
 #include <petscsnes.h> // USES PetscSNES
 
+#include <stdexcept> // USES std::runtime_error
+
 // KLUDGE, Fixes issue with PetscIsInfOrNanReal and include cmath
 // instead of math.h.
 #define isnan std::isnan // TEMPORARY
@@ -122,6 +124,18 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
     err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
     err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
     _setupFieldSplit(&pc, formulation, jacobian, fields);
+  } else if (_useMultigrid) {
+    PetscInt numFields = 0;
+    err = PetscSectionGetNumFields(fields.solution().localSection(), &numFields);PYLITH_CHECK_ERROR(err);
+    if (numFields > 1) {
+      throw std::runtime_error("Geometric multigrid preconditioner for a solution with Lagrange "
+			       "multipliers requires split fields.");
+    } // if
+    PetscKSP ksp = 0;
+    PetscPC pc = 0;
+    err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
+    _setupMultigrid(pc, fields.solution());
   } // if
 
   if (!_skipNullSpaceCreation) {
@@ -149,7 +163,23 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   PetscErrorCode err = 0;
   const PetscVec solutionVec = solution->globalVector();
 
+  if (_useMultigrid && _formulation->splitFields()) {
+    // Field split subsolvers require operators (Jacobian from
+    // previous reform) before SNES sets them.
+    assert(jacobian);
+    PetscKSP ksp = 0;
+    err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, jacobian->matrix(), _jacobianPC); PYLITH_CHECK_ERROR(err);
+    _setupMultigridFieldSplit(ksp, *solution);
+  } // if
+
   err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
+  PetscInt numIterations = 0;
+  err = SNESGetLinearSolveIterations(_snes, &numIterations); PYLITH_CHECK_ERROR(err);
+  _numIterations = numIterations;
+  SNESConvergedReason reason = SNES_CONVERGED_ITERATING;
+  err = SNESGetConvergedReason(_snes, &reason); PYLITH_CHECK_ERROR(err);
+  _converged = reason > 0;
   
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
@@ -584,6 +614,15 @@ pylith::problems::SolverNonlinear::initialGuess(PetscSNES snes,
 
   PetscErrorCode err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
 
+  // Constrained DOF kept in the global system start (and, with zero
+  // residual and identity rows, stay) at their prescribed values.
+  Formulation* formulation = (Formulation*) lsctx;assert(formulation);
+  const topology::SolutionFields& fields = formulation->fields();
+  const topology::Field& solution = fields.solution();
+  if (solution.keepsConstrainedDOF()) {
+    solution.copyConstrainedLocalToGlobal(initialGuessVec);
+  } // if
+
   PYLITH_METHOD_RETURN(0);
 } // initialGuess
 
@@ -25,11 +25,16 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/meshio/DataWriter.hh" // USES DataWriter
+#include "pylith/utils/array.hh" // USES int_array
 
 #include "journal/info.h" // USES journal::info_t
 
 #include <cstring> // USES strlen()
 #include <strings.h> // USES strcasecmp()
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <set> // USES std::set
+#include <algorithm> // USES std::max_element()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
@@ -54,8 +59,26 @@ pylith::topology::Distributor::distribute(topology::Mesh* const newMesh,
 					  const char* partitionerName)
 { // distribute
   PYLITH_METHOD_BEGIN;
+
+  distributeWithFaults(newMesh, origMesh, partitionerName, NULL, 0);
+
+  PYLITH_METHOD_END;
+} // distribute
+
+// ----------------------------------------------------------------------
+// Distribute mesh among processors, keeping both cells adjacent to
+// each fault face on the same processor.
+void
+pylith::topology::Distributor::distributeWithFaults(topology::Mesh* const newMesh,
+						    const topology::Mesh& origMesh,
+						    const char* partitionerName,
+						    const char* const* faultLabels,
+						    const int numFaultLabels)
+{ // distributeWithFaults
+  PYLITH_METHOD_BEGIN;
   
   assert(newMesh);
+  assert(!numFaultLabels || faultLabels);
   newMesh->coordsys(origMesh.coordsys());
 
   journal::info_t info("mesh_distributor");
@@ -71,17 +94,38 @@ pylith::topology::Distributor::distribute(topology::Mesh* const newMesh,
   err = DMPlexGetPartitioner(dmOrig, &partitioner);PYLITH_CHECK_ERROR(err);
   err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
 
+  if (numFaultLabels > 0) {
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_size(origMesh.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+    if (0 == commRank) {
+      info << journal::at(__HERE__)
+	   << "Adjusting partition to keep both cells adjacent to each fault face on the same processor." << journal::endl;
+    } // if
+    int_array cellRank;
+    _partition(&cellRank, origMesh);
+    _keepFaultsIntact(&cellRank, commSize, origMesh, faultLabels, numFaultLabels);
+    _setPartition(origMesh, cellRank, commSize);
+  } // if
+
   if (0 == commRank) {
     info << journal::at(__HERE__)
 	 << "Distributing partitioned mesh." << journal::endl;
   } // if
 
   PetscDM dmNew = NULL;
-  err = DMPlexDistribute(origMesh.dmMesh(), 0, NULL, &dmNew);PYLITH_CHECK_ERROR(err);
+  err = DMPlexDistribute(dmOrig, 0, NULL, &dmNew);PYLITH_CHECK_ERROR(err);
+  if (!dmNew) { // Running on a single processor.
+    err = PetscObjectReference((PetscObject) dmOrig);PYLITH_CHECK_ERROR(err);
+    dmNew = dmOrig;
+  } // if
   newMesh->dmMesh(dmNew);
 
+  if (numFaultLabels > 0) {
+    _checkFaultsLocal(*newMesh, faultLabels, numFaultLabels);
+  } // if
+
   PYLITH_METHOD_END;
-} // distribute
+} // distributeWithFaults
 
 // ----------------------------------------------------------------------
 // Write partitioning info for distributed mesh.
@@ -136,4 +180,339 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
   PYLITH_METHOD_END;
 } // write
 
+// ----------------------------------------------------------------------
+// Partition cells using the mesh partitioner.
+void
+pylith::topology::Distributor::_partition(int_array* cellRank,
+					  const topology::Mesh& mesh)
+{ // _partition
+  PYLITH_METHOD_BEGIN;
+
+  assert(cellRank);
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  PetscPartitioner partitioner = NULL;
+  PetscSection partSection = NULL;
+  PetscIS partitionIS = NULL;
+  const PetscInt* partitionPoints = NULL;
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetPartitioner(dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionCreate(mesh.comm(), &partSection);PYLITH_CHECK_ERROR(err);
+  err = PetscPartitionerPartition(partitioner, dmMesh, partSection, &partitionIS);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetChart(partSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  const PetscInt numCells = cellsStratum.size();
+
+  cellRank->resize(numCells);
+  *cellRank = 0;
+  err = ISGetIndices(partitionIS, &partitionPoints);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iRank=pStart; iRank < pEnd; ++iRank) {
+    PetscInt numPoints = 0, offset = 0;
+    err = PetscSectionGetDof(partSection, iRank, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(partSection, iRank, &offset);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=offset; i < offset+numPoints; ++i) {
+      const PetscInt cell = partitionPoints[i];
+      assert(cell >= cStart && cell < cEnd);
+      (*cellRank)[cell-cStart] = iRank;
+    } // for
+  } // for
+  err = ISRestoreIndices(partitionIS, &partitionPoints);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&partitionIS);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionDestroy(&partSection);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _partition
+
+// ----------------------------------------------------------------------
+// Adjust partition so that the two cells adjacent to each fault face
+// are assigned to the same processor.
+void
+pylith::topology::Distributor::_keepFaultsIntact(int_array* cellRank,
+						 const int numProcs,
+						 const topology::Mesh& mesh,
+						 const char* const* faultLabels,
+						 const int numFaultLabels)
+{ // _keepFaultsIntact
+  PYLITH_METHOD_BEGIN;
+
+  assert(cellRank);
+  assert(numProcs > 0);
+
+  journal::info_t info("mesh_distributor");
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  assert(size_t(numCells) == cellRank->size());
+
+  // Group cells connected through fault faces (union-find). Cells that
+  // only share a fault vertex or edge are not grouped, so a fault is
+  // spread over as many processors as the partitioner chooses.
+  std::vector<PetscInt> group(numCells);
+  std::vector<bool> isFaultCell(numCells, false);
+  for (PetscInt i=0; i < numCells; ++i) {
+    group[i] = i;
+  } // for
+  for (int iLabel=0; iLabel < numFaultLabels; ++iLabel) {
+    std::vector<PetscInt> faces;
+    _faultFaces(&faces, dmMesh, faultLabels[iLabel]);
+    const size_t numFaces = faces.size();
+    for (size_t iFace=0; iFace < numFaces; ++iFace) {
+      const PetscInt* support = NULL;
+      PetscInt supportSize = 0;
+      err = DMPlexGetSupportSize(dmMesh, faces[iFace], &supportSize);PYLITH_CHECK_ERROR(err);
+      err = DMPlexGetSupport(dmMesh, faces[iFace], &support);PYLITH_CHECK_ERROR(err);
+      PetscInt root = -1;
+      for (PetscInt s=0; s < supportSize; ++s) {
+	PetscInt c = support[s] - cStart;
+	assert(c >= 0 && c < numCells);
+	isFaultCell[c] = true;
+	while (group[c] != c) {
+	  group[c] = group[group[c]];
+	  c = group[c];
+	} // while
+	if (root < 0) {
+	  root = c;
+	} else if (c != root) {
+	  group[c] = root;
+	} // if/else
+      } // for
+    } // for
+  } // for
+
+  // Assign each group to the processor holding most of its cells.
+  std::map<PetscInt, std::vector<PetscInt> > groupCounts;
+  for (PetscInt c=0; c < numCells; ++c) {
+    if (!isFaultCell[c]) {
+      continue;
+    } // if
+    PetscInt root = c;
+    while (group[root] != root) {
+      root = group[root];
+    } // while
+    group[c] = root;
+    std::vector<PetscInt>& counts = groupCounts[root];
+    if (counts.empty()) {
+      counts.resize(numProcs, 0);
+    } // if
+    assert((*cellRank)[c] >= 0 && (*cellRank)[c] < numProcs);
+    ++counts[(*cellRank)[c]];
+  } // for
+  std::map<PetscInt, PetscInt> groupRank;
+  for (std::map<PetscInt, std::vector<PetscInt> >::const_iterator g_iter=groupCounts.begin(); g_iter != groupCounts.end(); ++g_iter) {
+    const std::vector<PetscInt>& counts = g_iter->second;
+    groupRank[g_iter->first] = std::max_element(counts.begin(), counts.end()) - counts.begin();
+  } // for
+  PetscInt numMoved = 0;
+  for (PetscInt c=0; c < numCells; ++c) {
+    if (isFaultCell[c]) {
+      const PetscInt iRank = groupRank[group[c]];
+      numMoved += (iRank != (*cellRank)[c]) ? 1 : 0;
+      (*cellRank)[c] = iRank;
+    } // if
+  } // for
+
+  if (0 == mesh.commRank()) {
+    info << journal::at(__HERE__)
+	 << "Moved " << numMoved << " cells to keep " << groupRank.size()
+	 << " groups of cells adjacent to fault faces on a single processor." << journal::endl;
+  } // if
+
+  PYLITH_METHOD_END;
+} // _keepFaultsIntact
+
+// ----------------------------------------------------------------------
+// Use partition with given processor for each cell when distributing
+// the mesh.
+void
+pylith::topology::Distributor::_setPartition(const topology::Mesh& mesh,
+					     const int_array& cellRank,
+					     const int numProcs)
+{ // _setPartition
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  assert(size_t(numCells) == cellRank.size());
+
+  // Sort cells by processor.
+  std::vector<PetscInt> sizes(numProcs, 0);
+  for (PetscInt c=0; c < numCells; ++c) {
+    ++sizes[cellRank[c]];
+  } // for
+  std::vector<PetscInt> offsets(numProcs, 0);
+  for (PetscInt iRank=1; iRank < numProcs; ++iRank) {
+    offsets[iRank] = offsets[iRank-1] + sizes[iRank-1];
+  } // for
+  std::vector<PetscInt> cells(numCells > 0 ? numCells : 1);
+  for (PetscInt c=0; c < numCells; ++c) {
+    cells[offsets[cellRank[c]]++] = cStart + c;
+  } // for
+
+  PetscPartitioner partitioner = NULL;
+  err = DMPlexGetPartitioner(dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+  err = PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL);PYLITH_CHECK_ERROR(err);
+  err = PetscPartitionerShellSetPartition(partitioner, numProcs, &sizes[0], &cells[0]);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setPartition
+
+// ----------------------------------------------------------------------
+// Verify that each processor has both cells adjacent to each of its
+// fault faces.
+void
+pylith::topology::Distributor::_checkFaultsLocal(const topology::Mesh& mesh,
+						 const char* const* faultLabels,
+						 const int numFaultLabels)
+{ // _checkFaultsLocal
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  PetscSF sfPoint = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotes = NULL;
+  err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &leaves, &remotes);PYLITH_CHECK_ERROR(err);
+
+  // Points shared with another processor are either leaves or roots
+  // with a nonzero degree.
+  std::vector<bool> isShared(numRoots > 0 ? numRoots : 0, false);
+  if (numRoots >= 0) {
+    const PetscInt* degree = NULL;
+    err = PetscSFComputeDegreeBegin(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+    err = PetscSFComputeDegreeEnd(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < numLeaves; ++i) {
+      const PetscInt point = leaves ? leaves[i] : i;
+      assert(point < numRoots);
+      isShared[point] = true;
+    } // for
+    for (PetscInt point=0; point < numRoots; ++point) {
+      if (degree[point] > 0) {
+	isShared[point] = true;
+      } // if
+    } // for
+  } // if
+
+  PetscInt numSplit = 0;
+  for (int iLabel=0; iLabel < numFaultLabels; ++iLabel) {
+    std::vector<PetscInt> faces;
+    _faultFaces(&faces, dmMesh, faultLabels[iLabel]);
+    const size_t numFaces = faces.size();
+    for (size_t iFace=0; iFace < numFaces; ++iFace) {
+      const PetscInt face = faces[iFace];
+      PetscInt supportSize = 0;
+      err = DMPlexGetSupportSize(dmMesh, face, &supportSize);PYLITH_CHECK_ERROR(err);
+      if (supportSize != 2 || (face < numRoots && isShared[face])) {
+	++numSplit;
+      } // if
+    } // for
+  } // for
+
+  PetscInt numSplitGlobal = 0;
+  err = MPI_Allreduce(&numSplit, &numSplitGlobal, 1, MPIU_INT, MPI_SUM, mesh.comm());PYLITH_CHECK_ERROR(err);
+  if (numSplitGlobal > 0) {
+    std::ostringstream msg;
+    msg << "Could not keep both cells adjacent to each fault face on a single processor. "
+	<< numSplitGlobal << " fault faces are shared among processors or are missing a cell after distributing the mesh.";
+    throw std::logic_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // _checkFaultsLocal
+
+// ----------------------------------------------------------------------
+// Get faces with all vertices in group of fault vertices.
+void
+pylith::topology::Distributor::_faultFaces(std::vector<PetscInt>* faces,
+					   PetscDM dmMesh,
+					   const char* faultLabel)
+{ // _faultFaces
+  PYLITH_METHOD_BEGIN;
+
+  assert(faces);
+  assert(dmMesh);
+  assert(faultLabel);
+
+  faces->clear();
+
+  PetscErrorCode err = 0;
+  PetscDMLabel label = NULL;
+  err = DMGetLabel(dmMesh, faultLabel, &label);PYLITH_CHECK_ERROR(err);
+  if (!label) { // Missing groups are reported when adjusting topology.
+    PYLITH_METHOD_END;
+  } // if
+  PetscIS pointsIS = NULL;
+  err = DMLabelGetStratumIS(label, 1, &pointsIS);PYLITH_CHECK_ERROR(err);
+  if (!pointsIS) {
+    PYLITH_METHOD_END;
+  } // if
+
+  topology::Stratum facesStratum(dmMesh, topology::Stratum::HEIGHT, 1);
+  const PetscInt fStart = facesStratum.begin();
+  const PetscInt fEnd = facesStratum.end();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Faces in the star of a fault vertex with all vertices on the fault,
+  // consistent with the faces selected by DMPlexCreateSubmesh().
+  std::set<PetscInt> faultFaces;
+  PetscInt numPoints = 0;
+  const PetscInt* points = NULL;
+  err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PetscInt vertex = points[iPoint];
+    if (vertex < vStart || vertex >= vEnd) {
+      continue;
+    } // if
+    PetscInt* star = NULL;
+    PetscInt starSize = 0;
+    err = DMPlexGetTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+    for (PetscInt s=0; s < starSize*2; s += 2) {
+      const PetscInt face = star[s];
+      if (face < fStart || face >= fEnd || faultFaces.count(face)) {
+	continue;
+      } // if
+      PetscInt* closure = NULL;
+      PetscInt closureSize = 0;
+      bool onFault = true;
+      err = DMPlexGetTransitiveClosure(dmMesh, face, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt c=0; c < closureSize*2 && onFault; c += 2) {
+	if (closure[c] >= vStart && closure[c] < vEnd) {
+	  PetscInt value = 0;
+	  err = DMLabelGetValue(label, closure[c], &value);PYLITH_CHECK_ERROR(err);
+	  onFault = (1 == value);
+	} // if
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dmMesh, face, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      if (onFault) {
+	faultFaces.insert(face);
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+
+  faces->assign(faultFaces.begin(), faultFaces.end());
+
+  PYLITH_METHOD_END;
+} // _faultFaces
+
 // End of file 
@@ -29,6 +29,10 @@
 #include "topologyfwd.hh" // forward declarations
 
 #include "pylith/meshio/meshiofwd.hh" // USES DataWriter<Mesh>
+#include "pylith/utils/arrayfwd.hh" // USES int_array
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+#include <vector> // USES std::vector
 
 // Distributor ----------------------------------------------------------
 /// Distribute mesh among processors.
@@ -56,6 +60,26 @@ public :
 		  const topology::Mesh& origMesh,
 		  const char* partitionerName);
 
+  /** Distribute mesh among processors, keeping both cells adjacent
+   * to each fault face on the same processor.
+   *
+   * Fault faces are not shared among processors in the distributed
+   * mesh, so each processor can insert the cohesive cells for its
+   * fault faces. Fault vertices and edges may still be shared.
+   *
+   * @param newMesh Distributed mesh (result).
+   * @param origMesh Mesh to distribute.
+   * @param partitionerName Name of PETSc partitioner to use in distributing mesh.
+   * @param faultLabels Array of names of groups of fault vertices.
+   * @param numFaultLabels Number of fault groups.
+   */
+  static
+  void distributeWithFaults(topology::Mesh* const newMesh,
+			    const topology::Mesh& origMesh,
+			    const char* partitionerName,
+			    const char* const* faultLabels,
+			    const int numFaultLabels);
+
   /** Write partitioning info for distributed mesh.
    *
    * @param writer Data writer for partition information.
@@ -66,6 +90,73 @@ public :
   void write(meshio::DataWriter* const writer,
 	     const topology::Mesh& mesh);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Partition cells using the mesh partitioner.
+   *
+   * @param cellRank Processor for each cell (result).
+   * @param mesh Mesh to distribute.
+   */
+  static
+  void _partition(int_array* cellRank,
+		  const topology::Mesh& mesh);
+
+  /** Adjust partition so that the two cells adjacent to each fault
+   * face are assigned to the same processor.
+   *
+   * Cells connected through fault faces are grouped and each group is
+   * assigned to the processor that holds most of its cells in the
+   * original partition. Other cells are not moved.
+   *
+   * @param cellRank Processor for each cell.
+   * @param numProcs Number of processors.
+   * @param mesh Mesh to distribute.
+   * @param faultLabels Array of names of groups of fault vertices.
+   * @param numFaultLabels Number of fault groups.
+   */
+  static
+  void _keepFaultsIntact(int_array* cellRank,
+			 const int numProcs,
+			 const topology::Mesh& mesh,
+			 const char* const* faultLabels,
+			 const int numFaultLabels);
+
+  /** Use partition with given processor for each cell when
+   * distributing the mesh.
+   *
+   * @param mesh Mesh to distribute.
+   * @param cellRank Processor for each cell.
+   * @param numProcs Number of processors.
+   */
+  static
+  void _setPartition(const topology::Mesh& mesh,
+		     const int_array& cellRank,
+		     const int numProcs);
+
+  /** Verify that each processor has both cells adjacent to each of
+   * its fault faces.
+   *
+   * @param mesh Distributed mesh.
+   * @param faultLabels Array of names of groups of fault vertices.
+   * @param numFaultLabels Number of fault groups.
+   */
+  static
+  void _checkFaultsLocal(const topology::Mesh& mesh,
+			 const char* const* faultLabels,
+			 const int numFaultLabels);
+
+  /** Get faces with all vertices in group of fault vertices.
+   *
+   * @param faces Fault faces (result).
+   * @param dmMesh PETSc DM for mesh.
+   * @param faultLabel Name of group of fault vertices.
+   */
+  static
+  void _faultFaces(std::vector<PetscInt>* faces,
+		   PetscDM dmMesh,
+		   const char* faultLabel);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -0,0 +1,614 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ElementRestriction.hh" // implementation of class methods
+
+#include "Stratum.hh" // USES Stratum
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::lower_bound()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    namespace _ElementRestriction {
+
+      /** Append indices for dof at point in closure order.
+       *
+       * Matches the ordering used by DMPlexVecGetClosure(): values at
+       * points with negative orientation are reversed in blocks of
+       * numComponents. Constrained dof have negative global indices,
+       * -(index+1). If the global numbering excludes constrained dof,
+       * unconstrained dof are numbered consecutively from the global
+       * offset, matching DMPlexMatSetClosure().
+       *
+       * @param indices Indices into local vector.
+       * @param scatterIndices Indices for assembly (-1 for constrained dof).
+       * @param globalIndices Global indices (NULL if not needed).
+       * @param offset Offset of point in local vector.
+       * @param globalOffset Global offset of dof at point (nonnegative).
+       * @param globalHasConstrained True if global numbering includes constrained dof.
+       * @param dof Number of dof at point.
+       * @param numComponents Number of components per block.
+       * @param orientation Orientation of point in closure.
+       * @param cdof Number of constrained dof at point.
+       * @param cind Indices of constrained dof at point.
+       */
+      void
+      appendPoint(std::vector<PylithInt>* indices,
+		  std::vector<PylithInt>* scatterIndices,
+		  std::vector<PylithInt>* globalIndices,
+		  const PetscInt offset,
+		  const PetscInt globalOffset,
+		  const bool globalHasConstrained,
+		  const PetscInt dof,
+		  const PetscInt numComponents,
+		  const PetscInt orientation,
+		  const PetscInt cdof,
+		  const PetscInt* cind)
+      { // appendPoint
+	assert(indices);
+	assert(scatterIndices);
+
+	const PetscInt blockSize = (numComponents > 0) ? numComponents : 1;
+	const PetscInt numBlocks = dof / blockSize;
+	for (PetscInt b=0; b < numBlocks; ++b) {
+	  const PetscInt block = (orientation >= 0) ? b : numBlocks-1-b;
+	  for (PetscInt c=0; c < blockSize; ++c) {
+	    const PetscInt d = block*blockSize + c;
+	    bool isConstrained = false;
+	    PetscInt numConstrainedBefore = 0;
+	    for (PetscInt i=0; i < cdof; ++i) {
+	      if (cind[i] == d) {
+		isConstrained = true;
+	      } else if (cind[i] < d) {
+		++numConstrainedBefore;
+	      } // if/else
+	    } // for
+	    indices->push_back(offset + d);
+	    scatterIndices->push_back(isConstrained ? -1 : offset + d);
+	    if (globalIndices) {
+	      const PetscInt globalIndex = globalHasConstrained ? globalOffset + d : globalOffset + d - numConstrainedBefore;
+	      globalIndices->push_back(isConstrained ? -(globalOffset + d + 1) : globalIndex);
+	    } // if
+	  } // for
+	} // for
+      } // appendPoint
+      /** Get global offset of point.
+       *
+       * @param globalOffset Global offset (nonnegative, owner's offset for
+       *   points owned by other processes).
+       * @param hasConstrained True if global section includes constrained dof.
+       * @param section Local section.
+       * @param globalSection Global section.
+       * @param point Point in mesh.
+       */
+      void
+      globalPointOffset(PetscInt* globalOffset,
+			bool* hasConstrained,
+			const PetscSection section,
+			const PetscSection globalSection,
+			const PetscInt point)
+      { // globalPointOffset
+	assert(globalOffset);
+	assert(hasConstrained);
+
+	PetscErrorCode err;
+	PetscInt goff = 0, gcdof = 0, cdof = 0;
+	err = PetscSectionGetOffset(globalSection, point, &goff);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetConstraintDof(section, point, &cdof);PYLITH_CHECK_ERROR(err);
+	// Global sections that exclude constrained dof carry the
+	// constraint counts; those that include them do not.
+	err = PetscSectionGetConstraintDof(globalSection, point, &gcdof);PYLITH_CHECK_ERROR(err);
+	*globalOffset = (goff < 0) ? -(goff+1) : goff;
+	*hasConstrained = cdof > 0 && 0 == gcdof;
+      } // globalPointOffset
+
+      /** Get local blocks of AIJ matrix.
+       *
+       * @param matDiag Diagonal block (matrix itself for MATSEQAIJ).
+       * @param matOffDiag Off-diagonal block (NULL for MATSEQAIJ).
+       * @param colmap Global columns of off-diagonal block (NULL for MATSEQAIJ).
+       * @param mat PETSc matrix.
+       * @returns True if matrix is MATSEQAIJ or MATMPIAIJ, false otherwise.
+       */
+      bool
+      getAIJBlocks(PetscMat* matDiag,
+		   PetscMat* matOffDiag,
+		   const PetscInt** colmap,
+		   const PetscMat mat)
+      { // getAIJBlocks
+	assert(matDiag);
+	assert(matOffDiag);
+	assert(colmap);
+
+	PetscErrorCode err;
+	PetscBool isSeqAIJ = PETSC_FALSE, isMPIAIJ = PETSC_FALSE;
+	err = PetscObjectTypeCompare((PetscObject) mat, MATSEQAIJ, &isSeqAIJ);PYLITH_CHECK_ERROR(err);
+	err = PetscObjectTypeCompare((PetscObject) mat, MATMPIAIJ, &isMPIAIJ);PYLITH_CHECK_ERROR(err);
+	if (isSeqAIJ) {
+	  *matDiag = mat;
+	  *matOffDiag = NULL;
+	  *colmap = NULL;
+	} else if (isMPIAIJ) {
+	  err = MatMPIAIJGetSeqAIJ(mat, matDiag, matOffDiag, colmap);PYLITH_CHECK_ERROR(err);
+	} else {
+	  return false;
+	} // if/else
+
+	return true;
+      } // getAIJBlocks
+
+      /** Find position of column in row of compressed sparse row matrix.
+       *
+       * @param ia Row offsets.
+       * @param ja Column indices (sorted within each row).
+       * @param row Local row.
+       * @param col Local column.
+       * @returns Position in value array or -1 if column is not in row.
+       */
+      PetscInt
+      findEntry(const PetscInt* ia,
+		const PetscInt* ja,
+		const PetscInt row,
+		const PetscInt col)
+      { // findEntry
+	const PetscInt* begin = &ja[ia[row]];
+	const PetscInt* end = &ja[ia[row+1]];
+	const PetscInt* entry = std::lower_bound(begin, end, col);
+	return (entry != end && *entry == col) ? PetscInt(entry - ja) : -1;
+      } // findEntry
+
+    } // _ElementRestriction
+  } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::topology::ElementRestriction::ElementRestriction(void) :
+  _section(NULL),
+  _numCells(0),
+  _closureSize(0),
+  _matrix(NULL),
+  _matrixNonzeroState(0),
+  _matrixRowStart(0),
+  _matrixRowEnd(0),
+  _matrixDiag(NULL),
+  _matrixOffDiag(NULL),
+  _valuesDiag(NULL),
+  _valuesOffDiag(NULL)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::topology::ElementRestriction::~ElementRestriction(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::ElementRestriction::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  assert(!_valuesDiag && !_valuesOffDiag);
+
+  PetscErrorCode err = PetscSectionDestroy(&_section);PYLITH_CHECK_ERROR(err);
+  _indices.resize(0);
+  _scatterIndices.resize(0);
+  _globalIndices.resize(0);
+  _numCells = 0;
+  _closureSize = 0;
+
+  err = MatDestroy(&_matrix);PYLITH_CHECK_ERROR(err);
+  _matrixNonzeroState = 0;
+  _matrixRowStart = 0;
+  _matrixRowEnd = 0;
+  _matrixPositions.resize(0);
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Build restriction for a list of cells.
+void
+pylith::topology::ElementRestriction::initialize(const PetscDM dm,
+						 const PetscSection section,
+						 const PetscInt* cells,
+						 const PetscInt numCells,
+						 const PetscSection globalSection)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  assert(!numCells || cells);
+  _build(dm, section, cells, 0, numCells, globalSection);
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Build restriction for cells in a stratum.
+void
+pylith::topology::ElementRestriction::initialize(const PetscDM dm,
+						 const PetscSection section,
+						 const Stratum& cells,
+						 const PetscSection globalSection)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  _build(dm, section, NULL, cells.begin(), cells.size(), globalSection);
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Prepare to add cell matrices directly into value arrays of matrix.
+void
+pylith::topology::ElementRestriction::beginMatrix(PetscMat mat)
+{ // beginMatrix
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+  assert(!_valuesDiag && !_valuesOffDiag);
+
+  if (!hasGlobalIndices()) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Search again only for a new matrix or a new nonzero pattern,
+  // whether or not the previous search found all of the positions.
+  PetscErrorCode err;
+  bool isCurrent = false;
+  if (mat == _matrix) {
+    PetscObjectState nonzeroState = 0;
+    err = MatGetNonzeroState(mat, &nonzeroState);PYLITH_CHECK_ERROR(err);
+    isCurrent = nonzeroState == _matrixNonzeroState;
+  } // if
+  if (!isCurrent) {
+    _buildMatrixPositions(mat);
+  } // if
+  if (!hasMatrixPositions(mat)) {
+    PYLITH_METHOD_END;
+  } // if
+
+  const PetscInt* colmap = NULL;
+  if (!_ElementRestriction::getAIJBlocks(&_matrixDiag, &_matrixOffDiag, &colmap, mat)) {
+    throw std::logic_error("Found positions of cell matrix entries for matrix that is not an AIJ matrix.");
+  } // if
+  err = MatSeqAIJGetArray(_matrixDiag, &_valuesDiag);PYLITH_CHECK_ERROR(err);
+  if (_matrixOffDiag) {
+    err = MatSeqAIJGetArray(_matrixOffDiag, &_valuesOffDiag);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_END;
+} // beginMatrix
+
+// ----------------------------------------------------------------------
+// Restore value arrays obtained in beginMatrix().
+void
+pylith::topology::ElementRestriction::endMatrix(PetscMat mat)
+{ // endMatrix
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+
+  PetscErrorCode err;
+  if (_valuesDiag) {
+    assert(mat == _matrix);
+    err = MatSeqAIJRestoreArray(_matrixDiag, &_valuesDiag);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (_valuesOffDiag) {
+    err = MatSeqAIJRestoreArray(_matrixOffDiag, &_valuesOffDiag);PYLITH_CHECK_ERROR(err);
+  } // if
+  _valuesDiag = NULL;
+  _valuesOffDiag = NULL;
+  _matrixDiag = NULL;
+  _matrixOffDiag = NULL;
+
+  PYLITH_METHOD_END;
+} // endMatrix
+
+// ----------------------------------------------------------------------
+// Add cell matrix into global matrix using cached global indices.
+void
+pylith::topology::ElementRestriction::addMatrix(PetscMat mat,
+						const PetscScalar* valuesCell,
+						const PetscInt iCell)
+{ // addMatrix
+  assert(mat);
+  assert(valuesCell);
+
+  PetscErrorCode err;
+  const PylithInt* indicesCell = globalIndices(iCell);
+  if (!_valuesDiag || mat != _matrix) {
+    err = MatSetValues(mat, _closureSize, indicesCell, _closureSize, indicesCell, valuesCell, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    return;
+  } // if
+
+  const PylithInt* positionsCell = &_matrixPositions[iCell*_closureSize*_closureSize];
+  for (PetscInt i=0; i < _closureSize; ++i) {
+    const PylithInt row = indicesCell[i];
+    if (row < 0) {
+      continue;
+    } // if
+    const PetscScalar* valuesRow = &valuesCell[i*_closureSize];
+    if (row < _matrixRowStart || row >= _matrixRowEnd) {
+      // Row owned by another process.
+      err = MatSetValues(mat, 1, &indicesCell[i], _closureSize, indicesCell, valuesRow, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+      continue;
+    } // if
+    const PylithInt* positionsRow = &positionsCell[i*_closureSize];
+    for (PetscInt j=0; j < _closureSize; ++j) {
+      const PylithInt position = positionsRow[j];
+      if (position >= 0) {
+	_valuesDiag[position] += valuesRow[j];
+      } else if (position <= -2) {
+	assert(_valuesOffDiag);
+	_valuesOffDiag[-(position+2)] += valuesRow[j];
+      } // if/else
+    } // for
+  } // for
+} // addMatrix
+
+// ----------------------------------------------------------------------
+// Find positions of cell matrix entries in value arrays of matrix.
+void
+pylith::topology::ElementRestriction::_buildMatrixPositions(PetscMat mat)
+{ // _buildMatrixPositions
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+  assert(hasGlobalIndices());
+
+  PetscErrorCode err = MatDestroy(&_matrix);PYLITH_CHECK_ERROR(err);
+  _matrixPositions.resize(0);
+
+  PetscBool isAssembled = PETSC_FALSE;
+  err = MatAssembled(mat, &isAssembled);PYLITH_CHECK_ERROR(err);
+  if (!isAssembled) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Remember the matrix and its nonzero state even if the search
+  // fails, so beginMatrix() does not repeat it until the nonzero
+  // pattern changes (e.g., a point-block preconditioning matrix never
+  // holds the full cell matrices).
+  err = MatGetNonzeroState(mat, &_matrixNonzeroState);PYLITH_CHECK_ERROR(err);
+  _matrix = mat;
+  err = PetscObjectReference((PetscObject) _matrix);PYLITH_CHECK_ERROR(err);
+
+  PetscMat matDiag = NULL, matOffDiag = NULL;
+  const PetscInt* colmap = NULL;
+  if (!_ElementRestriction::getAIJBlocks(&matDiag, &matOffDiag, &colmap, mat)) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscInt rowStart = 0, rowEnd = 0, colStart = 0, colEnd = 0;
+  err = MatGetOwnershipRange(mat, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+  err = MatGetOwnershipRangeColumn(mat, &colStart, &colEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscInt numRows = 0;
+  const PetscInt* iaDiag = NULL;
+  const PetscInt* jaDiag = NULL;
+  const PetscInt* iaOffDiag = NULL;
+  const PetscInt* jaOffDiag = NULL;
+  PetscInt numColsOffDiag = 0;
+  PetscBool done = PETSC_FALSE;
+  err = MatGetRowIJ(matDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaDiag, &jaDiag, &done);PYLITH_CHECK_ERROR(err);
+  if (!done) {
+    PYLITH_METHOD_END;
+  } // if
+  if (matOffDiag) {
+    err = MatGetRowIJ(matOffDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaOffDiag, &jaOffDiag, &done);PYLITH_CHECK_ERROR(err);
+    if (!done) {
+      err = MatRestoreRowIJ(matDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaDiag, &jaDiag, &done);PYLITH_CHECK_ERROR(err);
+      PYLITH_METHOD_END;
+    } // if
+    err = MatGetSize(matOffDiag, NULL, &numColsOffDiag);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Position codes: >= 0 for diagonal block, <= -2 for off-diagonal
+  // block (-(position+2)), and -1 for entries that are not added
+  // directly (constrained dof or rows owned by other processes).
+  const size_t matrixSize = _closureSize*_closureSize;
+  int_array positions(_numCells*matrixSize);
+  bool isComplete = true;
+  for (PetscInt iCell=0; iCell < _numCells && isComplete; ++iCell) {
+    const PylithInt* indicesCell = globalIndices(iCell);
+    PylithInt* positionsCell = &positions[iCell*matrixSize];
+    for (PetscInt i=0; i < _closureSize && isComplete; ++i) {
+      const PylithInt row = indicesCell[i];
+      const bool isLocalRow = row >= rowStart && row < rowEnd;
+      for (PetscInt j=0; j < _closureSize; ++j) {
+	const PylithInt col = indicesCell[j];
+	PetscInt position = -1;
+	if (isLocalRow && col >= 0) {
+	  if (col >= colStart && col < colEnd) {
+	    position = _ElementRestriction::findEntry(iaDiag, jaDiag, row-rowStart, col-colStart);
+	    isComplete = position >= 0;
+	  } else {
+	    const PetscInt* colEntry = std::lower_bound(colmap, colmap+numColsOffDiag, col);
+	    isComplete = matOffDiag && colEntry != colmap+numColsOffDiag && *colEntry == col;
+	    if (isComplete) {
+	      const PetscInt offset = _ElementRestriction::findEntry(iaOffDiag, jaOffDiag, row-rowStart, PetscInt(colEntry - colmap));
+	      isComplete = offset >= 0;
+	      position = -(offset+2);
+	    } // if
+	  } // if/else
+	  if (!isComplete) {
+	    break;
+	  } // if
+	} // if
+	positionsCell[i*_closureSize+j] = position;
+      } // for
+    } // for
+  } // for
+
+  err = MatRestoreRowIJ(matDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaDiag, &jaDiag, &done);PYLITH_CHECK_ERROR(err);
+  if (matOffDiag) {
+    err = MatRestoreRowIJ(matOffDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaOffDiag, &jaOffDiag, &done);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Entries missing from the nonzero pattern must go through
+  // MatSetValues() so PETSc can allocate or reject them.
+  if (!isComplete) {
+    PYLITH_METHOD_END;
+  } // if
+
+  _matrixPositions.resize(positions.size());
+  _matrixPositions = positions;
+  _matrixRowStart = rowStart;
+  _matrixRowEnd = rowEnd;
+
+  PYLITH_METHOD_END;
+} // _buildMatrixPositions
+
+// ----------------------------------------------------------------------
+// Build index arrays.
+void
+pylith::topology::ElementRestriction::_build(const PetscDM dm,
+					     const PetscSection section,
+					     const PetscInt* cells,
+					     const PetscInt cStart,
+					     const PetscInt numCells,
+					     const PetscSection globalSection)
+{ // _build
+  PYLITH_METHOD_BEGIN;
+
+  assert(dm);
+  assert(section);
+
+  deallocate();
+
+  PetscErrorCode err;
+  PetscInt numFields = 0;
+  err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+
+  std::vector<PylithInt> indices;
+  std::vector<PylithInt> scatterIndices;
+  std::vector<PylithInt> globalIndices;
+  std::vector<PylithInt>* globalIndicesPtr = (globalSection) ? &globalIndices : NULL;
+  PetscInt closureSize = 0;
+  for (PetscInt c=0; c < numCells; ++c) {
+    const PetscInt cell = cells ? cells[c] : cStart + c;
+    const size_t cellStart = indices.size();
+
+    PetscInt numPoints = 0;
+    PetscInt* closure = NULL;
+    err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &numPoints, &closure);PYLITH_CHECK_ERROR(err);
+
+    if (numFields > 0) {
+      for (PetscInt f=0; f < numFields; ++f) {
+	PetscInt numComponents = 0;
+	err = PetscSectionGetFieldComponents(section, f, &numComponents);PYLITH_CHECK_ERROR(err);
+	for (PetscInt p=0; p < numPoints*2; p += 2) {
+	  const PetscInt point = closure[p];
+	  PetscInt dof = 0, offset = 0, cdof = 0;
+	  const PetscInt* cind = NULL;
+	  err = PetscSectionGetFieldDof(section, point, f, &dof);PYLITH_CHECK_ERROR(err);
+	  if (!dof) {
+	    continue;
+	  } // if
+	  err = PetscSectionGetFieldOffset(section, point, f, &offset);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetFieldConstraintDof(section, point, f, &cdof);PYLITH_CHECK_ERROR(err);
+	  if (cdof > 0) {
+	    err = PetscSectionGetFieldConstraintIndices(section, point, f, &cind);PYLITH_CHECK_ERROR(err);
+	  } // if
+	  PetscInt globalOffset = 0;
+	  bool globalHasConstrained = false;
+	  if (globalSection) {
+	    _ElementRestriction::globalPointOffset(&globalOffset, &globalHasConstrained, section, globalSection, point);
+	    // Global dof of preceding fields at point come first.
+	    for (PetscInt g=0; g < f; ++g) {
+	      PetscInt gdof = 0, gcdof = 0;
+	      err = PetscSectionGetFieldDof(section, point, g, &gdof);PYLITH_CHECK_ERROR(err);
+	      err = PetscSectionGetFieldConstraintDof(section, point, g, &gcdof);PYLITH_CHECK_ERROR(err);
+	      globalOffset += (globalHasConstrained) ? gdof : gdof - gcdof;
+	    } // for
+	  } // if
+	  _ElementRestriction::appendPoint(&indices, &scatterIndices, globalIndicesPtr, offset, globalOffset, globalHasConstrained, dof, numComponents, closure[p+1], cdof, cind);
+	} // for
+      } // for
+    } else {
+      for (PetscInt p=0; p < numPoints*2; p += 2) {
+	const PetscInt point = closure[p];
+	PetscInt dof = 0, offset = 0, cdof = 0;
+	const PetscInt* cind = NULL;
+	err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+	if (!dof) {
+	  continue;
+	} // if
+	err = PetscSectionGetOffset(section, point, &offset);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetConstraintDof(section, point, &cdof);PYLITH_CHECK_ERROR(err);
+	if (cdof > 0) {
+	  err = PetscSectionGetConstraintIndices(section, point, &cind);PYLITH_CHECK_ERROR(err);
+	} // if
+	PetscInt globalOffset = 0;
+	bool globalHasConstrained = false;
+	if (globalSection) {
+	  _ElementRestriction::globalPointOffset(&globalOffset, &globalHasConstrained, section, globalSection, point);
+	} // if
+	_ElementRestriction::appendPoint(&indices, &scatterIndices, globalIndicesPtr, offset, globalOffset, globalHasConstrained, dof, 1, closure[p+1], cdof, cind);
+      } // for
+    } // if/else
+
+    err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &numPoints, &closure);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt cellSize = indices.size() - cellStart;
+    if (!c) {
+      closureSize = cellSize;
+    } else if (cellSize != closureSize) {
+      std::ostringstream msg;
+      msg << "Closure size (" << cellSize << ") of cell " << cell
+	  << " does not match closure size (" << closureSize
+	  << ") of other cells in element restriction.";
+      throw std::runtime_error(msg.str());
+    } // if/else
+  } // for
+
+  _numCells = numCells;
+  _closureSize = closureSize;
+  _indices.resize(indices.size());
+  _scatterIndices.resize(scatterIndices.size());
+  for (size_t i=0; i < indices.size(); ++i) {
+    _indices[i] = indices[i];
+    _scatterIndices[i] = scatterIndices[i];
+  } // for
+  _globalIndices.resize(globalIndices.size());
+  for (size_t i=0; i < globalIndices.size(); ++i) {
+    _globalIndices[i] = globalIndices[i];
+  } // for
+
+  _section = section;
+  err = PetscObjectReference((PetscObject) _section);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _build
+
+
+// End of file
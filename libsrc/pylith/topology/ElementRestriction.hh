@@ -0,0 +1,299 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/ElementRestriction.hh
+ *
+ * @brief C++ precomputed map from cell closures to local vector indices.
+ */
+
+#if !defined(pylith_topology_elementrestriction_hh)
+#define pylith_topology_elementrestriction_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM, PetscSection, PetscMat
+#include "pylith/utils/array.hh" // HASA int_array
+
+// ElementRestriction ---------------------------------------------------
+/** @brief Precomputed map from cell closures to local vector indices.
+ *
+ * The restriction holds a flat (numCells x closureSize) array of
+ * indices into the local vector for a section over a set of cells,
+ * in the same order as DMPlexVecGetClosure(). Once built, restricting
+ * a field to a cell is an indexed load and assembling a cell vector
+ * is an indexed add, so the DMPlex closure is traversed only once per
+ * (cells, section) pair instead of once per cell, field, and pass.
+ *
+ * All cells must have the same closure size. Fields that share the
+ * section layout (e.g., the solution, its increment, and the
+ * residual) can share a restriction.
+ */
+class pylith::topology::ElementRestriction
+{ // ElementRestriction
+  friend class TestElementRestriction; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  ElementRestriction(void);
+
+  /// Destructor.
+  ~ElementRestriction(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Build restriction for a list of cells.
+   *
+   * @param dm PETSc DM for mesh.
+   * @param section Local section of field.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   * @param globalSection Global section of field used to build global
+   *   indices for assembling cell matrices (NULL if not needed).
+   */
+  void initialize(const PetscDM dm,
+		  const PetscSection section,
+		  const PetscInt* cells,
+		  const PetscInt numCells,
+		  const PetscSection globalSection =NULL);
+
+  /** Build restriction for cells in a stratum.
+   *
+   * @param dm PETSc DM for mesh.
+   * @param section Local section of field.
+   * @param cells Stratum of cells.
+   * @param globalSection Global section of field used to build global
+   *   indices for assembling cell matrices (NULL if not needed).
+   */
+  void initialize(const PetscDM dm,
+		  const PetscSection section,
+		  const Stratum& cells,
+		  const PetscSection globalSection =NULL);
+
+  /** Check whether restriction was built for section.
+   *
+   * @param section Local section of field.
+   * @returns True if restriction is current for section, false otherwise.
+   */
+  bool isCurrent(const PetscSection section) const;
+
+  /** Get number of cells.
+   *
+   * @returns Number of cells.
+   */
+  PetscInt numCells(void) const;
+
+  /** Get number of values in the closure of each cell.
+   *
+   * @returns Closure size.
+   */
+  PetscInt closureSize(void) const;
+
+  /** Get indices into local vector for closure of cell.
+   *
+   * @param iCell Index of cell in restriction (not the mesh point).
+   * @returns Array of closureSize() indices.
+   */
+  const PylithInt* indices(const PetscInt iCell) const;
+
+  /** Check whether global indices for assembling cell matrices exist.
+   *
+   * @returns True if restriction has global indices, false otherwise.
+   */
+  bool hasGlobalIndices(void) const;
+
+  /** Get global indices for closure of cell.
+   *
+   * Dof at points owned by other processes use the owner's global
+   * offset and constrained dof are negative, so MatSetValues() ignores
+   * them. If the global section excludes constrained dof, the indices
+   * match those computed by DMPlexMatSetClosure(); if it includes
+   * them (see Field::keepConstrainedDOF()), constrained dof keep their
+   * slots in the global numbering.
+   *
+   * @param iCell Index of cell in restriction (not the mesh point).
+   * @returns Array of closureSize() global indices.
+   */
+  const PylithInt* globalIndices(const PetscInt iCell) const;
+
+  /** Gather values for closure of cell from local array.
+   *
+   * @param valuesCell Array of closureSize() values for cell.
+   * @param localArray Array of values for local vector.
+   * @param iCell Index of cell in restriction (not the mesh point).
+   */
+  void gather(PetscScalar* valuesCell,
+	      const PetscScalar* localArray,
+	      const PetscInt iCell) const;
+
+  /** Gather values for closure of cell from local array.
+   *
+   * @param values Array of values for cell.
+   * @param localArray Array of values for local vector.
+   * @param iCell Index of cell in restriction (not the mesh point).
+   */
+  void gather(scalar_array* values,
+	      const PetscScalar* localArray,
+	      const PetscInt iCell) const;
+
+  /** Gather values for closures of a block of consecutive cells.
+   *
+   * @param valuesCells Array of numCellsBlock*closureSize() values.
+   * @param localArray Array of values for local vector.
+   * @param iCellStart Index of first cell in block.
+   * @param numCellsBlock Number of cells in block.
+   */
+  void gatherBlock(PetscScalar* valuesCells,
+		   const PetscScalar* localArray,
+		   const PetscInt iCellStart,
+		   const PetscInt numCellsBlock) const;
+
+  /** Add values for closure of cell into local array.
+   *
+   * Constrained degrees of freedom are skipped, consistent with
+   * DMPlexVecSetClosure() using ADD_VALUES.
+   *
+   * @param valuesCell Array of closureSize() values for cell.
+   * @param localArray Array of values for local vector.
+   * @param iCell Index of cell in restriction (not the mesh point).
+   */
+  void scatterAdd(const PetscScalar* valuesCell,
+		  PetscScalar* localArray,
+		  const PetscInt iCell) const;
+
+  /** Prepare to add cell matrices into an AIJ matrix by writing
+   * directly into the value arrays of its local blocks.
+   *
+   * The first call for a matrix (and any call after the nonzero
+   * pattern changes) finds the position of every cell matrix entry in
+   * the value arrays of the diagonal and off-diagonal blocks; later
+   * calls only get the value arrays. Matrices that are not assembled
+   * AIJ matrices or whose nonzero pattern lacks some cell matrix
+   * entries use MatSetValues() in addMatrix(); the search is not
+   * repeated for them until the nonzero pattern changes.
+   *
+   * @pre Restriction must have been built with global indices.
+   *
+   * @param mat PETSc matrix.
+   */
+  void beginMatrix(PetscMat mat);
+
+  /** Restore value arrays obtained in beginMatrix().
+   *
+   * The matrix must still be assembled afterwards to communicate
+   * values in rows owned by other processes.
+   *
+   * @param mat PETSc matrix.
+   */
+  void endMatrix(PetscMat mat);
+
+  /** Check whether positions of cell matrix entries in the value
+   * arrays of matrix have been found.
+   *
+   * @param mat PETSc matrix.
+   * @returns True if positions have been found, false otherwise.
+   */
+  bool hasMatrixPositions(const PetscMat mat) const;
+
+  /** Add cell matrix into global matrix using cached global indices.
+   *
+   * Between beginMatrix() and endMatrix(), values in locally owned
+   * rows are added directly into the value arrays of the matrix and
+   * only rows owned by other processes go through MatSetValues().
+   * Otherwise, equivalent to DMPlexMatSetClosure() with ADD_VALUES
+   * without traversing the closure or recomputing indices.
+   *
+   * @pre Restriction must have been built with global indices.
+   *
+   * @param mat PETSc matrix.
+   * @param valuesCell Cell matrix (closureSize() x closureSize(), row major).
+   * @param iCell Index of cell in restriction (not the mesh point).
+   */
+  void addMatrix(PetscMat mat,
+		 const PetscScalar* valuesCell,
+		 const PetscInt iCell);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Build index arrays.
+   *
+   * @param dm PETSc DM for mesh.
+   * @param section Local section of field.
+   * @param cells Array of cells (NULL for contiguous range).
+   * @param cStart First cell in range (used if cells is NULL).
+   * @param numCells Number of cells.
+   * @param globalSection Global section of field (NULL if global
+   *   indices are not needed).
+   */
+  void _build(const PetscDM dm,
+	      const PetscSection section,
+	      const PetscInt* cells,
+	      const PetscInt cStart,
+	      const PetscInt numCells,
+	      const PetscSection globalSection);
+
+  /** Find positions of cell matrix entries in value arrays of matrix.
+   *
+   * Leaves positions empty if the matrix is not an assembled AIJ
+   * matrix or an entry is missing from its nonzero pattern. The
+   * matrix and its nonzero state are recorded for any assembled
+   * matrix, so a failed search is not repeated.
+   *
+   * @param mat PETSc matrix.
+   */
+  void _buildMatrixPositions(PetscMat mat);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PetscSection _section; ///< Section restriction was built for (referenced).
+  int_array _indices; ///< Indices into local vector [numCells*closureSize].
+  int_array _scatterIndices; ///< Indices for assembly (-1 for constrained dof).
+  int_array _globalIndices; ///< Global indices for matrix assembly (empty if not built).
+  PetscInt _numCells; ///< Number of cells.
+  PetscInt _closureSize; ///< Number of values in closure of each cell.
+
+  PetscMat _matrix; ///< Matrix last searched for positions (referenced).
+  PetscObjectState _matrixNonzeroState; ///< Nonzero state of matrix when it was searched.
+  PetscInt _matrixRowStart; ///< First row of matrix owned by this process.
+  PetscInt _matrixRowEnd; ///< One past last row of matrix owned by this process.
+  int_array _matrixPositions; ///< Positions of cell matrix entries [numCells*closureSize*closureSize].
+  PetscMat _matrixDiag; ///< Diagonal block of matrix (between beginMatrix() and endMatrix()).
+  PetscMat _matrixOffDiag; ///< Off-diagonal block of matrix (between beginMatrix() and endMatrix()).
+  PetscScalar* _valuesDiag; ///< Value array of diagonal block.
+  PetscScalar* _valuesOffDiag; ///< Value array of off-diagonal block.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  ElementRestriction(const ElementRestriction&); ///< Not implemented
+  const ElementRestriction& operator=(const ElementRestriction&); ///< Not implemented
+
+}; // ElementRestriction
+
+#include "ElementRestriction.icc"
+
+#endif // pylith_topology_elementrestriction_hh
+
+
+// End of file
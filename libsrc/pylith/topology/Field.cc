@@ -23,6 +23,7 @@
 #include "Mesh.hh" // USES Mesh
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/MemoryTracker.hh" // USES MemoryTracker
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -36,7 +37,8 @@ pylith::topology::Field::Field(const Mesh& mesh) :
   _mesh(mesh),
   _dm(NULL),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _keepConstrainedDOF(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -69,7 +71,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   _mesh(mesh),
   _dm(dm),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _keepConstrainedDOF(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -82,6 +85,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   err = PetscObjectSetName((PetscObject) _globalVec, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
   err = PetscObjectSetName((PetscObject) _localVec,  _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
 
+  utils::MemoryTracker::allocate(this, memoryUse());
+
   PYLITH_METHOD_END;
 } // constructor
 
@@ -94,7 +99,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   _mesh(mesh),
   _dm(dm),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _keepConstrainedDOF(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -110,6 +116,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   err = PetscObjectSetName((PetscObject) _localVec,  _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
   err = VecCopy(localVec, _localVec);PYLITH_CHECK_ERROR(err);
 
+  utils::MemoryTracker::allocate(this, memoryUse());
+
   PYLITH_METHOD_END;
 } // constructor
 
@@ -228,6 +236,50 @@ pylith::topology::Field::sectionSize(void) const
   PYLITH_METHOD_RETURN(size);
 } // sectionSize
 
+// ----------------------------------------------------------------------
+// Get number of bytes allocated for values and layout of field.
+size_t
+pylith::topology::Field::memoryUse(void) const
+{ // memoryUse
+  PYLITH_METHOD_BEGIN;
+
+  size_t bytes = 0;
+  PetscInt n = 0;
+  PetscErrorCode err;
+
+  if (_localVec) {
+    err = VecGetLocalSize(_localVec, &n);PYLITH_CHECK_ERROR(err);
+    bytes += n * sizeof(PetscScalar);
+  } // if
+  if (_globalVec) {
+    err = VecGetLocalSize(_globalVec, &n);PYLITH_CHECK_ERROR(err);
+    bytes += n * sizeof(PetscScalar);
+  } // if
+  const scatter_map_type::const_iterator scattersEnd = _scatters.end();
+  for (scatter_map_type::const_iterator s_iter=_scatters.begin(); s_iter != scattersEnd; ++s_iter) {
+    if (s_iter->second.vector && s_iter->second.vector != _globalVec) {
+      err = VecGetLocalSize(s_iter->second.vector, &n);PYLITH_CHECK_ERROR(err);
+      bytes += n * sizeof(PetscScalar);
+    } // if
+  } // for
+
+  // Section atlas holds the number of DOF and offset for each point
+  // in the chart plus the indices of constrained DOF.
+  PetscSection s = NULL;
+  if (_dm) {
+    err = DMGetDefaultSection(_dm, &s);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (s) {
+    PetscInt pStart = 0, pEnd = 0, storageSize = 0, constrainedStorageSize = 0;
+    err = PetscSectionGetChart(s, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetStorageSize(s, &storageSize);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstrainedStorageSize(s, &constrainedStorageSize);PYLITH_CHECK_ERROR(err);
+    bytes += (2*(pEnd-pStart) + (storageSize-constrainedStorageSize)) * sizeof(PetscInt);
+  } // if
+
+  PYLITH_METHOD_RETURN(bytes);
+} // memoryUse
+
 // ----------------------------------------------------------------------
 // Set chart for solution.
 void
@@ -566,6 +618,8 @@ pylith::topology::Field::cloneSection(const Field& src)
     } // if
   } // for
 
+  utils::MemoryTracker::allocate(this, memoryUse());
+
   PYLITH_METHOD_END;
 } // cloneSection
 
@@ -596,6 +650,9 @@ pylith::topology::Field::clear(void)
   _metadata.scale = 1.0;
   _metadata.vectorFieldType = OTHER;
   _metadata.dimsOkay = false;
+  _keepConstrainedDOF = false;
+
+  utils::MemoryTracker::deallocate(this);
 
   PYLITH_METHOD_END;
 } // clear
@@ -632,7 +689,8 @@ pylith::topology::Field::allocate(void)
     err = DMDestroy(&info.dm);PYLITH_CHECK_ERROR(err);
     err = DMCreateSubDM(_dm, 1, fields, NULL, &info.dm);PYLITH_CHECK_ERROR(err);
   } // for
-  
+
+  utils::MemoryTracker::allocate(this, memoryUse());
 
   PYLITH_METHOD_END;
 } // allocate
@@ -952,6 +1010,8 @@ pylith::topology::Field::createScatterWithBC(const Mesh& mesh,
   err = DMCreateGlobalVector(sinfo.dm, &sinfo.vector);PYLITH_CHECK_ERROR(err);
   err = PetscObjectSetName((PetscObject) sinfo.vector, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
 
+  utils::MemoryTracker::allocate(this, memoryUse());
+
   PYLITH_METHOD_END;
 } // createScatterWithBC
 
@@ -1057,9 +1117,116 @@ pylith::topology::Field::createScatterWithBC(const Mesh& mesh,
 
   err = PetscSectionDestroy(&subSection);PYLITH_CHECK_ERROR(err);
 
+  utils::MemoryTracker::allocate(this, memoryUse());
+
   PYLITH_METHOD_END;
 } // createScatterWithBC
 
+// ----------------------------------------------------------------------
+// Keep constrained DOF in the global PETSc vector of the field.
+void
+pylith::topology::Field::keepConstrainedDOF(void)
+{ // keepConstrainedDOF
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+  PetscErrorCode err = 0;
+
+  PetscSection section = NULL, gsection = NULL;
+  PetscSF sf = NULL;
+  err = DMGetDefaultSection(_dm, &section);PYLITH_CHECK_ERROR(err);assert(section);
+  err = DMGetPointSF(_dm, &sf);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionCreateGlobalSection(section, sf, PETSC_TRUE, PETSC_FALSE, &gsection);PYLITH_CHECK_ERROR(err);
+  err = DMSetDefaultGlobalSection(_dm, gsection);PYLITH_CHECK_ERROR(err);
+  // Rebuild star forest used in local/global transfers for new layout.
+  err = DMCreateDefaultSF(_dm, section, gsection);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionDestroy(&gsection);PYLITH_CHECK_ERROR(err);
+
+  PetscVec oldGlobalVec = _globalVec;
+  _globalVec = NULL;
+  err = DMCreateGlobalVector(_dm, &_globalVec);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) _globalVec, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+
+  // Scatters sharing the old global vector (or whose vector already
+  // matches the new layout) use the new global vector.
+  PetscInt globalSize = 0;
+  err = VecGetSize(_globalVec, &globalSize);PYLITH_CHECK_ERROR(err);
+  const scatter_map_type::iterator scattersEnd = _scatters.end();
+  for (scatter_map_type::iterator s_iter=_scatters.begin(); s_iter != scattersEnd; ++s_iter) {
+    ScatterInfo& sinfo = s_iter->second;
+    if (!sinfo.vector) {
+      continue;
+    } // if
+    PetscInt vecGlobalSize = 0;
+    err = VecGetSize(sinfo.vector, &vecGlobalSize);PYLITH_CHECK_ERROR(err);
+    if (sinfo.vector == oldGlobalVec || vecGlobalSize == globalSize) {
+      err = VecDestroy(&sinfo.vector);PYLITH_CHECK_ERROR(err);
+      sinfo.vector = _globalVec;
+      err = PetscObjectReference((PetscObject) sinfo.vector);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+  err = VecDestroy(&oldGlobalVec);PYLITH_CHECK_ERROR(err);
+
+  _keepConstrainedDOF = true;
+
+  PYLITH_METHOD_END;
+} // keepConstrainedDOF
+
+// ----------------------------------------------------------------------
+// Check whether the global PETSc vector includes constrained DOF.
+bool
+pylith::topology::Field::keepsConstrainedDOF(void) const
+{ // keepsConstrainedDOF
+  return _keepConstrainedDOF;
+} // keepsConstrainedDOF
+
+// ----------------------------------------------------------------------
+// Copy local values of constrained DOF into global PETSc vector.
+void
+pylith::topology::Field::copyConstrainedLocalToGlobal(const PetscVec vector) const
+{ // copyConstrainedLocalToGlobal
+  PYLITH_METHOD_BEGIN;
+
+  assert(vector);
+  if (!_keepConstrainedDOF) {
+    throw std::logic_error("Global vector does not include constrained DOF. Call keepConstrainedDOF() first.");
+  } // if
+
+  PetscSection section = localSection();assert(section);
+  PetscSection gsection = globalSection();assert(gsection);
+  PetscErrorCode err = 0;
+
+  PetscInt pStart = 0, pEnd = 0, rowStart = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = VecGetOwnershipRange(vector, &rowStart, NULL);PYLITH_CHECK_ERROR(err);
+
+  const PetscScalar* localArray = NULL;
+  PetscScalar* globalArray = NULL;
+  err = VecGetArrayRead(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(vector, &globalArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt cdof = 0, gdof = 0;
+    err = PetscSectionGetConstraintDof(section, p, &cdof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetDof(gsection, p, &gdof);PYLITH_CHECK_ERROR(err);
+    if (cdof <= 0 || gdof <= 0) { // skip unconstrained and unowned points
+      continue;
+    } // if
+
+    const PetscInt* cind = NULL;
+    PetscInt off = 0, goff = 0;
+    err = PetscSectionGetConstraintIndices(section, p, &cind);PYLITH_CHECK_ERROR(err);assert(cind);
+    err = PetscSectionGetOffset(section, p, &off);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(gsection, p, &goff);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < cdof; ++i) {
+      globalArray[goff-rowStart+cind[i]] = localArray[off+cind[i]];
+    } // for
+  } // for
+  err = VecRestoreArray(vector, &globalArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // copyConstrainedLocalToGlobal
+
 // ----------------------------------------------------------------------
 // Get PETSc vector associated with field.
 PetscVec
@@ -188,6 +188,13 @@ public :
    */
   int sectionSize(void) const;
 
+  /** Get number of bytes allocated for values and layout of field
+   * on this process.
+   *
+   * @returns Number of bytes.
+   */
+  size_t memoryUse(void) const;
+
   /** Has section been setup?
    *
    * @returns True if section has been setup.
@@ -432,6 +439,32 @@ public :
                            PetscInt labelValue,
                            const char* context ="");
 
+  /** Keep constrained DOF in the global PETSc vector of the field.
+   *
+   * Replaces the default global section of the field's DM with one
+   * that includes the constrained DOF, so every point keeps all of
+   * its DOF in the global numbering and matrices created from the DM
+   * retain the point block size even when only some components are
+   * constrained. The global vector is recreated and scatters sharing
+   * it are updated. Must be called after constraints are set.
+   */
+  void keepConstrainedDOF(void);
+
+  /** Check whether the global PETSc vector includes constrained DOF.
+   *
+   * @returns True if keepConstrainedDOF() was called, false otherwise.
+   */
+  bool keepsConstrainedDOF(void) const;
+
+  /** Copy local values of constrained DOF into global PETSc vector.
+   *
+   * Only points owned by this process are set. Requires
+   * keepConstrainedDOF() so constrained DOF have global slots.
+   *
+   * @param vector PETSc vector to update (layout of global vector).
+   */
+  void copyConstrainedLocalToGlobal(const PetscVec vector) const;
+
   /** Get PETSc vector associated with field.
    *
    * @param context Label for context associated with vector.
@@ -533,6 +566,7 @@ private :
   PetscVec _globalVec; ///< Global PETSc vector
   PetscVec _localVec; ///< Local PETSc vector
   subfields_type _subfields; ///< Map of subfields bundled together.
+  bool _keepConstrainedDOF; ///< True if global vector includes constrained DOF.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -23,6 +23,7 @@
 #include "Mesh.hh" // USES Mesh
 #include "Field.hh" // USES Field
 
+#include "pylith/utils/MemoryTracker.hh" // USES MemoryTracker
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <iostream> // USES std::cerr
 
@@ -32,6 +33,7 @@ pylith::topology::Jacobian::Jacobian(const Field& field,
                                      const char* matrixType,
                                      const bool blockOkay) :
   _matrix(0),
+  _assembledMatrix(0),
   _valuesChanged(true)
 { // constructor
   PYLITH_METHOD_BEGIN;
@@ -39,9 +41,31 @@ pylith::topology::Jacobian::Jacobian(const Field& field,
   PetscDM dmMesh = field.dmMesh();assert(dmMesh);
 
   const char* msg = "Could not create PETSc sparse matrix associated with system Jacobian.";
-  PetscErrorCode err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
-
+  PetscErrorCode err = 0;
   _type = matrixType;
+  if (_type == "shell") {
+    _createMatrixFree(field);
+  } else {
+    // Symmetric block storage keeps only the upper triangle. Integrators
+    // add full cell matrices and PETSc drops the entries below the
+    // diagonal.
+    const bool isSymmetric = _type == "sbaij" || _type == "seqsbaij" || _type == "mpisbaij";
+    if (isSymmetric) {
+      MatType dmMatType = NULL;
+      err = DMGetMatType(dmMesh, &dmMatType);PYLITH_CHECK_ERROR(err);
+      const std::string dmMatTypeOrig = dmMatType ? dmMatType : MATAIJ;
+      err = DMSetMatType(dmMesh, MATSBAIJ);PYLITH_CHECK_ERROR(err);
+      err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
+      err = DMSetMatType(dmMesh, dmMatTypeOrig.c_str());PYLITH_CHECK_ERROR(err);
+      err = MatSetOption(_matrix, MAT_IGNORE_LOWER_TRIANGULAR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } else {
+      err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
+    } // if/else
+    _assembledMatrix = _matrix;
+    err = PetscObjectReference((PetscObject) _assembledMatrix);PYLITH_CHECK_ERROR(err);
+  } // if/else
+
+  utils::MemoryTracker::allocate(this, memoryUse());
 
   PYLITH_METHOD_END;
 } // constructor
@@ -61,6 +85,8 @@ pylith::topology::Jacobian::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   PetscErrorCode err = MatDestroy(&_matrix);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&_assembledMatrix);PYLITH_CHECK_ERROR(err);
+  utils::MemoryTracker::deallocate(this);
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -81,6 +107,30 @@ pylith::topology::Jacobian::matrix(void)
   return _matrix;
 } // matrix
 
+// ----------------------------------------------------------------------
+// Get PETSc matrix integrators assemble into.
+const PetscMat
+pylith::topology::Jacobian::assembledMatrix(void) const
+{ // assembledMatrix
+  return _assembledMatrix;
+} // assembledMatrix
+
+// ----------------------------------------------------------------------
+// Get PETSc matrix integrators assemble into.
+PetscMat
+pylith::topology::Jacobian::assembledMatrix(void)
+{ // assembledMatrix
+  return _assembledMatrix;
+} // assembledMatrix
+
+// ----------------------------------------------------------------------
+// Check whether Jacobian is matrix-free.
+bool
+pylith::topology::Jacobian::isMatrixFree(void) const
+{ // isMatrixFree
+  return _matrix != _assembledMatrix;
+} // isMatrixFree
+
 // ----------------------------------------------------------------------
 // Get matrix type.
 const char*
@@ -89,6 +139,23 @@ pylith::topology::Jacobian::matrixType(void) const
   return _type.c_str();
 } // matrixType
 
+// ----------------------------------------------------------------------
+// Get number of bytes allocated for sparse matrix on this process.
+size_t
+pylith::topology::Jacobian::memoryUse(void) const
+{ // memoryUse
+  PYLITH_METHOD_BEGIN;
+
+  if (!_assembledMatrix) {
+    PYLITH_METHOD_RETURN(0);
+  } // if
+
+  MatInfo info;
+  PetscErrorCode err = MatGetInfo(_assembledMatrix, MAT_LOCAL, &info);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(size_t(info.memory));
+} // memoryUse
+
 // ----------------------------------------------------------------------
 // Assemble matrix.
 void
@@ -98,8 +165,9 @@ pylith::topology::Jacobian::assemble(const char* mode)
 
   PetscErrorCode err = 0;
   if (0 == strcmp(mode, "final_assembly")) {
-    err = MatAssemblyBegin(_matrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
-    err = MatAssemblyEnd(_matrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(_assembledMatrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_assembledMatrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    utils::MemoryTracker::allocate(this, memoryUse());
 
 #if 0 // DEBUGGING
     // Check for empty row
@@ -129,8 +197,8 @@ pylith::topology::Jacobian::assemble(const char* mode)
 #endif
 
   } else if (0 == strcmp(mode, "flush_assembly")) {
-    err = MatAssemblyBegin(_matrix, MAT_FLUSH_ASSEMBLY);PYLITH_CHECK_ERROR(err);
-    err = MatAssemblyEnd(_matrix, MAT_FLUSH_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(_assembledMatrix, MAT_FLUSH_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_assembledMatrix, MAT_FLUSH_ASSEMBLY);PYLITH_CHECK_ERROR(err);
   } else
     throw std::runtime_error("Unknown mode for assembly of sparse matrix "
 			     "associated with system Jacobian.");
@@ -147,12 +215,49 @@ pylith::topology::Jacobian::zero(void)
 { // zero
   PYLITH_METHOD_BEGIN;
 
-  PetscErrorCode err = MatZeroEntries(_matrix);PYLITH_CHECK_ERROR(err);
+  PetscErrorCode err = MatZeroEntries(_assembledMatrix);PYLITH_CHECK_ERROR(err);
   _valuesChanged = true;
 
   PYLITH_METHOD_END;
 } // zero
 
+// ----------------------------------------------------------------------
+// Add unit diagonal entries for constrained DOF.
+void
+pylith::topology::Jacobian::addConstrainedIdentity(const Field& field)
+{ // addConstrainedIdentity
+  PYLITH_METHOD_BEGIN;
+
+  assert(field.keepsConstrainedDOF());
+
+  PetscSection section = field.localSection();assert(section);
+  PetscSection gsection = field.globalSection();assert(gsection);
+  PetscErrorCode err = 0;
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt cdof = 0, gdof = 0;
+    err = PetscSectionGetConstraintDof(section, p, &cdof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetDof(gsection, p, &gdof);PYLITH_CHECK_ERROR(err);
+    if (cdof <= 0 || gdof <= 0) { // skip unconstrained and unowned points
+      continue;
+    } // if
+
+    const PetscInt* cind = NULL;
+    PetscInt goff = 0;
+    err = PetscSectionGetConstraintIndices(section, p, &cind);PYLITH_CHECK_ERROR(err);assert(cind);
+    err = PetscSectionGetOffset(gsection, p, &goff);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < cdof; ++i) {
+      const PetscInt row = goff + cind[i];
+      err = MatSetValue(_assembledMatrix, row, row, 1.0, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // for
+  _valuesChanged = true;
+
+  PYLITH_METHOD_END;
+} // addConstrainedIdentity
+
 // ----------------------------------------------------------------------
 // View matrix to stdout.
 void
@@ -160,7 +265,7 @@ pylith::topology::Jacobian::view(void) const
 { // view
   PYLITH_METHOD_BEGIN;
 
-  PetscErrorCode err = MatView(_matrix, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
+  PetscErrorCode err = MatView(_assembledMatrix, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
 
   PYLITH_METHOD_END;
 } // view
@@ -176,7 +281,7 @@ pylith::topology::Jacobian::write(const char* filename,
   PetscViewer viewer;
   PetscErrorCode err = PetscViewerBinaryOpen(comm, filename, FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
 
-  err = MatView(_matrix, viewer); PYLITH_CHECK_ERROR(err);
+  err = MatView(_assembledMatrix, viewer); PYLITH_CHECK_ERROR(err);
   err = PetscViewerDestroy(&viewer); PYLITH_CHECK_ERROR(err);
 
   PYLITH_METHOD_END;
@@ -189,7 +294,7 @@ pylith::topology::Jacobian::verifySymmetry(void) const
 { // verifySymmetry
   PYLITH_METHOD_BEGIN;
 
-  const PetscMat matSparse = _matrix;
+  const PetscMat matSparse = _assembledMatrix;
   PetscErrorCode err;
 
   int nrows = 0;
@@ -243,6 +348,64 @@ pylith::topology::Jacobian::verifySymmetry(void) const
   PYLITH_METHOD_END;
 } // verifySymmetry
 
+// ----------------------------------------------------------------------
+// Create shell matrix for Jacobian and point-block diagonal matrix for
+// preconditioning.
+void
+pylith::topology::Jacobian::_createMatrixFree(const Field& field)
+{ // _createMatrixFree
+  PYLITH_METHOD_BEGIN;
+
+  const PetscVec globalVec = field.globalVector();assert(globalVec);
+  PetscSection gsection = field.globalSection();assert(gsection);
+  MPI_Comm comm = field.mesh().comm();
+  PetscErrorCode err = 0;
+
+  PetscInt m = 0, M = 0;
+  err = VecGetLocalSize(globalVec, &m);PYLITH_CHECK_ERROR(err);
+  err = VecGetSize(globalVec, &M);PYLITH_CHECK_ERROR(err);
+
+  // Operator: action is supplied by the formulation via MatShellSetOperation().
+  err = MatCreateShell(comm, m, m, M, M, NULL, &_matrix);PYLITH_CHECK_ERROR(err);
+
+  // Preconditioning matrix: only the blocks coupling DOF at the same
+  // point, so the storage is a small fraction of the full Jacobian.
+  PetscInt* dnnz = (m > 0) ? new PetscInt[m] : 0;
+  PetscInt* onnz = (m > 0) ? new PetscInt[m] : 0;
+  PetscInt pStart = 0, pEnd = 0, row = 0;
+  err = PetscSectionGetChart(gsection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt gdof = 0, gcdof = 0;
+    err = PetscSectionGetDof(gsection, p, &gdof);PYLITH_CHECK_ERROR(err);
+    if (gdof <= 0) { // skip points owned by other processes
+      continue;
+    } // if
+    err = PetscSectionGetConstraintDof(gsection, p, &gcdof);PYLITH_CHECK_ERROR(err);
+    const PetscInt blockSize = gdof - gcdof;
+    for (PetscInt i = 0; i < blockSize; ++i, ++row) {
+      assert(row < m);
+      dnnz[row] = blockSize;
+      onnz[row] = 0;
+    } // for
+  } // for
+  assert(row == m);
+
+  err = MatCreate(comm, &_assembledMatrix);PYLITH_CHECK_ERROR(err);
+  err = MatSetSizes(_assembledMatrix, m, m, M, M);PYLITH_CHECK_ERROR(err);
+  err = MatSetType(_assembledMatrix, MATAIJ);PYLITH_CHECK_ERROR(err);
+  err = MatSetOptionsPrefix(_assembledMatrix, "jacobian_pc_");PYLITH_CHECK_ERROR(err);
+  err = MatSetFromOptions(_assembledMatrix);PYLITH_CHECK_ERROR(err);
+  err = MatXAIJSetPreallocation(_assembledMatrix, 1, dnnz, onnz, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  delete[] dnnz; dnnz = 0;
+  delete[] onnz; onnz = 0;
+
+  // Integrators assemble full cell matrices; keep only the entries
+  // inside the preallocated blocks.
+  err = MatSetOption(_assembledMatrix, MAT_NEW_NONZERO_LOCATIONS, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _createMatrixFree
+
 // ----------------------------------------------------------------------
 // Get flag indicating if sparse matrix values have been
 // updated.
@@ -43,6 +43,14 @@ class pylith::topology::Jacobian
 public :
 
   /** Default constructor.
+   *
+   * If the matrix type is "shell", the Jacobian is matrix-free: the
+   * operator is a PETSc shell matrix whose action is supplied by the
+   * formulation, and integrators assemble into a point-block diagonal
+   * matrix used only for preconditioning.
+   *
+   * Symmetric matrix types ("sbaij") store only the upper triangle;
+   * entries added below the diagonal are ignored.
    *
    * @param field Field associated with mesh and solution of the problem.
    * @param matrixType Type of PETSc sparse matrix.
@@ -71,12 +79,40 @@ public :
    */
   PetscMat matrix(void);
 
+  /** Get PETSc matrix integrators assemble into.
+   *
+   * Same as matrix() unless the Jacobian is matrix-free, in which case
+   * it is the point-block diagonal matrix used for preconditioning;
+   * entries outside the diagonal blocks are dropped.
+   *
+   * @returns PETSc sparse matrix.
+   */
+  const PetscMat assembledMatrix(void) const;
+
+  /** Get PETSc matrix integrators assemble into.
+   *
+   * @returns PETSc sparse matrix.
+   */
+  PetscMat assembledMatrix(void);
+
+  /** Check whether Jacobian is matrix-free.
+   *
+   * @returns True if matrix() is a shell matrix, false otherwise.
+   */
+  bool isMatrixFree(void) const;
+
   /** Get matrix type.
    *
    * @returns Matrix type.
    */
   const char* matrixType(void) const;
 
+  /** Get number of bytes allocated for sparse matrix on this process.
+   *
+   * @returns Number of bytes.
+   */
+  size_t memoryUse(void) const;
+
   /** Assemble matrix.
    *
    * @param mode Assembly mode.
@@ -86,6 +122,16 @@ public :
   /// Set entries in matrix to zero (retain structure).
   void zero(void);
 
+  /** Add unit diagonal entries for constrained DOF kept in the global
+   * numbering of the field (see Field::keepConstrainedDOF()).
+   *
+   * Cell matrices skip constrained rows and columns, so the identity
+   * rows decouple the constrained DOF from the rest of the system.
+   *
+   * @param field Field defining the layout of the matrix.
+   */
+  void addConstrainedIdentity(const Field& field);
+
   /// View matrix to stdout.
   void view(void) const;
 
@@ -111,10 +157,21 @@ public :
   /// Reset flag indicating if sparse matrix values have been updated.
   void resetValuesChanged(void);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Create shell matrix for Jacobian and point-block diagonal matrix
+   * for preconditioning.
+   *
+   * @param field Field associated with mesh and solution of the problem.
+   */
+  void _createMatrixFree(const Field& field);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscMat _matrix; ///< Sparse matrix for Jacobian of problem.
+  PetscMat _assembledMatrix; ///< Matrix integrators assemble into (same as _matrix unless matrix-free).
 
   bool _valuesChanged; ///< Sparse matrix values have been updated.
 
@@ -0,0 +1,369 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "RefineInterpolator.hh" // implementation of class methods
+
+#include "Mesh.hh" // USES Mesh
+#include "Field.hh" // USES Field
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::reverse()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    namespace _RefineInterpolator {
+
+      /// Maximum number of coarse vertices contributing to a fine
+      /// vertex (center of a hexahedron).
+      const PetscInt maxWeights = 8;
+
+      /** Number owned vertex components consecutively.
+       *
+       * Follows the ordering of the global vector for the field
+       * (points in chart order) but counts only the components at
+       * vertices, skipping constrained components if the global
+       * section excludes them.
+       *
+       * @param indices Global indices [numVertices*numComponents], -1
+       *   for components that are not owned or are excluded.
+       * @param numOwned Number of indices owned by this process.
+       * @param section Local section of field.
+       * @param globalSection Global section of field.
+       * @param dm PETSc DM for mesh.
+       * @param numComponents Number of components per vertex.
+       */
+      void
+      numberRows(int_array* indices,
+		 PetscInt* numOwned,
+		 const PetscSection section,
+		 const PetscSection globalSection,
+		 const PetscDM dm,
+		 const int numComponents)
+      { // numberRows
+	assert(indices);
+	assert(numOwned);
+
+	PetscErrorCode err = 0;
+	PetscInt vStart = 0, vEnd = 0;
+	err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+	indices->resize((vEnd-vStart)*numComponents);
+	*indices = -1;
+
+	PetscInt count = 0;
+	for (PetscInt v = vStart; v < vEnd; ++v) {
+	  PetscInt dof = 0, gdof = 0, cdof = 0, gcdof = 0;
+	  err = PetscSectionGetDof(section, v, &dof);PYLITH_CHECK_ERROR(err);
+	  if (dof != numComponents) {
+	    std::ostringstream msg;
+	    msg << "Interpolation between refined meshes requires " << numComponents
+		<< " DOF at each vertex. Vertex " << v << " has " << dof << " DOF.";
+	    throw std::runtime_error(msg.str());
+	  } // if
+	  err = PetscSectionGetDof(globalSection, v, &gdof);PYLITH_CHECK_ERROR(err);
+	  if (gdof < 0) { // not owned
+	    continue;
+	  } // if
+	  err = PetscSectionGetConstraintDof(section, v, &cdof);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetConstraintDof(globalSection, v, &gcdof);PYLITH_CHECK_ERROR(err);
+	  const PetscInt* cind = NULL;
+	  if (cdof > 0) {
+	    err = PetscSectionGetConstraintIndices(section, v, &cind);PYLITH_CHECK_ERROR(err);
+	  } // if
+	  for (int iComp = 0; iComp < numComponents; ++iComp) {
+	    bool isExcluded = false;
+	    for (PetscInt i = 0; i < cdof && gcdof > 0; ++i) {
+	      if (cind[i] == iComp) {
+		isExcluded = true;
+	      } // if
+	    } // for
+	    if (!isExcluded) {
+	      (*indices)[(v-vStart)*numComponents+iComp] = count++;
+	    } // if
+	  } // for
+	} // for
+
+	MPI_Comm comm = PETSC_COMM_SELF;
+	err = PetscObjectGetComm((PetscObject) dm, &comm);PYLITH_CHECK_ERROR(err);
+	PetscInt countEnd = 0;
+	err = MPI_Scan(&count, &countEnd, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+	const PetscInt countStart = countEnd - count;
+	const size_t size = indices->size();
+	for (size_t i = 0; i < size; ++i) {
+	  if ((*indices)[i] >= 0) {
+	    (*indices)[i] += countStart;
+	  } // if
+	} // for
+	*numOwned = count;
+      } // numberRows
+
+      /** Number components of all vertices (including those owned by
+       * other processes) using a global section without constraints.
+       *
+       * @param indices Global indices [numVertices*numComponents].
+       * @param numOwned Number of indices owned by this process.
+       * @param globalSection Global section.
+       * @param dm PETSc DM for mesh.
+       * @param numComponents Number of components per vertex.
+       */
+      void
+      numberColumns(int_array* indices,
+		    PetscInt* numOwned,
+		    const PetscSection globalSection,
+		    const PetscDM dm,
+		    const int numComponents)
+      { // numberColumns
+	assert(indices);
+	assert(numOwned);
+
+	PetscErrorCode err = 0;
+	PetscInt vStart = 0, vEnd = 0;
+	err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+	indices->resize((vEnd-vStart)*numComponents);
+
+	PetscInt count = 0;
+	for (PetscInt v = vStart; v < vEnd; ++v) {
+	  PetscInt gdof = 0, goff = 0;
+	  err = PetscSectionGetDof(globalSection, v, &gdof);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetOffset(globalSection, v, &goff);PYLITH_CHECK_ERROR(err);
+	  if (gdof >= 0) {
+	    count += numComponents;
+	  } // if
+	  goff = (goff < 0) ? -(goff+1) : goff;
+	  for (int iComp = 0; iComp < numComponents; ++iComp) {
+	    (*indices)[(v-vStart)*numComponents+iComp] = goff + iComp;
+	  } // for
+	} // for
+	*numOwned = count;
+      } // numberColumns
+
+    } // _RefineInterpolator
+  } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::topology::RefineInterpolator::RefineInterpolator(void)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::topology::RefineInterpolator::~RefineInterpolator(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::RefineInterpolator::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numInterpolations = _interpolations.size();
+  for (size_t i = 0; i < numInterpolations; ++i) {
+    PetscErrorCode err = MatDestroy(&_interpolations[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _interpolations.clear();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Create interpolation operators for all levels of the mesh hierarchy.
+void
+pylith::topology::RefineInterpolator::initialize(const Field& solution)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  deallocate();
+
+  const Mesh& mesh = solution.mesh();
+  PetscDM dmFine = mesh.dmMesh();assert(dmFine);
+  const int numComponents = mesh.dimension();
+  PetscErrorCode err = 0;
+
+  // Finest level first.
+  std::vector<PetscDM> dms;
+  dms.push_back(dmFine);
+  PetscDM dmCoarse = NULL;
+  err = DMGetCoarseDM(dmFine, &dmCoarse);PYLITH_CHECK_ERROR(err);
+  while (dmCoarse) {
+    dms.push_back(dmCoarse);
+    err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+  } // while
+  const size_t numLevels = dms.size();
+
+  int_array rowIndices;
+  PetscInt numRowsLocal = 0;
+  _RefineInterpolator::numberRows(&rowIndices, &numRowsLocal, solution.localSection(), solution.globalSection(), dmFine, numComponents);
+
+  for (size_t i = 1; i < numLevels; ++i) {
+    // Layout with numComponents values at each vertex on coarse level.
+    PetscSection section = NULL, globalSection = NULL;
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dms[i], 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionCreate(PetscObjectComm((PetscObject) dms[i]), &section);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetChart(section, vStart, vEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      err = PetscSectionSetDof(section, v, numComponents);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscSectionSetUp(section);PYLITH_CHECK_ERROR(err);
+    err = DMSetDefaultSection(dms[i], section);PYLITH_CHECK_ERROR(err);
+    err = DMGetDefaultGlobalSection(dms[i], &globalSection);PYLITH_CHECK_ERROR(err);
+
+    int_array columnIndices;
+    PetscInt numColumnsLocal = 0;
+    _RefineInterpolator::numberColumns(&columnIndices, &numColumnsLocal, globalSection, dms[i], numComponents);
+
+    _interpolations.push_back(_createInterpolation(dms[i], columnIndices, numColumnsLocal, dms[i-1], rowIndices, numRowsLocal, numComponents));
+
+    // Coarse level provides the rows for the next interpolation.
+    _RefineInterpolator::numberRows(&rowIndices, &numRowsLocal, section, globalSection, dms[i], numComponents);
+    err = PetscSectionDestroy(&section);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Order from coarsest to finest.
+  std::reverse(_interpolations.begin(), _interpolations.end());
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Get number of levels in the hierarchy.
+int
+pylith::topology::RefineInterpolator::numLevels(void) const
+{ // numLevels
+  return _interpolations.size() + 1;
+} // numLevels
+
+// ----------------------------------------------------------------------
+// Get interpolation from level-1 to level.
+PetscMat
+pylith::topology::RefineInterpolator::interpolation(const int level) const
+{ // interpolation
+  assert(level > 0 && size_t(level) <= _interpolations.size());
+  return _interpolations[level-1];
+} // interpolation
+
+// ----------------------------------------------------------------------
+// Create interpolation between two levels.
+PetscMat
+pylith::topology::RefineInterpolator::_createInterpolation(const PetscDM dmCoarse,
+							   const int_array& columnIndices,
+							   const PetscInt numColumnsLocal,
+							   const PetscDM dmFine,
+							   const int_array& rowIndices,
+							   const PetscInt numRowsLocal,
+							   const int numComponents)
+{ // _createInterpolation
+  PYLITH_METHOD_BEGIN;
+
+  using _RefineInterpolator::maxWeights;
+
+  PetscErrorCode err = 0;
+  MPI_Comm comm = PetscObjectComm((PetscObject) dmFine);
+
+  PetscMat mat = NULL;
+  err = MatCreate(comm, &mat);PYLITH_CHECK_ERROR(err);
+  err = MatSetSizes(mat, numRowsLocal, numColumnsLocal, PETSC_DETERMINE, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+  err = MatSetType(mat, MATAIJ);PYLITH_CHECK_ERROR(err);
+  err = MatSeqAIJSetPreallocation(mat, maxWeights, NULL);PYLITH_CHECK_ERROR(err);
+  err = MatMPIAIJSetPreallocation(mat, maxWeights, NULL, maxWeights, NULL);PYLITH_CHECK_ERROR(err);
+
+  PetscInt depth = 0, vStart = 0, vEnd = 0, vStartFine = 0, vEndFine = 0;
+  err = DMPlexGetDepth(dmCoarse, &depth);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmCoarse, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmFine, 0, &vStartFine, &vEndFine);PYLITH_CHECK_ERROR(err);
+  PetscInt cMax = -1, fMax = -1, eMax = -1;
+  err = DMPlexGetHybridBounds(dmCoarse, &cMax, &fMax, &eMax, NULL);PYLITH_CHECK_ERROR(err);
+
+  // Uniform refinement numbers the new vertices after the original
+  // ones: one for each non-hybrid edge, then quadrilateral face, then
+  // hexahedral cell, in point order (see DMPlex CellRefiner).
+  PetscInt vFine = vStartFine;
+  PetscInt cols[maxWeights];
+  PetscScalar weights[maxWeights];
+  for (PetscInt d = 0; d <= depth; ++d) {
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetDepthStratum(dmCoarse, d, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt pMax = (d == depth) ? cMax : (d == depth-1) ? fMax : (d == 1) ? eMax : -1;
+    if (pMax >= 0) {
+      pEnd = std::min(pEnd, pMax);
+    } // if
+    const PetscInt numVerticesRefined = (0 == d) ? 1 : (1 << d); // vertex, edge, quad, hex
+
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+      PetscInt numVertices = 0;
+      PetscInt closureSize = 0;
+      PetscInt* closure = NULL;
+      err = DMPlexGetTransitiveClosure(dmCoarse, p, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt i = 0; i < closureSize*2; i += 2) {
+	const PetscInt point = closure[i];
+	if (point >= vStart && point < vEnd && numVertices < maxWeights) {
+	  cols[numVertices++] = point;
+	} // if
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dmCoarse, p, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      if (numVertices != numVerticesRefined) { // no new vertex (e.g., triangle or tetrahedron)
+	continue;
+      } // if
+
+      if (vFine >= vEndFine) { // mismatch reported below
+	++vFine;
+	continue;
+      } // if
+      const PetscScalar weight = 1.0 / numVertices;
+      for (int iComp = 0; iComp < numComponents; ++iComp) {
+	const PetscInt row = rowIndices[(vFine-vStartFine)*numComponents+iComp];
+	if (row < 0) { // not owned or constrained
+	  continue;
+	} // if
+	PetscInt colsComp[maxWeights];
+	for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+	  colsComp[iVertex] = columnIndices[(cols[iVertex]-vStart)*numComponents+iComp];
+	  weights[iVertex] = weight;
+	} // for
+	err = MatSetValues(mat, 1, &row, numVertices, colsComp, weights, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+      } // for
+      ++vFine;
+    } // for
+  } // for
+  if (vFine != vEndFine) {
+    std::ostringstream msg;
+    msg << "Could not match vertices of refined mesh to coarse mesh (" << vFine-vStartFine
+	<< " of " << vEndFine-vStartFine << " vertices). Interpolation requires uniform "
+	<< "refinement of a mesh with linear cells.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  err = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+  err = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(mat);
+} // _createInterpolation
+
+
+// End of file
@@ -0,0 +1,130 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/RefineInterpolator.hh
+ *
+ * @brief C++ interpolation operators between levels of a uniformly
+ * refined mesh.
+ */
+
+#if !defined(pylith_topology_refineinterpolator_hh)
+#define pylith_topology_refineinterpolator_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HASA PetscMat, PetscDM
+#include "pylith/utils/array.hh" // HASA int_array
+
+#include <vector> // HASA std::vector
+
+// RefineInterpolator ---------------------------------------------------
+/** @brief Interpolation operators between levels of a uniformly
+ * refined mesh.
+ *
+ * RefineUniform keeps the coarse meshes as the chain of coarse DMs of
+ * the refined DM. For a vector field with one value per component at
+ * each vertex (the displacement field), the interpolation from a
+ * coarse level to the next finer level copies values at vertices
+ * present in both levels and averages the values at the vertices of
+ * the coarse edge, face, or cell containing each new vertex. This is
+ * exact for the linear and bilinear/trilinear basis functions.
+ *
+ * On the finest level the rows follow the global numbering of the
+ * displacement subfield of the solution, excluding constrained
+ * DOF. This matches the displacement block of a field split and, if
+ * the solution has no other subfields, the full global numbering.
+ */
+class pylith::topology::RefineInterpolator
+{ // RefineInterpolator
+  friend class TestRefineInterpolator; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  RefineInterpolator(void);
+
+  /// Destructor.
+  ~RefineInterpolator(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Create interpolation operators for all levels of the mesh
+   * hierarchy.
+   *
+   * @param solution Solution field over the finest mesh.
+   */
+  void initialize(const Field& solution);
+
+  /** Get number of levels in the hierarchy (including finest level).
+   *
+   * @returns Number of levels (1 if the mesh was not refined).
+   */
+  int numLevels(void) const;
+
+  /** Get interpolation from level-1 to level (0 is coarsest).
+   *
+   * @param level Level of the finer mesh (1 <= level < numLevels()).
+   * @returns PETSc matrix for interpolation.
+   */
+  PetscMat interpolation(const int level) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Create interpolation between two levels.
+   *
+   * @param dmCoarse PETSc DM for coarse mesh.
+   * @param columnIndices Global indices of vertex components of
+   *   coarse mesh [numVertices*numComponents].
+   * @param numColumnsLocal Number of columns owned by this process.
+   * @param dmFine PETSc DM for fine mesh.
+   * @param rowIndices Global indices of vertex components of fine
+   *   mesh (-1 if not owned or excluded) [numVertices*numComponents].
+   * @param numRowsLocal Number of rows owned by this process.
+   * @param numComponents Number of components per vertex.
+   * @returns PETSc matrix for interpolation.
+   */
+  PetscMat _createInterpolation(const PetscDM dmCoarse,
+				const int_array& columnIndices,
+				const PetscInt numColumnsLocal,
+				const PetscDM dmFine,
+				const int_array& rowIndices,
+				const PetscInt numRowsLocal,
+				const int numComponents);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::vector<PetscMat> _interpolations; ///< Interpolation to level i+1 from level i.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  RefineInterpolator(const RefineInterpolator&); ///< Not implemented
+  const RefineInterpolator& operator=(const RefineInterpolator&); ///< Not implemented
+
+}; // RefineInterpolator
+
+#endif // pylith_topology_refineinterpolator_hh
+
+
+// End of file
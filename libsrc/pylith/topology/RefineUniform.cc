@@ -76,15 +76,20 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     throw std::runtime_error(msg.str());
   } // if
 
-  // Refine, keeping original mesh intact.
+  // Refine, keeping original mesh intact. Each refined DM holds a
+  // reference to the DM it was refined from, so the hierarchy remains
+  // available (e.g., for geometric multigrid) after the coarse meshes
+  // are destroyed.
   PetscDM dmNew = NULL;
   err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
   err = DMRefine(dmOrig, mesh.comm(), &dmNew);PYLITH_CHECK_ERROR(err);
+  err = DMSetCoarseDM(dmNew, dmOrig);PYLITH_CHECK_ERROR(err);
 
   for (int i=1; i < levels; ++i) {
     PetscDM dmCur = dmNew; dmNew = NULL;
     err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmCur, mesh.comm(), &dmNew);PYLITH_CHECK_ERROR(err);
+    err = DMSetCoarseDM(dmNew, dmCur);PYLITH_CHECK_ERROR(err);
 
     err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
   } // for
@@ -47,6 +47,9 @@ public :
   void deallocate(void);
 
   /** Refine mesh.
+   *
+   * The coarse meshes are retained as the chain of coarse DMs of the
+   * refined mesh (see RefineInterpolator).
    *
    * @param newMesh Refined mesh (result).
    * @param mesh Mesh to refine.
@@ -35,6 +35,7 @@ namespace pylith {
     class Mesh;
     class MeshOps;
     class CoordsVisitor;
+    class ElementRestriction;
     class SubMeshIS;
     class Stratum;
     class StratumIS;
@@ -54,6 +55,7 @@ namespace pylith {
     class Distributor;
 
     class RefineUniform;
+    class RefineInterpolator;
 
     class ReverseCuthillMcKee;
 
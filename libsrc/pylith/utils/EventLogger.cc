@@ -22,6 +22,8 @@
 
 #include "error.h" // USES PYLITH_METHOD_BEGIN/END
 
+#include <petsc/private/logimpl.h> // USES PetscEventPerfLogEnsureSize()
+
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
@@ -101,6 +103,35 @@ pylith::utils::EventLogger::eventId(const char* name)
   PYLITH_METHOD_RETURN(iter->second);
 } // eventId
 
+// ----------------------------------------------------------------------
+// Add calls to event in the current stage without timing them.
+void
+pylith::utils::EventLogger::eventCount(const int id,
+				       const int count)
+{ // eventCount
+  PYLITH_METHOD_BEGIN;
+
+  PetscStageLog stageLog = NULL;
+  PetscErrorCode err = PetscLogGetStageLog(&stageLog);PYLITH_CHECK_ERROR(err);assert(stageLog);
+  int stage = -1;
+  err = PetscStageLogGetCurrent(stageLog, &stage);PYLITH_CHECK_ERROR(err);
+  if (stage < 0) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscEventPerfLog perfLog = NULL;
+  err = PetscStageLogGetEventPerfLog(stageLog, stage, &perfLog);PYLITH_CHECK_ERROR(err);assert(perfLog);
+  // The event log of a stage may not include events that have not
+  // begun in that stage yet.
+  if (id >= perfLog->numEvents) {
+    err = PetscEventPerfLogEnsureSize(perfLog, id+1);PYLITH_CHECK_ERROR(err);
+  } // if
+  assert(id < perfLog->numEvents);
+  perfLog->eventInfo[id].count += count;
+
+  PYLITH_METHOD_END;
+} // eventCount
+
 // ----------------------------------------------------------------------
 // Register stage.
 int
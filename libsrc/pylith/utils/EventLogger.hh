@@ -97,6 +97,18 @@ public :
    */
   void eventEnd(const int id);
 
+  /** Add calls to event in the current stage without timing them.
+   *
+   * Use this to report how many times an operation too fine-grained
+   * to wrap in eventBegin()/eventEnd() was performed. Nothing is
+   * recorded if PETSc logging is not active.
+   *
+   * @param id Event identifier.
+   * @param count Number of calls to add.
+   */
+  void eventCount(const int id,
+		  const int count);
+
   /** Register stage.
    *
    * @prerequisite Must call initialize() before registerStage().
@@ -0,0 +1,283 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "EventProfile.hh" // Implementation of class methods
+
+#include "error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petsclog.h" // USES PetscLogGetStageLog()
+
+#include <algorithm> // USES std::sort()
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setprecision()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cstring> // USES strcmp()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace utils {
+    namespace _EventProfile {
+      /// Order events by decreasing maximum time.
+      bool hotter(const EventProfile::EventStats& a,
+		  const EventProfile::EventStats& b) {
+	return a.time.max > b.time.max;
+      } // hotter
+    } // _EventProfile
+  } // utils
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::utils::EventProfile::EventProfile(void) :
+  _numProcs(0),
+  _rank(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::utils::EventProfile::~EventProfile(void)
+{ // destructor
+} // destructor
+
+// ----------------------------------------------------------------------
+// Turn on collection of performance information for events by PETSc.
+void
+pylith::utils::EventProfile::activate(void)
+{ // activate
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = PetscLogDefaultBegin();PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // activate
+
+// ----------------------------------------------------------------------
+// Collect statistics for events across processes.
+void
+pylith::utils::EventProfile::collect(const MPI_Comm comm)
+{ // collect
+  PYLITH_METHOD_BEGIN;
+
+  _events.clear();
+
+  PetscErrorCode err = 0;
+  err = MPI_Comm_size(comm, &_numProcs);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_rank(comm, &_rank);PYLITH_CHECK_ERROR(err);
+
+  PetscStageLog stageLog = NULL;
+  err = PetscLogGetStageLog(&stageLog);PYLITH_CHECK_ERROR(err);assert(stageLog);
+  const int numEvents = stageLog->eventLog->numEvents;
+
+  int numEventsMin = 0, numEventsMax = 0;
+  err = MPI_Allreduce((void*)&numEvents, &numEventsMin, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce((void*)&numEvents, &numEventsMax, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+  if (numEventsMin != numEventsMax) {
+    std::ostringstream msg;
+    msg << "Cannot collect event profile. Number of logging events differs across processes (min: "
+	<< numEventsMin << ", max: " << numEventsMax << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  // Sum count, time, and flops over stages for each event.
+  const int numValues = 3;
+  std::vector<double> localValues(numValues*numEvents, 0.0);
+  const int numStages = stageLog->numStages;
+  for (int iStage=0; iStage < numStages; ++iStage) {
+    const PetscEventPerfLog perfLog = stageLog->stageInfo[iStage].eventLog;assert(perfLog);
+    const int numStageEvents = std::min(perfLog->numEvents, numEvents);
+    for (int iEvent=0; iEvent < numStageEvents; ++iEvent) {
+      const PetscEventPerfInfo& info = perfLog->eventInfo[iEvent];
+      localValues[iEvent*numValues+0] += info.count;
+      localValues[iEvent*numValues+1] += info.time;
+      localValues[iEvent*numValues+2] += info.flops;
+    } // for
+  } // for
+
+  const int size = numValues*numEvents;
+  std::vector<double> sumValues(size);
+  std::vector<double> minValues(size);
+  std::vector<double> maxValues(size);
+  if (size > 0) {
+    err = MPI_Allreduce(&localValues[0], &sumValues[0], size, MPI_DOUBLE, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&localValues[0], &minValues[0], size, MPI_DOUBLE, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&localValues[0], &maxValues[0], size, MPI_DOUBLE, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  for (int iEvent=0; iEvent < numEvents; ++iEvent) {
+    const int i = iEvent*numValues;
+    if (maxValues[i+0] <= 0.0) {
+      continue;
+    } // if
+
+    EventStats stats;
+    stats.name = stageLog->eventLog->eventInfo[iEvent].name;
+    _calcStats(&stats.count, sumValues[i+0], minValues[i+0], maxValues[i+0], _numProcs);
+    _calcStats(&stats.time, sumValues[i+1], minValues[i+1], maxValues[i+1], _numProcs);
+    _calcStats(&stats.flops, sumValues[i+2], minValues[i+2], maxValues[i+2], _numProcs);
+    stats.imbalance = _calcImbalance(stats.time);
+    _events.push_back(stats);
+  } // for
+  std::stable_sort(_events.begin(), _events.end(), _EventProfile::hotter);
+
+  PYLITH_METHOD_END;
+} // collect
+
+// ----------------------------------------------------------------------
+// Get number of events in profile.
+int
+pylith::utils::EventProfile::numEvents(void) const
+{ // numEvents
+  return _events.size();
+} // numEvents
+
+// ----------------------------------------------------------------------
+// Get statistics for event.
+const pylith::utils::EventProfile::EventStats&
+pylith::utils::EventProfile::eventStats(const int index) const
+{ // eventStats
+  if (index < 0 || index >= int(_events.size())) {
+    std::ostringstream msg;
+    msg << "Index " << index << " of event in profile is out of range [0, " << _events.size() << ").";
+    throw std::out_of_range(msg.str());
+  } // if
+
+  return _events[index];
+} // eventStats
+
+// ----------------------------------------------------------------------
+// Write profile to file.
+void
+pylith::utils::EventProfile::write(const char* filename,
+				   const char* format) const
+{ // write
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+  assert(format);
+
+  if (strcmp(format, "json") && strcmp(format, "csv")) {
+    std::ostringstream msg;
+    msg << "Unknown format '" << format << "' for event profile. Known formats are 'json' and 'csv'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  if (_rank) {
+    PYLITH_METHOD_END;
+  } // if
+
+  std::ofstream fout(filename);
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open file '" << filename << "' for writing event profile.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout << std::setprecision(8);
+
+  if (!strcmp(format, "json")) {
+    _writeJSON(fout);
+  } else {
+    _writeCSV(fout);
+  } // if/else
+
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // write
+
+// ----------------------------------------------------------------------
+// Compute statistics from global sum, min, and max.
+void
+pylith::utils::EventProfile::_calcStats(Stats* stats,
+					const double sum,
+					const double min,
+					const double max,
+					const int numProcs)
+{ // _calcStats
+  assert(stats);
+  assert(numProcs > 0);
+
+  stats->min = min;
+  stats->max = max;
+  stats->mean = sum / numProcs;
+} // _calcStats
+
+// ----------------------------------------------------------------------
+// Compute load imbalance for event.
+double
+pylith::utils::EventProfile::_calcImbalance(const Stats& time)
+{ // _calcImbalance
+  return (time.mean > 0.0) ? time.max / time.mean : 1.0;
+} // _calcImbalance
+
+// ----------------------------------------------------------------------
+// Write profile in JSON format.
+void
+pylith::utils::EventProfile::_writeJSON(std::ostream& sout) const
+{ // _writeJSON
+  sout << "{\n"
+       << "  \"num_processes\": " << _numProcs << ",\n"
+       << "  \"events\": [";
+  const int numEvents = _events.size();
+  for (int i=0; i < numEvents; ++i) {
+    const EventStats& e = _events[i];
+
+    std::string name;
+    for (std::string::const_iterator c=e.name.begin(); c != e.name.end(); ++c) {
+      if ('"' == *c || '\\' == *c) {
+	name += '\\';
+      } // if
+      name += *c;
+    } // for
+
+    sout << ((i > 0) ? ",\n" : "\n")
+	 << "    {\"name\": \"" << name << "\""
+	 << ", \"count\": {\"min\": " << e.count.min << ", \"max\": " << e.count.max << ", \"mean\": " << e.count.mean << "}"
+	 << ", \"time\": {\"min\": " << e.time.min << ", \"max\": " << e.time.max << ", \"mean\": " << e.time.mean << "}"
+	 << ", \"flops\": {\"min\": " << e.flops.min << ", \"max\": " << e.flops.max << ", \"mean\": " << e.flops.mean << "}"
+	 << ", \"imbalance\": " << e.imbalance
+	 << "}";
+  } // for
+  sout << "\n  ]\n"
+       << "}\n";
+} // _writeJSON
+
+// ----------------------------------------------------------------------
+// Write profile in CSV format.
+void
+pylith::utils::EventProfile::_writeCSV(std::ostream& sout) const
+{ // _writeCSV
+  sout << "event,count_min,count_max,count_mean,time_min,time_max,time_mean,flops_min,flops_max,flops_mean,imbalance\n";
+  const int numEvents = _events.size();
+  for (int i=0; i < numEvents; ++i) {
+    const EventStats& e = _events[i];
+    sout << "\"" << e.name << "\""
+	 << "," << e.count.min << "," << e.count.max << "," << e.count.mean
+	 << "," << e.time.min << "," << e.time.max << "," << e.time.mean
+	 << "," << e.flops.min << "," << e.flops.max << "," << e.flops.mean
+	 << "," << e.imbalance
+	 << "\n";
+  } // for
+} // _writeCSV
+
+
+// End of file 
@@ -0,0 +1,175 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/EventProfile.hh
+ *
+ * @brief C++ object for collecting statistics across processes for
+ * PETSc logging events.
+ *
+ * The profile covers all events registered with PETSc (including
+ * those registered via EventLogger), summed over logging stages. For
+ * each event we compute the minimum, maximum, and mean over processes
+ * of the time, flops, and number of calls along with the load
+ * imbalance (ratio of maximum time to mean time). Events are sorted
+ * by decreasing maximum time, so the most expensive events are listed
+ * first.
+ */
+
+#if !defined(pylith_utils_eventprofile_hh)
+#define pylith_utils_eventprofile_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+#include <iosfwd> // USES std::ostream
+
+#include "petsc.h" // USES MPI_Comm
+
+// EventProfile ---------------------------------------------------------
+/** @brief C++ object for collecting statistics across processes for
+ * PETSc logging events.
+ */
+class pylith::utils::EventProfile
+{ // EventProfile
+  friend class TestEventProfile; // unit testing
+
+// PUBLIC STRUCTS ///////////////////////////////////////////////////////
+public :
+
+  /// Statistics over processes for a single quantity.
+  struct Stats {
+    double min; ///< Minimum over processes.
+    double max; ///< Maximum over processes.
+    double mean; ///< Mean over processes.
+  }; // Stats
+
+  /// Statistics over processes for an event.
+  struct EventStats {
+    std::string name; ///< Name of event.
+    Stats count; ///< Number of calls.
+    Stats time; ///< Time (s).
+    Stats flops; ///< Number of floating point operations.
+    double imbalance; ///< Ratio of maximum time to mean time.
+  }; // EventStats
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  EventProfile(void);
+
+  /// Destructor
+  ~EventProfile(void);
+
+  /** Turn on collection of performance information for events by
+   * PETSc. Must be called before the events to be profiled occur;
+   * this is not needed if PETSc logging was enabled via options
+   * (e.g., -log_view).
+   */
+  static
+  void activate(void);
+
+  /** Collect statistics for events across processes.
+   *
+   * This is a collective operation; all processes must have
+   * registered the same events in the same order.
+   *
+   * @param comm MPI communicator.
+   */
+  void collect(const MPI_Comm comm);
+
+  /** Get number of events in profile.
+   *
+   * Only events called at least once on some process are included.
+   *
+   * @returns Number of events.
+   */
+  int numEvents(void) const;
+
+  /** Get statistics for event.
+   *
+   * @param index Index of event (sorted by decreasing maximum time).
+   * @returns Statistics for event.
+   */
+  const EventStats& eventStats(const int index) const;
+
+  /** Write profile to file. Only the root process writes.
+   *
+   * @param filename Name of file.
+   * @param format Format of file ("json" or "csv").
+   */
+  void write(const char* filename,
+	     const char* format) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute statistics from global sum, min, and max.
+   *
+   * @param stats Statistics to compute.
+   * @param sum Sum over processes.
+   * @param min Minimum over processes.
+   * @param max Maximum over processes.
+   * @param numProcs Number of processes.
+   */
+  static
+  void _calcStats(Stats* stats,
+		  const double sum,
+		  const double min,
+		  const double max,
+		  const int numProcs);
+
+  /** Compute load imbalance for event.
+   *
+   * @param time Statistics for event time.
+   * @returns Ratio of maximum time to mean time (1.0 if no time).
+   */
+  static
+  double _calcImbalance(const Stats& time);
+
+  /** Write profile in JSON format.
+   *
+   * @param sout Output stream.
+   */
+  void _writeJSON(std::ostream& sout) const;
+
+  /** Write profile in CSV format.
+   *
+   * @param sout Output stream.
+   */
+  void _writeCSV(std::ostream& sout) const;
+
+  EventProfile(const EventProfile&); ///< Not implemented
+  const EventProfile& operator=(const EventProfile&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::vector<EventStats> _events; ///< Statistics for events.
+  int _numProcs; ///< Number of processes in profile.
+  int _rank; ///< Rank of this process in profile communicator.
+
+}; // EventProfile
+
+#endif // pylith_utils_eventprofile_hh
+
+
+// End of file 
@@ -0,0 +1,218 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MemoryTracker.hh" // Implementation of class methods
+
+#include <stdexcept> // USES std::logic_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+pylith::utils::MemoryTracker::stage_array_type pylith::utils::MemoryTracker::_stages;
+std::vector<int> pylith::utils::MemoryTracker::_stageStack;
+pylith::utils::MemoryTracker::map_record_type pylith::utils::MemoryTracker::_records;
+size_t pylith::utils::MemoryTracker::_inUse = 0;
+size_t pylith::utils::MemoryTracker::_highWater = 0;
+
+// ----------------------------------------------------------------------
+// Begin stage.
+void
+pylith::utils::MemoryTracker::stagePush(const char* name)
+{ // stagePush
+  assert(name);
+
+  _stageStack.push_back(_stageIndex(name));
+  _updateHighWater();
+} // stagePush
+
+// ----------------------------------------------------------------------
+// End current stage.
+void
+pylith::utils::MemoryTracker::stagePop(void)
+{ // stagePop
+  if (_stageStack.empty())
+    throw std::logic_error("Cannot pop memory stage; no stage is active.");
+
+  _stageStack.pop_back();
+} // stagePop
+
+// ----------------------------------------------------------------------
+// Register (or update) storage allocated by an object.
+void
+pylith::utils::MemoryTracker::allocate(const void* object,
+				       const size_t bytes)
+{ // allocate
+  assert(object);
+
+  // Storage replaced by an object is released before the new storage
+  // is counted.
+  deallocate(object);
+
+  const int stage = (_stageStack.empty()) ? _stageIndex("Main") : _stageStack.back();
+  Record& record = _records[object];
+  record.stage = stage;
+  record.bytes = bytes;
+
+  _inUse += bytes;
+  _stages[stage].inUse += bytes;
+  if (_inUse > _stages[stage].highWater)
+    _stages[stage].highWater = _inUse;
+  _updateHighWater();
+} // allocate
+
+// ----------------------------------------------------------------------
+// Unregister storage allocated by an object.
+void
+pylith::utils::MemoryTracker::deallocate(const void* object)
+{ // deallocate
+  map_record_type::iterator iter = _records.find(object);
+  if (iter == _records.end())
+    return;
+
+  const Record& record = iter->second;
+  assert(record.stage >= 0 && record.stage < int(_stages.size()));
+  assert(_inUse >= record.bytes);
+  assert(_stages[record.stage].inUse >= record.bytes);
+  _inUse -= record.bytes;
+  _stages[record.stage].inUse -= record.bytes;
+  _records.erase(iter);
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Get number of bytes currently allocated.
+size_t
+pylith::utils::MemoryTracker::inUse(void)
+{ // inUse
+  return _inUse;
+} // inUse
+
+// ----------------------------------------------------------------------
+// Get maximum number of bytes allocated at any one time.
+size_t
+pylith::utils::MemoryTracker::highWater(void)
+{ // highWater
+  return _highWater;
+} // highWater
+
+// ----------------------------------------------------------------------
+// Get number of stages.
+int
+pylith::utils::MemoryTracker::numStages(void)
+{ // numStages
+  return _stages.size();
+} // numStages
+
+// ----------------------------------------------------------------------
+// Get name of stage.
+const char*
+pylith::utils::MemoryTracker::stageName(const int index)
+{ // stageName
+  if (index < 0 || index >= int(_stages.size())) {
+    std::ostringstream msg;
+    msg << "Index " << index << " of memory stage is out of range [0, " << _stages.size() << ").";
+    throw std::out_of_range(msg.str());
+  } // if
+
+  return _stages[index].name.c_str();
+} // stageName
+
+// ----------------------------------------------------------------------
+// Get number of bytes allocated by objects registered during stage.
+size_t
+pylith::utils::MemoryTracker::stageInUse(const char* name)
+{ // stageInUse
+  const int numStages = _stages.size();
+  for (int i=0; i < numStages; ++i) {
+    if (_stages[i].name == name) {
+      return _stages[i].inUse;
+    } // if
+  } // for
+
+  return 0;
+} // stageInUse
+
+// ----------------------------------------------------------------------
+// Get maximum number of bytes allocated while stage was active.
+size_t
+pylith::utils::MemoryTracker::stageHighWater(const char* name)
+{ // stageHighWater
+  const int numStages = _stages.size();
+  for (int i=0; i < numStages; ++i) {
+    if (_stages[i].name == name) {
+      return _stages[i].highWater;
+    } // if
+  } // for
+
+  return 0;
+} // stageHighWater
+
+// ----------------------------------------------------------------------
+// Clear all stages and registered objects.
+void
+pylith::utils::MemoryTracker::reset(void)
+{ // reset
+  _stages.clear();
+  _stageStack.clear();
+  _records.clear();
+  _inUse = 0;
+  _highWater = 0;
+} // reset
+
+// ----------------------------------------------------------------------
+// Get index of stage, creating the stage if necessary.
+int
+pylith::utils::MemoryTracker::_stageIndex(const char* name)
+{ // _stageIndex
+  assert(name);
+
+  const int numStages = _stages.size();
+  for (int i=0; i < numStages; ++i) {
+    if (_stages[i].name == name) {
+      return i;
+    } // if
+  } // for
+
+  StageInfo info;
+  info.name = name;
+  info.inUse = 0;
+  info.highWater = 0;
+  _stages.push_back(info);
+
+  return numStages;
+} // _stageIndex
+
+// ----------------------------------------------------------------------
+// Update high-water marks of total and active stages.
+void
+pylith::utils::MemoryTracker::_updateHighWater(void)
+{ // _updateHighWater
+  if (_inUse > _highWater)
+    _highWater = _inUse;
+
+  const int stackSize = _stageStack.size();
+  for (int i=0; i < stackSize; ++i) {
+    StageInfo& info = _stages[_stageStack[i]];
+    if (_inUse > info.highWater)
+      info.highWater = _inUse;
+  } // for
+} // _updateHighWater
+
+
+// End of file 
@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/MemoryTracker.hh
+ *
+ * @brief C++ object for accounting of memory allocated by fields and
+ * matrices.
+ *
+ * Objects register their measured size (in bytes) when they allocate
+ * storage and unregister when they release it. Allocations are
+ * attributed to the stage that is active when they are registered.
+ * All information is local to a process.
+ */
+
+#if !defined(pylith_utils_memorytracker_hh)
+#define pylith_utils_memorytracker_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <cstddef> // USES size_t
+
+// MemoryTracker --------------------------------------------------------
+/** @brief C++ object for accounting of memory allocated by fields and
+ * matrices.
+ */
+class pylith::utils::MemoryTracker
+{ // MemoryTracker
+  friend class TestMemoryTracker; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Begin stage. Subsequent allocations are attributed to this stage.
+   *
+   * @param name Name of stage.
+   */
+  static
+  void stagePush(const char* name);
+
+  /// End current stage.
+  static
+  void stagePop(void);
+
+  /** Register (or update) storage allocated by an object.
+   *
+   * @param object Object holding the storage.
+   * @param bytes Size of storage in bytes.
+   */
+  static
+  void allocate(const void* object,
+		const size_t bytes);
+
+  /** Unregister storage allocated by an object.
+   *
+   * @param object Object holding the storage.
+   */
+  static
+  void deallocate(const void* object);
+
+  /** Get number of bytes currently allocated.
+   *
+   * @returns Number of bytes.
+   */
+  static
+  size_t inUse(void);
+
+  /** Get maximum number of bytes allocated at any one time.
+   *
+   * @returns Number of bytes.
+   */
+  static
+  size_t highWater(void);
+
+  /** Get number of stages.
+   *
+   * @returns Number of stages.
+   */
+  static
+  int numStages(void);
+
+  /** Get name of stage.
+   *
+   * @param index Index of stage.
+   * @returns Name of stage.
+   */
+  static
+  const char* stageName(const int index);
+
+  /** Get number of bytes currently allocated by objects registered
+   * during stage.
+   *
+   * @param name Name of stage.
+   * @returns Number of bytes.
+   */
+  static
+  size_t stageInUse(const char* name);
+
+  /** Get maximum number of bytes allocated at any one time while
+   * stage was active.
+   *
+   * @param name Name of stage.
+   * @returns Number of bytes.
+   */
+  static
+  size_t stageHighWater(const char* name);
+
+  /// Clear all stages and registered objects.
+  static
+  void reset(void);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Accounting for a stage.
+  struct StageInfo {
+    std::string name; ///< Name of stage.
+    size_t inUse; ///< Bytes allocated by objects registered in stage.
+    size_t highWater; ///< Maximum total bytes while stage was active.
+  }; // StageInfo
+
+  /// Storage registered by an object.
+  struct Record {
+    int stage; ///< Index of stage in which storage was registered.
+    size_t bytes; ///< Size of storage in bytes.
+  }; // Record
+
+// PRIVATE TYPEDEFS /////////////////////////////////////////////////////
+private :
+
+  typedef std::vector<StageInfo> stage_array_type;
+  typedef std::map<const void*, Record> map_record_type;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Get index of stage, creating the stage if necessary.
+   *
+   * @param name Name of stage.
+   * @returns Index of stage.
+   */
+  static
+  int _stageIndex(const char* name);
+
+  /// Update high-water marks of total and active stages.
+  static
+  void _updateHighWater(void);
+
+  MemoryTracker(void); ///< Not implemented
+  MemoryTracker(const MemoryTracker&); ///< Not implemented
+  const MemoryTracker& operator=(const MemoryTracker&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  static stage_array_type _stages; ///< Accounting for stages.
+  static std::vector<int> _stageStack; ///< Stack of active stages.
+  static map_record_type _records; ///< Registered objects.
+  static size_t _inUse; ///< Total bytes allocated.
+  static size_t _highWater; ///< Maximum total bytes allocated.
+
+}; // MemoryTracker
+
+#endif // pylith_utils_memorytracker_hh
+
+
+// End of file 
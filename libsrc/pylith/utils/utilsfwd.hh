@@ -31,6 +31,8 @@ namespace pylith {
   namespace utils {
 
     class EventLogger;
+    class EventProfile;
+    class MemoryTracker;
     class PylithVersion;
     class PetscVersion;
     class DependenciesVersion;
@@ -61,6 +61,13 @@ namespace pylith {
        */
       int numVerticesNoMesh(const pylith::topology::Mesh& mesh) const;
 
+      /** Label points to split for fault implementation without
+       * adjusting mesh topology.
+       *
+       * @param mesh PETSc mesh.
+       */
+      void labelTopology(pylith::topology::Mesh* const mesh);
+
       /** Adjust mesh topology for fault implementation.
        *
        * @param mesh PETSc mesh.
@@ -109,6 +109,13 @@ namespace pylith {
        */
       void updateStateVars(const PylithScalar t,
 			   pylith::topology::SolutionFields* const fields);
+
+      /** Get stable time step for advancing from time t to time t+dt.
+       *
+       * @param mesh Finite-element mesh.
+       * @returns Time step
+       */
+      PylithScalar stableTimeStep(const pylith::topology::Mesh& mesh);
       
       /** Constrain solution space based on friction.
        *
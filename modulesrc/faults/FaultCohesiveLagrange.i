@@ -59,6 +59,50 @@ namespace pylith {
        */
       void setupSolnDof(pylith::topology::Field* field);
 
+      /** Turn on/off accumulation of rupture metrics (rupture time, peak
+       * slip rate and its time, cumulative slip) at fault vertices and
+       * global rupture area, potency, and moment rate.
+       *
+       * @param value True if rupture metrics should be computed.
+       */
+      void ruptureMetrics(const bool value);
+
+      /** Set slip rate threshold for rupture time.
+       *
+       * @param value Slip rate threshold (dimensional).
+       */
+      void ruptureSlipRateThreshold(const PylithScalar value);
+
+      /** Set shear modulus for computing moment rate from potency rate.
+       *
+       * @param value Shear modulus (dimensional).
+       */
+      void ruptureShearModulus(const PylithScalar value);
+
+      /** Set name of file for time history of global rupture metrics.
+       *
+       * @param filename Name of file (empty for no file).
+       */
+      void ruptureMetricsFilename(const char* filename);
+
+      /** Get area of fault that has ruptured.
+       *
+       * @returns Rupture area (dimensional).
+       */
+      PylithScalar ruptureArea(void) const;
+
+      /** Get potency (integral of shear slip magnitude over the fault).
+       *
+       * @returns Potency (dimensional).
+       */
+      PylithScalar potency(void) const;
+
+      /** Get moment rate.
+       *
+       * @returns Moment rate (dimensional).
+       */
+      PylithScalar momentRate(void) const;
+
       /** Integrate contributions to residual term (r) for operator that
        * do not require assembly across processors.
        *
@@ -47,6 +47,13 @@ namespace pylith {
        */
       void material(pylith::materials::ElasticMaterial* m);
       
+      /** Set flag for computing cell fields averaged over the
+       * quadrature points of each cell.
+       *
+       * @param flag True to average cell fields, false otherwise.
+       */
+      void averageCellOutput(const bool flag);
+      
       /** Determine whether we need to recompute the Jacobian.
        *
        * @returns True if Jacobian needs to be recomputed, false otherwise.
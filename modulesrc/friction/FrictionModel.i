@@ -69,6 +69,13 @@ namespace pylith {
        */
       PylithScalar timeStep(void) const;
 
+      /** Get stable time step for advancing state variables.
+       *
+       * @returns Time step
+       */
+      virtual
+      PylithScalar stableTimeStep(void) const;
+
       /** Set database for physical property parameters.
        *
        * @param value Pointer to database.
@@ -43,6 +43,33 @@ namespace pylith {
        */
       void linearSlipRate(const PylithScalar value);
 
+      /** Set tolerance for relative error in state variable over a
+       * time step.
+       *
+       * @param value Relative tolerance.
+       */
+      void stateTolerance(const PylithScalar value);
+
+      /** Set maximum number of substeps used to integrate state
+       * variable over a time step.
+       *
+       * @param value Maximum number of substeps.
+       */
+      void maxSubsteps(const int value);
+
+      /** Set maximum slip in a time step as a fraction of the
+       * characteristic slip distance used for stable time step.
+       *
+       * @param value Fraction of characteristic slip distance.
+       */
+      void maxSlipFraction(const PylithScalar value);
+
+      /** Get stable time step for advancing state variables.
+       *
+       * @returns Time step
+       */
+      PylithScalar stableTimeStep(void) const;
+
       // PROTECTED METHODS //////////////////////////////////////////////
     protected :
 
@@ -110,10 +110,12 @@ namespace pylith {
        * @param t Time associated with field.
        * @param field Field over vertices.
        * @param mesh Mesh for output.
+       * @param scale Scale applied to values as they are written.
        */
       void writeVertexField(const PylithScalar t,
 			    pylith::topology::Field& field,
-			    const pylith::topology::Mesh& mesh);
+			    const pylith::topology::Mesh& mesh,
+			    const PylithScalar scale =1.0);
       
       /** Write field over cells to file.
        *
@@ -122,11 +124,13 @@ namespace pylith {
        * @param label Name of label defining cells to include in output
        *   (=0 means use all cells in mesh).
        * @param labelId Value of label defining which cells to include.
+       * @param scale Scale applied to values as they are written.
        */
       void writeCellField(const PylithScalar t,
 			  pylith::topology::Field& field,
 			  const char* label =0,
-			  const int labelId =0);
+			  const int labelId =0,
+			  const PylithScalar scale =1.0);
       
     }; // DataWriterVTK
 
@@ -0,0 +1,152 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/DataWriterVTU.i
+ *
+ * @brief Python interface to C++ DataWriterVTU object.
+ */
+
+namespace pylith {
+  namespace meshio {
+
+    class pylith::meshio::DataWriterVTU : public DataWriter
+    { // DataWriterVTU  
+      
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      DataWriterVTU(void);
+      
+      /// Destructor
+      ~DataWriterVTU(void);
+      
+      /** Make copy of this object.
+       *
+       * @returns Copy of this.
+       */
+      DataWriter* clone(void) const;
+      
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+  
+      /** Set filename for VTK collection (.pvd) file.
+       *
+       * The names of the files for each time step are generated from
+       * this name.
+       *
+       * @param filename Name of VTK collection file.
+       */
+      void filename(const char* filename);
+      
+      /** Set time format for time stamp in name of VTK files.
+       *
+       * @param format C style time format for filename.
+       */
+      void timeFormat(const char* format);
+      
+      /** Set value used to normalize time stamp in name of VTK files.
+       *
+       * Time stamp is divided by this value (time in seconds).
+       *
+       * @param value Value (time in seconds) used to normalize time stamp in
+       * filename.
+       */
+      void timeConstant(const PylithScalar value);
+      
+      /** Set flag indicating whether to store floating point values as
+       * 32-bit floats.
+       *
+       * @param value True if values are stored as 32-bit floats, false
+       * if values are stored as 64-bit floats.
+       */
+      void float32(const bool value);
+
+      /** Set encoding of appended binary data.
+       *
+       * @param value Encoding ("raw" or "base64").
+       */
+      void encoding(const char* value);
+
+      /** Prepare for writing files.
+       *
+       * @param mesh Finite-element mesh. 
+       * @param numTimeSteps Expected number of time steps for fields.
+       * @param label Name of label defining cells to include in output
+       *   (=0 means use all cells in mesh).
+       * @param labelId Value of label defining which cells to include.
+       */
+      void open(const pylith::topology::Mesh& mesh,
+		const int numTimeSteps,
+		const char* label =0,
+		const int labelId =0);
+      
+      /// Close output files.
+      void close(void);
+
+      /** Prepare file for data at a new time step.
+       *
+       * @param t Time stamp for new data
+       * @param mesh Finite-element mesh.
+       * @param label Name of label defining cells to include in output
+       *   (=0 means use all cells in mesh).
+       * @param labelId Value of label defining which cells to include.
+       */
+      void openTimeStep(const PylithScalar t,
+			const pylith::topology::Mesh& mesh,
+			const char* label =0,
+			const int labelId =0);
+      
+      /// Write files for time step.
+      void closeTimeStep(void);
+      
+      /** Write field over vertices to file.
+       *
+       * @param t Time associated with field.
+       * @param field Field over vertices.
+       * @param mesh Mesh for output.
+       * @param scale Scale applied to values as they are written.
+       */
+      void writeVertexField(const PylithScalar t,
+			    pylith::topology::Field& field,
+			    const pylith::topology::Mesh& mesh,
+			    const PylithScalar scale =1.0);
+      
+      /** Write field over cells to file.
+       *
+       * @param t Time associated with field.
+       * @param field Field over cells.
+       * @param label Name of label defining cells to include in output
+       *   (=0 means use all cells in mesh).
+       * @param labelId Value of label defining which cells to include.
+       * @param scale Scale applied to values as they are written.
+       */
+      void writeCellField(const PylithScalar t,
+			  pylith::topology::Field& field,
+			  const char* label =0,
+			  const int labelId =0,
+			  const PylithScalar scale =1.0);
+      
+    }; // DataWriterVTU
+
+  } // meshio
+} // pylith
+
+
+// End of file 
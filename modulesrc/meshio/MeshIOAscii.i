@@ -52,6 +52,18 @@ namespace pylith {
        */
       const char* filename(void) const;
 
+      /** Set flag for using binary cache of mesh file.
+       *
+       * @param value True if cache should be used, false otherwise.
+       */
+      void useCache(const bool value);
+
+      /** Get flag for using binary cache of mesh file.
+       *
+       * @returns True if cache is used, false otherwise.
+       */
+      bool useCache(void) const;
+
       // PROTECTED METHODS //////////////////////////////////////////////
     protected :
 
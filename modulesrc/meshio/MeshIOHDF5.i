@@ -0,0 +1,70 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/MeshIOHDF5.i
+ *
+ * @brief Python interface to C++ MeshIOHDF5 object.
+ */
+
+namespace pylith {
+  namespace meshio {
+
+    class MeshIOHDF5 : public MeshIO
+    { // MeshIOHDF5
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      MeshIOHDF5(void);
+
+      /// Destructor
+      ~MeshIOHDF5(void);
+
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+  
+      /** Set filename for HDF5 mesh file.
+       *
+       * @param filename Name of file
+       */
+      void filename(const char* name);
+      
+      /** Get filename of HDF5 mesh file.
+       *
+       * @returns Name of file
+       */
+      const char* filename(void) const;
+
+      // PROTECTED METHODS ////////////////////////////////////////////////////
+    protected :
+      
+      /// Write mesh
+      void _write(void) const;
+      
+      /// Read mesh
+      void _read(void);
+      
+    }; // MeshIOHDF5
+
+  } // meshio
+} // pylith
+
+
+// End of file 
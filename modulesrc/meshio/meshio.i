@@ -34,12 +34,14 @@
 #include "pylith/meshio/CellFilterAvg.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
+#include "pylith/meshio/DataWriterVTU.hh"
 #include "pylith/meshio/OutputManager.hh"
 #include "pylith/meshio/OutputSolnSubset.hh"
 #include "pylith/meshio/OutputSolnPoints.hh"
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
+#include "pylith/meshio/MeshIOHDF5.hh"
 #endif
 
 #include "pylith/utils/arrayfwd.hh"
@@ -82,12 +84,14 @@ import_array();
 %include "CellFilterAvg.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
+%include "DataWriterVTU.i"
 %include "OutputManager.i"
 %include "OutputSolnSubset.i"
 %include "OutputSolnPoints.i"
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
+%include "MeshIOHDF5.i"
 #endif
 
 // End of file
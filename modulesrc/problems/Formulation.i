@@ -66,6 +66,21 @@ namespace pylith {
        */
       bool useCustomConstraintPC(void) const;
 
+      /** Set flag for using the block diagonal (rather than diagonal)
+       * of the elasticity Jacobian in the custom preconditioner for
+       * Lagrange constraints.
+       *
+       * @param flag True if using block diagonal, false otherwise.
+       */
+      void useBlockConstraintPC(const bool flag);
+
+      /** Get flag indicating use of block diagonal in custom
+       * preconditioner for Lagrange constraints.
+       *
+       * @returns True if using block diagonal, false otherwise.
+       */
+      bool useBlockConstraintPC(void) const;
+
       /** Get solution fields.
        *
        * @returns solution fields.
@@ -52,6 +52,28 @@ namespace pylith {
        */
       void skipNullSpaceCreation(const bool value);
 
+      /** Set flag for using geometric multigrid preconditioner.
+       *
+       * The hierarchy comes from uniform refinement of the mesh
+       * (RefineUniform). With split fields, multigrid is used for the
+       * displacement block.
+       *
+       * @param[in] value True to use geometric multigrid.
+       */
+      void useMultigrid(const bool value);
+
+      /** Get number of Krylov iterations in most recent solve.
+       *
+       * @returns Number of linear iterations (0 if no iterative solve).
+       */
+      int numIterations(void) const;
+
+      /** Check whether most recent solve converged.
+       *
+       * @returns True if solver converged (true if no iterative solve).
+       */
+      bool converged(void) const;
+
       /** Initialize solver.
        *
        * @param fields Solution fields.
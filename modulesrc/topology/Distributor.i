@@ -48,6 +48,27 @@ namespace pylith {
 		      const pylith::topology::Mesh& origMesh,
 		      const char* partitionerName);
 
+      /** Distribute mesh among processors, keeping both cells
+       * adjacent to each fault face on the same processor.
+       *
+       * @param newMesh Distributed mesh (result).
+       * @param origMesh Mesh to distribute.
+       * @param partitionerName Name of PETSc partitioner to use in distributing mesh.
+       * @param faultLabels Array of names of groups of fault vertices.
+       * @param numFaultLabels Number of fault groups.
+       */
+      %apply(const char* const* string_list, const int list_len){
+	(const char* const* faultLabels,
+	 const int numFaultLabels)
+	  };
+      static
+      void distributeWithFaults(pylith::topology::Mesh* const newMesh,
+				const pylith::topology::Mesh& origMesh,
+				const char* partitionerName,
+				const char* const* faultLabels,
+				const int numFaultLabels);
+      %clear(const char* const* faultLabels, const int numFaultLabels);
+
       /** Write partitioning info for distributed mesh.
        *
        * @param writer Data writer for partition information.
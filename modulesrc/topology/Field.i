@@ -115,6 +115,13 @@ namespace pylith {
        */
       int sectionSize(void) const;
       
+      /** Get number of bytes allocated for values and layout of field
+       * on this process.
+       *
+       * @returns Number of bytes.
+       */
+      size_t memoryUse(void) const;
+
       /** Has section been setup?
        *
        * @returns True if section has been setup.
@@ -239,6 +246,18 @@ namespace pylith {
       void createScatter(const pylith::topology::Mesh& mesh,
 			 const char* context ="");
 
+      /** Keep constrained DOF in the global PETSc vector of the field.
+       *
+       * Must be called after constraints are set.
+       */
+      void keepConstrainedDOF(void);
+
+      /** Check whether the global PETSc vector includes constrained DOF.
+       *
+       * @returns True if keepConstrainedDOF() was called, false otherwise.
+       */
+      bool keepsConstrainedDOF(void) const;
+
       /** Get PETSc vector associated with field.
        *
        * @param context Label for context associated with vector.
@@ -291,4 +310,129 @@ namespace pylith {
 } // pylith
 
 
+// Zero-copy NumPy views of the local vector and copies of the section
+// layout.
+%extend pylith::topology::Field {
+
+  /** Get NumPy array sharing memory with the local PETSc vector.
+   *
+   * The array is valid only until _restoreLocalArray() is called;
+   * use the localArray() context manager rather than calling this
+   * directly.
+   *
+   * @param writable True if values may be modified, false for read-only.
+   * @returns NumPy array with values of field at local points.
+   */
+  PyObject* _getLocalArray(const bool writable) {
+    PetscVec vec = $self->localVector();
+    if (!vec) {
+      throw std::runtime_error("Cannot get array for field without local vector.");
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscInt size = 0;
+    err = VecGetLocalSize(vec, &size);PYLITH_CHECK_ERROR(err);
+    PetscScalar* values = NULL;
+    if (writable) {
+      err = VecGetArray(vec, &values);PYLITH_CHECK_ERROR(err);
+    } else {
+      err = VecGetArrayRead(vec, (const PetscScalar**)&values);PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    npy_intp dims[1] = { size };
+    const int typenum = (sizeof(double) == sizeof(PetscScalar)) ? NPY_DOUBLE : NPY_FLOAT;
+    PyObject* array = PyArray_SimpleNewFromData(1, dims, typenum, (void*)values);
+    if (!array) {
+      throw std::runtime_error("Could not create NumPy array for local vector of field.");
+    } // if
+    if (!writable) {
+      PyArray_CLEARFLAGS((PyArrayObject*)array, NPY_ARRAY_WRITEABLE);
+    } // if
+
+    return array;
+  } // _getLocalArray
+
+  /** Release NumPy array obtained from _getLocalArray().
+   *
+   * @param array NumPy array from _getLocalArray().
+   * @param writable Value of writable used in _getLocalArray().
+   */
+  void _restoreLocalArray(PyObject* array,
+			  const bool writable) {
+    if (!array || !PyArray_Check(array)) {
+      throw std::runtime_error("Expecting NumPy array from _getLocalArray().");
+    } // if
+    PetscVec vec = $self->localVector();assert(vec);
+
+    PetscErrorCode err = 0;
+    PetscScalar* values = (PetscScalar*) PyArray_DATA((PyArrayObject*)array);
+    if (writable) {
+      err = VecRestoreArray(vec, &values);PYLITH_CHECK_ERROR(err);
+    } else {
+      err = VecRestoreArrayRead(vec, (const PetscScalar**)&values);PYLITH_CHECK_ERROR(err);
+    } // if/else
+  } // _restoreLocalArray
+
+  /** Get number of degrees of freedom and offsets into the local
+   * vector for each point in the chart of the section.
+   *
+   * PetscSection does not expose its storage, so the layout is
+   * copied (two integers per point).
+   *
+   * @returns Tuple of NumPy arrays (dofs, offsets).
+   */
+  PyObject* sectionLayout(void) {
+    PetscSection section = $self->localSection();
+    if (!section) {
+      throw std::runtime_error("Cannot get layout for field without section.");
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    npy_intp dims[1] = { pEnd - pStart };
+    const int typenum = (8 == sizeof(PetscInt)) ? NPY_INT64 : NPY_INT32;
+    PyObject* dofs = PyArray_SimpleNew(1, dims, typenum);
+    PyObject* offsets = PyArray_SimpleNew(1, dims, typenum);
+    if (!dofs || !offsets) {
+      Py_XDECREF(dofs);
+      Py_XDECREF(offsets);
+      throw std::runtime_error("Could not create NumPy arrays for section layout of field.");
+    } // if
+    PetscInt* dofsData = (PetscInt*) PyArray_DATA((PyArrayObject*)dofs);
+    PetscInt* offsetsData = (PetscInt*) PyArray_DATA((PyArrayObject*)offsets);
+    for (PetscInt p=pStart, i=0; p < pEnd; ++p, ++i) {
+      err = PetscSectionGetDof(section, p, &dofsData[i]);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetOffset(section, p, &offsetsData[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    return Py_BuildValue("(NN)", dofs, offsets);
+  } // sectionLayout
+
+  %pythoncode %{
+  def localArray(self, writable=False):
+    """
+    Context manager providing a NumPy array that shares memory with
+    the local PETSc vector of the field. The array must not be used
+    after the context exits.
+
+    with field.localArray() as values:
+      ...
+    """
+    import contextlib
+
+    @contextlib.contextmanager
+    def _view(field, writable):
+      array = field._getLocalArray(writable)
+      try:
+        yield array
+      finally:
+        field._restoreLocalArray(array, writable)
+    return _view(self, writable)
+  %}
+
+} // Field
+
+
 // End of file 
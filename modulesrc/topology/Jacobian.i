@@ -66,6 +66,12 @@ namespace pylith {
        */
       const char* matrixType(void) const;
 
+      /** Get number of bytes allocated for sparse matrix on this process.
+       *
+       * @returns Number of bytes.
+       */
+      size_t memoryUse(void) const;
+
       /** Assemble matrix.
        *
        * @param mode Assembly mode.
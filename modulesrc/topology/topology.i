@@ -31,6 +31,8 @@
 #include "pylith/topology/Distributor.hh"
 #include "pylith/topology/RefineUniform.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 %}
 
 %include "exception.i"
@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/EventProfile.i
+ *
+ * @brief Python interface to C++ EventProfile.
+ */
+
+
+namespace pylith {
+  namespace utils {
+
+    class EventProfile
+    { // EventProfile
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      EventProfile(void);
+
+      /// Destructor
+      ~EventProfile(void);
+
+      /** Turn on collection of performance information for events by
+       * PETSc. Must be called before the events to be profiled occur.
+       */
+      static
+      void activate(void);
+
+      /** Collect statistics for events across processes.
+       *
+       * This is a collective operation.
+       *
+       * @param comm MPI communicator.
+       */
+      void collect(const MPI_Comm comm);
+
+      /** Get number of events in profile.
+       *
+       * @returns Number of events.
+       */
+      int numEvents(void) const;
+
+      /** Write profile to file. Only the root process writes.
+       *
+       * @param filename Name of file.
+       * @param format Format of file ("json" or "csv").
+       */
+      void write(const char* filename,
+		 const char* format) const;
+
+    }; // EventProfile
+
+  } // utils
+} // pylith
+
+
+// End of file 
@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/MemoryTracker.i
+ *
+ * @brief Python interface to C++ MemoryTracker.
+ */
+
+
+namespace pylith {
+  namespace utils {
+
+    class MemoryTracker
+    { // MemoryTracker
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Begin stage. Subsequent allocations are attributed to this stage.
+       *
+       * @param name Name of stage.
+       */
+      static
+      void stagePush(const char* name);
+
+      /// End current stage.
+      static
+      void stagePop(void);
+
+      /** Get number of bytes currently allocated.
+       *
+       * @returns Number of bytes.
+       */
+      static
+      size_t inUse(void);
+
+      /** Get maximum number of bytes allocated at any one time.
+       *
+       * @returns Number of bytes.
+       */
+      static
+      size_t highWater(void);
+
+      /** Get number of stages.
+       *
+       * @returns Number of stages.
+       */
+      static
+      int numStages(void);
+
+      /** Get name of stage.
+       *
+       * @param index Index of stage.
+       * @returns Name of stage.
+       */
+      static
+      const char* stageName(const int index);
+
+      /** Get number of bytes currently allocated by objects registered
+       * during stage.
+       *
+       * @param name Name of stage.
+       * @returns Number of bytes.
+       */
+      static
+      size_t stageInUse(const char* name);
+
+      /** Get maximum number of bytes allocated at any one time while
+       * stage was active.
+       *
+       * @param name Name of stage.
+       * @returns Number of bytes.
+       */
+      static
+      size_t stageHighWater(const char* name);
+
+      /// Clear all stages and registered objects.
+      static
+      void reset(void);
+
+    private :
+
+      MemoryTracker(void); ///< Not implemented
+
+    }; // MemoryTracker
+
+  } // utils
+} // pylith
+
+
+// End of file 
@@ -22,6 +22,8 @@
 // Header files for module C++ code
 %{
 #include "pylith/utils/EventLogger.hh"
+#include "pylith/utils/EventProfile.hh"
+#include "pylith/utils/MemoryTracker.hh"
 #include "pylith/utils/PylithVersion.hh"
 #include "pylith/utils/PetscVersion.hh"
 #include "pylith/utils/DependenciesVersion.hh"
@@ -56,6 +58,8 @@ import_array();
 // Interfaces
 %include "pylith_general.i"
 %include "EventLogger.i"
+%include "EventProfile.i"
+%include "MemoryTracker.i"
 %include "PylithVersion.i"
 %include "PetscVersion.i"
 %include "DependenciesVersion.i"
@@ -47,6 +47,7 @@ class PyLithApp(PetscApplication):
         # @li \b mesher Generates or imports the computational mesh.
         # @li \b problem Computational problem to solve
         # @li \b petsc Manager for PETSc options
+        # @li \b event_profiler Statistics across processes for logging events.
 
         import pyre.inventory
 
@@ -75,6 +76,10 @@ class PyLithApp(PetscApplication):
         perfLogger = pyre.inventory.facility("perf_logger", family="perf_logger", factory=MemoryLogger)
         perfLogger.meta['tip'] = "Performance and memory logging."
 
+        from pylith.utils.EventProfiler import EventProfiler
+        eventProfiler = pyre.inventory.facility("event_profiler", family="event_profiler", factory=EventProfiler)
+        eventProfiler.meta['tip'] = "Statistics across processes for logging events."
+
 
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -106,9 +111,11 @@ class PyLithApp(PetscApplication):
         self._debug.log(resourceUsageString())
 
         self._setupLogging()
+        self.eventProfiler.initialize()
 
         # Create mesh (adjust to account for interfaces (faults) if necessary)
         self._eventLogger.stagePush("Meshing")
+        self.perfLogger.stagePush("Meshing")
         interfaces = None
         if "interfaces" in dir(self.problem):
             interfaces = self.problem.interfaces.components()
@@ -116,10 +123,12 @@ class PyLithApp(PetscApplication):
         del interfaces
         del self.mesher
         self._debug.log(resourceUsageString())
+        self.perfLogger.stagePop()
         self._eventLogger.stagePop()
 
         # Setup problem, verify configuration, and then initialize
         self._eventLogger.stagePush("Setup")
+        self.perfLogger.stagePush("Setup")
         self.problem.preinitialize(mesh)
         self._debug.log(resourceUsageString())
 
@@ -128,6 +137,7 @@ class PyLithApp(PetscApplication):
         self.problem.initialize()
         self._debug.log(resourceUsageString())
 
+        self.perfLogger.stagePop()
         self._eventLogger.stagePop()
 
         # If initializing only, stop before running problem
@@ -140,9 +150,13 @@ class PyLithApp(PetscApplication):
 
         # Cleanup
         self._eventLogger.stagePush("Finalize")
+        self.perfLogger.stagePush("Finalize")
         self.problem.finalize()
+        self.perfLogger.stagePop()
         self._eventLogger.stagePop()
 
+        self.eventProfiler.finalize()
+
         self.perfLogger.logMesh('Mesh', mesh)
         self.compilePerformanceLog()
         if self.perfLogger.verbose:
@@ -271,6 +285,7 @@ class PyLithApp(PetscApplication):
         self.mesher = self.inventory.mesher
         self.problem = self.inventory.problem
         self.perfLogger = self.inventory.perfLogger
+        self.eventProfiler = self.inventory.eventProfiler
 
         import journal
         self._debug = journal.debug(self.name)
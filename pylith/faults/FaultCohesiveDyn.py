@@ -24,14 +24,14 @@
 ##
 ## Factory: fault
 
-from FaultCohesive import FaultCohesive
+from FaultCohesiveLagrange import FaultCohesiveLagrange
 from pylith.feassemble.Integrator import Integrator
 from faults import FaultCohesiveDyn as ModuleFaultCohesiveDyn
 
 from pylith.utils.NullComponent import NullComponent
 
 # FaultCohesiveDyn class
-class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
+class FaultCohesiveDyn(FaultCohesiveLagrange, Integrator, ModuleFaultCohesiveDyn):
   """
   Python object for a fault surface with kinematic (prescribed) slip
   implemented with cohesive elements.
@@ -88,7 +88,7 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     """
     Initialize configuration.
     """
-    FaultCohesive.__init__(self, name)
+    FaultCohesiveLagrange.__init__(self, name)
     Integrator.__init__(self)
     self._loggingPrefix = "CoDy "
 
@@ -209,7 +209,7 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     """
     Setup members using inventory.
     """
-    FaultCohesive._configure(self)
+    FaultCohesiveLagrange._configure(self)
     if not isinstance(self.inventory.tract, NullComponent):
       ModuleFaultCohesiveDyn.tractPerturbation(self, self.inventory.tract)
     ModuleFaultCohesiveDyn.frictionModel(self, self.inventory.friction)
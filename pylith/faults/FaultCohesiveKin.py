@@ -24,7 +24,7 @@
 ##
 ## Factory: fault
 
-from FaultCohesive import FaultCohesive
+from FaultCohesiveLagrange import FaultCohesiveLagrange
 from pylith.feassemble.Integrator import Integrator
 from faults import FaultCohesiveKin as ModuleFaultCohesiveKin
 
@@ -40,7 +40,7 @@ def eqsrcFactory(name):
 
 
 # FaultCohesiveKin class
-class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
+class FaultCohesiveKin(FaultCohesiveLagrange, Integrator, ModuleFaultCohesiveKin):
   """
   Python object for a fault surface with kinematic (prescribed) slip
   implemented with cohesive elements.
@@ -80,7 +80,7 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
     """
     Initialize configuration.
     """
-    FaultCohesive.__init__(self, name)
+    FaultCohesiveLagrange.__init__(self, name)
     Integrator.__init__(self)
     self._loggingPrefix = "CoKi "
 
@@ -210,7 +210,7 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
     """
     Setup members using inventory.
     """
-    FaultCohesive._configure(self)
+    FaultCohesiveLagrange._configure(self)
     self.eqsrcs = self.inventory.eqsrcs
     self.output = self.inventory.output
     return
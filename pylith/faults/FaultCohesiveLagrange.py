@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/faults/FaultCohesiveLagrange.py
+##
+
+## @brief Python abstract base class for a fault surface implemented
+## with cohesive elements and Lagrange multiplier constraints.
+##
+## Factory: fault
+
+from FaultCohesive import FaultCohesive
+from faults import FaultCohesiveLagrange as ModuleFaultCohesiveLagrange
+
+# FaultCohesiveLagrange class
+class FaultCohesiveLagrange(FaultCohesive):
+  """
+  Python abstract base class for a fault surface implemented with
+  cohesive elements and Lagrange multiplier constraints.
+
+  Inventory
+
+  @class Inventory
+  Python object for managing FaultCohesiveLagrange facilities and properties.
+  
+  \b Properties
+  @li \b rupture_metrics If True, accumulate rupture metrics.
+  @li \b rupture_slip_rate_threshold Slip rate threshold for rupture time.
+  @li \b rupture_shear_modulus Shear modulus for moment rate.
+  @li \b rupture_metrics_filename Name of file for time history of
+    global rupture metrics.
+  
+  \b Facilities
+  @li None
+
+  Factory: fault
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  from pyre.units.length import m
+  from pyre.units.time import s
+  from pyre.units.pressure import GPa
+
+  ruptureMetrics = pyre.inventory.bool("rupture_metrics", default=False)
+  ruptureMetrics.meta['tip'] = "If True, accumulate rupture time, peak slip " \
+      "rate, and cumulative slip at vertices and global rupture area, " \
+      "potency, and moment rate."
+
+  ruptureSlipRateThreshold = pyre.inventory.dimensional("rupture_slip_rate_threshold", default=1.0e-3*m/s)
+  ruptureSlipRateThreshold.meta['tip'] = "Slip rate threshold for rupture time."
+
+  ruptureShearModulus = pyre.inventory.dimensional("rupture_shear_modulus", default=30.0*GPa)
+  ruptureShearModulus.meta['tip'] = "Shear modulus for moment rate."
+
+  ruptureMetricsFilename = pyre.inventory.str("rupture_metrics_filename", default="")
+  ruptureMetricsFilename.meta['tip'] = "Name of file for time history of " \
+      "rupture area, potency, and moment rate (empty for no file)."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="faultcohesivelagrange"):
+    """
+    Constructor.
+    """
+    FaultCohesive.__init__(self, name)
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Setup members using inventory.
+    """
+    FaultCohesive._configure(self)
+    ModuleFaultCohesiveLagrange.ruptureMetrics(self, self.inventory.ruptureMetrics)
+    ModuleFaultCohesiveLagrange.ruptureSlipRateThreshold(self, self.inventory.ruptureSlipRateThreshold.value)
+    ModuleFaultCohesiveLagrange.ruptureShearModulus(self, self.inventory.ruptureShearModulus.value)
+    ModuleFaultCohesiveLagrange.ruptureMetricsFilename(self, self.inventory.ruptureMetricsFilename)
+    if self.inventory.ruptureMetrics:
+      self.availableFields['vertex']['data'] += ["rupture_time",
+                                                 "peak_slip_rate",
+                                                 "peak_slip_rate_time",
+                                                 "cumulative_slip"]
+    return
+
+  
+# End of file
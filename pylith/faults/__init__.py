@@ -25,6 +25,7 @@ __all__ = ['BruneSlipFn',
            'EqKinSrc',
            'Fault',
            'FaultCohesive',
+           'FaultCohesiveLagrange',
            'FaultCohesiveKin',
            'FaultCohesiveDyn',
            'SlipTimeFn',
@@ -174,6 +174,13 @@ class IntegratorElasticity(Integrator):
     Initialize output.
     """
     self.output.initialize(normalizer, self.materialObj.quadrature)
+
+    # Average cell fields as they are computed rather than filtering
+    # fields with values at all quadrature points.
+    from pylith.meshio.CellFilterAvg import CellFilterAvg
+    if isinstance(self.output.inventory.cellFilter, CellFilterAvg):
+      self.averageCellOutput(True)
+
     self.output.writeInfo()
     self.output.open(totalTime, numTimeSteps)
     return
@@ -46,6 +46,12 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
     ## \b Properties
     ## @li \b linear_slip_rate Nondimensional slip rate below which friction 
     ## varies linearly with slip rate.
+    ## @li \b state_tolerance Tolerance for relative error in state
+    ## variable over a time step.
+    ## @li \b max_substeps Maximum number of substeps for integrating
+    ## state variable over a time step.
+    ## @li \b max_slip_fraction Maximum slip in a time step as a fraction
+    ## of the characteristic slip distance (for adaptive time stepping).
     ##
     ## \b Facilities
     ## @li None
@@ -57,6 +63,21 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
     linearSlipRate.meta['tip'] = "Nondimensional slip rate below which friction " \
         "varies linearly with slip rate."
 
+    stateTolerance = pyre.inventory.float("state_tolerance", default=1.0e-6,
+                                          validator=pyre.inventory.greater(0.0))
+    stateTolerance.meta['tip'] = "Tolerance for relative error in state " \
+        "variable over a time step."
+
+    maxSubsteps = pyre.inventory.int("max_substeps", default=100,
+                                     validator=pyre.inventory.greater(0))
+    maxSubsteps.meta['tip'] = "Maximum number of substeps for integrating " \
+        "state variable over a time step."
+
+    maxSlipFraction = pyre.inventory.float("max_slip_fraction", default=0.5,
+                                           validator=pyre.inventory.greater(0.0))
+    maxSlipFraction.meta['tip'] = "Maximum slip in a time step as a fraction " \
+        "of the characteristic slip distance (for adaptive time stepping)."
+
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
   def __init__(self, name="ratestateageing"):
@@ -72,7 +93,8 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
                      "constitutive_parameter_a",
                      "constitutive_parameter_b",
                      "cohesion"],
-            'data': ["state_variable"]},
+            'data': ["state_variable",
+                     "previous_slip_rate"]},
          'cell': \
            {'info': [],
             'data': []}}
@@ -89,6 +111,9 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
     try:
       FrictionModel._configure(self)
       ModuleRateStateAgeing.linearSlipRate(self, self.inventory.linearSlipRate)
+      ModuleRateStateAgeing.stateTolerance(self, self.inventory.stateTolerance)
+      ModuleRateStateAgeing.maxSubsteps(self, self.inventory.maxSubsteps)
+      ModuleRateStateAgeing.maxSlipFraction(self, self.inventory.maxSlipFraction)
     except ValueError, err:
       aliases = ", ".join(self.aliases)
       raise ValueError("Error while configuring friction model "
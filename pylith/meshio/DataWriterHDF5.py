@@ -72,15 +72,8 @@ class DataWriterHDF5(DataWriter, ModuleDataWriterHDF5):
     """
     Close writer.
     """
+    # Xdmf file is updated by the C++ object after each time step.
     ModuleDataWriterHDF5.close(self)
-
-    # Only write Xdmf file on proc 0
-    from pylith.mpi.Communicator import mpi_comm_world
-    comm = mpi_comm_world()
-    if not comm.rank:
-      from Xdmf import Xdmf
-      xdmf = Xdmf()
-      xdmf.write(ModuleDataWriterHDF5.hdf5Filename(self), verbose=False)
     return
   
   
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/DataWriterVTU.py
+##
+## @brief Python object for writing finite-element data to XML VTK
+## files with binary data.
+
+from DataWriter import DataWriter
+from meshio import DataWriterVTU as ModuleDataWriterVTU
+
+# DataWriterVTU class
+class DataWriterVTU(DataWriter, ModuleDataWriterVTU):
+  """
+  Python object for writing finite-element data to XML VTK files with
+  binary data.
+
+  Each process writes a separate unstructured grid (.vtu) file for
+  each time step. A parallel unstructured grid (.pvtu) file for each
+  time step references these pieces and a collection (.pvd) file
+  lists all of the time steps.
+
+  Inventory
+
+  \b Properties
+  @li \b filename Name of VTK collection (.pvd) file.
+  @li \b time_format C style format string for time stamp in filename.
+  @li \b time_constant Value used to normalize time stamp in filename.
+  @li \b float32 Store floating point values as 32-bit floats.
+  @li \b encoding Encoding of binary data ('raw' or 'base64').
+  
+  \b Facilities
+  @li None
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  filename = pyre.inventory.str("filename", default="output.pvd")
+  filename.meta['tip'] = "Name of VTK collection (.pvd) file."
+
+  timeFormat = pyre.inventory.str("time_format", default="%f")
+  timeFormat.meta['tip'] = "C style format string for time stamp in filename."
+
+  from pyre.units.time import second
+  timeConstant = pyre.inventory.dimensional("time_constant",
+                                            default=1.0*second,
+                                            validator=pyre.inventory.greater(0.0*second))
+  timeConstant.meta['tip'] = "Values used to normalize time stamp in filename."
+
+  float32 = pyre.inventory.bool("float32", default=False)
+  float32.meta['tip'] = "Store floating point values as 32-bit floats."
+
+  encoding = pyre.inventory.str("encoding", default="raw",
+                                validator=pyre.inventory.choice(["raw", "base64"]))
+  encoding.meta['tip'] = "Encoding of binary data ('raw' or 'base64')."
+  
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="datawritervtu"):
+    """
+    Constructor.
+    """
+    DataWriter.__init__(self, name)
+    ModuleDataWriterVTU.__init__(self)
+    return
+
+
+  def initialize(self, normalizer):
+    """
+    Initialize writer.
+    """
+    DataWriter.initialize(self, normalizer, self.filename)
+    
+    timeScale = normalizer.timeScale()
+    timeConstantN = normalizer.nondimensionalize(self.timeConstant, timeScale)
+
+    ModuleDataWriterVTU.filename(self, self.filename)
+    ModuleDataWriterVTU.timeScale(self, timeScale.value)
+    ModuleDataWriterVTU.timeFormat(self, self.timeFormat)
+    ModuleDataWriterVTU.timeConstant(self, timeConstantN)
+    ModuleDataWriterVTU.float32(self, self.float32)
+    ModuleDataWriterVTU.encoding(self, self.encoding)
+    return
+  
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Configure object.
+    """
+    try:
+      DataWriter._configure(self)
+    except ValueError, err:
+      aliases = ", ".join(self.aliases)
+      raise ValueError("Error while configuring VTK output "
+                       "(%s):\n%s" % (aliases, err.message))
+
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def data_writer():
+  """
+  Factory associated with DataWriter.
+  """
+  return DataWriterVTU()
+
+
+# End of file 
@@ -59,6 +59,7 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
     ##
     ## \b Properties
     ## @li \b filename Name of mesh file
+    ## @li \b use_cache Use binary cache of mesh file.
     ##
     ## \b Facilities
     ## @li coordsys Coordinate system associated with mesh.
@@ -69,6 +70,9 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
                                   validator=validateFilename)
     filename.meta['tip'] = "Name of mesh file"
 
+    useCache = pyre.inventory.bool("use_cache", default=False)
+    useCache.meta['tip'] = "Write binary cache of mesh on first read and use it on subsequent reads."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pyre.inventory.facility("coordsys", family="coordsys",
                                        factory=CSCart)
@@ -94,6 +98,7 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
     MeshIOObj._configure(self)
     self.coordsys = self.inventory.coordsys
     self.filename(self.inventory.filename)
+    ModuleMeshIOAscii.useCache(self, self.inventory.useCache)
     return
 
 
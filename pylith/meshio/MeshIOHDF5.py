@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/MeshIOHDF5.py
+##
+## @brief Python object for reading/writing finite-element mesh
+## (including cohesive cells and groups) from/to a PyLith HDF5 file.
+##
+## Factory: mesh_io
+
+from MeshIOObj import MeshIOObj
+from meshio import MeshIOHDF5 as ModuleMeshIOHDF5
+
+# Validator for filename
+def validateFilename(value):
+  """
+  Validate filename.
+  """
+  if 0 == len(value):
+    raise ValueError("Filename for HDF5 mesh not specified.")
+  return value
+
+
+# MeshIOHDF5 class
+class MeshIOHDF5(MeshIOObj, ModuleMeshIOHDF5):
+  """
+  Python object for reading/writing finite-element mesh (including
+  cohesive cells and groups) from/to a PyLith HDF5 file.
+
+  Meshes in this format are written by MeshImporter after reordering
+  and inserting cohesive cells, so they are not adjusted again when
+  they are read.
+
+  Factory: mesh_io
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(MeshIOObj.Inventory):
+    """
+    Python object for managing MeshIOHDF5 facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing MeshIOHDF5 facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Name of mesh file
+    ##
+    ## \b Facilities
+    ## @li coordsys Coordinate system associated with mesh.
+
+    import pyre.inventory
+
+    filename = pyre.inventory.str("filename", default="mesh.h5",
+                                  validator=validateFilename)
+    filename.meta['tip'] = "Name of mesh file"
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pyre.inventory.facility("coordsys", family="coordsys",
+                                       factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system associated with mesh."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="meshiohdf5"):
+    """
+    Constructor.
+    """
+    MeshIOObj.__init__(self, name)
+    return
+
+
+  def isPreprocessed(self):
+    """
+    Mesh has already been reordered and cohesive cells have already
+    been inserted.
+    """
+    return True
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    MeshIOObj._configure(self)
+    self.coordsys = self.inventory.coordsys
+    ModuleMeshIOHDF5.filename(self, self.inventory.filename)
+    return
+
+
+  def _createModuleObj(self):
+    """
+    Create C++ MeshIOHDF5 object.
+    """
+    ModuleMeshIOHDF5.__init__(self)
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def mesh_io():
+  """
+  Factory associated with MeshIOHDF5.
+  """
+  return MeshIOHDF5()
+
+
+# End of file
@@ -86,6 +86,14 @@ class MeshIOObj(PetscComponent, ModuleMeshIO):
     return
 
 
+  def isPreprocessed(self):
+    """
+    Mesh has already been reordered and cohesive cells have already
+    been inserted.
+    """
+    return False
+
+
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
   def _configure(self):
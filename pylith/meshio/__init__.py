@@ -24,9 +24,11 @@ __all__ = ['CellFilter',
            'CellFilterAvg',
            'DataWriter',
            'DataWriterVTK',
+           'DataWriterVTU',
            'MeshIOObj',
            'MeshIOAscii',
            'MeshIOCubit',
+           'MeshIOHDF5',
            'MeshIOLagrit',
            'OutputDirichlet',
            'OutputFaultKin',
@@ -140,17 +140,17 @@ class MemoryLogger(Logger):
 
   def logField(self, stage, field):
     """
-    Read field parameters to determine memory from our model.
+    Log memory measured for field.
     """
-    import pylith.perf.Field
-
     if not stage in self.memory: self.memory[stage] = {}
     if not 'Fields' in self.memory[stage]:
       self.memory[stage]['Fields'] = {}
     if not field is None:
-      fieldModel = pylith.perf.Field.Field(field.label(), field.sectionSize(), 
-                                           field.chartSize())
-      fieldModel.tabulate(self.memory[stage]['Fields'])
+      memDict = self.memory[stage]['Fields']
+      label = field.label()
+      if not label in memDict:
+        memDict[label] = 0
+      memDict[label] += field.memoryUse()
     return
 
 
@@ -166,15 +166,15 @@ class MemoryLogger(Logger):
     return
 
 
-  def logJacobian(self, stage, label):
+  def logJacobian(self, stage, label, jacobian):
     """
-    Read parameters to determine memory from our model.
+    Log memory measured for sparse matrix.
     """
-    import pylith.perf.Jacobian
-
     if not stage in self.memory: self.memory[stage] = {}
-    jacModel = pylith.perf.Jacobian.Jacobian(label)
-    jacModel.tabulate(self.memory[stage])
+    if not label in self.memory[stage]:
+      self.memory[stage][label] = 0
+    if not jacobian is None:
+      self.memory[stage][label] += jacobian.memoryUse()
     return
 
 
@@ -191,6 +191,24 @@ class MemoryLogger(Logger):
     return
 
 
+  def stagePush(self, stage):
+    """
+    Begin stage for measured memory accounting.
+    """
+    from pylith.utils.utils import MemoryTracker
+    MemoryTracker.stagePush(stage)
+    return
+
+
+  def stagePop(self):
+    """
+    End current stage for measured memory accounting.
+    """
+    from pylith.utils.utils import MemoryTracker
+    MemoryTracker.stagePop()
+    return
+
+
   def mergeMemDict(self, memDictTarget, memDictSource):
     for key in memDictSource:
       if not key in memDictTarget:
@@ -278,12 +296,12 @@ class MemoryLogger(Logger):
     output.extend(self.processMemDict(self.memory, includeDealloc = \
                                         self.includeDealloc)[0])
 
-    output.append(self.memLine('Code',  'Total Alloced', 0))
-                               #logger.getAllocationTotal('default'), 1))
-    output.append(self.memLine('Code',  'Total Dealloced', 0))
-                               #logger.getDeallocationTotal('default'), 1))
+    output.append("MEASURED HIGH-WATER MEMORY PER PROCESS (fields and matrices)")
+    output.extend(self._measuredHighWater())
 
-    print '\n'.join(output)
+    from pylith.mpi.Communicator import mpi_comm_world
+    if 0 == mpi_comm_world().rank:
+      print '\n'.join(output)
     return
 
 
@@ -298,6 +316,32 @@ class MemoryLogger(Logger):
     return
 
 
+  def _measuredHighWater(self):
+    """
+    Get lines with min/max over processes of measured high-water
+    memory for each stage. Must be called collectively.
+    """
+    from pylith.utils.utils import MemoryTracker
+    from pylith.mpi.Communicator import mpi_comm_world
+    import pylith.mpi.mpi as mpi
+    comm = mpi_comm_world()
+
+    # Stages are created in the same order on all processes.
+    stages = [(MemoryTracker.stageName(i),
+               MemoryTracker.stageHighWater(MemoryTracker.stageName(i))) \
+                for i in xrange(MemoryTracker.numStages())]
+    stages.append(('Total', MemoryTracker.highWater()))
+
+    output = []
+    for name,mem in stages:
+      memMin = mpi.allreduce_scalar_double(mem, mpi.mpi_min(), comm.handle)
+      memMax = mpi.allreduce_scalar_double(mem, mpi.mpi_max(), comm.handle)
+      output.append('  %-30s min %12d bytes (%.3f MB), max %12d bytes (%.3f MB)' % \
+                      (name+':', memMin, memMin/self.megabyte,
+                       memMax, memMax/self.megabyte))
+    return output
+
+
 # FACTORIES ////////////////////////////////////////////////////////////
 
 def perf_logger():
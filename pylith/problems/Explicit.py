@@ -131,6 +131,8 @@ class Explicit(Formulation, ModuleExplicit):
     residual = self.fields.get("residual")
     residual.zeroAll()
     residual.createScatter(residual.mesh())
+    if self.keepConstrainedDOF:
+      residual.keepConstrainedDOF()
 
     lengthScale = normalizer.lengthScale()
     timeScale = normalizer.timeScale()
@@ -65,6 +65,8 @@ class Formulation(PetscComponent, ModuleFormulation):
     ## @li \b matrix_type Type of PETSc sparse matrix.
     ## @li \b split_fields Split solution fields into displacements and Lagrange constraints.
     ## @li \b use_custom_constraint_pc Use custom preconditioner for Lagrange constraints.
+    ## @li \b use_block_constraint_pc Use block diagonal of elasticity Jacobian in custom preconditioner for Lagrange constraints.
+    ## @li \b keep_constrained_dof Keep constrained DOF in the global system to retain block matrices.
     ## @li \b view_jacobian Flag to output Jacobian matrix when it is reformed.
     ##
     ## \b Facilities
@@ -76,7 +78,8 @@ class Formulation(PetscComponent, ModuleFormulation):
     import pyre.inventory
 
     matrixType = pyre.inventory.str("matrix_type", default="unknown")
-    matrixType.meta['tip'] = "Type of PETSc sparse matrix."
+    matrixType.meta['tip'] = "Type of PETSc sparse matrix ('shell' for " \
+        "matrix-free Jacobian with point-block diagonal preconditioning matrix)."
 
     useSplitFields = pyre.inventory.bool("split_fields", default=False)
     useSplitFields.meta['tip'] = "Split solution fields into displacements "\
@@ -87,6 +90,17 @@ class Formulation(PetscComponent, ModuleFormulation):
     useCustomConstraintPC.meta['tip'] = "Use custom preconditioner for " \
                                         "Lagrange constraints."
 
+    useBlockConstraintPC = pyre.inventory.bool("use_block_constraint_pc",
+                                               default=False)
+    useBlockConstraintPC.meta['tip'] = "Use spaceDim x spaceDim blocks " \
+        "(rather than diagonal) of elasticity Jacobian at fault vertices " \
+        "in custom preconditioner for Lagrange constraints."
+
+    keepConstrainedDOF = pyre.inventory.bool("keep_constrained_dof",
+                                             default=False)
+    keepConstrainedDOF.meta['tip'] = "Keep constrained DOF in global system " \
+        "(with identity rows) to retain block matrices for partial constraints."
+
     viewJacobian = pyre.inventory.bool("view_jacobian", default=False)
     viewJacobian.meta['tip'] = "Write Jacobian matrix to binary file."
     
@@ -219,6 +233,23 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     self._eventLogger.eventEnd(logEvent)
     return dt
+
+
+  def stepConverged(self):
+    """
+    Check whether solve in most recent time step converged.
+    """
+    return self.solver.converged()
+
+
+  def retryTimeStep(self, dt):
+    """
+    Get reduced time step for retrying a time step in which the solve
+    did not converge.
+
+    Returns None if the time step should not be retried.
+    """
+    return self.timeStep.retryTimeStep(dt)
   
 
   def prestep(self, t, dt):
@@ -305,6 +336,13 @@ class Formulation(PetscComponent, ModuleFormulation):
     import journal
     self._debug = journal.debug(self.name)
 
+    if self.inventory.useBlockConstraintPC and \
+           not self.inventory.useCustomConstraintPC:
+      print "WARNING: Request to use block diagonal in custom preconditioner " \
+            "for Lagrange constraints without using custom preconditioner. " \
+            "Setting custom preconditioner flag to 'True'."
+      self.inventory.useCustomConstraintPC = True
+
     if self.inventory.useCustomConstraintPC and \
            not self.inventory.useSplitFields:
       print "WARNING: Request to use custom preconditioner for Lagrange " \
@@ -312,8 +350,21 @@ class Formulation(PetscComponent, ModuleFormulation):
             "Setting split fields flag to 'True'."
       self.inventory.useSplitFields = True
 
+    if self.inventory.keepConstrainedDOF and self.inventory.useSplitFields:
+      print "WARNING: Keeping constrained DOF in the global system is not " \
+            "supported with split fields. " \
+            "Setting keep constrained DOF flag to 'False'."
+      self.inventory.keepConstrainedDOF = False
+    self.keepConstrainedDOF = self.inventory.keepConstrainedDOF
+
+    if self.matrixType == "shell" and self.inventory.useSplitFields:
+      print "WARNING: Matrix-free Jacobian is not supported with split " \
+            "fields. Setting matrix type to 'aij'."
+      self.matrixType = "aij"
+
     ModuleFormulation.splitFields(self, self.inventory.useSplitFields)
     ModuleFormulation.useCustomConstraintPC(self, self.inventory.useCustomConstraintPC)
+    ModuleFormulation.useBlockConstraintPC(self, self.inventory.useBlockConstraintPC)
 
     return
 
@@ -340,10 +391,11 @@ class Formulation(PetscComponent, ModuleFormulation):
     self.blockMatrixOkay = True
     if self.matrixType == "unknown" and self.solver.useCUDA:
       self.matrixType = "aijcusp"
-    for constraint in self.constraints:
-      numDimConstrained = constraint.numDimConstrained()
-      if numDimConstrained > 0 and self.mesh().dimension() != numDimConstrained:
-        self.blockMatrixOkay = False
+    if not self.keepConstrainedDOF:
+      for constraint in self.constraints:
+        numDimConstrained = constraint.numDimConstrained()
+        if numDimConstrained > 0 and self.mesh().dimension() != numDimConstrained:
+          self.blockMatrixOkay = False
     return
 
 
@@ -523,6 +575,9 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     #memoryLogger.stagePop()
 
+    if self.keepConstrainedDOF:
+      solution.keepConstrainedDOF()
+
     # This also creates a global order.
     solution.createScatter(solution.mesh())
 
@@ -657,7 +712,7 @@ class Formulation(PetscComponent, ModuleFormulation):
     Model memory allocation.
     """
     self.perfLogger.logFields('Problem', self.fields)
-    self.perfLogger.logJacobian('Jacobian', 'dummy')
+    self.perfLogger.logJacobian('Jacobian', 'Jacobian', self.jacobian)
     self.perfLogger.logGlobalOrder('GlobalOrder', 'VectorOrder',
                                    self.fields.get('residual'))
     for integrator in self.integrators:
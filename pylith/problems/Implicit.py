@@ -137,6 +137,8 @@ class Implicit(Formulation, ModuleImplicit):
     residual = self.fields.get("residual")
     residual.zeroAll()
     residual.createScatter(residual.mesh())
+    if self.keepConstrainedDOF:
+      residual.keepConstrainedDOF()
 
     lengthScale = normalizer.lengthScale()
     timeScale = normalizer.timeScale()
@@ -211,6 +213,8 @@ class Implicit(Formulation, ModuleImplicit):
     #self.jacobian.view() # TEMPORARY
     self.solver.solve(dispIncr, self.jacobian, residual)
     #dispIncr.view("DISP INCR") # TEMPORARY
+    if 0 == comm.rank:
+      self._info.log("Linear solver iterations: %d" % self.solver.numIterations())
 
     # DEBUGGING Verify solution makes residual 0
     #self._reformResidual(t+dt, dt)
@@ -53,6 +53,8 @@ class Solver(PetscComponent):
     ## Python object for managing Solver facilities and properties.
     ##
     ## \b Properties
+    ## @li \b create_null_space Create solution null space.
+    ## @li \b use_multigrid Use geometric multigrid preconditioner.
     ## @li \b use_cuda Use CUDA in solve if supported by solver.
     ##
     ## \b Facilities
@@ -63,6 +65,9 @@ class Solver(PetscComponent):
     createNullSpace = pyre.inventory.bool("create_null_space", default=True)
     createNullSpace.meta['tip'] = "Create solution null space. Changing this setting should only be necessary for test problems with fewer DOF than the null space."
 
+    useMultigrid = pyre.inventory.bool("use_multigrid", default=False)
+    useMultigrid.meta['tip'] = "Use geometric multigrid preconditioner (displacement block with split fields) with the hierarchy from uniform mesh refinement."
+
     useCUDA = pyre.inventory.bool("use_cuda", default=False,
                                   validator=validateUseCUDA)
     useCUDA.meta['tip'] = "Enable use of CUDA for finite-element integrations."
@@ -97,6 +102,7 @@ class Solver(PetscComponent):
 
     self.useCUDA = self.inventory.useCUDA
     self.createNullSpace = self.inventory.createNullSpace
+    self.useMultigrid = self.inventory.useMultigrid
     return
 
 
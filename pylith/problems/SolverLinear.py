@@ -75,6 +75,7 @@ class SolverLinear(Solver, ModuleSolverLinear):
     Solver._configure(self)
 
     ModuleSolverLinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    ModuleSolverLinear.useMultigrid(self, self.useMultigrid)
     return
 
 
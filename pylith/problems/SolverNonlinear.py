@@ -68,6 +68,7 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     Solver._configure(self)
 
     ModuleSolverNonlinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    ModuleSolverNonlinear.useMultigrid(self, self.useMultigrid)
     return
 
 
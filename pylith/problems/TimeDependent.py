@@ -201,6 +201,17 @@ class TimeDependent(Problem):
                          (tsec, tsec+dtsec))
       self._eventLogger.stagePush("Step")
       self.formulation.step(t, dt)
+      while not self.formulation.stepConverged():
+        dtRetry = self.formulation.retryTimeStep(dt)
+        if dtRetry is None:
+          break
+        dt = dtRetry
+        dtsec = self.normalizer.dimensionalize(dt, timeScale)
+        if 0 == comm.rank:
+          self._info.log("Solve did not converge. Retrying advancing solution from t=%s to t=%s." % \
+                           (tsec, tsec+dtsec))
+        self.formulation.prestep(t, dt)
+        self.formulation.step(t, dt)
       self._eventLogger.stagePop()
 
       if 0 == comm.rank:
@@ -210,6 +221,9 @@ class TimeDependent(Problem):
       self.formulation.poststep(t, dt)
       self._eventLogger.stagePop()
 
+      # Write event profile if necessary
+      app.eventProfiler.update()
+
       # Update time
       t += dt
 
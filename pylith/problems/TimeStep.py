@@ -141,6 +141,17 @@ class TimeStep(PetscComponent):
     Get current time step size.
     """
     return self.dtN
+
+
+  def retryTimeStep(self, dt):
+    """
+    Get reduced time step for retrying a time step in which the solve
+    did not converge.
+
+    Returns None if the time step should not be retried.
+    """
+    # Default is to accept the time step.
+    return None
   
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
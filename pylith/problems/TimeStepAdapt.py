@@ -51,6 +51,13 @@ class TimeStepAdapt(TimeStep):
     ## @li \b max_dt Maximum time step.
     ## @li \b adapt_skip Number of time steps to skip between adjusting value.
     ## @li \b stability_factor "Safety factor" for stable time step.
+    ## @li \b max_increase_factor Maximum factor by which time step can
+    ##   increase when adjusted (0 for no limit).
+    ## @li \b increase_threshold Minimum factor by which stable time step
+    ##   must exceed current time step to increase time step.
+    ## @li \b retry_factor Factor by which time step is reduced when
+    ##   retrying a time step in which the solve did not converge.
+    ## @li \b max_retries Maximum number of times to retry a time step.
     ##
     ## \b Facilities
     ## @li None
@@ -75,6 +82,25 @@ class TimeStepAdapt(TimeStep):
                                     validator=pyre.inventory.greater(0.0))
     stabilityFactor.meta['tip'] = "'Safety factor' for stable time step."
 
+    maxIncrease = pyre.inventory.float("max_increase_factor", default=0.0,
+                                       validator=pyre.inventory.greaterEqual(0.0))
+    maxIncrease.meta['tip'] = "Maximum factor by which time step can " \
+        "increase when adjusted (0 for no limit)."
+
+    increaseThreshold = pyre.inventory.float("increase_threshold", default=1.0,
+                                             validator=pyre.inventory.greaterEqual(1.0))
+    increaseThreshold.meta['tip'] = "Minimum factor by which stable time " \
+        "step must exceed current time step to increase time step."
+
+    retryFactor = pyre.inventory.float("retry_factor", default=0.5,
+                                       validator=pyre.inventory.greater(0.0))
+    retryFactor.meta['tip'] = "Factor by which time step is reduced when " \
+        "retrying a time step in which the solve did not converge."
+
+    maxRetries = pyre.inventory.int("max_retries", default=4,
+                                    validator=pyre.inventory.greaterEqual(0))
+    maxRetries.meta['tip'] = "Maximum number of times to retry a time step."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -85,6 +111,7 @@ class TimeStepAdapt(TimeStep):
     TimeStep.__init__(self, name)
     self._loggingPrefix = "DtAd "
     self.skipped = 0
+    self.numRetries = 0
     self.maxDtN = 0.0 # Nondimensionalized maximum time step
     return
 
@@ -120,16 +147,41 @@ class TimeStepAdapt(TimeStep):
     Adjust stable time step for advancing forward in time.
     """
     dtStable = self._stableTimeStep(mesh, integrators)
+    self.numRetries = 0
     
     if self.skipped < self.adaptSkip and \
           self.dtN != 0.0 and \
           self.dtN < dtStable:
       self.skipped += 1
     else:
-      self.dtN = min(dtStable/self.stabilityFactor, self.maxDtN)
+      dtN = min(dtStable/self.stabilityFactor, self.maxDtN)
+      if self.dtN != 0.0 and dtN > self.dtN:
+        # Ignore small increases and limit rate of increase, so that the
+        # time step does not oscillate.
+        if dtN < self.increaseThreshold*self.dtN:
+          dtN = self.dtN
+        elif self.maxIncrease > 0.0:
+          dtN = min(dtN, self.maxIncrease*self.dtN)
+      self.dtN = dtN
       self.skipped = 0
     return self.dtN
 
+
+  def retryTimeStep(self, dt):
+    """
+    Get reduced time step for retrying a time step in which the solve
+    did not converge.
+    """
+    if self.numRetries >= self.maxRetries:
+      raise RuntimeError("Solve did not converge after reducing time step "
+                         "%d times." % self.numRetries)
+    self.numRetries += 1
+
+    # Keep reduced time step for at least adapt_skip time steps.
+    self.dtN = dt*self.retryFactor
+    self.skipped = 0
+    return self.dtN
+
   
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
@@ -142,6 +194,13 @@ class TimeStepAdapt(TimeStep):
     self.maxDt = self.inventory.maxDt
     self.adaptSkip = self.inventory.adaptSkip
     self.stabilityFactor = self.inventory.stabilityFactor
+    self.maxIncrease = self.inventory.maxIncrease
+    self.increaseThreshold = self.inventory.increaseThreshold
+    self.retryFactor = self.inventory.retryFactor
+    if self.retryFactor >= 1.0:
+      raise ValueError("Factor for reducing time step when retrying a time "
+                       "step (%g) must be less than 1.0." % self.retryFactor)
+    self.maxRetries = self.inventory.maxRetries
     self.dt = self.maxDt
     return
 
@@ -67,9 +67,11 @@ class Distributor(PetscComponent, ModuleDistributor):
     return
 
 
-  def distribute(self, mesh, normalizer):
+  def distribute(self, mesh, normalizer, faultLabels=None):
     """
-    Distribute a Mesh
+    Distribute a Mesh. If faultLabels is given, both cells adjacent to
+    each fault face are kept on the same processor, so that cohesive
+    cells can be inserted after distribution.
     """
     self._setupLogging()
     logEvent = "%sdistribute" % self._loggingPrefix
@@ -81,7 +83,10 @@ class Distributor(PetscComponent, ModuleDistributor):
       partitionerName = "parmetis"
     else:
       partitionerName = self.partitioner
-    ModuleDistributor.distribute(newMesh, mesh, partitionerName)
+    if faultLabels is None:
+      ModuleDistributor.distribute(newMesh, mesh, partitionerName)
+    else:
+      ModuleDistributor.distributeWithFaults(newMesh, mesh, partitionerName, faultLabels)
 
     #from pylith.utils.petsc import MemoryLogger
     #memoryLogger = MemoryLogger.singleton()
@@ -93,6 +93,27 @@ class MeshGenerator(PetscComponent):
     return
 
 
+  def _labelTopology(self, mesh, interfaces):
+    """
+    Label points to split for interface implementation without
+    adjusting topology.
+    """
+    logEvent = "%slabelTopo" % self._loggingPrefix
+    self._eventLogger.eventBegin(logEvent)
+    
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    if not interfaces is None:
+      for interface in interfaces:
+        if 0 == comm.rank:
+          self._info.log("Labeling points to split for fault '%s'." % interface.label())
+        interface.labelTopology(mesh)
+
+    self._eventLogger.eventEnd(logEvent)
+    return
+
+
   def _adjustTopology(self, mesh, interfaces):
     """
     Adjust topology for interface implementation.
@@ -146,6 +167,7 @@ class MeshGenerator(PetscComponent):
     logger.initialize()
 
     events = ["create",
+              "labelTopo",
               "adjTopo"]
     for event in events:
       logger.registerEvent("%s%s" % (self._loggingPrefix, event))
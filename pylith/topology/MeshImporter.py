@@ -44,6 +44,10 @@ class MeshImporter(MeshGenerator):
     ##
     ## \b Properties
     ## @li reorder_mesh Reorder mesh using reverse Cuthill-McKee if true.
+    ## @li preprocessed_filename Name of HDF5 file for mesh after
+    ##   reordering and inserting cohesive cells (empty for none).
+    ## @li parallel_cohesive_cells Insert cohesive cells after
+    ##   distributing the mesh.
     ##
     ## \b Facilities
     ## @li \b reader Mesh reader.
@@ -55,6 +59,12 @@ class MeshImporter(MeshGenerator):
     reorderMesh = pyre.inventory.bool("reorder_mesh", default=False)
     reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
 
+    preprocessedFilename = pyre.inventory.str("preprocessed_filename", default="")
+    preprocessedFilename.meta['tip'] = "Name of HDF5 file for mesh after reordering and inserting cohesive cells (empty for none)."
+
+    parallelCohesiveCells = pyre.inventory.bool("parallel_cohesive_cells", default=False)
+    parallelCohesiveCells.meta['tip'] = "Insert cohesive cells after distributing the mesh instead of before."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pyre.inventory.facility("reader", family="mesh_io",
                                        factory=MeshIOAscii)
@@ -101,33 +111,72 @@ class MeshImporter(MeshGenerator):
     if self.debug:
       mesh.view()
 
-    # Reorder mesh
-    if self.reorderMesh:
-      logEvent2 = "%sreorder" % self._loggingPrefix
-      self._eventLogger.eventBegin(logEvent2)
-      self._debug.log(resourceUsageString())
+    # Insert cohesive cells after distribution only if the mesh is
+    # distributed and we do not need to write the serial mesh.
+    adjustParallel = self.parallelCohesiveCells and comm.size > 1 and \
+        not faults is None and len(faults) > 0 and \
+        not self.reader.isPreprocessed() and \
+        0 == len(self.preprocessedFilename)
+
+    if self.reader.isPreprocessed():
+      # Mesh was written after reordering and adjusting topology.
       if 0 == comm.rank:
-        self._info.log("Reordering cells and vertices.")
-      from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-      ordering = ReverseCuthillMcKee()
-      ordering.reorder(mesh)
-      self._eventLogger.eventEnd(logEvent2)
-
-    # Adjust topology
-    self._debug.log(resourceUsageString())
-    if 0 == comm.rank:
-      self._info.log("Adjusting topology.")
-    self._adjustTopology(mesh, faults)
+        self._info.log("Using preprocessed mesh.")
+    else:
+      # Reorder mesh
+      if self.reorderMesh:
+        logEvent2 = "%sreorder" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent2)
+        self._debug.log(resourceUsageString())
+        if 0 == comm.rank:
+          self._info.log("Reordering cells and vertices.")
+        from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+        ordering = ReverseCuthillMcKee()
+        ordering.reorder(mesh)
+        self._eventLogger.eventEnd(logEvent2)
+
+      # Adjust topology
+      self._debug.log(resourceUsageString())
+      if adjustParallel:
+        # Labeling is cheap compared with splitting the mesh, so it
+        # is done on the serial mesh and the labels are distributed.
+        if 0 == comm.rank:
+          self._info.log("Labeling faults.")
+        self._labelTopology(mesh, faults)
+      else:
+        if 0 == comm.rank:
+          self._info.log("Adjusting topology.")
+        self._adjustTopology(mesh, faults)
+
+      # Write preprocessed mesh (if necessary)
+      if len(self.preprocessedFilename) > 0:
+        if 0 == comm.rank:
+          self._info.log("Writing preprocessed mesh to '%s'." % self.preprocessedFilename)
+        from pylith.meshio.MeshIOHDF5 import MeshIOHDF5
+        writer = MeshIOHDF5()
+        writer.filename(self.preprocessedFilename)
+        writer.write(mesh)
 
     # Distribute mesh
     if comm.size > 1:
       if 0 == comm.rank:
         self._info.log("Distributing mesh.")
-      mesh = self.distributor.distribute(mesh, normalizer)
+      if adjustParallel:
+        faultLabels = [interface.label() for interface in faults]
+        mesh = self.distributor.distribute(mesh, normalizer, faultLabels)
+      else:
+        mesh = self.distributor.distribute(mesh, normalizer)
       if self.debug:
         mesh.view()
       mesh.memLoggingStage = "DistributedMesh"
 
+      # Adjust topology on each processor
+      if adjustParallel:
+        self._debug.log(resourceUsageString())
+        if 0 == comm.rank:
+          self._info.log("Adjusting topology in parallel.")
+        self._adjustTopology(mesh, faults)
+
     # Refine mesh (if necessary)
     newMesh = self.refiner.refine(mesh)
     if not newMesh == mesh:
@@ -156,6 +205,8 @@ class MeshImporter(MeshGenerator):
     self.distributor = self.inventory.distributor
     self.refiner = self.inventory.refiner
     self.reorderMesh = self.inventory.reorderMesh
+    self.preprocessedFilename = self.inventory.preprocessedFilename
+    self.parallelCohesiveCells = self.inventory.parallelCohesiveCells
     return
   
 
@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/utils/EventProfiler.py
+##
+## @brief Python EventProfiler object for writing statistics across
+## processes for logging events.
+##
+## USAGE:
+##
+## @li Call initialize() before any events to be profiled occur.
+##
+## @li Call update() every time step to write the profile at the
+## desired frequency.
+##
+## @li Call finalize() at the end of the run to write the final profile.
+##
+## Factory: event_profiler.
+
+from pylith.utils.PetscComponent import PetscComponent
+
+# EventProfiler class
+class EventProfiler(PetscComponent):
+  """
+  Python EventProfiler object for writing statistics across processes
+  for logging events.
+
+  USAGE:
+
+  (1) Call initialize() before any events to be profiled occur.
+
+  (2) Call update() every time step to write the profile at the
+  desired frequency.
+
+  (3) Call finalize() at the end of the run to write the final profile.
+
+  Factory: event_profiler.
+  """
+  
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(PetscComponent.Inventory):
+    """
+    Python object for managing EventProfiler facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing EventProfiler facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Name of file for profile (empty for no profile).
+    ## @li \b format Format of profile file.
+    ## @li \b steps Number of time steps between writing profile (0 for end of run only).
+    ##
+    ## \b Facilities
+    ## @li None
+
+    import pyre.inventory
+
+    filename = pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of file for profile (empty for no profile)."
+
+    format = pyre.inventory.str("format", default="json",
+                                validator=pyre.inventory.choice(["json", "csv"]))
+    format.meta['tip'] = "Format of profile file."
+
+    steps = pyre.inventory.int("steps", default=0,
+                               validator=pyre.inventory.greaterEqual(0))
+    steps.meta['tip'] = "Number of time steps between writing profile (0 for end of run only)."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="eventprofiler"):
+    """
+    Constructor.
+    """
+    PetscComponent.__init__(self, name, facility="event_profiler")
+    self.istep = 0
+    return
+
+
+  def initialize(self):
+    """
+    Turn on collection of event information.
+    """
+    if not self.filename:
+      return
+    from pylith.utils.utils import EventProfile
+    EventProfile.activate()
+    return
+  
+
+  def update(self):
+    """
+    Write profile if necessary. Must be called collectively.
+    """
+    self.istep += 1
+    if self.filename and self.steps > 0 and 0 == self.istep % self.steps:
+      self._write()
+    return
+  
+
+  def finalize(self):
+    """
+    Write final profile. Must be called collectively.
+    """
+    if self.filename:
+      self._write()
+    return
+  
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Setup members using inventory.
+    """
+    PetscComponent._configure(self)
+    self.filename = self.inventory.filename
+    self.format = self.inventory.format
+    self.steps = self.inventory.steps
+    return
+
+
+  def _write(self):
+    """
+    Collect statistics across processes and write profile.
+    """
+    from pylith.utils.utils import EventProfile
+    from pylith.mpi.Communicator import petsc_comm_world
+    comm = petsc_comm_world()
+
+    profile = EventProfile()
+    profile.collect(comm.handle)
+    profile.write(self.filename, self.format)
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def event_profiler():
+  """
+  Factory associated with EventProfiler.
+  """
+  return EventProfiler()
+
+
+# End of file 
@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/tri3/TestSlipOneFaultParallel.py
+##
+## @brief Test suite for testing pylith with shear slip and cohesive
+## cells inserted after distributing the mesh.
+
+import numpy
+
+from pylith.tests import run_pylith
+
+from TestSlipOneFault import TestSlipOneFault, SlipOneFaultApp
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class SlipOneFaultParallelApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="sliponefault_parallel")
+    return
+
+
+class TestSlipOneFaultParallel(TestSlipOneFault):
+  """
+  Test suite for testing pylith with shear sliponefault for 2-D box
+  with cohesive cells inserted after distributing the mesh.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    TestSlipOneFault.setUp(self)
+    run_pylith(SlipOneFaultParallelApp, nprocs=3)
+    self.outputRootSerial = self.outputRoot
+    self.outputRoot = "sliponefault_parallel"
+    return
+
+
+  def test_match_serial(self):
+    """
+    Check that mesh and fault match those with cohesive cells inserted
+    before distributing the mesh.
+    """
+    if not self.checkResults:
+      return
+
+    self._checkMatch("%s.h5" % self.outputRootSerial,
+                     "%s.h5" % self.outputRoot,
+                     "displacement")
+    self._checkMatch("%s-fault.h5" % self.outputRootSerial,
+                     "%s-fault.h5" % self.outputRoot,
+                     "slip")
+    return
+
+
+  def _checkMatch(self, filenameE, filename, fieldName):
+    """
+    Check number of cells and vertices and values of field at vertices
+    sorted by coordinates.
+    """
+    import h5py
+    h5E = h5py.File(filenameE, "r", driver="sec2")
+    h5 = h5py.File(filename, "r", driver="sec2")
+
+    self.assertEqual(h5E['topology/cells'].shape, h5['topology/cells'].shape)
+    self.assertEqual(h5E['geometry/vertices'].shape, h5['geometry/vertices'].shape)
+
+    valuesE = self._sortedValues(h5E, fieldName)
+    values = self._sortedValues(h5, fieldName)
+
+    tolerance = 1.0e-6
+    diff = numpy.abs(values - valuesE)
+    okay = diff < tolerance*(1.0 + numpy.abs(valuesE))
+    if numpy.sum(okay) != okay.size:
+      print "Values of '%s' in '%s' do not match '%s'." % (fieldName, filename, filenameE)
+      print "Expected values: ", valuesE[~okay]
+      print "Computed values: ", values[~okay]
+    self.assertEqual(okay.size, numpy.sum(okay))
+
+    h5E.close()
+    h5.close()
+    return
+
+
+  def _sortedValues(self, h5, fieldName):
+    """
+    Get coordinates and field values at vertices sorted by coordinates.
+
+    Split vertices have the same coordinates on each side of the fault,
+    so rows are sorted by coordinates and then by field values.
+    """
+    vertices = h5['geometry/vertices'][:]
+    field = h5['vertex_fields/%s' % fieldName][0,:,:]
+    rows = numpy.hstack((vertices, field))
+    order = numpy.lexsort(rows.transpose()[::-1])
+    return rows[order,:]
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestSlipOneFaultParallel import TestSlipOneFaultParallel as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
@@ -57,6 +57,9 @@ class TestApp(FullTestApp):
     from TestSlipOneFault import TestSlipOneFault
     suite.addTest(unittest.makeSuite(TestSlipOneFault))
 
+    from TestSlipOneFaultParallel import TestSlipOneFaultParallel
+    suite.addTest(unittest.makeSuite(TestSlipOneFaultParallel))
+
     from TestSlipTwoFaults import TestSlipTwoFaults
     suite.addTest(unittest.makeSuite(TestSlipTwoFaults))
 
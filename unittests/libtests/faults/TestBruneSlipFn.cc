@@ -36,6 +36,8 @@
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <cmath> // USES sqrt()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestBruneSlipFn );
 
@@ -430,6 +432,11 @@ pylith::faults::TestBruneSlipFn::_testInitialize(const _TestBruneSlipFn::DataStr
   const PetscInt vStart = verticesStratum.begin();
   const PetscInt vEnd = verticesStratum.end();
 
+  // No clamped vertices, so all vertices are cached.
+  CPPUNIT_ASSERT_EQUAL(spaceDim, slipfn._cache.spaceDim);
+  CPPUNIT_ASSERT_EQUAL(size_t(vEnd-vStart), slipfn._cache.vertices.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(vEnd-vStart), slipfn._cache.riseTime.size());
+
   const PylithScalar tolerance = 1.0e-06;
   for(PetscInt v = vStart, iPoint = 0; v < vEnd; ++v, ++iPoint) {
     const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
@@ -446,6 +453,20 @@ pylith::faults::TestBruneSlipFn::_testInitialize(const _TestBruneSlipFn::DataStr
     } // for
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.slipTimeE[iPoint]+originTime, slipTimeArray[stoff], tolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.riseTimeE[iPoint], riseTimeArray[rtoff], tolerance);
+
+    // Cached parameters
+    CPPUNIT_ASSERT_EQUAL(v, PetscInt(slipfn._cache.vertices[iPoint]));
+    PylithScalar slipMagE = 0.0;
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      slipMagE += finalSlipArray[fsoff+d]*finalSlipArray[fsoff+d];
+    } // for
+    slipMagE = sqrt(slipMagE);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(slipMagE, slipfn._cache.slipMag[iPoint], tolerance);
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(finalSlipArray[fsoff+d], slipfn._cache.slipDir[iPoint*spaceDim+d]*slipMagE, tolerance);
+    } // for
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(slipTimeArray[stoff], slipfn._cache.slipTime[iPoint], tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(riseTimeArray[rtoff], slipfn._cache.riseTime[iPoint], tolerance);
   } // for
 
   PYLITH_METHOD_END;
@@ -729,11 +729,72 @@ pylith::faults::TestFaultCohesive::testAdjustTopologyHex8Lagrange(void)
   PYLITH_METHOD_END;
 } // testAdjustTopologyHex8Lagrange
 
+// ----------------------------------------------------------------------
+// Test labelTopology() followed by adjustTopology() with 2-D triangular
+// element.
+void
+pylith::faults::TestFaultCohesive::testLabelTopologyTri3(void)
+{ // testLabelTopologyTri3
+  PYLITH_METHOD_BEGIN;
+
+  CohesiveDataTri3 data;
+  FaultCohesiveTract fault;
+  _testAdjustTopology(&fault, data, true);
+
+  PYLITH_METHOD_END;
+} // testLabelTopologyTri3
+
+// ----------------------------------------------------------------------
+// Test labelTopology() followed by adjustTopology() with 2-D quadrilateral
+// element.
+void
+pylith::faults::TestFaultCohesive::testLabelTopologyQuad4(void)
+{ // testLabelTopologyQuad4
+  PYLITH_METHOD_BEGIN;
+
+  CohesiveDataQuad4 data;
+  FaultCohesiveTract fault;
+  _testAdjustTopology(&fault, data, true);
+
+  PYLITH_METHOD_END;
+} // testLabelTopologyQuad4
+
+// ----------------------------------------------------------------------
+// Test labelTopology() followed by adjustTopology() with 3-D tetrahedral
+// element.
+void
+pylith::faults::TestFaultCohesive::testLabelTopologyTet4(void)
+{ // testLabelTopologyTet4
+  PYLITH_METHOD_BEGIN;
+
+  CohesiveDataTet4 data;
+  FaultCohesiveTract fault;
+  _testAdjustTopology(&fault, data, true);
+
+  PYLITH_METHOD_END;
+} // testLabelTopologyTet4
+
+// ----------------------------------------------------------------------
+// Test labelTopology() followed by adjustTopology() with 3-D hexahedral
+// element.
+void
+pylith::faults::TestFaultCohesive::testLabelTopologyHex8(void)
+{ // testLabelTopologyHex8
+  PYLITH_METHOD_BEGIN;
+
+  CohesiveDataHex8 data;
+  FaultCohesiveTract fault;
+  _testAdjustTopology(&fault, data, true);
+
+  PYLITH_METHOD_END;
+} // testLabelTopologyHex8
+
 // ----------------------------------------------------------------------
 // Test adjustTopology().
 void
 pylith::faults::TestFaultCohesive::_testAdjustTopology(Fault* fault,
-						       const CohesiveData& data)
+						       const CohesiveData& data,
+						       const bool labelFirst)
 { // _testAdjustTopology
   PYLITH_METHOD_BEGIN;
 
@@ -770,6 +831,9 @@ pylith::faults::TestFaultCohesive::_testAdjustTopology(Fault* fault,
   if (data.edge) {
     fault->edge(data.edge);
   } // if
+  if (labelFirst) {
+    dynamic_cast<FaultCohesive*>(fault)->labelTopology(&mesh);
+  } // if
   fault->adjustTopology(&mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
 #if 0 // DEBUGGING
   PetscViewerPushFormat(PETSC_VIEWER_STDOUT_WORLD, PETSC_VIEWER_ASCII_INFO_DETAIL);
@@ -92,6 +92,11 @@ class pylith::faults::TestFaultCohesive : public CppUnit::TestFixture
   CPPUNIT_TEST( testAdjustTopologyTet4Lagrange );
   CPPUNIT_TEST( testAdjustTopologyHex8Lagrange );
 
+  CPPUNIT_TEST( testLabelTopologyTri3 );
+  CPPUNIT_TEST( testLabelTopologyQuad4 );
+  CPPUNIT_TEST( testLabelTopologyTet4 );
+  CPPUNIT_TEST( testLabelTopologyHex8 );
+
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -230,6 +235,22 @@ public :
   /// multipliers.
   void testAdjustTopologyHex8Lagrange(void);
 
+  /// Test labelTopology() followed by adjustTopology() with 2-D
+  /// triangular element.
+  void testLabelTopologyTri3(void);
+
+  /// Test labelTopology() followed by adjustTopology() with 2-D
+  /// quadrilateral element.
+  void testLabelTopologyQuad4(void);
+
+  /// Test labelTopology() followed by adjustTopology() with 3-D
+  /// tetrahedral element.
+  void testLabelTopologyTet4(void);
+
+  /// Test labelTopology() followed by adjustTopology() with 3-D
+  /// hexahedral element.
+  void testLabelTopologyHex8(void);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 public :
 
@@ -237,9 +258,11 @@ public :
    *
    * @param fault Fault for cohesive elements.
    * @param data Cohesive element data.
+   * @param labelFirst Label points to split with labelTopology() first.
    */
   void _testAdjustTopology(Fault* fault,
-			   const CohesiveData& data);
+			   const CohesiveData& data,
+			   const bool labelFirst =false);
 
   /** Test adjustTopology().
    *
@@ -41,6 +41,7 @@
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <cmath> // USES pow()
 #include <stdexcept> // USES runtime_error
 
 // ----------------------------------------------------------------------
@@ -147,6 +148,67 @@ pylith::faults::TestFaultCohesiveKin::testUseLagrangeConstraints(void)
   PYLITH_METHOD_END;
 } // testUseLagrangeConstraints
 
+// ----------------------------------------------------------------------
+// Test _invertBlock().
+void
+pylith::faults::TestFaultCohesiveKin::testInvertBlock(void)
+{ // testInvertBlock
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar tolerance = 1.0e-06;
+
+  { // 2x2
+    const int size = 2;
+    const PylithScalar blockValues[size*size] = {
+      4.0, 1.0,
+      2.0, 3.0,
+    };
+    const PylithScalar inverseE[size*size] = {
+      0.3, -0.1,
+      -0.2, 0.4,
+    };
+    scalar_array block(blockValues, size*size);
+    scalar_array inverse(size*size);
+    FaultCohesiveKin::_invertBlock(&inverse, block, size);
+    for (int i=0; i < size*size; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(inverseE[i], inverse[i], tolerance);
+    } // for
+  } // 2x2
+
+  { // 3x3
+    const int size = 3;
+    const PylithScalar blockValues[size*size] = {
+      2.0, 0.0, 1.0,
+      1.0, 3.0, 0.0,
+      0.0, 1.0, 4.0,
+    };
+    scalar_array block(blockValues, size*size);
+    scalar_array inverse(size*size);
+    FaultCohesiveKin::_invertBlock(&inverse, block, size);
+
+    // Check block * inverse = identity.
+    for (int i=0; i < size; ++i) {
+      for (int j=0; j < size; ++j) {
+	PylithScalar value = 0.0;
+	for (int k=0; k < size; ++k) {
+	  value += block[i*size+k] * inverse[k*size+j];
+	} // for
+	CPPUNIT_ASSERT_DOUBLES_EQUAL((i == j) ? 1.0 : 0.0, value, tolerance);
+      } // for
+    } // for
+  } // 3x3
+
+  { // singular
+    const int size = 2;
+    scalar_array block(size*size);
+    block = 1.0;
+    scalar_array inverse(size*size);
+    CPPUNIT_ASSERT_THROW(FaultCohesiveKin::_invertBlock(&inverse, block, size), std::runtime_error);
+  } // singular
+
+  PYLITH_METHOD_END;
+} // testInvertBlock
+
 // ----------------------------------------------------------------------
 // Test initialize().
 void
@@ -394,6 +456,122 @@ pylith::faults::TestFaultCohesiveKin::testIntegrateJacobian(void)
   PYLITH_METHOD_END;
 } // testIntegrateJacobian
 
+// ----------------------------------------------------------------------
+// Test integrateJacobianAction() and integrateJacobian() with
+// matrix-free Jacobian.
+void
+pylith::faults::TestFaultCohesiveKin::testIntegrateJacobianAction(void)
+{ // testIntegrateJacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+  CPPUNIT_ASSERT(fault.hasJacobianAction());
+
+  CPPUNIT_ASSERT(_data->fieldT);
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT);
+
+  const PylithScalar t = 2.134;
+  topology::Jacobian jacobian(fields.solution());
+  fault.integrateJacobian(&jacobian, t, &fields);
+  jacobian.assemble("final_assembly");
+
+  // Input with distinct values for every DOF.
+  const topology::Field& solution = fields.solution();
+  PetscDM dmSoln = solution.dmMesh();CPPUNIT_ASSERT(dmSoln);
+  PetscVec inputLocalVec = NULL, actionLocalVec = NULL;
+  PetscVec inputVec = NULL, actionVec = NULL, actionVecE = NULL;
+  PetscErrorCode err = 0;
+  err = DMCreateLocalVector(dmSoln, &inputLocalVec);PYLITH_CHECK_ERROR(err);
+  err = VecDuplicate(inputLocalVec, &actionLocalVec);PYLITH_CHECK_ERROR(err);
+  err = DMCreateGlobalVector(dmSoln, &inputVec);PYLITH_CHECK_ERROR(err);
+  err = VecDuplicate(inputVec, &actionVec);PYLITH_CHECK_ERROR(err);
+  err = VecDuplicate(inputVec, &actionVecE);PYLITH_CHECK_ERROR(err);
+
+  PetscInt localSize = 0;
+  err = VecGetLocalSize(inputLocalVec, &localSize);PYLITH_CHECK_ERROR(err);
+  PetscScalar* inputArray = NULL;
+  err = VecGetArray(inputLocalVec, &inputArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < localSize; ++i) {
+    inputArray[i] = 0.5 + 0.25*i;
+  } // for
+  err = VecRestoreArray(inputLocalVec, &inputArray);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalBegin(dmSoln, inputLocalVec, INSERT_VALUES, inputVec);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalEnd(dmSoln, inputLocalVec, INSERT_VALUES, inputVec);PYLITH_CHECK_ERROR(err);
+
+  // Expected action from assembled Jacobian.
+  err = MatMult(jacobian.matrix(), inputVec, actionVecE);PYLITH_CHECK_ERROR(err);
+
+  // Action without assembling the Jacobian.
+  err = VecSet(actionLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+  const PetscScalar* inputArrayRead = NULL;
+  PetscScalar* actionArray = NULL;
+  err = VecGetArrayRead(inputLocalVec, &inputArrayRead);PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(actionLocalVec, &actionArray);PYLITH_CHECK_ERROR(err);
+  fault.integrateJacobianAction(actionArray, inputArrayRead, &fields);
+  err = VecRestoreArray(actionLocalVec, &actionArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(inputLocalVec, &inputArrayRead);PYLITH_CHECK_ERROR(err);
+  err = VecSet(actionVec, 0.0);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalBegin(dmSoln, actionLocalVec, ADD_VALUES, actionVec);PYLITH_CHECK_ERROR(err);
+  err = DMLocalToGlobalEnd(dmSoln, actionLocalVec, ADD_VALUES, actionVec);PYLITH_CHECK_ERROR(err);
+
+  PetscInt size = 0;
+  err = VecGetLocalSize(actionVec, &size);PYLITH_CHECK_ERROR(err);
+  const PetscScalar* actionArrayE = NULL;
+  const PetscScalar* actionArrayRead = NULL;
+  err = VecGetArrayRead(actionVecE, &actionArrayE);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(actionVec, &actionArrayRead);PYLITH_CHECK_ERROR(err);
+  const PylithScalar tolerance = 1.0e-06;
+  for (PetscInt i=0; i < size; ++i) {
+    if (fabs(actionArrayE[i]) > 1.0)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, actionArrayRead[i]/actionArrayE[i], tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(actionArrayE[i], actionArrayRead[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(actionVec, &actionArrayRead);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(actionVecE, &actionArrayE);PYLITH_CHECK_ERROR(err);
+
+  err = VecDestroy(&inputLocalVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&actionLocalVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&inputVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&actionVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&actionVecE);PYLITH_CHECK_ERROR(err);
+
+  // Matrix-free Jacobian keeps the diagonal blocks of the Lagrange
+  // multipliers in the preconditioning matrix for calcPreconditioner().
+  topology::Jacobian jacobianShell(fields.solution(), "shell");
+  fault.integrateJacobian(&jacobianShell, t, &fields);
+  CPPUNIT_ASSERT_EQUAL(false, fault.needNewJacobian());
+  jacobianShell.assemble("final_assembly");
+
+  PetscMat pcMat = jacobianShell.assembledMatrix();
+  PetscSection solnGlobalSection = solution.globalSection();CPPUNIT_ASSERT(solnGlobalSection);
+  const int spaceDim = _data->spaceDim;
+  const int numVertices = fault._cohesiveVertices.size();
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const int e_lagrange = fault._cohesiveVertices[iVertex].lagrange;
+    if (e_lagrange < 0) {
+      continue;
+    } // if
+    PetscInt gloff = 0;
+    err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff);PYLITH_CHECK_ERROR(err);
+    const PetscInt* cols = NULL;
+    PetscInt ncols = 0;
+    err = MatGetRow(pcMat, gloff, &ncols, &cols, NULL);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(spaceDim), ncols);
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      CPPUNIT_ASSERT_EQUAL(gloff+iDim, cols[iDim]);
+    } // for
+    err = MatRestoreRow(pcMat, gloff, &ncols, &cols, NULL);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobianAction
+
 // ----------------------------------------------------------------------
 // Test integrateJacobian() with lumped Jacobian.
 void
@@ -598,6 +776,90 @@ pylith::faults::TestFaultCohesiveKin::testCalcTractionsChange(void)
   PYLITH_METHOD_END;
 } // testCalcTractionsChange
 
+// ----------------------------------------------------------------------
+// Test updateStateVars() with rupture metrics.
+void
+pylith::faults::TestFaultCohesiveKin::testRuptureMetrics(void)
+{ // testRuptureMetrics
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  fault.ruptureMetrics(true);
+  fault.ruptureShearModulus(2.0);
+  _initialize(&mesh, &fault, &fields);
+  CPPUNIT_ASSERT(fault._fields);
+
+  const int spaceDim = _data->spaceDim;
+  const PylithScalar lengthScale = _data->lengthScale;
+  const PylithScalar timeScale = _data->timeScale;
+  const PylithScalar slipShear = 2.0; // nondimensional
+  const PylithScalar dt = 0.5; // nondimensional
+  const PylithScalar t = 1.0; // nondimensional
+
+  // Set relative displacement to shear slip along first direction in
+  // fault coordinate system plus opening that should be ignored.
+  topology::VecVisitorMesh orientationVisitor(fault._fields->get("orientation"));
+  const PetscScalar* orientationArray = orientationVisitor.localArray();CPPUNIT_ASSERT(orientationArray);
+  topology::VecVisitorMesh areaVisitor(fault._fields->get("area"));
+  const PetscScalar* areaArray = areaVisitor.localArray();CPPUNIT_ASSERT(areaArray);
+  PylithScalar areaTotal = 0.0;
+  {
+    topology::VecVisitorMesh dispRelVisitor(fault._fields->get("relative disp"));
+    PetscScalar* dispRelArray = dispRelVisitor.localArray();CPPUNIT_ASSERT(dispRelArray);
+    const int numVertices = fault._cohesiveVertices.size();
+    for (int i=0; i < numVertices; ++i) {
+      const PetscInt v_fault = fault._cohesiveVertices[i].fault;
+      if (fault._cohesiveVertices[i].lagrange < 0) { // skip clamped edges
+	continue;
+      } // if
+      const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+      const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+      for (int d=0; d < spaceDim; ++d) {
+	dispRelArray[droff+d] = slipShear*orientationArray[ooff+d] + 0.1*orientationArray[ooff+(spaceDim-1)*spaceDim+d];
+      } // for
+      areaTotal += areaArray[areaVisitor.sectionOffset(v_fault)];
+    } // for
+  } // Set relative displacement
+
+  fault.timeStep(dt);
+  fault.updateStateVars(t, &fields);
+  // Slip does not change in second step.
+  fault.updateStateVars(t+dt, &fields);
+
+  const PylithScalar tolerance = 1.0e-06;
+  topology::VecVisitorMesh ruptureTimeVisitor(fault.vertexField("rupture_time"));
+  const PetscScalar* ruptureTimeArray = ruptureTimeVisitor.localArray();CPPUNIT_ASSERT(ruptureTimeArray);
+  topology::VecVisitorMesh peakRateVisitor(fault.vertexField("peak_slip_rate"));
+  const PetscScalar* peakRateArray = peakRateVisitor.localArray();CPPUNIT_ASSERT(peakRateArray);
+  topology::VecVisitorMesh peakRateTimeVisitor(fault.vertexField("peak_slip_rate_time"));
+  const PetscScalar* peakRateTimeArray = peakRateTimeVisitor.localArray();CPPUNIT_ASSERT(peakRateTimeArray);
+  topology::VecVisitorMesh cumSlipVisitor(fault.vertexField("cumulative_slip"));
+  const PetscScalar* cumSlipArray = cumSlipVisitor.localArray();CPPUNIT_ASSERT(cumSlipArray);
+  const int numVertices = fault._cohesiveVertices.size();
+  for (int i=0; i < numVertices; ++i) {
+    const PetscInt v_fault = fault._cohesiveVertices[i].fault;
+    if (fault._cohesiveVertices[i].lagrange < 0) { // skip clamped edges
+      continue;
+    } // if
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ruptureTimeArray[ruptureTimeVisitor.sectionOffset(v_fault)]/(t+dt), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, peakRateArray[peakRateVisitor.sectionOffset(v_fault)]/(slipShear/dt), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, peakRateTimeArray[peakRateTimeVisitor.sectionOffset(v_fault)]/(t+dt), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cumSlipArray[cumSlipVisitor.sectionOffset(v_fault)]/slipShear, tolerance);
+  } // for
+
+  const PylithScalar areaE = areaTotal * pow(lengthScale, spaceDim-1);
+  const PylithScalar potencyE = areaTotal * slipShear * pow(lengthScale, spaceDim);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.ruptureArea()/areaE, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.potency()/potencyE, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, fault.momentRate()*timeScale/potencyE, tolerance);
+
+  PYLITH_METHOD_END;
+} // testRuptureMetrics
+
 
 // ----------------------------------------------------------------------
 void
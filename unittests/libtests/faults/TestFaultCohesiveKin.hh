@@ -55,6 +55,7 @@ class pylith::faults::TestFaultCohesiveKin : public CppUnit::TestFixture
   CPPUNIT_TEST( testEqsrc );
   CPPUNIT_TEST( testNeedNewJacobian );
   CPPUNIT_TEST( testUseLagrangeConstraints );
+  CPPUNIT_TEST( testInvertBlock );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -87,6 +88,9 @@ public :
   /// Test useLagrangeConstraints().
   void testUseLagrangeConstraints(void);
 
+  /// Test _invertBlock().
+  void testInvertBlock(void);
+
   /// Test initialize().
   void testInitialize(void);
 
@@ -96,6 +100,10 @@ public :
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
+  /// Test integrateJacobianAction() and integrateJacobian() with
+  /// matrix-free Jacobian.
+  void testIntegrateJacobianAction(void);
+
   /// Test integrateJacobian() with lumped Jacobian.
   void testIntegrateJacobianLumped(void);
 
@@ -105,6 +113,9 @@ public :
   /// Test _calcTractionsChange().
   void testCalcTractionsChange(void);
 
+  /// Test updateStateVars() with rupture metrics.
+  void testRuptureMetrics(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
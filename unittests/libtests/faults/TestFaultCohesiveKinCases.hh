@@ -54,9 +54,11 @@ class pylith::faults::TestFaultCohesiveKinTri3 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -80,8 +82,10 @@ class pylith::faults::TestFaultCohesiveKinTri3d : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -105,8 +109,10 @@ class pylith::faults::TestFaultCohesiveKinTri3g : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -130,9 +136,11 @@ class pylith::faults::TestFaultCohesiveKinQuad4 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -156,8 +164,10 @@ class pylith::faults::TestFaultCohesiveKinQuad4e : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -180,8 +190,10 @@ class pylith::faults::TestFaultCohesiveKinQuad4i : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -205,9 +217,11 @@ class pylith::faults::TestFaultCohesiveKinTet4 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -231,8 +245,10 @@ class pylith::faults::TestFaultCohesiveKinTet4e : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -256,8 +272,10 @@ class pylith::faults::TestFaultCohesiveKinTet4f : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -281,9 +299,11 @@ class pylith::faults::TestFaultCohesiveKinHex8 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,293 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFaultCohesiveParallel.hh" // Implementation of class methods
+
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::max()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestFaultCohesiveParallel );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace faults {
+    namespace _TestFaultCohesiveParallel {
+      const char* filename = "data/tri3_parallel.mesh";
+      const char* faultLabel = "fault";
+      const int faultId = 100;
+
+      // Cells 1 and 8 touch the fault only at vertices 1 and 2, on
+      // opposite sides of the fault. Whichever processor owns the
+      // shared fault vertices, in one of the two partitions the owner
+      // uses only one side of the fault at one of them.
+      const int numCells = 10;
+      const int cellRank[numCells] = { 0, 1, 0, 0, 0, 0, 0, 0, 1, 0 };
+      const int cellRankSwap[numCells] = { 1, 0, 1, 1, 1, 1, 1, 1, 0, 1 };
+
+      // Serial mesh with cohesive cells.
+      const int numVertices = 14;
+      const int numCellsCohesive = 13;
+    } // _TestFaultCohesiveParallel
+  } // faults
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test adjustTopology() with processor 1 touching the fault at single vertices.
+void
+pylith::faults::TestFaultCohesiveParallel::testAdjustTopologyOneSide(void)
+{ // testAdjustTopologyOneSide
+  PYLITH_METHOD_BEGIN;
+
+  _testAdjustTopology(_TestFaultCohesiveParallel::cellRank);
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyOneSide
+
+// ----------------------------------------------------------------------
+// Test adjustTopology() with processor 0 touching the fault at single vertices.
+void
+pylith::faults::TestFaultCohesiveParallel::testAdjustTopologyOneSideSwap(void)
+{ // testAdjustTopologyOneSideSwap
+  PYLITH_METHOD_BEGIN;
+
+  _testAdjustTopology(_TestFaultCohesiveParallel::cellRankSwap);
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyOneSideSwap
+
+// ----------------------------------------------------------------------
+// Label fault on serial mesh, distribute mesh, insert cohesive cells,
+// and compare with inserting cohesive cells in serial mesh.
+void
+pylith::faults::TestFaultCohesiveParallel::_testAdjustTopology(const int* cellRank)
+{ // _testAdjustTopology
+  PYLITH_METHOD_BEGIN;
+
+  PetscMPIInt commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(PETSC_COMM_WORLD, &commSize);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(2, commSize);
+
+  // Reference: insert cohesive cells without distributing the mesh.
+  topology::Mesh meshSerial;
+  _labelMesh(&meshSerial);
+  _adjustTopology(&meshSerial);
+  int_array numOwnedE;
+  _countOwned(&numOwnedE, meshSerial);
+  const size_t depth = numOwnedE.size() - 1;
+  CPPUNIT_ASSERT_EQUAL(size_t(3), numOwnedE.size());
+  CPPUNIT_ASSERT_EQUAL(_TestFaultCohesiveParallel::numVertices, int(numOwnedE[0]));
+  CPPUNIT_ASSERT_EQUAL(_TestFaultCohesiveParallel::numCellsCohesive, int(numOwnedE[depth]));
+
+  topology::Mesh mesh;
+  _labelMesh(&mesh);
+  topology::Mesh newMesh;
+  _distribute(&newMesh, mesh, cellRank);
+  _adjustTopology(&newMesh);
+  int_array numOwned;
+  _countOwned(&numOwned, newMesh);
+
+  // Every split and cohesive point is owned by exactly one processor.
+  CPPUNIT_ASSERT_EQUAL(numOwnedE.size(), numOwned.size());
+  for (size_t i=0; i < numOwnedE.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(numOwnedE[i], numOwned[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testAdjustTopology
+
+// ----------------------------------------------------------------------
+// Read mesh and label points to split.
+void
+pylith::faults::TestFaultCohesiveParallel::_labelMesh(topology::Mesh* mesh)
+{ // _labelMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(_TestFaultCohesiveParallel::filename);
+  iohandler.interpolate(true);
+  iohandler.read(mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh->dimension());
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  spatialdata::units::Nondimensional normalizer;
+  topology::MeshOps::nondimensionalize(mesh, normalizer);
+
+  FaultCohesiveKin fault;
+  fault.id(_TestFaultCohesiveParallel::faultId);
+  fault.label(_TestFaultCohesiveParallel::faultLabel);
+  fault.labelTopology(mesh);
+
+  PYLITH_METHOD_END;
+} // _labelMesh
+
+// ----------------------------------------------------------------------
+// Distribute mesh using given partition.
+void
+pylith::faults::TestFaultCohesiveParallel::_distribute(topology::Mesh* newMesh,
+						       const topology::Mesh& mesh,
+						       const int* cellRank)
+{ // _distribute
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(newMesh);
+  CPPUNIT_ASSERT(cellRank);
+
+  newMesh->coordsys(mesh.coordsys());
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscMPIInt commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(mesh.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+  // Only the processor with the serial mesh has cells to partition.
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  CPPUNIT_ASSERT(0 == numCells || _TestFaultCohesiveParallel::numCells == numCells);
+  std::vector<PetscInt> sizes(commSize, 0);
+  std::vector<PetscInt> cells(numCells > 0 ? numCells : 1);
+  for (PetscInt iRank=0, index=0; iRank < commSize; ++iRank) {
+    for (PetscInt c=0; c < numCells; ++c) {
+      if (cellRank[c] == iRank) {
+	++sizes[iRank];
+	cells[index++] = cStart + c;
+      } // if
+    } // for
+  } // for
+
+  PetscPartitioner partitioner = NULL;
+  err = DMPlexGetPartitioner(dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+  err = PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL);PYLITH_CHECK_ERROR(err);
+  err = PetscPartitionerShellSetPartition(partitioner, commSize, &sizes[0], &cells[0]);PYLITH_CHECK_ERROR(err);
+
+  PetscDM dmNew = NULL;
+  err = DMPlexDistribute(dmMesh, 0, NULL, &dmNew);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(dmNew);
+  newMesh->dmMesh(dmNew);
+
+  PYLITH_METHOD_END;
+} // _distribute
+
+// ----------------------------------------------------------------------
+// Insert cohesive cells for fault.
+void
+pylith::faults::TestFaultCohesiveParallel::_adjustTopology(topology::Mesh* mesh)
+{ // _adjustTopology
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  // Points to split were labeled before distribution, so the
+  // starting points for new vertices and cells are not used.
+  int firstFaultVertex = 0;
+  int firstLagrangeVertex = 0;
+  int firstFaultCell = 0;
+  FaultCohesiveKin fault;
+  fault.id(_TestFaultCohesiveParallel::faultId);
+  fault.label(_TestFaultCohesiveParallel::faultLabel);
+  fault.adjustTopology(mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+
+  PYLITH_METHOD_END;
+} // _adjustTopology
+
+// ----------------------------------------------------------------------
+// Check that the owner of every leaf in the point star forest is a
+// root and count the owned points in each stratum over all processors.
+void
+pylith::faults::TestFaultCohesiveParallel::_countOwned(int_array* numOwned,
+						       const topology::Mesh& mesh)
+{ // _countOwned
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(numOwned);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  MPI_Comm comm = mesh.comm();
+  PetscMPIInt commRank = 0;
+  PetscErrorCode err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+  // Mesh is interpolated. Use dimension rather than depth, because a
+  // processor without cells has no strata.
+  const PetscInt depth = mesh.dimension();
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscSF sfPoint = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotes = NULL;
+  err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &leaves, &remotes);PYLITH_CHECK_ERROR(err);
+
+  // Flag local leaves and get flags for their owners.
+  std::vector<PetscInt> isLeaf(pEnd > 0 ? pEnd : 1, 0), isRemoteLeaf(pEnd > 0 ? pEnd : 1, 0);
+  PetscInt numInvalidLocal = 0;
+  if (numRoots >= 0) {
+    for (PetscInt i=0; i < numLeaves; ++i) {
+      isLeaf[leaves ? leaves[i] : i] = 1;
+      numInvalidLocal += (remotes[i].rank == commRank) ? 1 : 0;
+    } // for
+    err = PetscSFBcastBegin(sfPoint, MPIU_INT, &isLeaf[0], &isRemoteLeaf[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfPoint, MPIU_INT, &isLeaf[0], &isRemoteLeaf[0]);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < numLeaves; ++i) {
+      numInvalidLocal += isRemoteLeaf[leaves ? leaves[i] : i];
+    } // for
+  } // if
+  PetscInt numInvalid = 0;
+  err = MPI_Allreduce(&numInvalidLocal, &numInvalid, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), numInvalid);
+
+  // Count points that are not leaves.
+  std::vector<PetscInt> numOwnedLocal(depth+1, 0), numOwnedGlobal(depth+1, 0);
+  for (PetscInt d=0; d <= depth; ++d) {
+    PetscInt dStart = 0, dEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, d, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p=std::max(dStart, pStart); p < dEnd; ++p) {
+      numOwnedLocal[d] += isLeaf[p] ? 0 : 1;
+    } // for
+  } // for
+  err = MPI_Allreduce(&numOwnedLocal[0], &numOwnedGlobal[0], depth+1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+  numOwned->resize(depth+1);
+  for (PetscInt d=0; d <= depth; ++d) {
+    (*numOwned)[d] = numOwnedGlobal[d];
+  } // for
+
+  PYLITH_METHOD_END;
+} // _countOwned
+
+
+// End of file 
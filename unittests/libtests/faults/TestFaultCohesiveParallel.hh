@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/faults/TestFaultCohesiveParallel.hh
+ *
+ * @brief C++ TestFaultCohesiveParallel object
+ *
+ * C++ unit testing for inserting cohesive cells after distributing
+ * the mesh. Must be run on two processors.
+ */
+
+#if !defined(pylith_faults_testfaultcohesiveparallel_hh)
+#define pylith_faults_testfaultcohesiveparallel_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/utils/arrayfwd.hh" // USES int_array
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace faults {
+    class TestFaultCohesiveParallel;
+  } // faults
+} // pylith
+
+/// C++ unit testing for inserting cohesive cells in a distributed mesh.
+class pylith::faults::TestFaultCohesiveParallel : public CppUnit::TestFixture
+{ // class TestFaultCohesiveParallel
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestFaultCohesiveParallel );
+
+  CPPUNIT_TEST( testAdjustTopologyOneSide );
+  CPPUNIT_TEST( testAdjustTopologyOneSideSwap );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test adjustTopology() with fault labeled before distribution and
+  /// processor 1 touching the fault at single vertices.
+  void testAdjustTopologyOneSide(void);
+
+  /// Test adjustTopology() with fault labeled before distribution and
+  /// processor 0 touching the fault at single vertices.
+  void testAdjustTopologyOneSideSwap(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Label fault on serial mesh, distribute mesh, insert cohesive
+   * cells, and compare with inserting cohesive cells in serial mesh.
+   *
+   * @param cellRank Processor for each cell of the serial mesh.
+   */
+  void _testAdjustTopology(const int* cellRank);
+
+  /** Read mesh and label points to split.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _labelMesh(topology::Mesh* mesh);
+
+  /** Distribute mesh using given partition.
+   *
+   * @param newMesh Distributed mesh.
+   * @param mesh Serial mesh.
+   * @param cellRank Processor for each cell of the serial mesh.
+   */
+  void _distribute(topology::Mesh* newMesh,
+		   const topology::Mesh& mesh,
+		   const int* cellRank);
+
+  /** Insert cohesive cells for fault.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _adjustTopology(topology::Mesh* mesh);
+
+  /** Check that the owner of every leaf in the point star forest is a
+   * root and count the owned points in each stratum over all
+   * processors.
+   *
+   * @param numOwned Number of owned points in each stratum (output).
+   * @param mesh Finite-element mesh.
+   */
+  void _countOwned(int_array* numOwned,
+		   const topology::Mesh& mesh);
+
+}; // class TestFaultCohesiveParallel
+
+#endif // pylith_faults_testfaultcohesiveparallel_hh
+
+
+// End of file 
@@ -0,0 +1,5 @@
+#!/bin/sh
+#
+# Run unit tests that require more than one processor.
+
+exec ${MPIRUN:-mpirun} -np 2 ./testfaultsmpi
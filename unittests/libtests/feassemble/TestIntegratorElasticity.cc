@@ -140,5 +140,88 @@ pylith::feassemble::TestIntegratorElasticity::testCalcTotalStrain3D(void)
   PYLITH_METHOD_END;
 } // testCalcTotalStrain3D
 
+// ----------------------------------------------------------------------
+// Test totalStrainKernel().
+void
+pylith::feassemble::TestIntegratorElasticity::testTotalStrainKernel(void)
+{ // testTotalStrainKernel
+  PYLITH_METHOD_BEGIN;
+
+  // Kernels with fixed loop bounds must match the general kernels.
+  const int numCases = 5;
+  const int cellDims[numCases] = { 2, 2, 3, 3, 3 };
+  const int numBasisCases[numCases] = { 3, 4, 4, 8, 4 };
+  const int numQuadPtsCases[numCases] = { 1, 4, 1, 8, 4 };
+  const bool isFixed[numCases] = { true, true, true, true, false };
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iCase=0; iCase < numCases; ++iCase) {
+    const int dim = cellDims[iCase];
+    const int numBasis = numBasisCases[iCase];
+    const int numQuadPts = numQuadPtsCases[iCase];
+    const int tensorSize = (2 == dim) ? 3 : 6;
+
+    IntegratorElasticity::totalStrain_fn_type kernel =
+      IntegratorElasticity::_totalStrainKernel(dim, numBasis, numQuadPts);
+    IntegratorElasticity::totalStrain_fn_type kernelGeneral = (2 == dim) ?
+      &IntegratorElasticity::_calcTotalStrain2D : &IntegratorElasticity::_calcTotalStrain3D;
+    CPPUNIT_ASSERT(kernel);
+    CPPUNIT_ASSERT_EQUAL(isFixed[iCase], kernel != kernelGeneral);
+
+    scalar_array basisDeriv(numQuadPts*numBasis*dim);
+    for (size_t i=0; i < basisDeriv.size(); ++i) {
+      basisDeriv[i] = 0.1*(i % 7) - 0.25*(i % 3);
+    } // for
+    scalar_array disp(numBasis*dim);
+    for (size_t i=0; i < disp.size(); ++i) {
+      disp[i] = 0.3*(i % 5) - 0.7;
+    } // for
+
+    const int size = numQuadPts * tensorSize;
+    scalar_array strain(size);
+    scalar_array strainE(size);
+    kernel(&strain, basisDeriv, &disp[0], numBasis, dim, numQuadPts);
+    kernelGeneral(&strainE, basisDeriv, &disp[0], numBasis, dim, numQuadPts);
+
+    for (int i=0; i < size; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(strainE[i], strain[i], tolerance);
+  } // for
+
+  CPPUNIT_ASSERT(!IntegratorElasticity::_totalStrainKernel(1, 2, 1));
+
+  PYLITH_METHOD_END;
+} // testTotalStrainKernel
+
+// ----------------------------------------------------------------------
+// Test averageQuadPts().
+void
+pylith::feassemble::TestIntegratorElasticity::testAverageQuadPts(void)
+{ // testAverageQuadPts
+  PYLITH_METHOD_BEGIN;
+
+  const int numQuadPts = 3;
+  const int fiberDim = 2;
+  const PylithScalar quadWtsVals[numQuadPts] = { 0.5, 1.0, 0.5 };
+  const PylithScalar valuesVals[numQuadPts*fiberDim] = {
+    1.0, -2.0,
+    3.0,  4.0,
+    5.0, -6.0,
+  };
+  // avg = (0.5*v0 + 1.0*v1 + 0.5*v2) / 2.0
+  const PylithScalar avgE[fiberDim] = { 3.0, 0.0 };
+
+  scalar_array quadWts(quadWtsVals, numQuadPts);
+  scalar_array values(valuesVals, numQuadPts*fiberDim);
+  PylithScalar avg[fiberDim];
+
+  IntegratorElasticity::_averageQuadPts(avg, values, quadWts, fiberDim);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int i=0; i < fiberDim; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(avgE[i], avg[i], tolerance);
+
+  PYLITH_METHOD_END;
+} // testAverageQuadPts
+
 
 // End of file 
@@ -45,6 +45,8 @@ class pylith::feassemble::TestIntegratorElasticity : public CppUnit::TestFixture
 
   CPPUNIT_TEST( testCalcTotalStrain2D );
   CPPUNIT_TEST( testCalcTotalStrain3D );
+  CPPUNIT_TEST( testTotalStrainKernel );
+  CPPUNIT_TEST( testAverageQuadPts );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -57,6 +59,12 @@ public :
   /// Test calcTotalStrain3D().
   void testCalcTotalStrain3D(void);
 
+  /// Test totalStrainKernel().
+  void testTotalStrainKernel(void);
+
+  /// Test averageQuadPts().
+  void testAverageQuadPts(void);
+
 }; // class TestIntegratorElasticity
 
 #endif // pylith_feassemble_testintegratorelasticity_hh
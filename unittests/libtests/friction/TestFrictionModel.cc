@@ -653,7 +653,7 @@ pylith::friction::TestFrictionModel::testNonDimStateVars(void)
 
   for (int iLoc=0; iLoc < numLocs; ++iLoc) {
     for (int i=0; i < stateVarsSize; ++i)
-      stateVars[i] = _data->dbStateVars[iLoc*stateVarsSize+i];
+      stateVars[i] = _data->stateVars[iLoc*stateVarsSize+i];
     _friction->_nondimStateVars(&stateVars[0], stateVars.size());
     
     const PylithScalar* const stateVarsNondimE =
@@ -856,6 +856,96 @@ pylith::friction::TestFrictionModel::test_updateStateVars(void)
   PYLITH_METHOD_END;
 } // test_updateStateVars
 
+// ----------------------------------------------------------------------
+// Test _calcFrictionBatch()
+void
+pylith::friction::TestFrictionModel::test_calcFrictionBatch(void)
+{ // test_calcFrictionBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+
+  // Transpose test data to structure-of-arrays layout.
+  scalar_array properties(numPropsVertex*numLocs);
+  scalar_array stateVars(numVarsVertex*numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      properties[i*numLocs+iLoc] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      stateVars[i*numLocs+iLoc] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+
+  const PylithScalar t = 1.5;
+  scalar_array friction(numLocs);
+  _friction->timeStep(_data->dt);
+  _friction->_calcFrictionBatch(&friction[0], t, _data->slip, _data->slipRate, _data->normalTraction, numLocs,
+				&properties[0], numPropsVertex,
+				(numVarsVertex > 0) ? &stateVars[0] : 0, numVarsVertex);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar frictionE = _data->friction[iLoc];
+    if (0.0 != frictionE)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, friction[iLoc]/frictionE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE, friction[iLoc], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Test _updateStateVarsBatch()
+void
+pylith::friction::TestFrictionModel::test_updateStateVarsBatch(void)
+{ // test_updateStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+  if (0 == numVarsVertex)
+    PYLITH_METHOD_END;
+
+  // Transpose test data to structure-of-arrays layout.
+  scalar_array properties(numPropsVertex*numLocs);
+  scalar_array stateVars(numVarsVertex*numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      properties[i*numLocs+iLoc] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      stateVars[i*numLocs+iLoc] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+
+  const PylithScalar t = 1.5;
+  _friction->timeStep(_data->dt);
+  _friction->_updateStateVarsBatch(t, _data->slip, _data->slipRate, _data->normalTraction, numLocs,
+				   &stateVars[0], numVarsVertex,
+				   &properties[0], numPropsVertex);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* stateVarsE = &_data->stateVarsUpdated[iLoc*numVarsVertex];
+    for (int i=0; i < numVarsVertex; ++i) {
+      const PylithScalar stateVar = stateVars[i*numLocs+iLoc];
+      if (0.0 != stateVarsE[i])
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVar/stateVarsE[i], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsE[i], stateVar, tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Setup nondimensionalization.
 void
@@ -139,6 +139,12 @@ public :
   /// Test _updateStateVars().
   void test_updateStateVars(void);
 
+  /// Test _calcFrictionBatch().
+  void test_calcFrictionBatch(void);
+
+  /// Test _updateStateVarsBatch().
+  void test_updateStateVarsBatch(void);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
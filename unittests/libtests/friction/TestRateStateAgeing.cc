@@ -24,6 +24,10 @@
 
 #include "pylith/friction/RateStateAgeing.hh" // USES RateStateAgeing
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
+#include <stdexcept> // USES std::runtime_error
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::friction::TestRateStateAgeing );
 
@@ -51,6 +55,66 @@ pylith::friction::TestRateStateAgeing::testLinearSlipRate(void)
   CPPUNIT_ASSERT_EQUAL(value, model._linearSlipRate);
 } // testLinearSlipRate
   
+// ----------------------------------------------------------------------
+// Test tolerance for error in state variable.
+void
+pylith::friction::TestRateStateAgeing::testStateTolerance(void)
+{ // testStateTolerance
+  RateStateAgeing model;
+
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(1.0e-6), model._stateTolerance); // default
+
+  const PylithScalar value = 1.0e-8;
+  model.stateTolerance(value);
+  CPPUNIT_ASSERT_EQUAL(value, model._stateTolerance);
+
+  CPPUNIT_ASSERT_THROW(model.stateTolerance(0.0), std::runtime_error);
+} // testStateTolerance
+  
+// ----------------------------------------------------------------------
+// Test maximum number of substeps.
+void
+pylith::friction::TestRateStateAgeing::testMaxSubsteps(void)
+{ // testMaxSubsteps
+  RateStateAgeing model;
+
+  CPPUNIT_ASSERT_EQUAL(100, model._maxSubsteps); // default
+
+  const int value = 20;
+  model.maxSubsteps(value);
+  CPPUNIT_ASSERT_EQUAL(value, model._maxSubsteps);
+
+  CPPUNIT_ASSERT_THROW(model.maxSubsteps(0), std::runtime_error);
+} // testMaxSubsteps
+  
+// ----------------------------------------------------------------------
+// Test maximum slip fraction for stable time step.
+void
+pylith::friction::TestRateStateAgeing::testMaxSlipFraction(void)
+{ // testMaxSlipFraction
+  RateStateAgeing model;
+
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.5), model._maxSlipFraction); // default
+
+  const PylithScalar value = 0.2;
+  model.maxSlipFraction(value);
+  CPPUNIT_ASSERT_EQUAL(value, model._maxSlipFraction);
+
+  CPPUNIT_ASSERT_THROW(model.maxSlipFraction(0.0), std::runtime_error);
+
+  // Constant slip rate, so stable time step is limited only by slip.
+  const PylithScalar properties[6] = { 0.6, 0.000001, 0.0370, 0.0125, 0.0172, 1000000 };
+  PylithScalar stateVars[2] = { 92.7, -1.0 };
+  const PylithScalar slipRate = 1.0;
+  const PylithScalar dtStableE = value * 0.0370 / slipRate;
+
+  model.timeStep(0.01);
+  model._updateStateVars(1.5, 0.12, slipRate, -2.2, stateVars, 2, properties, 6);
+
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, model.stableTimeStep()/dtStableE, tolerance);
+} // testMaxSlipFraction
+  
 // ----------------------------------------------------------------------
 // Test properties metadata.
 void
@@ -101,7 +165,51 @@ pylith::friction::TestRateStateAgeing::testHasPropStateVar(void)
   CPPUNIT_ASSERT(material.hasPropStateVar("constitutive_parameter_b"));
   CPPUNIT_ASSERT(!material.hasPropStateVar("aaa"));
   CPPUNIT_ASSERT(material.hasPropStateVar("state_variable"));
+  CPPUNIT_ASSERT(material.hasPropStateVar("previous_slip_rate"));
 } // testHasPropStateVar
 
+// ----------------------------------------------------------------------
+// Test _updateStateVars() with slip rate varying over time step.
+void
+pylith::friction::TestRateStateAgeing::testUpdateStateVarsAdaptive(void)
+{ // testUpdateStateVarsAdaptive
+  RateStateAgeing model;
+
+  const PylithScalar properties[6] = {
+    0.6, // coef
+    0.000001, // slipRate0
+    0.0370, // L
+    0.0125, // a
+    0.0172, // b
+    1000000, // cohesion
+  };
+  PylithScalar stateVars[2] = {
+    92.7, // state
+    0.0001, // previous slip rate
+  };
+  const PylithScalar t = 1.5;
+  const PylithScalar dt = 0.01;
+  const PylithScalar slip = 0.12;
+  const PylithScalar slipRate = 1.0;
+  const PylithScalar normalTraction = -2.2;
+
+  // State variable from integrating d(theta)/dt = 1 - slipRate*theta/L
+  // with slip rate varying linearly from 0.0001 to 1.0 using fine
+  // steps.
+  const PylithScalar stateE = 80.99057227061284;
+  // Time step from estimated error for a single step.
+  const PylithScalar dtStableE = 0.0075638575861719905;
+
+  CPPUNIT_ASSERT_EQUAL(pylith::PYLITH_MAXSCALAR, model.stableTimeStep());
+
+  model.timeStep(dt);
+  model._updateStateVars(t, slip, slipRate, normalTraction, stateVars, 2, properties, 6);
+
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVars[0]/stateE, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(slipRate, stateVars[1], tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, model.stableTimeStep()/dtStableE, tolerance);
+} // testUpdateStateVarsAdaptive
+
 
 // End of file 
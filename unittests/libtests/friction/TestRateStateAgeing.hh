@@ -44,6 +44,9 @@ class pylith::friction::TestRateStateAgeing : public TestFrictionModel
   CPPUNIT_TEST_SUITE( TestRateStateAgeing );
 
   CPPUNIT_TEST( testLinearSlipRate );
+  CPPUNIT_TEST( testStateTolerance );
+  CPPUNIT_TEST( testMaxSubsteps );
+  CPPUNIT_TEST( testMaxSlipFraction );
   CPPUNIT_TEST( testPropertiesMetadata );
   CPPUNIT_TEST( testStateVarsMetadata );
   CPPUNIT_TEST( testDBToProperties );
@@ -56,6 +59,9 @@ class pylith::friction::TestRateStateAgeing : public TestFrictionModel
   CPPUNIT_TEST( test_calcFriction );
   CPPUNIT_TEST( test_calcFrictionDeriv );
   CPPUNIT_TEST( test_updateStateVars );
+  CPPUNIT_TEST( test_calcFrictionBatch );
+  CPPUNIT_TEST( test_updateStateVarsBatch );
+  CPPUNIT_TEST( testUpdateStateVarsAdaptive );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -67,6 +73,15 @@ public :
 
   /// Test cutoff for linear slip rate.
   void testLinearSlipRate(void);
+
+  /// Test stateTolerance().
+  void testStateTolerance(void);
+
+  /// Test maxSubsteps().
+  void testMaxSubsteps(void);
+
+  /// Test maxSlipFraction().
+  void testMaxSlipFraction(void);
   
   /// Test properties metadata.
   void testPropertiesMetadata(void);
@@ -77,6 +92,9 @@ public :
   /// Test hasPropStateVar().
   void testHasPropStateVar(void);
 
+  /// Test _updateStateVars() with slip rate varying over time step.
+  void testUpdateStateVarsAdaptive(void);
+
 }; // class TestRateStateAgeing
 
 #endif // pylith_friction_testslipweakeningtime_hh
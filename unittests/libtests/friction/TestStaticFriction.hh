@@ -55,6 +55,8 @@ class pylith::friction::TestStaticFriction : public TestFrictionModel
   CPPUNIT_TEST( test_calcFriction );
   CPPUNIT_TEST( test_calcFrictionDeriv );
   CPPUNIT_TEST( test_updateStateVars );
+  CPPUNIT_TEST( test_calcFrictionBatch );
+  CPPUNIT_TEST( test_updateStateVarsBatch );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -22,7 +22,7 @@ const int pylith::friction::RateStateAgeingData::_numLocs = 2;
 
 const int pylith::friction::RateStateAgeingData::_numProperties = 6;
 
-const int pylith::friction::RateStateAgeingData::_numStateVars = 1;
+const int pylith::friction::RateStateAgeingData::_numStateVars = 2;
 
 const int pylith::friction::RateStateAgeingData::_numDBProperties = 6;
 
@@ -30,7 +30,7 @@ const int pylith::friction::RateStateAgeingData::_numDBStateVars = 1;
 
 const int pylith::friction::RateStateAgeingData::_numPropsVertex = 6;
 
-const int pylith::friction::RateStateAgeingData::_numVarsVertex = 1;
+const int pylith::friction::RateStateAgeingData::_numVarsVertex = 2;
 
 const PylithScalar pylith::friction::RateStateAgeingData::_lengthScale =   1.00000000e+03;
 
@@ -53,6 +53,7 @@ const int pylith::friction::RateStateAgeingData::_numPropertyValues[] = {
 
 const int pylith::friction::RateStateAgeingData::_numStateVarValues[] = {
   1,
+  1,
 };
 
 const char* pylith::friction::RateStateAgeingData::_dbPropertyValues[] = {
@@ -105,7 +106,9 @@ const PylithScalar pylith::friction::RateStateAgeingData::_properties[] = {
 
 const PylithScalar pylith::friction::RateStateAgeingData::_stateVars[] = {
   92.7,
+  -1.0,
   93.7,
+  -1.0,
 };
 
 const PylithScalar pylith::friction::RateStateAgeingData::_propertiesNondim[] = {
@@ -125,7 +128,9 @@ const PylithScalar pylith::friction::RateStateAgeingData::_propertiesNondim[] =
 
 const PylithScalar pylith::friction::RateStateAgeingData::_stateVarsNondim[] = {
   92.7,
+  -0.001,
   93.7,
+  -0.001,
 };
 
 const PylithScalar pylith::friction::RateStateAgeingData::_friction[] = {
@@ -155,7 +160,9 @@ const PylithScalar pylith::friction::RateStateAgeingData::_normalTraction[] = {
 
 const PylithScalar pylith::friction::RateStateAgeingData::_stateVarsUpdated[] = {
   92.682443150471812,
+  0.0011,
   93.668141160483529,
+  0.0021,
 };
 
 pylith::friction::RateStateAgeingData::RateStateAgeingData(void)
@@ -165,5 +165,107 @@ pylith::materials::TestEffectiveStress::testCalculateCubic(void)
   } // for
 } // testCalculateCubic
 
+// ----------------------------------------------------------------------
+// Test calculateWarmStart().
+void
+pylith::materials::TestEffectiveStress::testCalculateWarmStart(void)
+{ // testCalculateWarmStart
+  const PylithScalar tolerance = 1.0e-06;
+
+  { // linear: Newton converges in one step from any guess
+    const PylithScalar valueE = 10.0;
+    _EffectiveStress::Linear material;
+
+    const int ntests = 4;
+    const PylithScalar guesses[ntests] = { 0.0, 6.0, 14.0, 20.0 };
+    const PylithScalar scale = 1.0;
+    for (int i=0; i < ntests; ++i) {
+      EffectiveStress::SolveStats stats;
+      const PylithScalar value =
+	EffectiveStress::calculateWarmStart<_EffectiveStress::Linear>(guesses[i], scale,
+								      &material, &stats);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+      CPPUNIT_ASSERT_EQUAL(2, stats.numIterations);
+      CPPUNIT_ASSERT(!stats.fallback);
+    } // for
+  } // linear
+
+  { // quadratic: guesses far from root
+    const PylithScalar valueE = 1.0e+04;
+    _EffectiveStress::Quadratic material;
+
+    const int ntests = 4;
+    const PylithScalar guesses[ntests] = { 1.0, 1.0e-1, 2.0e-2, 1.0e-2 };
+    const PylithScalar scale = 1.0e-2;
+    for (int i=0; i < ntests; ++i) {
+      EffectiveStress::SolveStats stats;
+      const PylithScalar value =
+	EffectiveStress::calculateWarmStart<_EffectiveStress::Quadratic>(guesses[i], scale,
+									 &material, &stats);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+      CPPUNIT_ASSERT(!stats.fallback);
+    } // for
+  } // quadratic
+
+  { // cubic: zero derivative at x=4 forces fallback to bracketing
+    const PylithScalar valueE = 6.0;
+    _EffectiveStress::Cubic material;
+
+    EffectiveStress::SolveStats stats;
+    PylithScalar value =
+      EffectiveStress::calculateWarmStart<_EffectiveStress::Cubic>(4.0, 1.0, &material, &stats);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+    CPPUNIT_ASSERT(stats.fallback);
+
+    value = EffectiveStress::calculateWarmStart<_EffectiveStress::Cubic>(6.5, 1.0, &material, &stats);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+    CPPUNIT_ASSERT(!stats.fallback);
+  } // cubic
+} // testCalculateWarmStart
+
+// ----------------------------------------------------------------------
+// Test SolverLog.
+void
+pylith::materials::TestEffectiveStress::testSolverLog(void)
+{ // testSolverLog
+  const PylithScalar tolerance = 1.0e-06;
+
+  EffectiveStress::SolverLog log;
+  CPPUNIT_ASSERT_EQUAL(0, log.numSolves());
+  CPPUNIT_ASSERT_EQUAL(0, log.numIterations());
+  CPPUNIT_ASSERT_EQUAL(0, log.numFallbacks());
+
+  // Counts accumulate without registering events.
+  _EffectiveStress::Linear linear;
+  PylithScalar value = log.calculate<_EffectiveStress::Linear>(6.0, 1.0, &linear);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/10.0, tolerance);
+  value = log.calculate<_EffectiveStress::Linear>(14.0, 1.0, &linear);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/10.0, tolerance);
+  CPPUNIT_ASSERT_EQUAL(2, log.numSolves());
+  CPPUNIT_ASSERT_EQUAL(4, log.numIterations());
+  CPPUNIT_ASSERT_EQUAL(0, log.numFallbacks());
+
+  _EffectiveStress::Cubic cubic;
+  value = log.calculate<_EffectiveStress::Cubic>(4.0, 1.0, &cubic);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/6.0, tolerance);
+  CPPUNIT_ASSERT_EQUAL(3, log.numSolves());
+  CPPUNIT_ASSERT_EQUAL(1, log.numFallbacks());
+
+  // Report without events discards counts.
+  log.report();
+  CPPUNIT_ASSERT_EQUAL(0, log.numSolves());
+  CPPUNIT_ASSERT_EQUAL(0, log.numIterations());
+  CPPUNIT_ASSERT_EQUAL(0, log.numFallbacks());
+
+  // Report with events resets counts.
+  log.initialize("TestEffectiveStress");
+  value = log.calculate<_EffectiveStress::Linear>(20.0, 1.0, &linear);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/10.0, tolerance);
+  CPPUNIT_ASSERT_EQUAL(1, log.numSolves());
+  log.report();
+  CPPUNIT_ASSERT_EQUAL(0, log.numSolves());
+  CPPUNIT_ASSERT_EQUAL(0, log.numIterations());
+} // testSolverLog
+
 
 // End of file
@@ -48,6 +48,8 @@ class pylith::materials::TestEffectiveStress : public CppUnit::TestFixture
   CPPUNIT_TEST( testCalculateLinear );
   CPPUNIT_TEST( testCalculateQuadratic );
   CPPUNIT_TEST( testCalculateCubic );
+  CPPUNIT_TEST( testCalculateWarmStart );
+  CPPUNIT_TEST( testSolverLog );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -63,6 +65,12 @@ public :
   /// Test calculate() with cubic function.
   void testCalculateCubic(void);
 
+  /// Test calculateWarmStart().
+  void testCalculateWarmStart(void);
+
+  /// Test SolverLog.
+  void testSolverLog(void);
+
 }; // class TestEffectiveStress
 
 #endif // pylith_materials_testeffectivestress_hh
@@ -59,6 +59,7 @@ class pylith::materials::TestGenMaxwellQpQsIsotropic3D : public TestElasticMater
 
   // Need to test Maxwell viscoelastic specific behavior.
   CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( test_dtToProperties );
   CPPUNIT_TEST( testUseElasticBehavior );
   CPPUNIT_TEST( testHasStateVars );
 
@@ -80,6 +81,9 @@ public :
   /// Test timeStep()
   void testTimeStep(void);
 
+  /// Test _dtToProperties()
+  void test_dtToProperties(void);
+
   /// Test useElasticBehavior()
   void testUseElasticBehavior(void);
 
@@ -25,7 +25,10 @@
 
 #include "pylith/materials/MaxwellIsotropic3D.hh" // USES MaxwellIsotropic3D
 
+#include "pylith/utils/array.hh" // USES scalar_array
+
 #include <cstring> // USES memcpy()
+#include <cmath> // USES fabs()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestMaxwellIsotropic3D );
@@ -62,6 +65,42 @@ pylith::materials::TestMaxwellIsotropic3D::testTimeStep(void)
   CPPUNIT_ASSERT_EQUAL(true, material.needNewJacobian());
 } // testTimeStep
 
+// ----------------------------------------------------------------------
+// Test _dtToProperties()
+void
+pylith::materials::TestMaxwellIsotropic3D::test_dtToProperties(void)
+{ // test_dtToProperties
+  MaxwellIsotropic3D material;
+  MaxwellIsotropic3DTimeDepData data;
+
+  const PylithScalar dt = 2.0e+5;
+  material.timeStep(dt);
+
+  const int numLocs = data.numLocs;
+  const int propertiesSize = data.numPropsQuadPt;
+  CPPUNIT_ASSERT_EQUAL(propertiesSize, material._numPropsQuadPt);
+  scalar_array properties(propertiesSize);
+
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    memcpy(&properties[0], &data.propertiesNondim[iLoc*propertiesSize],
+	   propertiesSize*sizeof(PylithScalar));
+    // Time step dependent properties follow all other properties.
+    for (int i=MaxwellIsotropic3D::p_viscousStrainParam; i < propertiesSize; ++i)
+      properties[i] = 0.0;
+    material._dtToProperties(&properties[0], properties.size());
+
+    const PylithScalar* const propertiesE =
+      &data.propertiesNondim[iLoc*propertiesSize];
+    const PylithScalar tolerance = 1.0e-06;
+    for (int i=0; i < propertiesSize; ++i) {
+      if (fabs(propertiesE[i]) > tolerance)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[i]/propertiesE[i], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(propertiesE[i], properties[i], tolerance);
+    } // for
+  } // for
+} // test_dtToProperties
+
 // ----------------------------------------------------------------------
 // Test useElasticBehavior()
 void
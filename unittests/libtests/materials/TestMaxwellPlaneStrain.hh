@@ -59,6 +59,7 @@ class pylith::materials::TestMaxwellPlaneStrain : public TestElasticMaterial
 
   // Need to test Maxwell viscoelastic specific behavior.
   CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( test_dtToProperties );
   CPPUNIT_TEST( testUseElasticBehavior );
   CPPUNIT_TEST( testHasStateVars );
 
@@ -83,6 +84,9 @@ public :
   /// Test timeStep()
   void testTimeStep(void);
 
+  /// Test _dtToProperties()
+  void test_dtToProperties(void);
+
   /// Test useElasticBehavior()
   void testUseElasticBehavior(void);
 
@@ -57,7 +57,8 @@ class GenMaxwellIsotropic3DElastic(ElasticMaterialApp):
     self.dbPropertyValues = ["density", "vs", "vp",
                              "shear-ratio-1", "shear-ratio-2", "shear-ratio-3",
                              "viscosity-1", "viscosity-2", "viscosity-3"]
-    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1, 1, 1, 1],
+    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                          1, 1, 1, 1, 1, 1],
                                          dtype=numpy.int32)
 
     self.dbStateVarValues = ["total-strain-xx",
@@ -126,8 +127,9 @@ class GenMaxwellIsotropic3DElastic(ElasticMaterialApp):
     propA = [densityA, vsA, vpA] + shearRatioA + viscosityA
     propB = [densityB, vsB, vpB] + shearRatioB + viscosityB
     self.dbProperties = numpy.array([propA, propB], dtype=numpy.float64)
-    propA = [densityA, muA, lambdaA] + shearRatioA + maxwellTimeA
-    propB = [densityB, muB, lambdaB] + shearRatioB + maxwellTimeB
+    # Time step factors are computed when the time step is set.
+    propA = [densityA, muA, lambdaA] + shearRatioA + maxwellTimeA + [0.0]*6
+    propB = [densityB, muB, lambdaB] + shearRatioB + maxwellTimeB + [0.0]*6
     self.properties = numpy.array([propA, propB], dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -145,11 +147,11 @@ class GenMaxwellIsotropic3DElastic(ElasticMaterialApp):
         numpy.array([ [densityA/density0, muA/mu0, lambdaA/mu0,
                        shearRatioA[0], shearRatioA[1], shearRatioA[2],
                        maxwellTimeA[0]/time0, maxwellTimeA[1]/time0,
-                       maxwellTimeA[2]/time0],
+                       maxwellTimeA[2]/time0] + [0.0]*6,
                       [densityB/density0, muB/mu0, lambdaB/mu0,
                        shearRatioB[0], shearRatioB[1], shearRatioB[2],
                        maxwellTimeB[0]/time0, maxwellTimeB[1]/time0,
-                       maxwellTimeB[2]/time0] ],
+                       maxwellTimeB[2]/time0] + [0.0]*6 ],
                     dtype=numpy.float64)
 
     self.stateVarsNondim = self.stateVars # no scaling
@@ -25,7 +25,7 @@ const int pylith::materials::GenMaxwellIsotropic3DElasticData::_dimension = 3;
 
 const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numLocs = 2;
 
-const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numProperties = 9;
+const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numProperties = 15;
 
 const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numStateVars = 4;
 
@@ -33,7 +33,7 @@ const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numDBProperties
 
 const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numDBStateVars = 24;
 
-const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numPropsQuadPt = 9;
+const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numPropsQuadPt = 15;
 
 const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numVarsQuadPt = 24;
 
@@ -59,6 +59,12 @@ const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numPropertyValue
 1,
 1,
 1,
+1,
+1,
+1,
+1,
+1,
+1,
 };
 
 const int pylith::materials::GenMaxwellIsotropic3DElasticData::_numStateVarValues[] = {
@@ -189,6 +195,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DElasticData::_propert
   8.88888889e+07,
   4.44444444e+07,
   2.22222222e+09,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
   2.00000000e+03,
   2.88000000e+09,
   2.88000000e+09,
@@ -198,6 +210,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DElasticData::_propert
   1.73611111e+09,
   1.73611111e+10,
   1.73611111e+11,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::GenMaxwellIsotropic3DElasticData::_stateVars[] = {
@@ -261,6 +279,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DElasticData::_propert
   8.88888889e+07,
   4.44444444e+07,
   2.22222222e+09,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
   8.88888889e-02,
   1.28000000e-01,
   1.28000000e-01,
@@ -270,6 +294,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DElasticData::_propert
   1.73611111e+09,
   1.73611111e+10,
   1.73611111e+11,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::GenMaxwellIsotropic3DElasticData::_stateVarsNondim[] = {
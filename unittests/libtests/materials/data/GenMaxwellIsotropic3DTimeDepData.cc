@@ -25,7 +25,7 @@ const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_dimension = 3;
 
 const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numLocs = 2;
 
-const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numProperties = 9;
+const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numProperties = 15;
 
 const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numStateVars = 4;
 
@@ -33,7 +33,7 @@ const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numDBProperties
 
 const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numDBStateVars = 24;
 
-const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numPropsQuadPt = 9;
+const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numPropsQuadPt = 15;
 
 const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numVarsQuadPt = 24;
 
@@ -59,6 +59,12 @@ const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numPropertyValue
 1,
 1,
 1,
+1,
+1,
+1,
+1,
+1,
+1,
 };
 
 const int pylith::materials::GenMaxwellIsotropic3DTimeDepData::_numStateVarValues[] = {
@@ -189,6 +195,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DTimeDepData::_propert
   8.88888889e+07,
   4.44444444e+07,
   2.22222222e+09,
+  9.98875843e-01,
+  9.97753371e-01,
+  9.99955001e-01,
+  9.97752529e-01,
+  9.95510110e-01,
+  9.99910004e-01,
   2.00000000e+03,
   2.88000000e+09,
   2.88000000e+09,
@@ -198,6 +210,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DTimeDepData::_propert
   1.73611111e+09,
   1.73611111e+10,
   1.73611111e+11,
+  9.99942402e-01,
+  9.99994240e-01,
+  9.99999424e-01,
+  9.99884807e-01,
+  9.99988480e-01,
+  9.99998848e-01,
 };
 
 const PylithScalar pylith::materials::GenMaxwellIsotropic3DTimeDepData::_stateVars[] = {
@@ -261,6 +279,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DTimeDepData::_propert
   8.88888889e+07,
   4.44444444e+07,
   2.22222222e+09,
+  9.98875843e-01,
+  9.97753371e-01,
+  9.99955001e-01,
+  9.97752529e-01,
+  9.95510110e-01,
+  9.99910004e-01,
   8.88888889e-02,
   1.28000000e-01,
   1.28000000e-01,
@@ -270,6 +294,12 @@ const PylithScalar pylith::materials::GenMaxwellIsotropic3DTimeDepData::_propert
   1.73611111e+09,
   1.73611111e+10,
   1.73611111e+11,
+  9.99942402e-01,
+  9.99994240e-01,
+  9.99999424e-01,
+  9.99884807e-01,
+  9.99988480e-01,
+  9.99998848e-01,
 };
 
 const PylithScalar pylith::materials::GenMaxwellIsotropic3DTimeDepData::_stateVarsNondim[] = {
@@ -25,7 +25,7 @@ const int pylith::materials::GenMaxwellPlaneStrainElasticData::_dimension = 2;
 
 const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numLocs = 2;
 
-const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numProperties = 9;
+const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numProperties = 15;
 
 const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numStateVars = 5;
 
@@ -33,7 +33,7 @@ const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numDBProperties
 
 const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numDBStateVars = 16;
 
-const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numPropsQuadPt = 9;
+const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numPropsQuadPt = 15;
 
 const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numVarsQuadPt = 16;
 
@@ -59,6 +59,12 @@ const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numPropertyValue
 1,
 1,
 1,
+1,
+1,
+1,
+1,
+1,
+1,
 };
 
 const int pylith::materials::GenMaxwellPlaneStrainElasticData::_numStateVarValues[] = {
@@ -166,6 +172,12 @@ const PylithScalar pylith::materials::GenMaxwellPlaneStrainElasticData::_propert
   8.88888889e+07,
   4.44444444e+07,
   2.22222222e+09,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
   2.00000000e+03,
   2.88000000e+09,
   2.88000000e+09,
@@ -175,6 +187,12 @@ const PylithScalar pylith::materials::GenMaxwellPlaneStrainElasticData::_propert
   1.73611111e+09,
   1.73611111e+10,
   1.73611111e+11,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::GenMaxwellPlaneStrainElasticData::_stateVars[] = {
@@ -222,6 +240,12 @@ const PylithScalar pylith::materials::GenMaxwellPlaneStrainElasticData::_propert
   8.88888889e+07,
   4.44444444e+07,
   2.22222222e+09,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
   8.88888889e-02,
   1.28000000e-01,
   1.28000000e-01,
@@ -231,6 +255,12 @@ const PylithScalar pylith::materials::GenMaxwellPlaneStrainElasticData::_propert
   1.73611111e+09,
   1.73611111e+10,
   1.73611111e+11,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::GenMaxwellPlaneStrainElasticData::_stateVarsNondim[] = {
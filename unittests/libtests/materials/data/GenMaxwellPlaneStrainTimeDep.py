@@ -59,7 +59,8 @@ class GenMaxwellPlaneStrainTimeDep(ElasticMaterialApp):
     self.dbPropertyValues = ["density", "vs", "vp",
                              "shear-ratio-1", "shear-ratio-2", "shear-ratio-3",
                              "viscosity-1", "viscosity-2", "viscosity-3"]
-    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1, 1, 1, 1],
+    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                          1, 1, 1, 1, 1, 1],
                                          dtype=numpy.int32)
 
     self.dbStateVarValues = ["stress-zz-initial",
@@ -130,8 +131,15 @@ class GenMaxwellPlaneStrainTimeDep(ElasticMaterialApp):
     dbPropA = [densityA, vsA, vpA] + shearRatioA + viscosityA
     dbPropB = [densityB, vsB, vpB] + shearRatioB + viscosityB
     self.dbProperties = numpy.array([dbPropA, dbPropB], dtype=numpy.float64)
-    propA = [densityA, muA, lambdaA] + shearRatioA + maxwellTimeA
-    propB = [densityB, muB, lambdaB] + shearRatioB + maxwellTimeB
+    # Time step factors (time scale is 1, so same as nondimensional).
+    dqA = [self._computeViscousFactor(t) for t in maxwellTimeA]
+    expFacA = [math.exp(-self.dt/t) for t in maxwellTimeA]
+    dqB = [self._computeViscousFactor(t) for t in maxwellTimeB]
+    expFacB = [math.exp(-self.dt/t) for t in maxwellTimeB]
+    propA = [densityA, muA, lambdaA] + shearRatioA + maxwellTimeA + \
+        dqA + expFacA
+    propB = [densityB, muB, lambdaB] + shearRatioB + maxwellTimeB + \
+        dqB + expFacB
     self.properties = numpy.array([propA, propB], dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -155,11 +163,11 @@ class GenMaxwellPlaneStrainTimeDep(ElasticMaterialApp):
         numpy.array([ [densityA/density0, muA/mu0, lambdaA/mu0,
                        shearRatioA[0], shearRatioA[1], shearRatioA[2],
                        maxwellTimeA[0]/time0, maxwellTimeA[1]/time0,
-                       maxwellTimeA[2]/time0],
+                       maxwellTimeA[2]/time0] + dqA + expFacA,
                       [densityB/density0, muB/mu0, lambdaB/mu0,
                        shearRatioB[0], shearRatioB[1], shearRatioB[2],
                        maxwellTimeB[0]/time0, maxwellTimeB[1]/time0,
-                       maxwellTimeB[2]/time0] ],
+                       maxwellTimeB[2]/time0] + dqB + expFacB ],
                     dtype=numpy.float64)
 
     self.initialStress = numpy.array([initialStressA,
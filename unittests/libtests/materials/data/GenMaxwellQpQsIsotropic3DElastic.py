@@ -66,6 +66,10 @@ class GenMaxwellQpQsIsotropic3DElastic(ElasticMaterialApp):
                              "bulk-viscosity-3",
                              ]
     self.numPropertyValues = numpy.array([1, 1, 1,
+                                          1, 1, 1,
+                                          1, 1, 1,
+                                          1, 1, 1,
+                                          1, 1, 1,
                                           1, 1, 1,
                                           1, 1, 1,
                                           1, 1, 1,
@@ -158,8 +162,9 @@ class GenMaxwellQpQsIsotropic3DElastic(ElasticMaterialApp):
     propA = [densityA, vsA, vpA] + shearRatioA + shearViscosityA + bulkRatioA + bulkViscosityA
     propB = [densityB, vsB, vpB] + shearRatioB + shearViscosityB + bulkRatioB + bulkViscosityB
     self.dbProperties = numpy.array([propA, propB], dtype=numpy.float64)
-    propA = [densityA, muA, kA] + shearRatioA + maxwellTimeA + bulkRatioA + maxwellTimeBulkA
-    propB = [densityB, muB, kB] + shearRatioB + maxwellTimeB + bulkRatioB + maxwellTimeBulkB
+    # Time step factors are computed when the time step is set.
+    propA = [densityA, muA, kA] + shearRatioA + maxwellTimeA + bulkRatioA + maxwellTimeBulkA + [0.0]*12
+    propB = [densityB, muB, kB] + shearRatioB + maxwellTimeB + bulkRatioB + maxwellTimeBulkB + [0.0]*12
     self.properties = numpy.array([propA, propB], dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -176,12 +181,12 @@ class GenMaxwellQpQsIsotropic3DElastic(ElasticMaterialApp):
                        shearRatioA[0], shearRatioA[1], shearRatioA[2],
                        maxwellTimeA[0]/time0, maxwellTimeA[1]/time0, maxwellTimeA[2]/time0,
                        bulkRatioA[0], bulkRatioA[1], bulkRatioA[2],
-                       maxwellTimeBulkA[0]/time0, maxwellTimeBulkA[1]/time0, maxwellTimeBulkA[2]/time0],
+                       maxwellTimeBulkA[0]/time0, maxwellTimeBulkA[1]/time0, maxwellTimeBulkA[2]/time0] + [0.0]*12,
                       [densityB/density0, muB/mu0, kB/mu0,
                        shearRatioB[0], shearRatioB[1], shearRatioB[2],
                        maxwellTimeB[0]/time0, maxwellTimeB[1]/time0, maxwellTimeB[2]/time0, 
                        bulkRatioB[0], bulkRatioB[1], bulkRatioB[2],
-                       maxwellTimeBulkB[0]/time0, maxwellTimeBulkB[1]/time0, maxwellTimeBulkB[2]/time0] ],
+                       maxwellTimeBulkB[0]/time0, maxwellTimeBulkB[1]/time0, maxwellTimeBulkB[2]/time0] + [0.0]*12 ],
                     dtype=numpy.float64)
 
     self.stateVarsNondim = self.stateVars # no scaling
@@ -25,7 +25,7 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_dimension =
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numLocs = 2;
 
-const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numProperties = 15;
+const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numProperties = 27;
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numStateVars = 27;
 
@@ -33,7 +33,7 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numDBPropert
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numDBStateVars = 27;
 
-const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numPropsQuadPt = 15;
+const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numPropsQuadPt = 27;
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numVarsQuadPt = 27;
 
@@ -65,6 +65,18 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numPropertyV
 1,
 1,
 1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
 };
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_numStateVarValues[] = {
@@ -251,6 +263,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_pro
   5.33333333e+07,
   5.33333333e+06,
   5.33333333e+08,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
   2.00000000e+03,
   2.88000000e+09,
   4.80000000e+09,
@@ -266,6 +290,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_pro
   4.16666667e+08,
   4.16666667e+09,
   4.16666667e+10,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_stateVars[] = {
@@ -341,6 +377,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_pro
   5.33333333e+07,
   5.33333333e+06,
   5.33333333e+08,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
   8.88888889e-02,
   1.28000000e-01,
   2.13333333e-01,
@@ -356,6 +404,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_pro
   4.16666667e+08,
   4.16666667e+09,
   4.16666667e+10,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DElasticData::_stateVarsNondim[] = {
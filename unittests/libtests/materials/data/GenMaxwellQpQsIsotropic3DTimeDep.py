@@ -24,6 +24,7 @@
 from ElasticMaterialApp import ElasticMaterialApp
 
 import numpy
+import math
 
 # ----------------------------------------------------------------------
 dimension = 3
@@ -67,6 +68,10 @@ class GenMaxwellQpQsIsotropic3DTimeDep(ElasticMaterialApp):
                              "bulk-viscosity-3",
                              ]
     self.numPropertyValues = numpy.array([1, 1, 1,
+                                          1, 1, 1,
+                                          1, 1, 1,
+                                          1, 1, 1,
+                                          1, 1, 1,
                                           1, 1, 1,
                                           1, 1, 1,
                                           1, 1, 1,
@@ -183,8 +188,19 @@ class GenMaxwellQpQsIsotropic3DTimeDep(ElasticMaterialApp):
     propA = [densityA, vsA, vpA] + shearRatioA + shearViscosityA + bulkRatioA + bulkViscosityA
     propB = [densityB, vsB, vpB] + shearRatioB + shearViscosityB + bulkRatioB + bulkViscosityB
     self.dbProperties = numpy.array([propA, propB], dtype=numpy.float64)
-    propA = [densityA, muA, kA] + shearRatioA + maxwellTimeA + bulkRatioA + maxwellTimeBulkA
-    propB = [densityB, muB, kB] + shearRatioB + maxwellTimeB + bulkRatioB + maxwellTimeBulkB
+    # Time step factors (time scale is 1, so same as nondimensional).
+    dqFac = lambda t: t*(1.0-math.exp(-self.dt/t))/self.dt
+    expFac = lambda t: math.exp(-self.dt/t)
+    dtPropA = [dqFac(t) for t in maxwellTimeA] + \
+        [expFac(t) for t in maxwellTimeA] + \
+        [dqFac(t) for t in maxwellTimeBulkA] + \
+        [expFac(t) for t in maxwellTimeBulkA]
+    dtPropB = [dqFac(t) for t in maxwellTimeB] + \
+        [expFac(t) for t in maxwellTimeB] + \
+        [dqFac(t) for t in maxwellTimeBulkB] + \
+        [expFac(t) for t in maxwellTimeBulkB]
+    propA = [densityA, muA, kA] + shearRatioA + maxwellTimeA + bulkRatioA + maxwellTimeBulkA + dtPropA
+    propB = [densityB, muB, kB] + shearRatioB + maxwellTimeB + bulkRatioB + maxwellTimeBulkB + dtPropB
     self.properties = numpy.array([propA, propB], dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -207,12 +223,12 @@ class GenMaxwellQpQsIsotropic3DTimeDep(ElasticMaterialApp):
                        shearRatioA[0], shearRatioA[1], shearRatioA[2],
                        maxwellTimeA[0]/time0, maxwellTimeA[1]/time0, maxwellTimeA[2]/time0,
                        bulkRatioA[0], bulkRatioA[1], bulkRatioA[2],
-                       maxwellTimeBulkA[0]/time0, maxwellTimeBulkA[1]/time0, maxwellTimeBulkA[2]/time0],
+                       maxwellTimeBulkA[0]/time0, maxwellTimeBulkA[1]/time0, maxwellTimeBulkA[2]/time0] + dtPropA,
                       [densityB/density0, muB/mu0, kB/mu0,
                        shearRatioB[0], shearRatioB[1], shearRatioB[2],
                        maxwellTimeB[0]/time0, maxwellTimeB[1]/time0, maxwellTimeB[2]/time0, 
                        bulkRatioB[0], bulkRatioB[1], bulkRatioB[2],
-                       maxwellTimeBulkB[0]/time0, maxwellTimeBulkB[1]/time0, maxwellTimeBulkB[2]/time0] ],
+                       maxwellTimeBulkB[0]/time0, maxwellTimeBulkB[1]/time0, maxwellTimeBulkB[2]/time0] + dtPropB ],
                     dtype=numpy.float64)
 
     self.stateVarsNondim = self.stateVars # no scaling
@@ -25,7 +25,7 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_dimension =
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numLocs = 2;
 
-const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numProperties = 15;
+const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numProperties = 27;
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numStateVars = 27;
 
@@ -33,7 +33,7 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numDBPropert
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numDBStateVars = 27;
 
-const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numPropsQuadPt = 15;
+const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numPropsQuadPt = 27;
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numVarsQuadPt = 27;
 
@@ -65,6 +65,18 @@ const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numPropertyV
 1,
 1,
 1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
+1,
 };
 
 const int pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_numStateVarValues[] = {
@@ -251,6 +263,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_pro
   1.33333333e+08,
   1.77777778e+07,
   5.33333333e+09,
+  9.97753371e-01,
+  9.77833737e-01,
+  9.99775034e-01,
+  9.95510110e-01,
+  9.55997482e-01,
+  9.99550101e-01,
+  9.99250375e-01,
+  9.94396035e-01,
+  9.99981250e-01,
+  9.98501124e-01,
+  9.88813045e-01,
+  9.99962501e-01,
   2.00000000e+03,
   2.88000000e+09,
   4.80000000e+09,
@@ -266,6 +290,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_pro
   1.04166667e+09,
   1.04166667e+10,
   1.04166667e+11,
+  9.99712055e-01,
+  9.99971201e-01,
+  9.99997120e-01,
+  9.99424166e-01,
+  9.99942402e-01,
+  9.99994240e-01,
+  9.99904006e-01,
+  9.99990400e-01,
+  9.99999040e-01,
+  9.99808018e-01,
+  9.99980800e-01,
+  9.99998080e-01,
 };
 
 const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_stateVars[] = {
@@ -341,6 +377,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_pro
   1.33333333e+08,
   1.77777778e+07,
   5.33333333e+09,
+  9.97753371e-01,
+  9.77833737e-01,
+  9.99775034e-01,
+  9.95510110e-01,
+  9.55997482e-01,
+  9.99550101e-01,
+  9.99250375e-01,
+  9.94396035e-01,
+  9.99981250e-01,
+  9.98501124e-01,
+  9.88813045e-01,
+  9.99962501e-01,
   8.88888889e-02,
   1.28000000e-01,
   2.13333333e-01,
@@ -356,6 +404,18 @@ const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_pro
   1.04166667e+09,
   1.04166667e+10,
   1.04166667e+11,
+  9.99712055e-01,
+  9.99971201e-01,
+  9.99997120e-01,
+  9.99424166e-01,
+  9.99942402e-01,
+  9.99994240e-01,
+  9.99904006e-01,
+  9.99990400e-01,
+  9.99999040e-01,
+  9.99808018e-01,
+  9.99980800e-01,
+  9.99998080e-01,
 };
 
 const PylithScalar pylith::materials::GenMaxwellQpQsIsotropic3DTimeDepData::_stateVarsNondim[] = {
@@ -51,7 +51,7 @@ class MaxwellIsotropic3DElastic(ElasticMaterialApp):
     self.numLocs = numLocs
 
     self.dbPropertyValues = ["density", "vs", "vp", "viscosity"]
-    self.numPropertyValues = numpy.array([1, 1, 1, 1], dtype=numpy.int32)
+    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1], dtype=numpy.int32)
 
     self.dbStateVarValues = ["total-strain-xx",
                              "total-strain-yy",
@@ -98,8 +98,11 @@ class MaxwellIsotropic3DElastic(ElasticMaterialApp):
     self.dbProperties = numpy.array([ [densityA, vsA, vpA, viscosityA],
                                       [densityB, vsB, vpB, viscosityB] ], 
                                     dtype=numpy.float64)
-    self.properties = numpy.array([ [densityA, muA, lambdaA, maxwellTimeA],
-                                    [densityB, muB, lambdaB, maxwellTimeB] ],
+    # Time step factors are computed when the time step is set.
+    self.properties = numpy.array([ [densityA, muA, lambdaA, maxwellTimeA,
+                                     0.0, 0.0],
+                                    [densityB, muB, lambdaB, maxwellTimeB,
+                                     0.0, 0.0] ],
                                      dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -112,8 +115,10 @@ class MaxwellIsotropic3DElastic(ElasticMaterialApp):
     density0 = self.densityScale
     time0 = self.timeScale
     self.propertiesNondim = \
-        numpy.array([ [densityA/density0, muA/mu0, lambdaA/mu0, maxwellTimeA/time0],
-                      [densityB/density0, muB/mu0, lambdaB/mu0, maxwellTimeB/time0] ],
+        numpy.array([ [densityA/density0, muA/mu0, lambdaA/mu0, maxwellTimeA/time0,
+                       0.0, 0.0],
+                      [densityB/density0, muB/mu0, lambdaB/mu0, maxwellTimeB/time0,
+                       0.0, 0.0] ],
                     dtype=numpy.float64)
 
     self.stateVarsNondim = self.stateVars # no scaling
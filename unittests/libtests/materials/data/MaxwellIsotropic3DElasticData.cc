@@ -25,7 +25,7 @@ const int pylith::materials::MaxwellIsotropic3DElasticData::_dimension = 3;
 
 const int pylith::materials::MaxwellIsotropic3DElasticData::_numLocs = 2;
 
-const int pylith::materials::MaxwellIsotropic3DElasticData::_numProperties = 4;
+const int pylith::materials::MaxwellIsotropic3DElasticData::_numProperties = 6;
 
 const int pylith::materials::MaxwellIsotropic3DElasticData::_numStateVars = 2;
 
@@ -33,7 +33,7 @@ const int pylith::materials::MaxwellIsotropic3DElasticData::_numDBProperties = 4
 
 const int pylith::materials::MaxwellIsotropic3DElasticData::_numDBStateVars = 12;
 
-const int pylith::materials::MaxwellIsotropic3DElasticData::_numPropsQuadPt = 4;
+const int pylith::materials::MaxwellIsotropic3DElasticData::_numPropsQuadPt = 6;
 
 const int pylith::materials::MaxwellIsotropic3DElasticData::_numVarsQuadPt = 12;
 
@@ -54,6 +54,8 @@ const int pylith::materials::MaxwellIsotropic3DElasticData::_numPropertyValues[]
 1,
 1,
 1,
+1,
+1,
 };
 
 const int pylith::materials::MaxwellIsotropic3DElasticData::_numStateVarValues[] = {
@@ -126,10 +128,14 @@ const PylithScalar pylith::materials::MaxwellIsotropic3DElasticData::_properties
   2.25000000e+10,
   2.25000000e+10,
   4.44444444e+07,
+  0.00000000e+00,
+  0.00000000e+00,
   2.00000000e+03,
   2.88000000e+09,
   2.88000000e+09,
   3.47222222e+08,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::MaxwellIsotropic3DElasticData::_stateVars[] = {
@@ -164,10 +170,14 @@ const PylithScalar pylith::materials::MaxwellIsotropic3DElasticData::_properties
   1.00000000e+00,
   1.00000000e+00,
   4.44444444e+07,
+  0.00000000e+00,
+  0.00000000e+00,
   8.88888889e-02,
   1.28000000e-01,
   1.28000000e-01,
   3.47222222e+08,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::MaxwellIsotropic3DElasticData::_stateVarsNondim[] = {
@@ -54,7 +54,7 @@ class MaxwellPlaneStrainElastic(ElasticMaterialApp):
     self.numLocs = numLocs
 
     self.dbPropertyValues = ["density", "vs", "vp", "viscosity"]
-    self.numPropertyValues = numpy.array([1, 1, 1, 1], dtype=numpy.int32)
+    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1], dtype=numpy.int32)
 
     self.dbStateVarValues = ["stress-zz-initial",
                              "total-strain-xx",
@@ -99,8 +99,11 @@ class MaxwellPlaneStrainElastic(ElasticMaterialApp):
     self.dbProperties = numpy.array([ [densityA, vsA, vpA, viscosityA],
                                       [densityB, vsB, vpB, viscosityB] ], 
                                     dtype=numpy.float64)
-    self.properties = numpy.array([ [densityA, muA, lambdaA, maxwellTimeA],
-                                    [densityB, muB, lambdaB, maxwellTimeB] ],
+    # Time step factors are computed when the time step is set.
+    self.properties = numpy.array([ [densityA, muA, lambdaA, maxwellTimeA,
+                                     0.0, 0.0],
+                                    [densityB, muB, lambdaB, maxwellTimeB,
+                                     0.0, 0.0] ],
                                      dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -120,9 +123,9 @@ class MaxwellPlaneStrainElastic(ElasticMaterialApp):
     time0 = self.timeScale
     self.propertiesNondim = \
         numpy.array([ [densityA/density0, muA/mu0, lambdaA/mu0,
-                       maxwellTimeA/time0],
+                       maxwellTimeA/time0, 0.0, 0.0],
                       [densityB/density0, muB/mu0, lambdaB/mu0,
-                       maxwellTimeB/time0] ],
+                       maxwellTimeB/time0, 0.0, 0.0] ],
                     dtype=numpy.float64)
 
     stressInitialZZANondim = stressInitialZZA/mu0
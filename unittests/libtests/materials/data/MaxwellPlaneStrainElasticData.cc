@@ -25,7 +25,7 @@ const int pylith::materials::MaxwellPlaneStrainElasticData::_dimension = 2;
 
 const int pylith::materials::MaxwellPlaneStrainElasticData::_numLocs = 2;
 
-const int pylith::materials::MaxwellPlaneStrainElasticData::_numProperties = 4;
+const int pylith::materials::MaxwellPlaneStrainElasticData::_numProperties = 6;
 
 const int pylith::materials::MaxwellPlaneStrainElasticData::_numStateVars = 3;
 
@@ -33,7 +33,7 @@ const int pylith::materials::MaxwellPlaneStrainElasticData::_numDBProperties = 4
 
 const int pylith::materials::MaxwellPlaneStrainElasticData::_numDBStateVars = 8;
 
-const int pylith::materials::MaxwellPlaneStrainElasticData::_numPropsQuadPt = 4;
+const int pylith::materials::MaxwellPlaneStrainElasticData::_numPropsQuadPt = 6;
 
 const int pylith::materials::MaxwellPlaneStrainElasticData::_numVarsQuadPt = 8;
 
@@ -54,6 +54,8 @@ const int pylith::materials::MaxwellPlaneStrainElasticData::_numPropertyValues[]
 1,
 1,
 1,
+1,
+1,
 };
 
 const int pylith::materials::MaxwellPlaneStrainElasticData::_numStateVarValues[] = {
@@ -115,10 +117,14 @@ const PylithScalar pylith::materials::MaxwellPlaneStrainElasticData::_properties
   2.25000000e+10,
   2.25000000e+10,
   4.44444444e+07,
+  0.00000000e+00,
+  0.00000000e+00,
   2.00000000e+03,
   2.88000000e+09,
   2.88000000e+09,
   3.47222222e+08,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::MaxwellPlaneStrainElasticData::_stateVars[] = {
@@ -145,10 +151,14 @@ const PylithScalar pylith::materials::MaxwellPlaneStrainElasticData::_properties
   1.00000000e+00,
   1.00000000e+00,
   4.44444444e+07,
+  0.00000000e+00,
+  0.00000000e+00,
   8.88888889e-02,
   1.28000000e-01,
   1.28000000e-01,
   3.47222222e+08,
+  0.00000000e+00,
+  0.00000000e+00,
 };
 
 const PylithScalar pylith::materials::MaxwellPlaneStrainElasticData::_stateVarsNondim[] = {
@@ -55,8 +55,9 @@ class MaxwellPlaneStrainTimeDep(ElasticMaterialApp):
     self.numLocs = numLocs
 
     self.dbPropertyValues = ["density", "vs", "vp", "viscosity"]
-    self.propertyValues = ["density", "mu", "lambda", "maxwellTime"]
-    self.numPropertyValues = numpy.array([1, 1, 1, 1], dtype=numpy.int32)
+    self.propertyValues = ["density", "mu", "lambda", "maxwellTime",
+                           "viscousStrainParam", "viscousStrainDecay"]
+    self.numPropertyValues = numpy.array([1, 1, 1, 1, 1, 1], dtype=numpy.int32)
 
     self.dbStateVarValues = ["stress-zz-initial",
                              "total-strain-xx",
@@ -110,8 +111,15 @@ class MaxwellPlaneStrainTimeDep(ElasticMaterialApp):
     self.dbProperties = numpy.array([ [densityA, vsA, vpA, viscosityA],
                                       [densityB, vsB, vpB, viscosityB] ], 
                                     dtype=numpy.float64)
-    self.properties = numpy.array([ [densityA, muA, lambdaA, maxwellTimeA],
-                                    [densityB, muB, lambdaB, maxwellTimeB] ],
+    # Time step factors (time scale is 1, so same as nondimensional).
+    dqA = self._computeViscousFactor(maxwellTimeA)
+    expFacA = math.exp(-self.dt/maxwellTimeA)
+    dqB = self._computeViscousFactor(maxwellTimeB)
+    expFacB = math.exp(-self.dt/maxwellTimeB)
+    self.properties = numpy.array([ [densityA, muA, lambdaA, maxwellTimeA,
+                                     dqA, expFacA],
+                                    [densityB, muB, lambdaB, maxwellTimeB,
+                                     dqB, expFacB] ],
                                      dtype=numpy.float64)
 
     # TEMPORARY, need to determine how to use initial state variables
@@ -126,9 +134,9 @@ class MaxwellPlaneStrainTimeDep(ElasticMaterialApp):
     time0 = self.timeScale
     self.propertiesNondim = \
         numpy.array([ [densityA/density0, muA/mu0, lambdaA/mu0, \
-                       maxwellTimeA/time0],
+                       maxwellTimeA/time0, dqA, expFacA],
                       [densityB/density0, muB/mu0, lambdaB/mu0, \
-                       maxwellTimeB/time0] ],
+                       maxwellTimeB/time0, dqB, expFacB] ],
                     dtype=numpy.float64)
 
     self.initialStress = numpy.array([initialStressA,
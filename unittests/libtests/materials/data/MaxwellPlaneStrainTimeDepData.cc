@@ -25,7 +25,7 @@ const int pylith::materials::MaxwellPlaneStrainTimeDepData::_dimension = 2;
 
 const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numLocs = 2;
 
-const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numProperties = 4;
+const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numProperties = 6;
 
 const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numStateVars = 3;
 
@@ -33,7 +33,7 @@ const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numDBProperties = 4
 
 const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numDBStateVars = 8;
 
-const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numPropsQuadPt = 4;
+const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numPropsQuadPt = 6;
 
 const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numVarsQuadPt = 8;
 
@@ -54,6 +54,8 @@ const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numPropertyValues[]
 1,
 1,
 1,
+1,
+1,
 };
 
 const int pylith::materials::MaxwellPlaneStrainTimeDepData::_numStateVarValues[] = {
@@ -115,10 +117,14 @@ const PylithScalar pylith::materials::MaxwellPlaneStrainTimeDepData::_properties
   2.25000000e+10,
   2.25000000e+10,
   4.44444444e+07,
+  9.97753371e-01,
+  9.95510110e-01,
   2.00000000e+03,
   2.88000000e+09,
   2.88000000e+09,
   3.47222222e+09,
+  9.99971201e-01,
+  9.99942402e-01,
 };
 
 const PylithScalar pylith::materials::MaxwellPlaneStrainTimeDepData::_stateVars[] = {
@@ -145,10 +151,14 @@ const PylithScalar pylith::materials::MaxwellPlaneStrainTimeDepData::_properties
   1.00000000e+00,
   1.00000000e+00,
   4.44444444e+07,
+  9.97753371e-01,
+  9.95510110e-01,
   8.88888889e-02,
   1.28000000e-01,
   1.28000000e-01,
   3.47222222e+09,
+  9.99971201e-01,
+  9.99942402e-01,
 };
 
 const PylithScalar pylith::materials::MaxwellPlaneStrainTimeDepData::_stateVarsNondim[] = {
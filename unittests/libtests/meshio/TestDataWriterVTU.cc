@@ -0,0 +1,289 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTU.hh" // Implementation of class methods
+
+#include "data/DataWriterVTKDataMeshTri3.hh" // USES DataWriterVTKDataMeshTri3
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Fields.hh" // USES Fields
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTU );
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTU::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterMesh::setUp();
+  _data = new DataWriterVTKDataMeshTri3;
+  _initialize();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestDataWriterVTU::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterMesh::tearDown();
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestDataWriterVTU::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  CPPUNIT_ASSERT_EQUAL(std::string("output.pvd"), writer._filename);
+  CPPUNIT_ASSERT_EQUAL(false, writer._float32);
+  CPPUNIT_ASSERT_EQUAL(false, writer._base64);
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpen);
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestDataWriterVTU::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const char* filename = "data.pvd";
+  writer.filename(filename);
+  CPPUNIT_ASSERT_EQUAL(std::string(filename), writer._filename);
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test timeFormat()
+void
+pylith::meshio::TestDataWriterVTU::testTimeFormat(void)
+{ // testTimeFormat
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const char* format = "%4.1f";
+  writer.timeFormat(format);
+  CPPUNIT_ASSERT_EQUAL(std::string(format), writer._timeFormat);
+
+  PYLITH_METHOD_END;
+} // testTimeFormat
+
+// ----------------------------------------------------------------------
+// Test timeConstant()
+void
+pylith::meshio::TestDataWriterVTU::testTimeConstant(void)
+{ // testTimeConstant
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const PylithScalar value = 4.5;
+  writer.timeConstant(value);
+  CPPUNIT_ASSERT_EQUAL(value, writer._timeConstant);
+
+  CPPUNIT_ASSERT_THROW(writer.timeConstant(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testTimeConstant
+
+// ----------------------------------------------------------------------
+// Test float32()
+void
+pylith::meshio::TestDataWriterVTU::testFloat32(void)
+{ // testFloat32
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  writer.float32(true);
+  CPPUNIT_ASSERT_EQUAL(true, writer._float32);
+
+  writer.float32(false);
+  CPPUNIT_ASSERT_EQUAL(false, writer._float32);
+
+  PYLITH_METHOD_END;
+} // testFloat32
+
+// ----------------------------------------------------------------------
+// Test encoding()
+void
+pylith::meshio::TestDataWriterVTU::testEncoding(void)
+{ // testEncoding
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  writer.encoding("base64");
+  CPPUNIT_ASSERT_EQUAL(true, writer._base64);
+
+  writer.encoding("raw");
+  CPPUNIT_ASSERT_EQUAL(false, writer._base64);
+
+  CPPUNIT_ASSERT_THROW(writer.encoding("ascii"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testEncoding
+
+// ----------------------------------------------------------------------
+// Test _filenameRoot().
+void
+pylith::meshio::TestDataWriterVTU::testFilenameRoot(void)
+{ // testFilenameRoot
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  // Append info to filename if number of time steps is 0.
+  writer._numTimeSteps = 0;
+  writer._filename = "output.pvd";
+  CPPUNIT_ASSERT_EQUAL(std::string("output_info"), writer._filenameRoot(0.0));
+
+  // Use default normalization of 1.0, remove period from time stamp.
+  writer._numTimeSteps = 100;
+  writer.timeFormat("%05.2f");
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0230"), writer._filenameRoot(2.3));
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0230_p3.vtu"), writer._pieceFilename(writer._filenameRoot(2.3), 3));
+
+  // Use normalization of 20.0, remove period from time stamp.
+  writer.timeConstant(20.0);
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0250"), writer._filenameRoot(50.0));
+
+  PYLITH_METHOD_END;
+} // testFilenameRoot
+
+// ----------------------------------------------------------------------
+// Test _encodeBase64().
+void
+pylith::meshio::TestDataWriterVTU::testEncodeBase64(void)
+{ // testEncodeBase64
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT_EQUAL(std::string(""), DataWriterVTU::_encodeBase64("", 0));
+  CPPUNIT_ASSERT_EQUAL(std::string("TQ=="), DataWriterVTU::_encodeBase64("M", 1));
+  CPPUNIT_ASSERT_EQUAL(std::string("TWE="), DataWriterVTU::_encodeBase64("Ma", 2));
+  CPPUNIT_ASSERT_EQUAL(std::string("TWFu"), DataWriterVTU::_encodeBase64("Man", 3));
+  CPPUNIT_ASSERT_EQUAL(std::string("cGxlYXN1cmUu"), DataWriterVTU::_encodeBase64("pleasure.", 9));
+
+  PYLITH_METHOD_END;
+} // testEncodeBase64
+
+// ----------------------------------------------------------------------
+// Test writeVertexField() and writeCellField().
+void
+pylith::meshio::TestDataWriterVTU::testWriteFields(void)
+{ // testWriteFields
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  topology::Fields vertexFields(*_mesh);
+  _createVertexFields(&vertexFields);
+  topology::Fields cellFields(*_mesh);
+  _createCellFields(&cellFields);
+
+  DataWriterVTU writer;
+  writer.filename("tri3_vtu.pvd");
+  writer.timeFormat(_data->timeFormat);
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  writer.open(*_mesh, numTimeSteps);
+  writer.openTimeStep(t, *_mesh);
+  for (int i=0; i < _data->numVertexFields; ++i) {
+    topology::Field& field = vertexFields.get(_data->vertexFieldsInfo[i].name);
+    writer.writeVertexField(t, field, *_mesh);
+  } // for
+  for (int i=0; i < _data->numCellFields; ++i) {
+    topology::Field& field = cellFields.get(_data->cellFieldsInfo[i].name);
+    writer.writeCellField(t, field);
+  } // for
+  writer.closeTimeStep();
+  writer.close();
+
+  const std::string& root = writer._filenameRoot(t);
+
+  // Piece: cohesive cells are not included, 2-D vectors are padded to 3 components.
+  const std::string& piece = _readHeader(writer._pieceFilename(root, 0).c_str());
+  std::ostringstream sizes;
+  sizes << "NumberOfPoints=\"" << _data->numVertices << "\" NumberOfCells=\"" << _data->numCells << "\"";
+  CPPUNIT_ASSERT(piece.find(sizes.str()) != std::string::npos);
+  CPPUNIT_ASSERT(piece.find("Name=\"displacement\" NumberOfComponents=\"3\"") != std::string::npos);
+  CPPUNIT_ASSERT(piece.find("Name=\"traction\" NumberOfComponents=\"3\"") != std::string::npos);
+  CPPUNIT_ASSERT(piece.find("Name=\"stress\" NumberOfComponents=\"3\"") != std::string::npos);
+  CPPUNIT_ASSERT(piece.find("<AppendedData encoding=\"raw\">") != std::string::npos);
+
+  // Parallel index references piece.
+  const std::string& index = _readHeader((root + ".pvtu").c_str());
+  CPPUNIT_ASSERT(index.find("<Piece Source=\"" + writer._pieceFilename(root, 0) + "\"/>") != std::string::npos);
+
+  // Collection references parallel index.
+  const std::string& collection = _readHeader("tri3_vtu.pvd");
+  CPPUNIT_ASSERT(collection.find("file=\"" + root + ".pvtu\"") != std::string::npos);
+
+  PYLITH_METHOD_END;
+} // testWriteFields
+
+// ----------------------------------------------------------------------
+// Read XML header of file.
+std::string
+pylith::meshio::TestDataWriterVTU::_readHeader(const char* filename)
+{ // _readHeader
+  std::ifstream fin(filename, std::ios::in | std::ios::binary);
+  CPPUNIT_ASSERT(fin.is_open());
+  std::ostringstream contents;
+  contents << fin.rdbuf();
+  fin.close();
+
+  // Keep AppendedData element but drop binary data.
+  const std::string& text = contents.str();
+  const size_t pos = text.find("<AppendedData");
+  return (pos != std::string::npos) ? text.substr(0, text.find('\n', pos)) : text;
+} // _readHeader
+
+
+// End of file 
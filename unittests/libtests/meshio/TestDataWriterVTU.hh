@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestDataWriterVTU.hh
+ *
+ * @brief C++ TestDataWriterVTU object
+ *
+ * C++ unit testing for DataWriterVTU.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtu_hh)
+#define pylith_meshio_testdatawritervtu_hh
+
+#include "TestDataWriterMesh.hh" // ISA TestDataWriterMesh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string> // USES std::string
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestDataWriterVTU;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTU : public TestDataWriterMesh,
+					  public CppUnit::TestFixture
+{ // class TestDataWriterVTU
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTU );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testTimeFormat );
+  CPPUNIT_TEST( testTimeConstant );
+  CPPUNIT_TEST( testFloat32 );
+  CPPUNIT_TEST( testEncoding );
+  CPPUNIT_TEST( testFilenameRoot );
+  CPPUNIT_TEST( testEncodeBase64 );
+  CPPUNIT_TEST( testWriteFields );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test filename()
+  void testFilename(void);
+
+  /// Test timeFormat()
+  void testTimeFormat(void);
+
+  /// Test timeConstant()
+  void testTimeConstant(void);
+
+  /// Test float32()
+  void testFloat32(void);
+
+  /// Test encoding()
+  void testEncoding(void);
+
+  /// Test _filenameRoot().
+  void testFilenameRoot(void);
+
+  /// Test _encodeBase64().
+  void testEncodeBase64(void);
+
+  /// Test writeVertexField() and writeCellField().
+  void testWriteFields(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Read XML header of file.
+   *
+   * @param filename Name of file.
+   * @returns Contents of file before appended data.
+   */
+  static
+  std::string _readHeader(const char* filename);
+
+}; // class TestDataWriterVTU
+
+#endif // pylith_meshio_testdatawritervtu_hh
+
+
+// End of file 
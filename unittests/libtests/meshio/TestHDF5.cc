@@ -406,6 +406,47 @@ pylith::meshio::TestHDF5::testDatasetRawExternal(void)
   PYLITH_METHOD_END;
 } // testDatasetRawExternal
 
+// ----------------------------------------------------------------------
+// Test writeDataset() and readDataset().
+void
+pylith::meshio::TestHDF5::testDataset(void)
+{ // testDataset
+  PYLITH_METHOD_BEGIN;
+
+  const int ndimsE = 2;
+  const hsize_t dimsE[ndimsE] = { 4, 3 };
+  const int nitems = 12;
+  const int valuesE[nitems] = {
+    1, 3, 5,
+    7, 9, 11,
+    13, 15, 17,
+    19, 21, 23,
+  };
+
+  HDF5 h5("test.h5", H5F_ACC_TRUNC);
+  h5.writeDataset("/", "data", (void*)valuesE, dimsE, ndimsE, H5T_NATIVE_INT);
+  h5.close();
+
+  h5.open("test.h5", H5F_ACC_RDONLY);
+  char* valuesC = 0;
+  hsize_t* dims = 0;
+  int ndims = 0;
+  h5.readDataset("/", "data", &valuesC, &dims, &ndims, H5T_NATIVE_INT);
+  h5.close();
+
+  CPPUNIT_ASSERT_EQUAL(ndimsE, ndims);
+  for (int i=0; i < ndims; ++i)
+    CPPUNIT_ASSERT_EQUAL(dimsE[i], dims[i]);
+  const int* values = (int*)valuesC;
+  for (int i=0; i < nitems; ++i)
+    CPPUNIT_ASSERT_EQUAL(valuesE[i], values[i]);
+
+  delete[] valuesC; valuesC = 0;
+  delete[] dims; dims = 0;
+
+  PYLITH_METHOD_END;
+} // testDataset
+
 // ----------------------------------------------------------------------
 // Test writeAttribute(string) and readAttribute(string).
 void
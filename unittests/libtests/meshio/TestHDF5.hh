@@ -54,6 +54,7 @@ class pylith::meshio::TestHDF5 : public CppUnit::TestFixture
   CPPUNIT_TEST( testCreateDataset );
   CPPUNIT_TEST( testDatasetChunk );
   CPPUNIT_TEST( testDatasetRawExternal );
+  CPPUNIT_TEST( testDataset );
 
   CPPUNIT_TEST( testAttributeString );
   CPPUNIT_TEST( testDatasetString );
@@ -96,6 +97,9 @@ public :
   /// Test createDatasetRawExternal() and updateDatasetRawExternal().
   void testDatasetRawExternal(void);
 
+  /// Test writeDataset() and readDataset().
+  void testDataset(void);
+
   /// Test writeAttribute(string) and readAttribute(string).
   void testAttributeString(void);
 
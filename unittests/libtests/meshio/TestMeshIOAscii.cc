@@ -33,6 +33,9 @@
 #include "data/MeshData3DIndexOne.hh"
 
 #include <strings.h> // USES strcasecmp()
+#include <cstdio> // USES remove()
+#include <fstream> // USES std::ifstream
+#include <stdexcept> // USES std::runtime_error
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestMeshIOAscii );
@@ -91,6 +94,22 @@ pylith::meshio::TestMeshIOAscii::testFilename(void)
   PYLITH_METHOD_END;
 } // testFilename
 
+// ----------------------------------------------------------------------
+// Test useCache()
+void
+pylith::meshio::TestMeshIOAscii::testUseCache(void)
+{ // testUseCache
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  CPPUNIT_ASSERT_EQUAL(false, iohandler.useCache());
+
+  iohandler.useCache(true);
+  CPPUNIT_ASSERT_EQUAL(true, iohandler.useCache());
+
+  PYLITH_METHOD_END;
+} // testUseCache
+
 // ----------------------------------------------------------------------
 // Test write() and read() for 1D mesh.
 void
@@ -203,6 +222,68 @@ pylith::meshio::TestMeshIOAscii::testReadComments(void)
   PYLITH_METHOD_END;
 } // testWriteReadComments
 
+// ----------------------------------------------------------------------
+// Test read() using binary cache for 2D mesh in 2D space.
+void
+pylith::meshio::TestMeshIOAscii::testReadCache(void)
+{ // testReadCache
+  PYLITH_METHOD_BEGIN;
+
+  MeshData2D data;
+  const char* filename = "mesh2D_cache.txt";
+
+  _createMesh(data);
+
+  // Write mesh and remove any stale cache.
+  MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.write(_mesh);
+  const std::string cacheFilename = std::string(filename) + ".cache";
+  remove(cacheFilename.c_str());
+
+  // First read parses the ASCII file and writes the cache.
+  iohandler.useCache(true);
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+  _checkVals(data);
+
+  std::ifstream cache(cacheFilename.c_str());
+  CPPUNIT_ASSERT(cache.is_open());
+  cache.close();
+
+  // Second read uses the cache.
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+  _checkVals(data);
+
+  PYLITH_METHOD_END;
+} // testReadCache
+
+// ----------------------------------------------------------------------
+// Test read() error message for file with malformed value.
+void
+pylith::meshio::TestMeshIOAscii::testReadMalformed(void)
+{ // testReadMalformed
+  PYLITH_METHOD_BEGIN;
+
+  const char* filename = "data/mesh2D_malformed.txt";
+
+  MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  delete _mesh; _mesh = new topology::Mesh;
+  try {
+    iohandler.read(_mesh);
+    CPPUNIT_FAIL("Expected exception for malformed mesh file.");
+  } catch (const std::runtime_error& err) {
+    const std::string msgE =
+      "Error occurred while reading PyLith mesh ASCII file 'data/mesh2D_malformed.txt' at line 10.\n"
+      "Could not parse '1.0.000000e+00' as a floating point value.";
+    CPPUNIT_ASSERT_EQUAL(msgE, std::string(err.what()));
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // testReadMalformed
+
 // ----------------------------------------------------------------------
 // Build mesh, perform write() and read(), and then check values.
 void
@@ -49,6 +49,7 @@ class pylith::meshio::TestMeshIOAscii : public TestMeshIO
   CPPUNIT_TEST( testDebug );
   CPPUNIT_TEST( testInterpolate );
   CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testUseCache );
   CPPUNIT_TEST( testWriteRead1D );
   CPPUNIT_TEST( testWriteRead1Din2D );
   CPPUNIT_TEST( testWriteRead1Din3D );
@@ -57,6 +58,8 @@ class pylith::meshio::TestMeshIOAscii : public TestMeshIO
   CPPUNIT_TEST( testWriteRead3D );
   CPPUNIT_TEST( testRead3DIndexOne );
   CPPUNIT_TEST( testReadComments );
+  CPPUNIT_TEST( testReadCache );
+  CPPUNIT_TEST( testReadMalformed );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -75,6 +78,9 @@ public :
   /// Test filename()
   void testFilename(void);
 
+  /// Test useCache()
+  void testUseCache(void);
+
   /// Test write() and read() for 1D mesh in 1D space.
   void testWriteRead1D(void);
 
@@ -99,6 +105,12 @@ public :
   /// Test and read() for 2D mesh in 2D space with comments.
   void testReadComments(void);
 
+  /// Test read() using binary cache for 2D mesh in 2D space.
+  void testReadCache(void);
+
+  /// Test read() error message for file with malformed value.
+  void testReadMalformed(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -0,0 +1,207 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+#include <portinfo>
+
+#include "TestMeshIOHDF5.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOHDF5.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "data/MeshData1D.hh"
+#include "data/MeshData2D.hh"
+#include "data/MeshData2Din3D.hh"
+#include "data/MeshData3D.hh"
+
+#include <strings.h> // USES strcasecmp()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestMeshIOHDF5 );
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOHDF5::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOHDF5 iohandler;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test debug()
+void
+pylith::meshio::TestMeshIOHDF5::testDebug(void)
+{ // testDebug
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOHDF5 iohandler;
+  _testDebug(iohandler);
+
+  PYLITH_METHOD_END;
+} // testDebug
+
+// ----------------------------------------------------------------------
+// Test interpolate()
+void
+pylith::meshio::TestMeshIOHDF5::testInterpolate(void)
+{ // testInterpolate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOHDF5 iohandler;
+  _testInterpolate(iohandler);
+
+  PYLITH_METHOD_END;
+} // testInterpolate
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestMeshIOHDF5::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOHDF5 iohandler;
+
+  const char* filename = "hi.h5";
+  iohandler.filename(filename);
+  CPPUNIT_ASSERT(0 == strcasecmp(filename, iohandler.filename()));
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 1D mesh.
+void
+pylith::meshio::TestMeshIOHDF5::testWriteRead1D(void)
+{ // testWriteRead1D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData1D data;
+  const char* filename = "mesh1D.h5";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead1D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 2D mesh in 2D space.
+void
+pylith::meshio::TestMeshIOHDF5::testWriteRead2D(void)
+{ // testWriteRead2D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData2D data;
+  const char* filename = "mesh2D.h5";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead2D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 2D mesh in 3D space.
+void
+pylith::meshio::TestMeshIOHDF5::testWriteRead2Din3D(void)
+{ // testWriteRead2Din3D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData2Din3D data;
+  const char* filename = "mesh2Din3D.h5";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead2Din3D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 3D mesh.
+void
+pylith::meshio::TestMeshIOHDF5::testWriteRead3D(void)
+{ // testWriteRead3D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData3D data;
+  const char* filename = "mesh3D.h5";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead3D
+
+// ----------------------------------------------------------------------
+// Test write() and read() preserve hybrid bounds.
+void
+pylith::meshio::TestMeshIOHDF5::testWriteReadHybrid(void)
+{ // testWriteReadHybrid
+  PYLITH_METHOD_BEGIN;
+
+  MeshData2D data;
+  const char* filename = "mesh2D_hybrid.h5";
+
+  _createMesh(data);
+
+  // Treat last cell as a hybrid cell.
+  const PetscInt cMaxE = data.numCells-1;
+  PetscErrorCode err = DMPlexSetHybridBounds(_mesh->dmMesh(), cMaxE, PETSC_DETERMINE, PETSC_DETERMINE, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+
+  MeshIOHDF5 iohandler;
+  iohandler.filename(filename);
+  iohandler.write(_mesh);
+
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  PetscInt cMax = 0, fMax = 0, eMax = 0, vMax = 0;
+  err = DMPlexGetHybridBounds(_mesh->dmMesh(), &cMax, &fMax, &eMax, &vMax);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(cMaxE, cMax);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(-1), vMax);
+
+  _checkVals(data);
+
+  PYLITH_METHOD_END;
+} // testWriteReadHybrid
+
+// ----------------------------------------------------------------------
+// Build mesh, perform write() and read(), and then check values.
+void
+pylith::meshio::TestMeshIOHDF5::_testWriteRead(const MeshData& data,
+					       const char* filename)
+{ // _testWriteRead
+  PYLITH_METHOD_BEGIN;
+
+  _createMesh(data);
+
+  // Write mesh
+  MeshIOHDF5 iohandler;
+  iohandler.filename(filename);
+  iohandler.write(_mesh);
+
+  // Read mesh
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  // Make sure meshIn matches data
+  _checkVals(data);
+
+  PYLITH_METHOD_END;
+} // _testWriteRead
+
+
+// End of file 
@@ -0,0 +1,108 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+/**
+ * @file unittests/libtests/meshio/TestMeshIOHDF5.hh
+ *
+ * @brief C++ TestMeshIOHDF5 object
+ *
+ * C++ unit testing for MeshIOHDF5.
+ */
+
+#if !defined(pylith_meshio_testmeshiohdf5_hh)
+#define pylith_meshio_testmeshiohdf5_hh
+
+// Include directives ---------------------------------------------------
+#include "TestMeshIO.hh"
+
+// Forward declarations -------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    class TestMeshIOHDF5;
+
+    class MeshData;
+  } // meshio
+} // pylith
+
+// TestMeshIOHDF5 -------------------------------------------------------
+class pylith::meshio::TestMeshIOHDF5 : public TestMeshIO
+{ // class TestMeshIOHDF5
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMeshIOHDF5 );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testDebug );
+  CPPUNIT_TEST( testInterpolate );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testWriteRead1D );
+  CPPUNIT_TEST( testWriteRead2D );
+  CPPUNIT_TEST( testWriteRead2Din3D );
+  CPPUNIT_TEST( testWriteRead3D );
+  CPPUNIT_TEST( testWriteReadHybrid );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test debug()
+  void testDebug(void);
+
+  /// Test interpolate()
+  void testInterpolate(void);
+
+  /// Test filename()
+  void testFilename(void);
+
+  /// Test write() and read() for 1D mesh in 1D space.
+  void testWriteRead1D(void);
+
+  /// Test write() and read() for 2D mesh in 2D space.
+  void testWriteRead2D(void);
+
+  /// Test write() and read() for 2D mesh in 3D space.
+  void testWriteRead2Din3D(void);
+
+  /// Test write() and read() for 3D mesh in 3D space.
+  void testWriteRead3D(void);
+
+  /// Test write() and read() preserve hybrid bounds.
+  void testWriteReadHybrid(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Build mesh, perform write() and read(), and then check values.
+   *
+   * @param data Mesh data
+   * @param filename Name of mesh file to write/read
+   */
+  void _testWriteRead(const MeshData& data,
+		      const char* filename);
+
+}; // class TestMeshIOHDF5
+
+#endif // pylith_meshio_testmeshiohdf5_hh
+
+
+// End of file 
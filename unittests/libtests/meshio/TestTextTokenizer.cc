@@ -0,0 +1,502 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+#include <portinfo>
+
+#include "TestTextTokenizer.hh" // Implementation of class methods
+
+#include "pylith/meshio/TextTokenizer.hh" // USES TextTokenizer
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cstdio> // USES remove()
+#include <cstdlib> // USES strtod()
+#include <cmath> // USES std::isinf(), std::isnan()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestTextTokenizer );
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestTextTokenizer::tearDown(void)
+{ // tearDown
+  if (!_filename.empty()) {
+    remove(_filename.c_str());
+    _filename = "";
+  } // if
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test open() with missing file.
+void
+pylith::meshio::TestTextTokenizer::testOpen(void)
+{ // testOpen
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  try {
+    tokenizer.open("data/nonexistent.txt");
+    CPPUNIT_FAIL("Expected exception for missing file.");
+  } catch (const std::runtime_error& err) {
+    CPPUNIT_ASSERT_EQUAL(std::string("Could not open file 'data/nonexistent.txt' for reading."), std::string(err.what()));
+  } // try/catch
+  CPPUNIT_ASSERT_EQUAL(0, tokenizer.lineNumber());
+
+  // Empty file has no lines with content.
+  _open(&tokenizer, "");
+  CPPUNIT_ASSERT(!tokenizer.nextLine());
+
+  PYLITH_METHOD_END;
+} // testOpen
+
+// ----------------------------------------------------------------------
+// Test nextLine() and lineNumber() with comments and blank lines.
+void
+pylith::meshio::TestTextTokenizer::testNextLine(void)
+{ // testNextLine
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer,
+	"// header\n"
+	"\n"
+	"   \t\n"
+	"  first 1 // comment\n"
+	"// only comment\n"
+	"\n"
+	"second/third\n"
+	"last");
+
+  const char* token = 0;
+  size_t length = 0;
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(4, tokenizer.lineNumber());
+  std::string value;
+  tokenizer.restOfLine(&value);
+  CPPUNIT_ASSERT_EQUAL(std::string("first 1"), value);
+
+  // A single slash does not start a comment.
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(7, tokenizer.lineNumber());
+  CPPUNIT_ASSERT(tokenizer.nextToken(&token, &length));
+  CPPUNIT_ASSERT_EQUAL(std::string("second/third"), std::string(token, length));
+
+  // Last line without trailing newline.
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(8, tokenizer.lineNumber());
+  CPPUNIT_ASSERT(tokenizer.nextToken(&token, &length));
+  CPPUNIT_ASSERT_EQUAL(std::string("last"), std::string(token, length));
+
+  CPPUNIT_ASSERT(!tokenizer.nextLine());
+
+  PYLITH_METHOD_END;
+} // testNextLine
+
+// ----------------------------------------------------------------------
+// Test nextToken() and matches().
+void
+pylith::meshio::TestTextTokenizer::testNextToken(void)
+{ // testNextToken
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer, "Dimension = 2\r\n");
+
+  const char* token = 0;
+  size_t length = 0;
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT(tokenizer.nextToken(&token, &length));
+  CPPUNIT_ASSERT(TextTokenizer::matches(token, length, "dimension"));
+  CPPUNIT_ASSERT(!TextTokenizer::matches(token, length, "dim"));
+  CPPUNIT_ASSERT(!TextTokenizer::matches(token, length, "dimensions"));
+
+  tokenizer.skipPast('=');
+  CPPUNIT_ASSERT_EQUAL(2, tokenizer.readInt());
+
+  // Carriage return is treated as whitespace.
+  CPPUNIT_ASSERT(!tokenizer.nextToken(&token, &length));
+  CPPUNIT_ASSERT(!token);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), length);
+
+  PYLITH_METHOD_END;
+} // testNextToken
+
+// ----------------------------------------------------------------------
+// Test ignore().
+void
+pylith::meshio::TestTextTokenizer::testIgnore(void)
+{ // testIgnore
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer,
+	"cells = {\n"
+	"  1 2\n"
+	"  } after\n"
+	"next 3\n");
+
+  const char* token = 0;
+  size_t length = 0;
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  tokenizer.ignore('{');
+  CPPUNIT_ASSERT_EQUAL(1, tokenizer.readIntAnyLine());
+  CPPUNIT_ASSERT_EQUAL(2, tokenizer.lineNumber());
+  CPPUNIT_ASSERT_EQUAL(2, tokenizer.readInt());
+
+  // Remainder of line after delimiter is parsed as the next line.
+  tokenizer.ignore('}');
+  CPPUNIT_ASSERT_EQUAL(3, tokenizer.lineNumber());
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(3, tokenizer.lineNumber());
+  CPPUNIT_ASSERT(tokenizer.nextToken(&token, &length));
+  CPPUNIT_ASSERT_EQUAL(std::string("after"), std::string(token, length));
+
+  try {
+    tokenizer.ignore('}');
+    CPPUNIT_FAIL("Expected exception at end of file.");
+  } catch (const std::runtime_error& err) {
+    CPPUNIT_ASSERT_EQUAL(std::string("Reached end of file while looking for '}'."), std::string(err.what()));
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // testIgnore
+
+// ----------------------------------------------------------------------
+// Test readInt().
+void
+pylith::meshio::TestTextTokenizer::testReadInt(void)
+{ // testReadInt
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer,
+	"12 -3 +4 0 007\n"
+	"12a\n"
+	"x\n"
+	"-\n"
+	"1.5\n"
+	"5\n");
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(12, tokenizer.readInt());
+  CPPUNIT_ASSERT_EQUAL(-3, tokenizer.readInt());
+  CPPUNIT_ASSERT_EQUAL(4, tokenizer.readInt());
+  CPPUNIT_ASSERT_EQUAL(0, tokenizer.readInt());
+  CPPUNIT_ASSERT_EQUAL(7, tokenizer.readInt());
+
+  const char* valuesBad[4] = {
+    "12a",
+    "x",
+    "-",
+    "1.5",
+  };
+  for (int i=0; i < 4; ++i) {
+    CPPUNIT_ASSERT(tokenizer.nextLine());
+    CPPUNIT_ASSERT_EQUAL(3+i, tokenizer.lineNumber());
+    try {
+      tokenizer.readInt();
+      CPPUNIT_FAIL("Expected exception for malformed integer.");
+    } catch (const std::runtime_error& err) {
+      const std::string msgE = std::string("Could not parse '") + valuesBad[i] + "' as an integer.";
+      CPPUNIT_ASSERT_EQUAL(msgE, std::string(err.what()));
+    } // try/catch
+  } // for
+
+  // Missing value at end of line.
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(5, tokenizer.readInt());
+  try {
+    tokenizer.readInt();
+    CPPUNIT_FAIL("Expected exception for missing integer.");
+  } catch (const std::runtime_error& err) {
+    CPPUNIT_ASSERT_EQUAL(std::string("Could not parse '' as an integer."), std::string(err.what()));
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // testReadInt
+
+// ----------------------------------------------------------------------
+// Test readInt() with values that do not fit in an int.
+void
+pylith::meshio::TestTextTokenizer::testReadIntOverflow(void)
+{ // testReadIntOverflow
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer,
+	"2147483647 -2147483648\n"
+	"2147483648\n"
+	"-2147483649\n"
+	"99999999999999999999999\n");
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(2147483647, tokenizer.readInt());
+  CPPUNIT_ASSERT_EQUAL(-2147483647-1, tokenizer.readInt());
+
+  const char* valuesBad[3] = {
+    "2147483648",
+    "-2147483649",
+    "99999999999999999999999",
+  };
+  for (int i=0; i < 3; ++i) {
+    CPPUNIT_ASSERT(tokenizer.nextLine());
+    try {
+      tokenizer.readInt();
+      CPPUNIT_FAIL("Expected exception for integer overflow.");
+    } catch (const std::runtime_error& err) {
+      const std::string msgE = std::string("Could not parse '") + valuesBad[i] + "' as an integer.";
+      CPPUNIT_ASSERT_EQUAL(msgE, std::string(err.what()));
+    } // try/catch
+  } // for
+
+  PYLITH_METHOD_END;
+} // testReadIntOverflow
+
+// ----------------------------------------------------------------------
+// Test readIntAnyLine().
+void
+pylith::meshio::TestTextTokenizer::testReadIntAnyLine(void)
+{ // testReadIntAnyLine
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer,
+	"1 2\n"
+	"\n"
+	"// comment\n"
+	"  3 // comment\n");
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(1, tokenizer.readIntAnyLine());
+  CPPUNIT_ASSERT_EQUAL(2, tokenizer.readIntAnyLine());
+  CPPUNIT_ASSERT_EQUAL(3, tokenizer.readIntAnyLine());
+  CPPUNIT_ASSERT_EQUAL(4, tokenizer.lineNumber());
+
+  try {
+    tokenizer.readIntAnyLine();
+    CPPUNIT_FAIL("Expected exception at end of file.");
+  } catch (const std::runtime_error& err) {
+    CPPUNIT_ASSERT_EQUAL(std::string("Reached end of file while reading integers."), std::string(err.what()));
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // testReadIntAnyLine
+
+// ----------------------------------------------------------------------
+// Test readScalar() with values converted without strtod().
+void
+pylith::meshio::TestTextTokenizer::testReadScalar(void)
+{ // testReadScalar
+  PYLITH_METHOD_BEGIN;
+
+  const int numValues = 12;
+  const char* values[numValues] = {
+    "0",
+    "-0.0",
+    "1.5",
+    "-0.25",
+    "+3e2",
+    "7",
+    ".5",
+    "5.",
+    "1.0E-22",
+    "6.0e+22",
+    "1.234567e+00",
+    "9007199254740992",
+  };
+  _checkScalars(values, numValues);
+
+  PYLITH_METHOD_END;
+} // testReadScalar
+
+// ----------------------------------------------------------------------
+// Test readScalar() with values handed to strtod().
+void
+pylith::meshio::TestTextTokenizer::testReadScalarStrtod(void)
+{ // testReadScalarStrtod
+  PYLITH_METHOD_BEGIN;
+
+  // Value with more digits than fit in the stack buffer for strtod().
+  std::string longValue = "0.";
+  for (int i=0; i < 150; ++i) {
+    longValue += char('0' + (i*7) % 10);
+  } // for
+
+  const int numValues = 14;
+  const char* values[numValues] = {
+    // Long mantissas.
+    "3.14159265358979323846264338327950288",
+    "123456789012345678901234567890",
+    "0.000000000000000000000000123456789",
+    "9007199254740993",
+    "1.00000000000000000001",
+    "18446744073709551615",
+    // Exponents beyond exactly representable powers of 10.
+    "1.0e-23",
+    "1.0e+23",
+    "1.0e-30",
+    "-2.5e+300",
+    "2.2250738585072014e-308",
+    "4.9e-324",
+    "1.0e+400",
+    longValue.c_str(),
+  };
+  _checkScalars(values, numValues);
+
+  PYLITH_METHOD_END;
+} // testReadScalarStrtod
+
+// ----------------------------------------------------------------------
+// Test readScalar() with inf and nan.
+void
+pylith::meshio::TestTextTokenizer::testReadScalarSpecial(void)
+{ // testReadScalarSpecial
+  PYLITH_METHOD_BEGIN;
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer, "inf -Infinity nan NAN\n");
+
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  PylithScalar value = tokenizer.readScalar();
+  CPPUNIT_ASSERT(std::isinf(value) && value > 0.0);
+  value = tokenizer.readScalar();
+  CPPUNIT_ASSERT(std::isinf(value) && value < 0.0);
+  CPPUNIT_ASSERT(std::isnan(tokenizer.readScalar()));
+  CPPUNIT_ASSERT(std::isnan(tokenizer.readScalar()));
+
+  PYLITH_METHOD_END;
+} // testReadScalarSpecial
+
+// ----------------------------------------------------------------------
+// Test readScalar() with malformed values.
+void
+pylith::meshio::TestTextTokenizer::testReadScalarBad(void)
+{ // testReadScalarBad
+  PYLITH_METHOD_BEGIN;
+
+  const int numValues = 8;
+  const char* valuesBad[numValues] = {
+    "1.2.3",
+    "abc",
+    "1e",
+    "1e+",
+    "--1",
+    "1.0x",
+    ".",
+    "1.0e5.0",
+  };
+
+  std::string text;
+  for (int i=0; i < numValues; ++i) {
+    text += std::string(valuesBad[i]) + "\n// comment\n";
+  } // for
+  text += "1.0\n";
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer, text.c_str());
+
+  for (int i=0; i < numValues; ++i) {
+    CPPUNIT_ASSERT(tokenizer.nextLine());
+    CPPUNIT_ASSERT_EQUAL(1+2*i, tokenizer.lineNumber());
+    try {
+      tokenizer.readScalar();
+      CPPUNIT_FAIL("Expected exception for malformed floating point value.");
+    } catch (const std::runtime_error& err) {
+      const std::string msgE = std::string("Could not parse '") + valuesBad[i] + "' as a floating point value.";
+      CPPUNIT_ASSERT_EQUAL(msgE, std::string(err.what()));
+    } // try/catch
+  } // for
+
+  // Missing value at end of line.
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(1.0), tokenizer.readScalar());
+  try {
+    tokenizer.readScalar();
+    CPPUNIT_FAIL("Expected exception for missing floating point value.");
+  } catch (const std::runtime_error& err) {
+    CPPUNIT_ASSERT_EQUAL(std::string("Could not parse '' as a floating point value."), std::string(err.what()));
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // testReadScalarBad
+
+// ----------------------------------------------------------------------
+// Write text to a file and open it with the tokenizer.
+void
+pylith::meshio::TestTextTokenizer::_open(TextTokenizer* tokenizer,
+					 const char* text)
+{ // _open
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(tokenizer);
+  CPPUNIT_ASSERT(text);
+
+  _filename = "texttokenizer.txt";
+  std::ofstream fout(_filename.c_str());
+  CPPUNIT_ASSERT(fout.is_open());
+  fout << text;
+  fout.close();
+
+  tokenizer->open(_filename.c_str());
+
+  PYLITH_METHOD_END;
+} // _open
+
+// ----------------------------------------------------------------------
+// Read values with readScalar() and check them against strtod().
+void
+pylith::meshio::TestTextTokenizer::_checkScalars(const char* const* values,
+						 const int numValues)
+{ // _checkScalars
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(values);
+
+  // Values on one line separated by varying whitespace.
+  std::string text;
+  for (int i=0; i < numValues; ++i) {
+    text += std::string(values[i]) + ((i % 2) ? "\t" : "   ");
+  } // for
+  text += "\n";
+
+  TextTokenizer tokenizer;
+  _open(&tokenizer, text.c_str());
+  CPPUNIT_ASSERT(tokenizer.nextLine());
+  for (int i=0; i < numValues; ++i) {
+    const PylithScalar valueE = PylithScalar(strtod(values[i], 0));
+    const PylithScalar value = tokenizer.readScalar();
+    // Conversion must be correctly rounded, so compare bit for bit.
+    if (valueE != value) {
+      std::ostringstream msg;
+      msg << "Mismatch in value '" << values[i] << "'.";
+      CPPUNIT_FAIL(msg.str());
+    } // if
+  } // for
+  CPPUNIT_ASSERT(!tokenizer.nextLine());
+
+  PYLITH_METHOD_END;
+} // _checkScalars
+
+
+// End of file
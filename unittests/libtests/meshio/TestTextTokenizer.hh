@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+/**
+ * @file unittests/libtests/meshio/TestTextTokenizer.hh
+ *
+ * @brief C++ TestTextTokenizer object
+ *
+ * C++ unit testing for TextTokenizer.
+ */
+
+#if !defined(pylith_meshio_testtexttokenizer_hh)
+#define pylith_meshio_testtexttokenizer_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string> // USES std::string
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestTextTokenizer;
+    class TextTokenizer; // USES TextTokenizer
+  } // meshio
+} // pylith
+
+/// C++ unit testing for TextTokenizer
+class pylith::meshio::TestTextTokenizer : public CppUnit::TestFixture
+{ // class TestTextTokenizer
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestTextTokenizer );
+
+  CPPUNIT_TEST( testOpen );
+  CPPUNIT_TEST( testNextLine );
+  CPPUNIT_TEST( testNextToken );
+  CPPUNIT_TEST( testIgnore );
+  CPPUNIT_TEST( testReadInt );
+  CPPUNIT_TEST( testReadIntOverflow );
+  CPPUNIT_TEST( testReadIntAnyLine );
+  CPPUNIT_TEST( testReadScalar );
+  CPPUNIT_TEST( testReadScalarStrtod );
+  CPPUNIT_TEST( testReadScalarSpecial );
+  CPPUNIT_TEST( testReadScalarBad );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test open() with missing file.
+  void testOpen(void);
+
+  /// Test nextLine() and lineNumber() with comments and blank lines.
+  void testNextLine(void);
+
+  /// Test nextToken() and matches().
+  void testNextToken(void);
+
+  /// Test ignore().
+  void testIgnore(void);
+
+  /// Test readInt().
+  void testReadInt(void);
+
+  /// Test readInt() with values that do not fit in an int.
+  void testReadIntOverflow(void);
+
+  /// Test readIntAnyLine().
+  void testReadIntAnyLine(void);
+
+  /// Test readScalar() with values converted without strtod().
+  void testReadScalar(void);
+
+  /// Test readScalar() with values handed to strtod().
+  void testReadScalarStrtod(void);
+
+  /// Test readScalar() with inf and nan.
+  void testReadScalarSpecial(void);
+
+  /// Test readScalar() with malformed values.
+  void testReadScalarBad(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Write text to a file and open it with the tokenizer.
+   *
+   * @param tokenizer Tokenizer to open.
+   * @param text Contents of file.
+   */
+  void _open(TextTokenizer* tokenizer,
+	     const char* text);
+
+  /** Read values on one line with readScalar() and check them against
+   * strtod().
+   *
+   * @param values Array of values as strings.
+   * @param numValues Number of values.
+   */
+  void _checkScalars(const char* const* values,
+		     const int numValues);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  std::string _filename; ///< Name of file written by test.
+
+}; // class TestTextTokenizer
+
+#endif // pylith_meshio_testtexttokenizer_hh
+
+
+// End of file
@@ -24,11 +24,16 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
 #include <cstring> // USES strcmp()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestXdmf );
 
+// ----------------------------------------------------------------------
+typedef pylith::topology::FieldBase FieldBase;
+
 // ----------------------------------------------------------------------
 // Test constructor.
 void
@@ -37,10 +42,67 @@ pylith::meshio::TestXdmf::testConstructor(void)
   PYLITH_METHOD_BEGIN;
 
   Xdmf one;
+  CPPUNIT_ASSERT(!one.isOpen());
 
   PYLITH_METHOD_END;
 } // testConstructor
 
+// ----------------------------------------------------------------------
+// Test open() and close().
+void
+pylith::meshio::TestXdmf::testOpenClose(void)
+{ // testOpenClose
+  PYLITH_METHOD_BEGIN;
+
+  Xdmf metafile;
+  metafile.open("output/mydata.h5", 2, 3, 2, 6, 2);
+  CPPUNIT_ASSERT(metafile.isOpen());
+  CPPUNIT_ASSERT_EQUAL(std::string("output/mydata.xmf"), metafile.filename());
+  CPPUNIT_ASSERT_EQUAL(std::string("mydata.h5"), metafile._filenameHDF5);
+  CPPUNIT_ASSERT_EQUAL(2, metafile._numCells);
+  CPPUNIT_ASSERT_EQUAL(3, metafile._numCorners);
+  CPPUNIT_ASSERT_EQUAL(2, metafile._cellDim);
+  CPPUNIT_ASSERT_EQUAL(6, metafile._numVertices);
+  CPPUNIT_ASSERT_EQUAL(2, metafile._spaceDim);
+
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 6, 2, 1);
+
+  // Reopening clears time stamps and fields.
+  metafile.open("mydata_info.h5", 2, 3, 2, 6, 2);
+  CPPUNIT_ASSERT_EQUAL(std::string("mydata_info.xmf"), metafile.filename());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), metafile._timeStamps.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), metafile._fields.size());
+
+  metafile.close();
+  CPPUNIT_ASSERT(!metafile.isOpen());
+
+  PYLITH_METHOD_END;
+} // testOpenClose
+
+// ----------------------------------------------------------------------
+// Test updateField().
+void
+pylith::meshio::TestXdmf::testUpdateField(void)
+{ // testUpdateField
+  PYLITH_METHOD_BEGIN;
+
+  Xdmf metafile;
+  metafile.open("mydata.h5", 2, 3, 2, 6, 2);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 6, 2, 1);
+  metafile.updateField("traction", FieldBase::CELLS_FIELD, FieldBase::VECTOR, 2, 2, 1);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 6, 2, 2);
+
+  CPPUNIT_ASSERT_EQUAL(size_t(2), metafile._fields.size());
+  CPPUNIT_ASSERT_EQUAL(std::string("displacement"), metafile._fields[0].name);
+  CPPUNIT_ASSERT_EQUAL(2, metafile._fields[0].numTimeSteps);
+  CPPUNIT_ASSERT_EQUAL(std::string("traction"), metafile._fields[1].name);
+  CPPUNIT_ASSERT_EQUAL(FieldBase::CELLS_FIELD, metafile._fields[1].domain);
+  CPPUNIT_ASSERT_EQUAL(1, metafile._fields[1].numTimeSteps);
+
+  PYLITH_METHOD_END;
+} // testUpdateField
+
 // ----------------------------------------------------------------------
 // Test write() with tri3 mesh and vertex data.
 void
@@ -48,31 +110,37 @@ pylith::meshio::TestXdmf::testWriteTri3Vertex(void)
 { // testWriteTri3Vertex
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/tri3_vertex.h5";
-  const char* filenameXdmf = "tri3_vertex.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("tri3_vertex.h5", 2, 3, 2, 6, 2);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 6, 2, 1);
+  metafile.updateField("other", FieldBase::VERTICES_FIELD, FieldBase::OTHER, 6, 2, 1);
+  metafile.updateField("pressure", FieldBase::VERTICES_FIELD, FieldBase::SCALAR, 6, 1, 1);
+  metafile.updateField("stress", FieldBase::VERTICES_FIELD, FieldBase::TENSOR, 6, 3, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("tri3_vertex.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteTri3Vertex
 
 // ----------------------------------------------------------------------
-// Test write() with Tri3 mesh and cell data.
+// Test write() with tri3 mesh and cell data.
 void
 pylith::meshio::TestXdmf::testWriteTri3Cell(void)
 { // testWriteTri3Cell
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/tri3_cell.h5";
-  const char* filenameXdmf = "tri3_cell.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("tri3_cell.h5", 2, 3, 2, 6, 2);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("other", FieldBase::CELLS_FIELD, FieldBase::OTHER, 2, 2, 1);
+  metafile.updateField("pressure", FieldBase::CELLS_FIELD, FieldBase::SCALAR, 2, 1, 1);
+  metafile.updateField("stress", FieldBase::CELLS_FIELD, FieldBase::TENSOR, 2, 3, 1);
+  metafile.updateField("traction", FieldBase::CELLS_FIELD, FieldBase::VECTOR, 2, 2, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("tri3_cell.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteTri3Cell
@@ -84,31 +152,37 @@ pylith::meshio::TestXdmf::testWriteQuad4Vertex(void)
 { // testWriteQuad4Vertex
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/quad4_vertex.h5";
-  const char* filenameXdmf = "quad4_vertex.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("quad4_vertex.h5", 2, 4, 2, 6, 2);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 6, 2, 1);
+  metafile.updateField("other", FieldBase::VERTICES_FIELD, FieldBase::OTHER, 6, 2, 1);
+  metafile.updateField("pressure", FieldBase::VERTICES_FIELD, FieldBase::SCALAR, 6, 1, 1);
+  metafile.updateField("stress", FieldBase::VERTICES_FIELD, FieldBase::TENSOR, 6, 3, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("quad4_vertex.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteQuad4Vertex
 
 // ----------------------------------------------------------------------
-// Test write() with Quad4 mesh and cell data.
+// Test write() with quad4 mesh and cell data.
 void
 pylith::meshio::TestXdmf::testWriteQuad4Cell(void)
 { // testWriteQuad4Cell
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/quad4_cell.h5";
-  const char* filenameXdmf = "quad4_cell.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("quad4_cell.h5", 2, 4, 2, 6, 2);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("other", FieldBase::CELLS_FIELD, FieldBase::OTHER, 2, 2, 1);
+  metafile.updateField("pressure", FieldBase::CELLS_FIELD, FieldBase::SCALAR, 2, 1, 1);
+  metafile.updateField("stress", FieldBase::CELLS_FIELD, FieldBase::TENSOR, 2, 3, 1);
+  metafile.updateField("traction", FieldBase::CELLS_FIELD, FieldBase::VECTOR, 2, 2, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("quad4_cell.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteQuad4Cell
@@ -120,13 +194,16 @@ pylith::meshio::TestXdmf::testWriteTet4Vertex(void)
 { // testWriteTet4Vertex
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/tet4_vertex.h5";
-  const char* filenameXdmf = "tet4_vertex.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("tet4_vertex.h5", 2, 4, 3, 8, 3);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 8, 3, 1);
+  metafile.updateField("other", FieldBase::VERTICES_FIELD, FieldBase::OTHER, 8, 2, 1);
+  metafile.updateField("pressure", FieldBase::VERTICES_FIELD, FieldBase::SCALAR, 8, 1, 1);
+  metafile.updateField("stress", FieldBase::VERTICES_FIELD, FieldBase::TENSOR, 8, 6, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("tet4_vertex.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteTet4Vertex
@@ -138,13 +215,16 @@ pylith::meshio::TestXdmf::testWriteTet4Cell(void)
 { // testWriteTet4Cell
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/tet4_cell.h5";
-  const char* filenameXdmf = "tet4_cell.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("tet4_cell.h5", 2, 4, 3, 8, 3);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("other", FieldBase::CELLS_FIELD, FieldBase::OTHER, 2, 4, 1);
+  metafile.updateField("pressure", FieldBase::CELLS_FIELD, FieldBase::SCALAR, 2, 1, 1);
+  metafile.updateField("stress", FieldBase::CELLS_FIELD, FieldBase::TENSOR, 2, 6, 1);
+  metafile.updateField("traction", FieldBase::CELLS_FIELD, FieldBase::VECTOR, 2, 3, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("tet4_cell.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteTet4Cell
@@ -156,13 +236,16 @@ pylith::meshio::TestXdmf::testWriteHex8Vertex(void)
 { // testWriteHex8Vertex
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/hex8_vertex.h5";
-  const char* filenameXdmf = "hex8_vertex.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("hex8_vertex.h5", 2, 8, 3, 16, 3);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 16, 3, 1);
+  metafile.updateField("other", FieldBase::VERTICES_FIELD, FieldBase::OTHER, 16, 2, 1);
+  metafile.updateField("pressure", FieldBase::VERTICES_FIELD, FieldBase::SCALAR, 16, 1, 1);
+  metafile.updateField("stress", FieldBase::VERTICES_FIELD, FieldBase::TENSOR, 16, 6, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("hex8_vertex.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteHex8Vertex
@@ -174,17 +257,75 @@ pylith::meshio::TestXdmf::testWriteHex8Cell(void)
 { // testWriteHex8Cell
   PYLITH_METHOD_BEGIN;
 
-  const char* filenameHDF5 = "data/hex8_cell.h5";
-  const char* filenameXdmf = "hex8_cell.xmf";
-
   Xdmf metafile;
-  metafile.write(filenameXdmf, filenameHDF5);
+  metafile.open("hex8_cell.h5", 2, 8, 3, 16, 3);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("other", FieldBase::CELLS_FIELD, FieldBase::OTHER, 2, 2, 1);
+  metafile.updateField("pressure", FieldBase::CELLS_FIELD, FieldBase::SCALAR, 2, 1, 1);
+  metafile.updateField("stress", FieldBase::CELLS_FIELD, FieldBase::TENSOR, 2, 6, 1);
+  metafile.updateField("traction", FieldBase::CELLS_FIELD, FieldBase::VECTOR, 2, 3, 1);
+  metafile.write();
 
-  _checkFile(filenameXdmf);
+  _checkFile("hex8_cell.xmf");
 
   PYLITH_METHOD_END;
 } // testWriteHex8Cell
 
+// ----------------------------------------------------------------------
+// Test write() after each of several time steps.
+void
+pylith::meshio::TestXdmf::testWriteTimeSteps(void)
+{ // testWriteTimeSteps
+  PYLITH_METHOD_BEGIN;
+
+  const char* filename = "tri3_steps.xmf";
+
+  Xdmf metafile;
+  metafile.open("tri3_steps.h5", 2, 3, 2, 6, 2);
+
+  const int numTimeSteps = 3;
+  for (int i=0; i < numTimeSteps; ++i) {
+    metafile.addTimeStamp(0.5*i);
+    metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 6, 2, i+1);
+    metafile.write();
+
+    // File is complete after each time step.
+    std::ostringstream dims;
+    dims << "Dimensions=\"" << i+1 << " 6 2\"";
+    CPPUNIT_ASSERT_EQUAL(1, _countMatches(filename, "</Xdmf>"));
+    CPPUNIT_ASSERT_EQUAL(i+1, _countMatches(filename, "<Grid Name=\"domain\""));
+    CPPUNIT_ASSERT_EQUAL(2*(i+1), _countMatches(filename, dims.str().c_str()));
+  } // for
+
+  // Field not written for all time steps is only included in grids
+  // for time steps with data.
+  metafile.updateField("pressure", FieldBase::VERTICES_FIELD, FieldBase::SCALAR, 6, 1, 1);
+  metafile.write();
+  CPPUNIT_ASSERT_EQUAL(1, _countMatches(filename, "<Attribute Name=\"pressure\""));
+
+  PYLITH_METHOD_END;
+} // testWriteTimeSteps
+
+// ----------------------------------------------------------------------
+// Test write() with 1-D domain.
+void
+pylith::meshio::TestXdmf::testWrite1D(void)
+{ // testWrite1D
+  PYLITH_METHOD_BEGIN;
+
+  Xdmf metafile;
+  metafile.open("line2.h5", 2, 2, 1, 3, 1);
+  metafile.addTimeStamp(1.0);
+  metafile.updateField("displacement", FieldBase::VERTICES_FIELD, FieldBase::VECTOR, 3, 1, 1);
+  metafile.write();
+
+  // Xdmf grids are not defined for 1-D domains.
+  std::ifstream fileIn("line2.xmf");
+  CPPUNIT_ASSERT(!fileIn.is_open());
+
+  PYLITH_METHOD_END;
+} // testWrite1D
+
 // ----------------------------------------------------------------------
 // Check Xdmf file against archived file.
 void
@@ -222,5 +363,29 @@ pylith::meshio::TestXdmf::_checkFile(const char* filename)
   PYLITH_METHOD_END;
 } // _checkFile
 
+// ----------------------------------------------------------------------
+// Count number of occurrences of string in file.
+int
+pylith::meshio::TestXdmf::_countMatches(const char* filename,
+					const char* value)
+{ // _countMatches
+  PYLITH_METHOD_BEGIN;
+
+  std::ifstream fileIn(filename);
+  CPPUNIT_ASSERT(fileIn.is_open());
+  std::ostringstream buffer;
+  buffer << fileIn.rdbuf();
+  fileIn.close();
+
+  const std::string contents = buffer.str();
+  const size_t length = strlen(value);
+  int count = 0;
+  for (size_t pos = contents.find(value); pos != std::string::npos; pos = contents.find(value, pos+length)) {
+    ++count;
+  } // for
+
+  PYLITH_METHOD_RETURN(count);
+} // _countMatches
+
 
-// End of file 
+// End of file
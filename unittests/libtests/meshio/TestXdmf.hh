@@ -29,6 +29,8 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <string> // USES std::string
+
 /// Namespace for pylith package
 namespace pylith {
   namespace meshio {
@@ -44,6 +46,8 @@ class pylith::meshio::TestXdmf : public CppUnit::TestFixture
   CPPUNIT_TEST_SUITE( TestXdmf );
 
   CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testOpenClose );
+  CPPUNIT_TEST( testUpdateField );
   CPPUNIT_TEST( testWriteTri3Vertex );
   CPPUNIT_TEST( testWriteTri3Cell );
   CPPUNIT_TEST( testWriteQuad4Vertex );
@@ -52,6 +56,8 @@ class pylith::meshio::TestXdmf : public CppUnit::TestFixture
   CPPUNIT_TEST( testWriteTet4Cell );
   CPPUNIT_TEST( testWriteHex8Vertex );
   CPPUNIT_TEST( testWriteHex8Cell );
+  CPPUNIT_TEST( testWriteTimeSteps );
+  CPPUNIT_TEST( testWrite1D );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -61,6 +67,12 @@ public :
   /// Test constructor.
   void testConstructor(void);
 
+  /// Test open() and close().
+  void testOpenClose(void);
+
+  /// Test updateField().
+  void testUpdateField(void);
+
   /// Test write() with tri3 mesh and vertex data.
   void testWriteTri3Vertex(void);
 
@@ -85,6 +97,12 @@ public :
   /// Test write() with hex8 mesh and cell data.
   void testWriteHex8Cell(void);
 
+  /// Test write() after each of several time steps.
+  void testWriteTimeSteps(void);
+
+  /// Test write() with 1-D domain.
+  void testWrite1D(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -94,9 +112,19 @@ private :
    */
   static
   void _checkFile(const char* filename);
-  
+
+  /** Count number of occurrences of string in file.
+   *
+   * @param filename Name of file.
+   * @param value String to count.
+   * @returns Number of occurrences.
+   */
+  static
+  int _countMatches(const char* filename,
+		    const char* value);
+
 }; // class TestXdmf
 
 #endif // pylith_meshio_testxdmf_hh
 
-// End of file 
+// End of file
@@ -0,0 +1,194 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDistributor.hh" // Implementation of class methods
+
+#include "pylith/topology/Distributor.hh" // USES Distributor
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES int_array
+
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::min(), std::max()
+#include <stdexcept> // USES std::logic_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestDistributor );
+
+// ----------------------------------------------------------------------
+// Test _faultFaces().
+void
+pylith::topology::TestDistributor::testFaultFaces(void)
+{ // testFaultFaces
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh);
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err = 0;
+
+  // Faces between cells 0 and 2 and between cells 1 and 3.
+  const size_t numFacesE = 2;
+  const PetscInt supportE[numFacesE*2] = {
+    0, 2,
+    1, 3,
+  };
+
+  std::vector<PetscInt> faces;
+  Distributor::_faultFaces(&faces, dmMesh, "fault");
+  CPPUNIT_ASSERT_EQUAL(numFacesE, faces.size());
+  for (size_t iFace=0; iFace < numFacesE; ++iFace) {
+    const PetscInt* support = NULL;
+    PetscInt supportSize = 0;
+    err = DMPlexGetSupportSize(dmMesh, faces[iFace], &supportSize);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetSupport(dmMesh, faces[iFace], &support);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(2), supportSize);
+    const PetscInt c0 = std::min(support[0], support[1]);
+    const PetscInt c1 = std::max(support[0], support[1]);
+    CPPUNIT_ASSERT_EQUAL(supportE[iFace*2+0], c0);
+    CPPUNIT_ASSERT_EQUAL(supportE[iFace*2+1], c1);
+  } // for
+
+  // Group with no faces.
+  Distributor::_faultFaces(&faces, dmMesh, "edge 2");
+  CPPUNIT_ASSERT_EQUAL(size_t(0), faces.size());
+
+  // Missing group.
+  Distributor::_faultFaces(&faces, dmMesh, "missing");
+  CPPUNIT_ASSERT_EQUAL(size_t(0), faces.size());
+
+  PYLITH_METHOD_END;
+} // testFaultFaces
+
+// ----------------------------------------------------------------------
+// Test _keepFaultsIntact().
+void
+pylith::topology::TestDistributor::testKeepFaultsIntact(void)
+{ // testKeepFaultsIntact
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh);
+
+  const int numCells = 4;
+  const char* faultLabels[1] = { "fault" };
+  const char* edgeLabels[1] = { "edge 2" };
+
+  { // Cells 1 and 3 share a fault face but are on different processors.
+    const int numProcs = 3;
+    const PetscInt cellRankOrig[numCells] = { 0, 2, 0, 1 };
+    const PetscInt cellRankE[numCells] = { 0, 1, 0, 1 };
+    int_array cellRank(cellRankOrig, numCells);
+    Distributor::_keepFaultsIntact(&cellRank, numProcs, mesh, faultLabels, 1);
+    for (int c=0; c < numCells; ++c) {
+      CPPUNIT_ASSERT_EQUAL(cellRankE[c], cellRank[c]);
+    } // for
+  } // Cells 1 and 3
+
+  { // Fault is spread over two processors but is not split.
+    const int numProcs = 2;
+    const PetscInt cellRankE[numCells] = { 1, 0, 1, 0 };
+    int_array cellRank(cellRankE, numCells);
+    Distributor::_keepFaultsIntact(&cellRank, numProcs, mesh, faultLabels, 1);
+    for (int c=0; c < numCells; ++c) {
+      CPPUNIT_ASSERT_EQUAL(cellRankE[c], cellRank[c]);
+    } // for
+  } // Fault on two processors
+
+  { // Group of vertices without faces does not change partition.
+    const int numProcs = 3;
+    const PetscInt cellRankE[numCells] = { 0, 2, 0, 1 };
+    int_array cellRank(cellRankE, numCells);
+    Distributor::_keepFaultsIntact(&cellRank, numProcs, mesh, edgeLabels, 1);
+    for (int c=0; c < numCells; ++c) {
+      CPPUNIT_ASSERT_EQUAL(cellRankE[c], cellRank[c]);
+    } // for
+  } // No faces
+
+  PYLITH_METHOD_END;
+} // testKeepFaultsIntact
+
+// ----------------------------------------------------------------------
+// Test _checkFaultsLocal().
+void
+pylith::topology::TestDistributor::testCheckFaultsLocal(void)
+{ // testCheckFaultsLocal
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh);
+
+  const char* faultLabels[1] = { "fault" };
+  Distributor::_checkFaultsLocal(mesh, faultLabels, 1);
+
+  // Group includes faces on the boundary of the domain.
+  const char* edgeLabels[1] = { "edge 1" };
+  CPPUNIT_ASSERT_THROW(Distributor::_checkFaultsLocal(mesh, edgeLabels, 1), std::logic_error);
+
+  PYLITH_METHOD_END;
+} // testCheckFaultsLocal
+
+// ----------------------------------------------------------------------
+// Test distributeWithFaults().
+void
+pylith::topology::TestDistributor::testDistributeWithFaults(void)
+{ // testDistributeWithFaults
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh);
+
+  const char* faultLabels[1] = { "fault" };
+  Mesh newMesh;
+  Distributor::distributeWithFaults(&newMesh, mesh, "simple", faultLabels, 1);
+
+  CPPUNIT_ASSERT_EQUAL(mesh.numCells(), newMesh.numCells());
+  CPPUNIT_ASSERT_EQUAL(mesh.numVertices(), newMesh.numVertices());
+
+  PetscDM dmMesh = newMesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscBool hasLabel = PETSC_FALSE;
+  PetscErrorCode err = DMHasLabel(dmMesh, "fault", &hasLabel);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(hasLabel);
+
+  PYLITH_METHOD_END;
+} // testDistributeWithFaults
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestDistributor::_setupMesh(Mesh* mesh)
+{ // _setupMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/fourtri3.mesh");
+  iohandler.interpolate(true);
+  iohandler.read(mesh);
+  CPPUNIT_ASSERT_EQUAL(4, mesh->numCells());
+  CPPUNIT_ASSERT_EQUAL(5, mesh->numVertices());
+
+  PYLITH_METHOD_END;
+} // _setupMesh
+
+
+// End of file 
@@ -0,0 +1,88 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestDistributor.hh
+ *
+ * @brief C++ TestDistributor object
+ *
+ * C++ unit testing for Distributor.
+ */
+
+#if !defined(pylith_topology_testdistributor_hh)
+#define pylith_topology_testdistributor_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestDistributor;
+  } // topology
+} // pylith
+
+// TestDistributor ------------------------------------------------------
+/// C++ unit testing for Distributor.
+class pylith::topology::TestDistributor : public CppUnit::TestFixture
+{ // class TestDistributor
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDistributor );
+
+  CPPUNIT_TEST( testFaultFaces );
+  CPPUNIT_TEST( testKeepFaultsIntact );
+  CPPUNIT_TEST( testCheckFaultsLocal );
+  CPPUNIT_TEST( testDistributeWithFaults );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test _faultFaces().
+  void testFaultFaces(void);
+
+  /// Test _keepFaultsIntact().
+  void testKeepFaultsIntact(void);
+
+  /// Test _checkFaultsLocal().
+  void testCheckFaultsLocal(void);
+
+  /// Test distributeWithFaults().
+  void testDistributeWithFaults(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Setup mesh with one fault.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  static
+  void _setupMesh(Mesh* mesh);
+
+}; // class TestDistributor
+
+#endif // pylith_topology_testdistributor_hh
+
+
+// End of file 
@@ -0,0 +1,414 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestElementRestriction.hh" // Implementation of class methods
+
+#include "pylith/topology/ElementRestriction.hh" // USES ElementRestriction
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestElementRestriction );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::topology::TestElementRestriction::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  ElementRestriction restriction;
+  CPPUNIT_ASSERT(!restriction._section);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), restriction.numCells());
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), restriction.closureSize());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test initialize(), isCurrent(), numCells(), and closureSize().
+void
+pylith::topology::TestElementRestriction::testInitialize(void)
+{ // testInitialize
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscSection section = field->localSection();CPPUNIT_ASSERT(section);
+
+  ElementRestriction restriction;
+  CPPUNIT_ASSERT(!restriction.isCurrent(section));
+  restriction.initialize(dmMesh, section, cellsStratum);
+  CPPUNIT_ASSERT(restriction.isCurrent(section));
+  CPPUNIT_ASSERT_EQUAL(cellsStratum.size(), restriction.numCells());
+
+  const int numCorners = 3;
+  const int fiberDim = mesh.dimension();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(numCorners*fiberDim), restriction.closureSize());
+
+  restriction.deallocate();
+  CPPUNIT_ASSERT(!restriction.isCurrent(section));
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testInitialize
+
+// ----------------------------------------------------------------------
+// Test gather().
+void
+pylith::topology::TestElementRestriction::testGather(void)
+{ // testGather
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  ElementRestriction restriction;
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum);
+  const PetscInt closureSize = restriction.closureSize();
+
+  VecVisitorMesh fieldVisitor(*field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  scalar_array valuesE(closureSize);
+  scalar_array values(closureSize);
+  const PylithScalar tolerance = 1.0e-6;
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    fieldVisitor.getClosure(&valuesE, c);
+    restriction.gather(&values, fieldArray, c-cStart);
+    for (PetscInt i=0; i < closureSize; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[i], values[i], tolerance);
+    } // for
+  } // for
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testGather
+
+// ----------------------------------------------------------------------
+// Test gatherBlock().
+void
+pylith::topology::TestElementRestriction::testGatherBlock(void)
+{ // testGatherBlock
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+
+  ElementRestriction restriction;
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum);
+  const PetscInt numCells = restriction.numCells();
+  const PetscInt closureSize = restriction.closureSize();
+
+  VecVisitorMesh fieldVisitor(*field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  scalar_array valuesBlock(numCells*closureSize);
+  restriction.gatherBlock(&valuesBlock[0], fieldArray, 0, numCells);
+
+  scalar_array valuesCell(closureSize);
+  const PylithScalar tolerance = 1.0e-6;
+  for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+    restriction.gather(&valuesCell, fieldArray, iCell);
+    for (PetscInt i=0; i < closureSize; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesCell[i], valuesBlock[iCell*closureSize+i], tolerance);
+    } // for
+  } // for
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testGatherBlock
+
+// ----------------------------------------------------------------------
+// Test scatterAdd().
+void
+pylith::topology::TestElementRestriction::testScatterAdd(void)
+{ // testScatterAdd
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  Field fieldE(mesh);
+  fieldE.cloneSection(*field);
+  fieldE.zeroAll();
+  field->zeroAll();
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  ElementRestriction restriction;
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum);
+  const PetscInt closureSize = restriction.closureSize();
+
+  VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  VecVisitorMesh fieldEVisitor(fieldE);
+  scalar_array valuesCell(closureSize);
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    for (PetscInt i=0; i < closureSize; ++i) {
+      valuesCell[i] = 0.5*(c+1) + 0.1*i;
+    } // for
+    fieldEVisitor.setClosure(&valuesCell[0], valuesCell.size(), c, ADD_VALUES);
+    restriction.scatterAdd(&valuesCell[0], fieldArray, c-cStart);
+  } // for
+
+  const PetscScalar* fieldEArray = fieldEVisitor.localArray();CPPUNIT_ASSERT(fieldEArray);
+  PetscInt storageSize = 0;
+  PetscErrorCode err = PetscSectionGetStorageSize(field->localSection(), &storageSize);PYLITH_CHECK_ERROR(err);
+  const PylithScalar tolerance = 1.0e-6;
+  for (PetscInt i=0; i < storageSize; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(fieldEArray[i], fieldArray[i], tolerance);
+  } // for
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testScatterAdd
+
+// ----------------------------------------------------------------------
+// Test hasGlobalIndices() and globalIndices().
+void
+pylith::topology::TestElementRestriction::testGlobalIndices(void)
+{ // testGlobalIndices
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+
+  ElementRestriction restriction;
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum);
+  CPPUNIT_ASSERT(!restriction.hasGlobalIndices());
+
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum, field->globalSection());
+  CPPUNIT_ASSERT(restriction.hasGlobalIndices());
+
+  // Serial mesh without constraints: global indices match local indices.
+  const PetscInt numCells = restriction.numCells();
+  const PetscInt closureSize = restriction.closureSize();
+  for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+    const PylithInt* indicesCell = restriction.indices(iCell);
+    const PylithInt* globalIndicesCell = restriction.globalIndices(iCell);
+    for (PetscInt i=0; i < closureSize; ++i) {
+      CPPUNIT_ASSERT_EQUAL(indicesCell[i], globalIndicesCell[i]);
+    } // for
+  } // for
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testGlobalIndices
+
+// ----------------------------------------------------------------------
+// Test beginMatrix(), addMatrix(), and endMatrix().
+void
+pylith::topology::TestElementRestriction::testAddMatrix(void)
+{ // testAddMatrix
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+
+  ElementRestriction restriction;
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum, field->globalSection());
+  CPPUNIT_ASSERT(restriction.hasGlobalIndices());
+
+  Jacobian jacobian(*field);
+  Jacobian jacobianE(*field);
+  const PetscMat mat = jacobian.assembledMatrix();CPPUNIT_ASSERT(mat);
+  const PetscMat matE = jacobianE.assembledMatrix();CPPUNIT_ASSERT(matE);
+  CPPUNIT_ASSERT(!restriction.hasMatrixPositions(mat));
+
+  const PetscInt numCells = restriction.numCells();
+  const PetscInt closureSize = restriction.closureSize();
+  scalar_array cellMatrix(closureSize*closureSize);
+
+  // Positions are found on the first pass if the matrix is already
+  // assembled; the second pass must add directly into the value arrays.
+  PetscErrorCode err;
+  const int numPasses = 2;
+  for (int iPass=0; iPass < numPasses; ++iPass) {
+    jacobian.zero();
+    jacobianE.zero();
+
+    restriction.beginMatrix(mat);
+    if (iPass > 0) {
+      CPPUNIT_ASSERT(restriction.hasMatrixPositions(mat));
+    } // if
+    for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+      for (size_t i=0; i < cellMatrix.size(); ++i) {
+	cellMatrix[i] = 1.0 + 0.1*iCell + 0.01*i + iPass;
+      } // for
+      restriction.addMatrix(mat, &cellMatrix[0], iCell);
+      err = DMPlexMatSetClosure(dmMesh, field->localSection(), field->globalSection(), matE, cellsStratum.begin()+iCell, &cellMatrix[0], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    restriction.endMatrix(mat);
+
+    jacobian.assemble("final_assembly");
+    jacobianE.assemble("final_assembly");
+
+    err = MatAXPY(matE, -1.0, mat, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    PetscReal norm = 0.0;
+    err = MatNorm(matE, NORM_FROBENIUS, &norm);PYLITH_CHECK_ERROR(err);
+    const PylithScalar tolerance = 1.0e-12;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, norm, tolerance);
+  } // for
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testAddMatrix
+
+// ----------------------------------------------------------------------
+// Test addMatrix() with matrix missing entries of cell matrices.
+void
+pylith::topology::TestElementRestriction::testAddMatrixPointBlock(void)
+{ // testAddMatrixPointBlock
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  Field* field = 0;
+  _setupField(&mesh, &field);CPPUNIT_ASSERT(field);
+
+  const PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+
+  ElementRestriction restriction;
+  restriction.initialize(dmMesh, field->localSection(), cellsStratum, field->globalSection());
+  CPPUNIT_ASSERT(restriction.hasGlobalIndices());
+
+  // Preconditioning matrices of matrix-free Jacobians only hold the
+  // blocks coupling DOF at the same point.
+  Jacobian jacobian(*field, "shell");
+  Jacobian jacobianE(*field, "shell");
+  const PetscMat mat = jacobian.assembledMatrix();CPPUNIT_ASSERT(mat);
+  const PetscMat matE = jacobianE.assembledMatrix();CPPUNIT_ASSERT(matE);
+
+  const PetscInt numCells = restriction.numCells();
+  const PetscInt closureSize = restriction.closureSize();
+  scalar_array cellMatrix(closureSize*closureSize);
+
+  // Once the matrix is assembled, the failed search for positions is
+  // recorded against its nonzero state and not repeated.
+  PetscErrorCode err;
+  const int numPasses = 3;
+  for (int iPass=0; iPass < numPasses; ++iPass) {
+    jacobian.zero();
+    jacobianE.zero();
+
+    restriction.beginMatrix(mat);
+    CPPUNIT_ASSERT(!restriction.hasMatrixPositions(mat));
+    if (iPass > 0) {
+      CPPUNIT_ASSERT(mat == restriction._matrix);
+      PetscObjectState nonzeroState = 0;
+      err = MatGetNonzeroState(mat, &nonzeroState);PYLITH_CHECK_ERROR(err);
+      CPPUNIT_ASSERT(nonzeroState == restriction._matrixNonzeroState);
+    } // if
+    for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+      for (size_t i=0; i < cellMatrix.size(); ++i) {
+	cellMatrix[i] = 1.0 + 0.1*iCell + 0.01*i + iPass;
+      } // for
+      restriction.addMatrix(mat, &cellMatrix[0], iCell);
+      err = DMPlexMatSetClosure(dmMesh, field->localSection(), field->globalSection(), matE, cellsStratum.begin()+iCell, &cellMatrix[0], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    restriction.endMatrix(mat);
+
+    jacobian.assemble("final_assembly");
+    jacobianE.assemble("final_assembly");
+
+    err = MatAXPY(matE, -1.0, mat, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    PetscReal norm = 0.0;
+    err = MatNorm(matE, NORM_FROBENIUS, &norm);PYLITH_CHECK_ERROR(err);
+    const PylithScalar tolerance = 1.0e-12;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, norm, tolerance);
+  } // for
+
+  delete field; field = 0;
+
+  PYLITH_METHOD_END;
+} // testAddMatrixPointBlock
+
+// ----------------------------------------------------------------------
+// Setup mesh and field with vector values at vertices.
+void
+pylith::topology::TestElementRestriction::_setupField(Mesh* mesh,
+						      Field** field)
+{ // _setupField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(field);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.interpolate(true);
+  iohandler.read(mesh);
+
+  const int fiberDim = mesh->dimension();
+  delete *field; *field = new Field(*mesh);CPPUNIT_ASSERT(*field);
+  (*field)->label("field");
+  (*field)->newSection(FieldBase::VERTICES_FIELD, fiberDim);
+  (*field)->allocate();
+
+  VecVisitorMesh fieldVisitor(**field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  PetscInt storageSize = 0;
+  PetscErrorCode err = PetscSectionGetStorageSize((*field)->localSection(), &storageSize);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < storageSize; ++i) {
+    fieldArray[i] = 1.0 + 0.25*i;
+  } // for
+
+  PYLITH_METHOD_END;
+} // _setupField
+
+
+// End of file 
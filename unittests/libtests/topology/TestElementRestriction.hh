@@ -0,0 +1,106 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestElementRestriction.hh
+ *
+ * @brief C++ TestElementRestriction object
+ *
+ * C++ unit testing for ElementRestriction.
+ */
+
+#if !defined(pylith_topology_testelementrestriction_hh)
+#define pylith_topology_testelementrestriction_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestElementRestriction;
+  } // topology
+} // pylith
+
+// TestElementRestriction -----------------------------------------------
+/// C++ unit testing for ElementRestriction.
+class pylith::topology::TestElementRestriction : public CppUnit::TestFixture
+{ // class TestElementRestriction
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestElementRestriction );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testGather );
+  CPPUNIT_TEST( testGatherBlock );
+  CPPUNIT_TEST( testScatterAdd );
+  CPPUNIT_TEST( testGlobalIndices );
+  CPPUNIT_TEST( testAddMatrix );
+  CPPUNIT_TEST( testAddMatrixPointBlock );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test initialize(), isCurrent(), numCells(), and closureSize().
+  void testInitialize(void);
+
+  /// Test gather().
+  void testGather(void);
+
+  /// Test gatherBlock().
+  void testGatherBlock(void);
+
+  /// Test scatterAdd().
+  void testScatterAdd(void);
+
+  /// Test hasGlobalIndices() and globalIndices().
+  void testGlobalIndices(void);
+
+  /// Test beginMatrix(), addMatrix(), and endMatrix().
+  void testAddMatrix(void);
+
+  /// Test addMatrix() with matrix missing entries of cell matrices.
+  void testAddMatrixPointBlock(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Setup mesh and field with vector values at vertices.
+   *
+   * @param mesh Finite-element mesh.
+   * @param field Field over vertices of mesh.
+   */
+  static
+  void _setupField(Mesh* mesh,
+		   Field** field);
+
+}; // class TestElementRestriction
+
+#endif // pylith_topology_testelementrestriction_hh
+
+
+// End of file 
@@ -1222,6 +1222,106 @@ pylith::topology::TestFieldMesh::testCreateScatterWithBC(void)
   PYLITH_METHOD_END;
 } // testCreateScatterWithBC
 
+// ----------------------------------------------------------------------
+// Test keepConstrainedDOF() and copyConstrainedLocalToGlobal().
+void
+pylith::topology::TestFieldMesh::testKeepConstrainedDOF(void)
+{ // testKeepConstrainedDOF
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 3;
+  const PetscInt nconstraints[4] = { 0, 2, 1, 0 };
+  const PetscInt constraints[3] = {
+    0, 2,     // 1
+    1,        // 2
+  };
+  const PylithScalar valueBC = 4.5;
+
+  Mesh mesh;
+  _buildMesh(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum depthStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  const PetscInt vEnd = depthStratum.end();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(4), vEnd-vStart);
+
+  PetscErrorCode err = 0;
+
+  Field field(mesh);
+  const std::string& label = "field A";
+  field.label(label.c_str());
+  field.newSection(Field::VERTICES_FIELD, fiberDim);
+  PetscSection section = field.localSection();CPPUNIT_ASSERT(section);
+  for(PetscInt v = vStart, iV = 0; v < vEnd; ++v) {
+    err = PetscSectionAddConstraintDof(section, v, nconstraints[iV++]);PYLITH_CHECK_ERROR(err);
+  } // for
+  field.allocate();
+  int index = 0;
+  for(PetscInt v = vStart, iV = 0; v < vEnd; ++v, index += nconstraints[iV++]) {
+    err = PetscSectionSetConstraintIndices(section, v, (PetscInt *) &constraints[index]);PYLITH_CHECK_ERROR(err);
+  } // for
+  field.zeroAll();
+  field.createScatter(mesh);
+  CPPUNIT_ASSERT(!field.keepsConstrainedDOF());
+
+  const int numConstrained = 3;
+  const int sizeAll = (vEnd-vStart) * fiberDim;
+  PetscInt size = 0;
+  err = VecGetSize(field.globalVector(), &size);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(sizeAll-numConstrained, size);
+
+  field.keepConstrainedDOF();
+  CPPUNIT_ASSERT(field.keepsConstrainedDOF());
+  err = VecGetSize(field.globalVector(), &size);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(sizeAll, size);
+
+  // Scatter shares new global vector.
+  const Field::ScatterInfo& sinfo = field._getScatter("");
+  CPPUNIT_ASSERT_EQUAL(field.globalVector(), sinfo.vector);
+  const char* vecname = 0;
+  err = PetscObjectGetName((PetscObject)sinfo.vector, &vecname);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(label, std::string(vecname));
+
+  // Set constrained values and copy them into a zeroed global vector.
+  { // setup
+    VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+    index = 0;
+    for(PetscInt v = vStart, iV = 0; v < vEnd; ++v, index += nconstraints[iV++]) {
+      const PetscInt off = fieldVisitor.sectionOffset(v);
+      for (PetscInt i = 0; i < nconstraints[iV]; ++i) {
+	fieldArray[off+constraints[index+i]] = valueBC;
+      } // for
+    } // for
+  } // setup
+  PetscVec globalVec = field.globalVector();CPPUNIT_ASSERT(globalVec);
+  err = VecSet(globalVec, 0.0);PYLITH_CHECK_ERROR(err);
+  field.copyConstrainedLocalToGlobal(globalVec);
+
+  PetscScalar sum = 0.0;
+  err = VecSum(globalVec, &sum);PYLITH_CHECK_ERROR(err);
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(numConstrained*valueBC, PetscRealPart(sum), tolerance);
+
+  // Constrained values survive a round trip through the global vector.
+  field.zeroAll();
+  field.scatterGlobalToLocal();
+  { // check
+    VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+    index = 0;
+    for(PetscInt v = vStart, iV = 0; v < vEnd; ++v, index += nconstraints[iV++]) {
+      const PetscInt off = fieldVisitor.sectionOffset(v);
+      for (PetscInt i = 0; i < nconstraints[iV]; ++i) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueBC, fieldArray[off+constraints[index+i]], tolerance);
+      } // for
+    } // for
+  } // check
+
+  PYLITH_METHOD_END;
+} // testKeepConstrainedDOF
+
 // ----------------------------------------------------------------------
 // Test vector().
 void
@@ -73,6 +73,7 @@ class pylith::topology::TestFieldMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testView );
   CPPUNIT_TEST( testCreateScatter );
   CPPUNIT_TEST( testCreateScatterWithBC );
+  CPPUNIT_TEST( testKeepConstrainedDOF );
   CPPUNIT_TEST( testVector );
   CPPUNIT_TEST( testScatterLocalToGlobal );
   CPPUNIT_TEST( testScatterGlobalToLocal );
@@ -168,6 +169,9 @@ public :
   /// Test createScatterWithBC().
   void testCreateScatterWithBC(void);
 
+  /// Test keepConstrainedDOF() and copyConstrainedLocalToGlobal().
+  void testKeepConstrainedDOF(void);
+
   /// Test vector().
   void testVector(void);
 
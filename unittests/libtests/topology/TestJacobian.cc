@@ -28,6 +28,8 @@
 
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 
+#include "petscmat.h" // USES MatGetSize(), MatGetValues()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestJacobian );
 
@@ -94,6 +96,105 @@ pylith::topology::TestJacobian::testMatrix(void)
   PYLITH_METHOD_END;
 } // testMatrix
 
+// ----------------------------------------------------------------------
+// Test matrix-free Jacobian.
+void
+pylith::topology::TestJacobian::testMatrixFree(void)
+{ // testMatrixFree
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+
+  Jacobian jacobianAssembled(field);
+  CPPUNIT_ASSERT(!jacobianAssembled.isMatrixFree());
+  CPPUNIT_ASSERT(jacobianAssembled.matrix() == jacobianAssembled.assembledMatrix());
+
+  Jacobian jacobian(field, "shell");
+  CPPUNIT_ASSERT(jacobian.isMatrixFree());
+
+  const PetscMat matrix = jacobian.matrix();
+  const PetscMat precondMatrix = jacobian.assembledMatrix();
+  CPPUNIT_ASSERT(matrix);
+  CPPUNIT_ASSERT(precondMatrix);
+  CPPUNIT_ASSERT(matrix != precondMatrix);
+
+  PetscErrorCode err = 0;
+  PetscBool isShell = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) matrix, MATSHELL, &isShell);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(isShell);
+
+  PetscInt nrows = 0, ncols = 0, nrowsE = 0;
+  err = MatGetSize(precondMatrix, &nrows, &ncols);CPPUNIT_ASSERT(!err);
+  err = VecGetSize(field.globalVector(), &nrowsE);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(nrowsE, nrows);
+  CPPUNIT_ASSERT_EQUAL(nrowsE, ncols);
+
+  // Entries coupling different points are dropped.
+  const PetscInt spaceDim = mesh.dimension();
+  const PetscScalar value = 2.0;
+  err = MatSetValue(precondMatrix, 0, 1, value, ADD_VALUES);CPPUNIT_ASSERT(!err);
+  err = MatSetValue(precondMatrix, 0, spaceDim, value, ADD_VALUES);CPPUNIT_ASSERT(!err);
+  jacobian.assemble("final_assembly");
+
+  MatInfo info;
+  err = MatGetInfo(precondMatrix, MAT_LOCAL, &info);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(PetscLogDouble(nrows*spaceDim), info.nz_allocated);
+
+  PetscScalar valueBlock = 0.0;
+  PetscInt row = 0, col = 1;
+  err = MatGetValues(precondMatrix, 1, &row, 1, &col, &valueBlock);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(value, valueBlock);
+
+  PYLITH_METHOD_END;
+} // testMatrixFree
+
+// ----------------------------------------------------------------------
+// Test upper triangular storage for symmetric matrix type.
+void
+pylith::topology::TestJacobian::testSymmetric(void)
+{ // testSymmetric
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+
+  Jacobian jacobian(field, "sbaij");
+  const PetscMat matrix = jacobian.matrix();CPPUNIT_ASSERT(matrix);
+
+  PetscErrorCode err = 0;
+  PetscBool isSBAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompareAny((PetscObject) matrix, &isSBAIJ, MATSEQSBAIJ, MATMPISBAIJ, "");CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(isSBAIJ);
+
+  // Entries below the diagonal are ignored, so adding a full
+  // symmetric cell matrix adds each off-diagonal entry once.
+  const PetscInt indices[2] = { 0, 1 };
+  const PetscScalar values[4] = {
+    4.0, 1.0,
+    1.0, 3.0,
+  };
+  err = MatSetValues(matrix, 2, indices, 2, indices, values, ADD_VALUES);CPPUNIT_ASSERT(!err);
+  jacobian.assemble("final_assembly");
+
+  PetscScalar value = 0.0;
+  PetscInt row = 0, col = 1;
+  err = MatGetValues(matrix, 1, &row, 1, &col, &value);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(values[1], value);
+
+  // Nonsymmetric matrix type on the same field is unaffected.
+  Jacobian jacobianB(field, "aij");
+  PetscBool isSBAIJB = PETSC_TRUE;
+  err = PetscObjectTypeCompareAny((PetscObject) jacobianB.matrix(), &isSBAIJB, MATSEQSBAIJ, MATMPISBAIJ, "");CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(!isSBAIJB);
+
+  PYLITH_METHOD_END;
+} // testSymmetric
+
 // ----------------------------------------------------------------------
 // Test assemble().
 void
@@ -48,6 +48,8 @@ class pylith::topology::TestJacobian : public CppUnit::TestFixture
   CPPUNIT_TEST( testConstructor );
   CPPUNIT_TEST( testConstructorSubDomain );
   CPPUNIT_TEST( testMatrix );
+  CPPUNIT_TEST( testMatrixFree );
+  CPPUNIT_TEST( testSymmetric );
   CPPUNIT_TEST( testAssemble );
   CPPUNIT_TEST( testZero );
   CPPUNIT_TEST( testView );
@@ -67,6 +69,12 @@ public :
   /// Test matrix().
   void testMatrix(void);
 
+  /// Test matrix-free Jacobian.
+  void testMatrixFree(void);
+
+  /// Test upper triangular storage for symmetric matrix type.
+  void testSymmetric(void);
+
   /// Test assemble().
   void testAssemble(void);
 
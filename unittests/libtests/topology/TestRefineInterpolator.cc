@@ -0,0 +1,185 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+#include <portinfo>
+
+#include "TestRefineInterpolator.hh" // Implementation of class methods
+
+#include "pylith/topology/RefineInterpolator.hh" // USES RefineInterpolator
+
+#include "pylith/topology/RefineUniform.hh" // USES RefineUniform
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "data/MeshDataCohesiveTri3Level1.hh"
+#include "data/MeshDataCohesiveQuad4Level1.hh"
+#include "data/MeshDataCohesiveTet4Level1.hh"
+#include "data/MeshDataCohesiveHex8Level1.hh"
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestRefineInterpolator );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::topology::TestRefineInterpolator::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  RefineInterpolator interpolator;
+  CPPUNIT_ASSERT_EQUAL(1, interpolator.numLevels());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test initialize() with mesh that has not been refined.
+void
+pylith::topology::TestRefineInterpolator::testUnrefined(void)
+{ // testUnrefined
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTri3Level1 data;
+  Mesh mesh(data.cellDim);
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(data.filename);
+  iohandler.interpolate(true);
+  iohandler.read(&mesh);
+
+  Field field(mesh);
+  field.newSection(FieldBase::VERTICES_FIELD, mesh.dimension());
+  field.allocate();
+
+  RefineInterpolator interpolator;
+  interpolator.initialize(field);
+  CPPUNIT_ASSERT_EQUAL(1, interpolator.numLevels());
+
+  PYLITH_METHOD_END;
+} // testUnrefined
+
+// ----------------------------------------------------------------------
+// Test interpolation() with tri3 cells.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationTri3(void)
+{ // testInterpolationTri3
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTri3Level1 data;
+  _testInterpolation(data);
+
+  PYLITH_METHOD_END;
+} // testInterpolationTri3
+
+// ----------------------------------------------------------------------
+// Test interpolation() with quad4 cells.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationQuad4(void)
+{ // testInterpolationQuad4
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveQuad4Level1 data;
+  _testInterpolation(data);
+
+  PYLITH_METHOD_END;
+} // testInterpolationQuad4
+
+// ----------------------------------------------------------------------
+// Test interpolation() with tet4 cells.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationTet4(void)
+{ // testInterpolationTet4
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTet4Level1 data;
+  _testInterpolation(data);
+
+  PYLITH_METHOD_END;
+} // testInterpolationTet4
+
+// ----------------------------------------------------------------------
+// Test interpolation() with hex8 cells.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationHex8(void)
+{ // testInterpolationHex8
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveHex8Level1 data;
+  _testInterpolation(data);
+
+  PYLITH_METHOD_END;
+} // testInterpolationHex8
+
+// ----------------------------------------------------------------------
+// Test interpolation().
+void
+pylith::topology::TestRefineInterpolator::_testInterpolation(const MeshDataCohesive& data)
+{ // _testInterpolation
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh(data.cellDim);
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(data.filename);
+  iohandler.interpolate(true);
+  iohandler.read(&mesh);
+
+  Stratum verticesStratum(mesh.dmMesh(), Stratum::DEPTH, 0);
+  const PetscInt numVerticesCoarse = verticesStratum.size();
+
+  RefineUniform refiner;
+  Mesh newMesh(data.cellDim);
+  refiner.refine(&newMesh, mesh, data.refineLevel);
+
+  Field field(newMesh);
+  field.newSection(FieldBase::VERTICES_FIELD, newMesh.dimension());
+  field.allocate();
+
+  RefineInterpolator interpolator;
+  interpolator.initialize(field);
+  CPPUNIT_ASSERT_EQUAL(data.refineLevel+1, interpolator.numLevels());
+
+  const PetscMat mat = interpolator.interpolation(1);CPPUNIT_ASSERT(mat);
+  PetscInt numRows = 0, numCols = 0;
+  PetscErrorCode err = MatGetSize(mat, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+  const int numComponents = data.cellDim;
+  CPPUNIT_ASSERT_EQUAL(data.numVertices*numComponents, numRows);
+  CPPUNIT_ASSERT_EQUAL(numVerticesCoarse*numComponents, numCols);
+
+  // Interpolation of a uniform field is uniform.
+  PetscVec coarseVec = NULL, fineVec = NULL;
+  err = MatCreateVecs(mat, &coarseVec, &fineVec);PYLITH_CHECK_ERROR(err);
+  err = VecSet(coarseVec, 1.0);PYLITH_CHECK_ERROR(err);
+  err = MatMult(mat, coarseVec, fineVec);PYLITH_CHECK_ERROR(err);
+  PetscReal valueMin = 0.0, valueMax = 0.0;
+  err = VecMin(fineVec, NULL, &valueMin);PYLITH_CHECK_ERROR(err);
+  err = VecMax(fineVec, NULL, &valueMax);PYLITH_CHECK_ERROR(err);
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, valueMin, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, valueMax, tolerance);
+  err = VecDestroy(&coarseVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&fineVec);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _testInterpolation
+
+
+// End of file 
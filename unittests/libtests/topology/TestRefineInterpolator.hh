@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestRefineInterpolator.hh
+ *
+ * @brief C++ TestRefineInterpolator object
+ *
+ * C++ unit testing for RefineInterpolator.
+ */
+
+#if !defined(pylith_topology_testrefineinterpolator_hh)
+#define pylith_topology_testrefineinterpolator_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestRefineInterpolator;
+
+    class MeshDataCohesive; // test data
+  } // topology
+} // pylith
+
+// RefineInterpolator ---------------------------------------------------
+class pylith::topology::TestRefineInterpolator : public CppUnit::TestFixture
+{ // class TestRefineInterpolator
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestRefineInterpolator );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testUnrefined );
+  CPPUNIT_TEST( testInterpolationTri3 );
+  CPPUNIT_TEST( testInterpolationQuad4 );
+  CPPUNIT_TEST( testInterpolationTet4 );
+  CPPUNIT_TEST( testInterpolationHex8 );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test initialize() with mesh that has not been refined.
+  void testUnrefined(void);
+
+  /// Test interpolation() with tri3 cells.
+  void testInterpolationTri3(void);
+
+  /// Test interpolation() with quad4 cells.
+  void testInterpolationQuad4(void);
+
+  /// Test interpolation() with tet4 cells.
+  void testInterpolationTet4(void);
+
+  /// Test interpolation() with hex8 cells.
+  void testInterpolationHex8(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Test interpolation().
+   *
+   * @param data Test data.
+   */
+  void _testInterpolation(const MeshDataCohesive& data);
+
+}; // class TestRefineInterpolator
+
+#endif // pylith_topology_testrefineinterpolator_hh
+
+
+// End of file 
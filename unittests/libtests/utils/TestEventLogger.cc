@@ -164,6 +164,48 @@ pylith::utils::TestEventLogger::testEventLogging(void)
   PYLITH_METHOD_END;
 } // testEventLogging
 
+// ----------------------------------------------------------------------
+// Test eventCount().
+void
+pylith::utils::TestEventLogger::testEventCount(void)
+{ // testEventCount
+  PYLITH_METHOD_BEGIN;
+
+  EventLogger logger;
+  logger.className("my class");
+  logger.initialize();
+  const int id = logger.registerEvent("event count");
+
+  PetscStageLog stageLog = NULL;
+  PetscErrorCode err = PetscLogGetStageLog(&stageLog);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(stageLog);
+  int stage = -1;
+  err = PetscStageLogGetCurrent(stageLog, &stage);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(stage >= 0);
+  PetscEventPerfLog perfLog = NULL;
+  err = PetscStageLogGetEventPerfLog(stageLog, stage, &perfLog);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(perfLog);
+  CPPUNIT_ASSERT(id < perfLog->numEvents);
+  const int countOrig = perfLog->eventInfo[id].count;
+
+  logger.eventCount(id, 5);
+  logger.eventCount(id, 0);
+  logger.eventCount(id, 2);
+
+  CPPUNIT_ASSERT_EQUAL(countOrig+7, perfLog->eventInfo[id].count);
+
+  // Stage in which the event has not begun.
+  const int stageId = logger.registerStage("event count stage");
+  logger.stagePush(stageId);
+  logger.eventCount(id, 3);
+  logger.stagePop();
+
+  PetscEventPerfLog perfLogStage = NULL;
+  err = PetscStageLogGetEventPerfLog(stageLog, stageId, &perfLogStage);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(perfLogStage);
+  CPPUNIT_ASSERT(id < perfLogStage->numEvents);
+  CPPUNIT_ASSERT_EQUAL(3, perfLogStage->eventInfo[id].count);
+
+  PYLITH_METHOD_END;
+} // testEventCount
+
 // ----------------------------------------------------------------------
 // Test registerStage().
 void
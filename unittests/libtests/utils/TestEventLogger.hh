@@ -49,6 +49,7 @@ class pylith::utils::TestEventLogger : public CppUnit::TestFixture
   CPPUNIT_TEST( testRegisterEvent );
   CPPUNIT_TEST( testEventId );
   CPPUNIT_TEST( testEventLogging );
+  CPPUNIT_TEST( testEventCount );
   CPPUNIT_TEST( testRegisterStage );
   CPPUNIT_TEST( testStageId );
   CPPUNIT_TEST( testStageLogging );
@@ -76,6 +77,9 @@ public :
   /// Test eventBegin() and eventEnd().
   void testEventLogging(void);
 
+  /// Test eventCount().
+  void testEventCount(void);
+
   /// Test registerStage().
   void testRegisterStage(void);
 
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestEventProfile.hh" // Implementation of class methods
+
+#include "pylith/utils/EventProfile.hh" // USES EventProfile
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ifstream
+#include <iterator> // USES std::istreambuf_iterator
+#include <string> // USES std::string
+#include <stdexcept> // USES std::out_of_range
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestEventProfile );
+
+// ----------------------------------------------------------------------
+// Test _calcStats() and _calcImbalance().
+void
+pylith::utils::TestEventProfile::testCalcStats(void)
+{ // testCalcStats
+  PYLITH_METHOD_BEGIN;
+
+  const double tolerance = 1.0e-12;
+
+  EventProfile::Stats stats;
+  EventProfile::_calcStats(&stats, 10.0, 1.0, 4.0, 4);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stats.min, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0, stats.max, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.5, stats.mean, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.6, EventProfile::_calcImbalance(stats), tolerance);
+
+  EventProfile::_calcStats(&stats, 0.0, 0.0, 0.0, 2);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, EventProfile::_calcImbalance(stats), tolerance);
+
+  PYLITH_METHOD_END;
+} // testCalcStats
+
+// ----------------------------------------------------------------------
+// Test collect(), numEvents(), and eventStats().
+void
+pylith::utils::TestEventProfile::testCollect(void)
+{ // testCollect
+  PYLITH_METHOD_BEGIN;
+
+  EventProfile::activate();
+
+  EventLogger logger;
+  logger.className("profile class");
+  logger.initialize();
+  const int idA = logger.registerEvent("profile event A");
+  logger.registerEvent("profile event B");
+
+  const int numCalls = 3;
+  for (int i=0; i < numCalls; ++i) {
+    logger.eventBegin(idA);
+    logger.eventEnd(idA);
+  } // for
+
+  EventProfile profile;
+  profile.collect(PETSC_COMM_WORLD);
+  CPPUNIT_ASSERT_EQUAL(1, profile._numProcs);
+
+  // Event B was never called so it is not in the profile.
+  bool foundA = false;
+  const int numEvents = profile.numEvents();
+  for (int i=0; i < numEvents; ++i) {
+    const EventProfile::EventStats& stats = profile.eventStats(i);
+    CPPUNIT_ASSERT(std::string("profile event B") != stats.name);
+    if (std::string("profile event A") == stats.name) {
+      foundA = true;
+      CPPUNIT_ASSERT_EQUAL(double(numCalls), stats.count.max);
+      CPPUNIT_ASSERT_EQUAL(double(numCalls), stats.count.min);
+      CPPUNIT_ASSERT_EQUAL(double(numCalls), stats.count.mean);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stats.imbalance, 1.0e-12);
+    } // if
+    if (i > 0) {
+      CPPUNIT_ASSERT(profile.eventStats(i-1).time.max >= stats.time.max);
+    } // if
+  } // for
+  CPPUNIT_ASSERT(foundA);
+
+  CPPUNIT_ASSERT_THROW(profile.eventStats(numEvents), std::out_of_range);
+
+  PYLITH_METHOD_END;
+} // testCollect
+
+// ----------------------------------------------------------------------
+// Test write().
+void
+pylith::utils::TestEventProfile::testWrite(void)
+{ // testWrite
+  PYLITH_METHOD_BEGIN;
+
+  EventProfile profile;
+  EventProfile::EventStats stats;
+  stats.name = "event \"A\"";
+  EventProfile::_calcStats(&stats.count, 2.0, 2.0, 2.0, 1);
+  EventProfile::_calcStats(&stats.time, 0.5, 0.5, 0.5, 1);
+  EventProfile::_calcStats(&stats.flops, 100.0, 100.0, 100.0, 1);
+  stats.imbalance = 1.0;
+  profile._events.push_back(stats);
+  profile._numProcs = 1;
+
+  profile.write("event_profile.json", "json");
+  std::ifstream fjson("event_profile.json");
+  CPPUNIT_ASSERT(fjson.is_open());
+  const std::string json((std::istreambuf_iterator<char>(fjson)), std::istreambuf_iterator<char>());
+  CPPUNIT_ASSERT(json.find("\"num_processes\": 1") != std::string::npos);
+  CPPUNIT_ASSERT(json.find("\"name\": \"event \\\"A\\\"\"") != std::string::npos);
+  CPPUNIT_ASSERT(json.find("\"imbalance\": 1") != std::string::npos);
+
+  profile.write("event_profile.csv", "csv");
+  std::ifstream fcsv("event_profile.csv");
+  CPPUNIT_ASSERT(fcsv.is_open());
+  std::string header;
+  std::getline(fcsv, header);
+  CPPUNIT_ASSERT_EQUAL(std::string("event,count_min,count_max,count_mean,time_min,time_max,time_mean,flops_min,flops_max,flops_mean,imbalance"), header);
+
+  CPPUNIT_ASSERT_THROW(profile.write("event_profile.txt", "txt"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testWrite
+
+
+// End of file 
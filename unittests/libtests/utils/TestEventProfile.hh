@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file tests/libtests/utils/TestEventProfile.hh
+ *
+ * @brief C++ TestEventProfile object
+ *
+ * C++ unit testing for EventProfile.
+ */
+
+#if !defined(pylith_utils_testeventprofile_hh)
+#define pylith_utils_testeventprofile_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestEventProfile;
+  } // utils
+} // pylith
+
+/// C++ unit testing for EventProfile
+class pylith::utils::TestEventProfile : public CppUnit::TestFixture
+{ // class TestEventProfile
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestEventProfile );
+
+  CPPUNIT_TEST( testCalcStats );
+  CPPUNIT_TEST( testCollect );
+  CPPUNIT_TEST( testWrite );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test _calcStats() and _calcImbalance().
+  void testCalcStats(void);
+
+  /// Test collect(), numEvents(), and eventStats().
+  void testCollect(void);
+
+  /// Test write().
+  void testWrite(void);
+
+}; // class TestEventProfile
+
+#endif // pylith_utils_testeventprofile_hh
+
+// End of file 
@@ -0,0 +1,164 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMemoryTracker.hh" // Implementation of class methods
+
+#include "pylith/utils/MemoryTracker.hh" // USES MemoryTracker
+
+#include <string> // USES std::string
+#include <stdexcept> // USES std::logic_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestMemoryTracker );
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::utils::TestMemoryTracker::setUp(void)
+{ // setUp
+  MemoryTracker::reset();
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::utils::TestMemoryTracker::tearDown(void)
+{ // tearDown
+  MemoryTracker::reset();
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test stagePush(), stagePop(), numStages(), and stageName().
+void
+pylith::utils::TestMemoryTracker::testStages(void)
+{ // testStages
+  CPPUNIT_ASSERT_EQUAL(0, MemoryTracker::numStages());
+  CPPUNIT_ASSERT_THROW(MemoryTracker::stagePop(), std::logic_error);
+
+  MemoryTracker::stagePush("Setup");
+  MemoryTracker::stagePush("Solve");
+  MemoryTracker::stagePop();
+  MemoryTracker::stagePush("Setup");
+  MemoryTracker::stagePop();
+  MemoryTracker::stagePop();
+
+  CPPUNIT_ASSERT_EQUAL(2, MemoryTracker::numStages());
+  CPPUNIT_ASSERT_EQUAL(std::string("Setup"), std::string(MemoryTracker::stageName(0)));
+  CPPUNIT_ASSERT_EQUAL(std::string("Solve"), std::string(MemoryTracker::stageName(1)));
+  CPPUNIT_ASSERT_THROW(MemoryTracker::stageName(2), std::out_of_range);
+} // testStages
+
+// ----------------------------------------------------------------------
+// Test allocate().
+void
+pylith::utils::TestMemoryTracker::testAllocate(void)
+{ // testAllocate
+  int objA = 0;
+  int objB = 0;
+
+  // Allocation outside of a stage is attributed to "Main".
+  MemoryTracker::allocate(&objA, 100);
+  CPPUNIT_ASSERT_EQUAL(size_t(100), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(100), MemoryTracker::stageInUse("Main"));
+
+  MemoryTracker::stagePush("Setup");
+  MemoryTracker::allocate(&objB, 40);
+  CPPUNIT_ASSERT_EQUAL(size_t(140), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(40), MemoryTracker::stageInUse("Setup"));
+
+  // Reallocation replaces previous record.
+  MemoryTracker::allocate(&objA, 60);
+  CPPUNIT_ASSERT_EQUAL(size_t(100), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryTracker::stageInUse("Main"));
+  CPPUNIT_ASSERT_EQUAL(size_t(100), MemoryTracker::stageInUse("Setup"));
+  MemoryTracker::stagePop();
+
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryTracker::stageInUse("Unknown"));
+} // testAllocate
+
+// ----------------------------------------------------------------------
+// Test deallocate().
+void
+pylith::utils::TestMemoryTracker::testDeallocate(void)
+{ // testDeallocate
+  int objA = 0;
+  int objB = 0;
+
+  MemoryTracker::stagePush("Setup");
+  MemoryTracker::allocate(&objA, 100);
+  MemoryTracker::allocate(&objB, 50);
+  MemoryTracker::stagePop();
+
+  MemoryTracker::deallocate(&objA);
+  CPPUNIT_ASSERT_EQUAL(size_t(50), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(50), MemoryTracker::stageInUse("Setup"));
+
+  // Deallocating an unregistered object is a no-op.
+  MemoryTracker::deallocate(&objA);
+  CPPUNIT_ASSERT_EQUAL(size_t(50), MemoryTracker::inUse());
+
+  MemoryTracker::deallocate(&objB);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryTracker::stageInUse("Setup"));
+} // testDeallocate
+
+// ----------------------------------------------------------------------
+// Test highWater() and stageHighWater().
+void
+pylith::utils::TestMemoryTracker::testHighWater(void)
+{ // testHighWater
+  int objA = 0;
+  int objB = 0;
+  int objC = 0;
+
+  MemoryTracker::stagePush("Setup");
+  MemoryTracker::allocate(&objA, 100);
+  MemoryTracker::allocate(&objB, 200);
+  MemoryTracker::deallocate(&objB);
+  MemoryTracker::stagePop();
+
+  MemoryTracker::stagePush("Solve");
+  MemoryTracker::allocate(&objC, 50);
+  MemoryTracker::stagePop();
+
+  CPPUNIT_ASSERT_EQUAL(size_t(150), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(300), MemoryTracker::highWater());
+  CPPUNIT_ASSERT_EQUAL(size_t(300), MemoryTracker::stageHighWater("Setup"));
+  // High-water for stage includes memory allocated in earlier stages.
+  CPPUNIT_ASSERT_EQUAL(size_t(150), MemoryTracker::stageHighWater("Solve"));
+} // testHighWater
+
+// ----------------------------------------------------------------------
+// Test reset().
+void
+pylith::utils::TestMemoryTracker::testReset(void)
+{ // testReset
+  int objA = 0;
+
+  MemoryTracker::stagePush("Setup");
+  MemoryTracker::allocate(&objA, 100);
+
+  MemoryTracker::reset();
+  CPPUNIT_ASSERT_EQUAL(0, MemoryTracker::numStages());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryTracker::inUse());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryTracker::highWater());
+  CPPUNIT_ASSERT_THROW(MemoryTracker::stagePop(), std::logic_error);
+} // testReset
+
+
+// End of file 
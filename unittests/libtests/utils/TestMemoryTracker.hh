@@ -0,0 +1,79 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file tests/libtests/utils/TestMemoryTracker.hh
+ *
+ * @brief C++ TestMemoryTracker object
+ *
+ * C++ unit testing for MemoryTracker.
+ */
+
+#if !defined(pylith_utils_testmemorytracker_hh)
+#define pylith_utils_testmemorytracker_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestMemoryTracker;
+  } // utils
+} // pylith
+
+/// C++ unit testing for MemoryTracker
+class pylith::utils::TestMemoryTracker : public CppUnit::TestFixture
+{ // class TestMemoryTracker
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMemoryTracker );
+
+  CPPUNIT_TEST( testStages );
+  CPPUNIT_TEST( testAllocate );
+  CPPUNIT_TEST( testDeallocate );
+  CPPUNIT_TEST( testHighWater );
+  CPPUNIT_TEST( testReset );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test stagePush(), stagePop(), numStages(), and stageName().
+  void testStages(void);
+
+  /// Test allocate().
+  void testAllocate(void);
+
+  /// Test deallocate().
+  void testDeallocate(void);
+
+  /// Test highWater() and stageHighWater().
+  void testHighWater(void);
+
+  /// Test reset().
+  void testReset(void);
+
+}; // class TestMemoryTracker
+
+#endif // pylith_utils_testmemorytracker_hh
+
+// End of file 
@@ -50,6 +50,18 @@ class TestMeshIOAscii(unittest.TestCase):
     return
 
 
+  def test_useCache(self):
+    """
+    Test useCache().
+    """
+    io = MeshIOAscii()
+    self.assertEqual(False, io.useCache())
+
+    io.useCache(True)
+    self.assertEqual(True, io.useCache())
+    return
+
+
   def test_readwrite(self):
     """
     Test write() and read().
@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/meshio/TestMeshIOHDF5.py
+
+## @brief Unit testing of Python MeshIOHDF5 object.
+
+import unittest
+
+from pylith.meshio.MeshIOHDF5 import MeshIOHDF5
+
+# ----------------------------------------------------------------------
+class TestMeshIOHDF5(unittest.TestCase):
+  """
+  Unit testing of Python MeshIOHDF5 object.
+  """
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    io = MeshIOHDF5()
+    return
+
+
+  def test_filename(self):
+    """
+    Test filename().
+    """
+    value = "hi.h5"
+
+    io = MeshIOHDF5()
+    io.filename(value)
+    self.assertEqual(value, io.filename())
+    return
+
+
+  def test_isPreprocessed(self):
+    """
+    Test isPreprocessed().
+    """
+    io = MeshIOHDF5()
+    self.assertTrue(io.isPreprocessed())
+    return
+
+
+  def test_readwrite(self):
+    """
+    Test write() and read().
+    """
+    filenameIn = "data/mesh2Din3D.txt"
+    filenameH5 = "mesh2Din3D_test.h5"
+    filenameOut = "data/mesh2Din3D_testh5.txt"
+
+    from spatialdata.geocoords.CSCart import CSCart
+    cs = CSCart()
+    cs._configure()
+
+    from pylith.meshio.MeshIOAscii import MeshIOAscii
+    ioAscii = MeshIOAscii()
+    ioAscii.inventory.filename = filenameIn
+    ioAscii.inventory.coordsys = cs
+    ioAscii._configure()
+    mesh = ioAscii.read(debug=False, interpolate=True)
+
+    io = MeshIOHDF5()
+    io.inventory.filename = filenameH5
+    io.inventory.coordsys = cs
+    io._configure()
+    io.write(mesh)
+    mesh = io.read(debug=False, interpolate=True)
+
+    ioAscii.filename(filenameOut)
+    ioAscii.write(mesh)
+
+    fileE = open(filenameIn, "r")
+    linesE = fileE.readlines()
+    fileE.close()
+    fileT = open(filenameOut, "r")
+    linesT = fileT.readlines()
+    fileT.close()
+
+    self.assertEqual(len(linesE), len(linesT))
+    for (lineE, lineT) in zip(linesE, linesT):
+      self.assertEqual(lineE, lineT)
+    return
+
+
+  def test_factory(self):
+    """
+    Test factory method.
+    """
+    from pylith.meshio.MeshIOHDF5 import mesh_io
+    io = mesh_io()
+    return
+
+
+# End of file 
@@ -59,6 +59,9 @@ class TestApp(UnitTestApp):
     from TestDataWriterVTK import TestDataWriterVTK
     suite.addTest(unittest.makeSuite(TestDataWriterVTK))
 
+    from TestDataWriterVTU import TestDataWriterVTU
+    suite.addTest(unittest.makeSuite(TestDataWriterVTU))
+
     from TestOutputManagerMesh import TestOutputManagerMesh
     suite.addTest(unittest.makeSuite(TestOutputManagerMesh))
 
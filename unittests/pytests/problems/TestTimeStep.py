@@ -125,4 +125,14 @@ class TestTimeStep(unittest.TestCase):
     return
 
 
+  def test_retryTimeStep(self):
+    """
+    Test retryTimeStep().
+    """
+    tstep = self.tstep
+
+    self.assertEqual(None, tstep.retryTimeStep(1.0e-4))
+    return
+
+
 # End of file 
@@ -158,6 +158,69 @@ class TestTimeStepAdapt(unittest.TestCase):
     return
 
 
+  def test_timeStepHysteresis(self):
+    """
+    Test timeStep() with limits on increasing time step.
+    """
+    tstep = self.tstep
+
+    tstep.adaptSkip = 0
+    tstep.maxIncrease = 2.0
+    tstep.increaseThreshold = 1.5
+    tstep.maxDtN = 10.0
+    integrators = [Integrator(0.2)]
+
+    from pylith.topology.Mesh import Mesh
+    mesh = Mesh()
+
+    # Reduce time step without limit
+    dt = 0.2 / 2.0
+    self.assertEqual(dt, tstep.timeStep(mesh, integrators))
+
+    # Ignore small increase
+    integrators[0].dt = 0.28
+    self.assertEqual(dt, tstep.timeStep(mesh, integrators))
+
+    # Limit increase
+    integrators[0].dt = 2.0
+    dt = 0.2
+    self.assertEqual(dt, tstep.timeStep(mesh, integrators))
+    dt = 0.4
+    self.assertEqual(dt, tstep.timeStep(mesh, integrators))
+
+    # Limit increase and then ignore small increase
+    dt = 0.8
+    self.assertEqual(dt, tstep.timeStep(mesh, integrators))
+    self.assertEqual(dt, tstep.timeStep(mesh, integrators))
+
+    return
+
+
+  def test_retryTimeStep(self):
+    """
+    Test retryTimeStep().
+    """
+    tstep = self.tstep
+
+    tstep.maxRetries = 2
+    tstep.retryFactor = 0.5
+
+    self.assertEqual(0.25, tstep.retryTimeStep(0.5))
+    self.assertEqual(0.25, tstep.currentStep())
+    self.assertEqual(0.125, tstep.retryTimeStep(0.25))
+    self.assertRaises(RuntimeError, tstep.retryTimeStep, 0.125)
+
+    # Adjusting time step resets number of retries and keeps reduced
+    # time step (skipped).
+    from pylith.topology.Mesh import Mesh
+    mesh = Mesh()
+    integrators = [Integrator(2.0)]
+    self.assertEqual(0.125, tstep.timeStep(mesh, integrators))
+    self.assertEqual(0.0625, tstep.retryTimeStep(0.125))
+
+    return
+
+
   def test_factory(self):
     """
     Test factory method.
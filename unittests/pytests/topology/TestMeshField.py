@@ -168,4 +168,43 @@ class TestMeshField(unittest.TestCase):
     return
 
 
+  def test_localArray(self):
+    """
+    Test localArray().
+    """
+    fieldB = Field(self.mesh)
+    fieldB.newSection(Field.VERTICES_FIELD, 2)
+    fieldB.allocate()
+    fieldB.zeroAll()
+
+    with fieldB.localArray(writable=True) as values:
+      self.assertEqual(8, values.shape[0])
+      values[:] = range(8)
+
+    import numpy
+    with fieldB.localArray() as values:
+      self.assertTrue(numpy.allclose(values, numpy.arange(8)))
+      self.assertFalse(values.flags.writeable)
+    return
+
+
+  def test_sectionLayout(self):
+    """
+    Test sectionLayout().
+    """
+    fieldB = Field(self.mesh)
+    fieldB.newSection(Field.VERTICES_FIELD, 2)
+    fieldB.allocate()
+
+    (dofs, offsets) = fieldB.sectionLayout()
+    self.assertEqual(fieldB.chartSize(), dofs.shape[0])
+    self.assertEqual(fieldB.chartSize(), offsets.shape[0])
+    self.assertEqual(8, sum(dofs))
+    for dof,offset in zip(dofs, offsets):
+      if dof > 0:
+        self.assertEqual(2, dof)
+        self.assertTrue(0 <= offset and offset < 8)
+    return
+
+
 # End of file 